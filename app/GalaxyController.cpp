@@ -1,6 +1,15 @@
 #include "GalaxyController.h"
 #include <QDebug>
 #include <QRandomGenerator>
+#include <QFile>
+
+namespace {
+// Sidecar file holding the route landmark tables for an exported galaxy
+QString landmarksPath(const QString& galaxyFilePath)
+{
+    return galaxyFilePath + QStringLiteral(".landmarks");
+}
+}
 
 GalaxyController::GalaxyController(QObject *parent)
     : QObject(parent)
@@ -11,6 +20,8 @@ GalaxyController::GalaxyController(QObject *parent)
     , m_xmlImporter(nullptr)
     , m_galaxyFactions(nullptr)
     , m_galaxyFactionsViewModel(nullptr)
+    , m_routeViewModel(nullptr)
+    , m_connectivityViewModel(nullptr)
     , m_statusMessage("Ready")
     , m_isGenerating(false)
     , m_showSystemNames(true)
@@ -24,9 +35,14 @@ GalaxyController::GalaxyController(QObject *parent)
     , m_spiralTightness(1.0)
     , m_coreRadius(0.1)
     , m_edgeRadius(0.9)
+    , m_connectComponents(false)
+    , m_removeCrossings(false)
+    , m_lazyPlanets(false)
+    , m_arenaAllocation(false)
     , m_randomizeParameters(false)
     , m_selectedSystemId(0)
     , m_selectedStarSystemViewModel(nullptr)
+    , m_starSystemViewModels(this)
 {
     initializeModels();
 }
@@ -54,10 +70,39 @@ void GalaxyController::initializeModels()
     
     // Create the factions model
     m_galaxyFactions = std::make_shared<ggh::Galaxy::Factions::models::GalaxyFactions>();
+
+    // Lets `owned`/`unowned` system filters ask the factions who holds a system
+    m_galaxyViewModel->setOwnershipLookup(
+        [factions = std::weak_ptr(m_galaxyFactions)](ggh::GalaxyCore::utilities::SystemId systemId) {
+            const auto locked = factions.lock();
+            return locked && locked->ownerOf(systemId) != ggh::Galaxy::Factions::models::GalaxyFactions::NO_FACTION;
+        });
     
     // Create the factions view model and initialize it
     m_galaxyFactionsViewModel = new ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel(this);
     m_galaxyFactionsViewModel->initialize(m_galaxyFactions);
+    m_galaxyFactionsViewModel->setGalaxy(m_galaxyModel);
+    
+    // Create the route view model
+    m_routeViewModel = new ggh::Galaxy::Navigation::viewmodels::RouteViewModel(this);
+    m_routeViewModel->setGalaxy(m_galaxyModel);
+    
+    // Create the connectivity view model
+    m_connectivityViewModel = new ggh::Galaxy::Analysis::viewmodels::ConnectivityViewModel(this);
+    m_connectivityViewModel->setGalaxy(m_galaxyModel);
+    
+    // Adding or removing systems and lanes outdates the analysis and any centrality scores
+    connect(m_galaxyViewModel, &ggh::GalaxyCore::viewmodels::GalaxyViewModel::systemCountChanged,
+            this, &GalaxyController::onGalaxyEdited);
+    connect(m_galaxyViewModel, &ggh::GalaxyCore::viewmodels::GalaxyViewModel::travelLaneCountChanged,
+            this, &GalaxyController::onGalaxyEdited);
+    
+    // Scores are written onto the models; tell the list models to re-read that role
+    connect(m_connectivityViewModel, &ggh::Galaxy::Analysis::viewmodels::ConnectivityViewModel::centralityChanged,
+            this, [this]() {
+                m_galaxyViewModel->starSystems()->notifyBetweennessChanged();
+                m_galaxyViewModel->travelLanes()->notifyBetweennessChanged();
+            });
     
     // Create the galaxy generator
     m_galaxyGenerator = new ggh::GalaxyFactories::GalaxyGenerator();
@@ -72,6 +117,10 @@ void GalaxyController::initializeModels()
     defaultParams.spiralTightness = m_spiralTightness;
     defaultParams.coreRadius = m_coreRadius;
     defaultParams.edgeRadius = m_edgeRadius;
+    defaultParams.connectComponents = m_connectComponents;
+    defaultParams.removeCrossings = m_removeCrossings;
+    defaultParams.lazyPlanets = m_lazyPlanets;
+    defaultParams.arenaAllocation = m_arenaAllocation;
     defaultParams.seed = QRandomGenerator::global()->bounded(1000000);
     m_galaxyGenerator->setParameters(defaultParams);
     
@@ -94,6 +143,16 @@ ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel* GalaxyController::ga
     return m_galaxyFactionsViewModel;
 }
 
+ggh::Galaxy::Navigation::viewmodels::RouteViewModel* GalaxyController::routeViewModel() const
+{
+    return m_routeViewModel;
+}
+
+ggh::Galaxy::Analysis::viewmodels::ConnectivityViewModel* GalaxyController::connectivityViewModel() const
+{
+    return m_connectivityViewModel;
+}
+
 ggh::GalaxyFactories::GalaxyGenerator* GalaxyController::galaxyGenerator() const
 {
     return m_galaxyGenerator;
@@ -137,6 +196,9 @@ void GalaxyController::generateGalaxy()
         if (newGalaxy) {
             m_galaxyModel = std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel>(newGalaxy.release());
             m_galaxyViewModel->setGalaxy(m_galaxyModel);
+            m_routeViewModel->setGalaxy(m_galaxyModel);
+            m_connectivityViewModel->setGalaxy(m_galaxyModel);
+            m_galaxyFactionsViewModel->setGalaxy(m_galaxyModel);
             emit galaxyViewModelChanged();
             
             m_statusMessage = QString("Galaxy generated successfully with %1 star systems")
@@ -192,6 +254,10 @@ void GalaxyController::generateGalaxyWithParameters(int starSystemCount, double
     params.systemCount = starSystemCount;
     params.width = static_cast<int>(galaxyWidth);
     params.height = static_cast<int>(galaxyHeight);
+    params.connectComponents = m_connectComponents;
+    params.removeCrossings = m_removeCrossings;
+    params.lazyPlanets = m_lazyPlanets;
+    params.arenaAllocation = m_arenaAllocation;
     
     if (seed >= 0) {
         params.seed = seed;
@@ -224,6 +290,11 @@ void GalaxyController::exportGalaxy(const QString& filePath)
         bool success = m_exporterObject->exportObject();
         QString message = success ? "Galaxy exported successfully" : m_exporterObject->errorString();
         
+        // Landmark tables travel next to the galaxy so route queries are fast right after import
+        if (success && m_routeViewModel && m_routeViewModel->hasLandmarks()) {
+            m_routeViewModel->saveLandmarks(landmarksPath(filePath));
+        }
+        
         qDebug() << "Galaxy export to" << filePath << (success ? "succeeded" : "failed");
         if (!success) {
             qWarning() << "Export error:" << message;
@@ -263,14 +334,10 @@ void GalaxyController::exportStarSystem(const QString& systemName, const QString
     emit exportStarted();
     
     try {
-        // Find the star system by name
-        const auto& systems = m_galaxyModel->getAllStarSystems();
-        auto it = std::find_if(systems.begin(), systems.end(),
-            [&systemName](const auto& system) {
-                return QString::fromStdString(system->getName()) == systemName;
-            });
+        // Find the star system by name through the galaxy's name index
+        const auto system = m_galaxyModel->findStarSystemByName(systemName.toStdString());
         
-        if (it == systems.end()) {
+        if (!system) {
             QString errorMsg = QString("Star system '%1' not found").arg(systemName);
             qWarning() << errorMsg;
             emit exportFinished(false, errorMsg);
@@ -279,7 +346,7 @@ void GalaxyController::exportStarSystem(const QString& systemName, const QString
         
         // Create a star system view model for export
         auto systemViewModel = new ggh::GalaxyCore::viewmodels::StarSystemViewModel(this);
-        systemViewModel->setStarSystem(*it);
+        systemViewModel->setStarSystem(system);
         
         // Set up exporter
         m_exporterObject->setModel(systemViewModel);
@@ -318,6 +385,8 @@ bool GalaxyController::importGalaxy(const QString& filePath)
     
     try {
         // Import the galaxy using the factory pattern
+        m_xmlImporter->setLazyPlanets(m_lazyPlanets);
+        m_xmlImporter->setArenaAllocation(m_arenaAllocation);
         auto importedGalaxy = m_xmlImporter->importGalaxy(filePath);
         
         if (!importedGalaxy) {
@@ -335,6 +404,18 @@ bool GalaxyController::importGalaxy(const QString& filePath)
             m_galaxyViewModel->setGalaxy(m_galaxyModel);
             emit galaxyViewModelChanged();
         }
+        if (m_routeViewModel) {
+            m_routeViewModel->setGalaxy(m_galaxyModel);
+            if (QFile::exists(landmarksPath(filePath))) {
+                m_routeViewModel->loadLandmarks(landmarksPath(filePath));
+            }
+        }
+        if (m_connectivityViewModel) {
+            m_connectivityViewModel->setGalaxy(m_galaxyModel);
+        }
+        if (m_galaxyFactionsViewModel) {
+            m_galaxyFactionsViewModel->setGalaxy(m_galaxyModel);
+        }
         
         // Update galaxy parameters to match imported galaxy
         m_galaxyWidth = m_galaxyModel->getWidth();
@@ -595,6 +676,78 @@ void GalaxyController::setEdgeRadius(double radius)
     }
 }
 
+bool GalaxyController::connectComponents() const
+{
+    return m_connectComponents;
+}
+
+void GalaxyController::setConnectComponents(bool connect)
+{
+    if (m_connectComponents != connect) {
+        m_connectComponents = connect;
+        if (m_galaxyGenerator) {
+            auto params = m_galaxyGenerator->getParameters();
+            params.connectComponents = connect;
+            m_galaxyGenerator->setParameters(params);
+        }
+        emit connectComponentsChanged();
+    }
+}
+
+bool GalaxyController::removeCrossings() const
+{
+    return m_removeCrossings;
+}
+
+void GalaxyController::setRemoveCrossings(bool remove)
+{
+    if (m_removeCrossings != remove) {
+        m_removeCrossings = remove;
+        if (m_galaxyGenerator) {
+            auto params = m_galaxyGenerator->getParameters();
+            params.removeCrossings = remove;
+            m_galaxyGenerator->setParameters(params);
+        }
+        emit removeCrossingsChanged();
+    }
+}
+
+bool GalaxyController::lazyPlanets() const
+{
+    return m_lazyPlanets;
+}
+
+void GalaxyController::setLazyPlanets(bool lazy)
+{
+    if (m_lazyPlanets != lazy) {
+        m_lazyPlanets = lazy;
+        if (m_galaxyGenerator) {
+            auto params = m_galaxyGenerator->getParameters();
+            params.lazyPlanets = lazy;
+            m_galaxyGenerator->setParameters(params);
+        }
+        emit lazyPlanetsChanged();
+    }
+}
+
+bool GalaxyController::arenaAllocation() const
+{
+    return m_arenaAllocation;
+}
+
+void GalaxyController::setArenaAllocation(bool arena)
+{
+    if (m_arenaAllocation != arena) {
+        m_arenaAllocation = arena;
+        if (m_galaxyGenerator) {
+            auto params = m_galaxyGenerator->getParameters();
+            params.arenaAllocation = arena;
+            m_galaxyGenerator->setParameters(params);
+        }
+        emit arenaAllocationChanged();
+    }
+}
+
 bool GalaxyController::randomizeParameters() const
 {
     return m_randomizeParameters;
@@ -636,11 +789,10 @@ void GalaxyController::clearSelection()
         return; // Already cleared
     }
     
+    // The viewmodel stays pooled for the next time this system is selected
     m_selectedSystemId = 0;
-    if (m_selectedStarSystemViewModel) {
-        m_selectedStarSystemViewModel->deleteLater();
-        m_selectedStarSystemViewModel = nullptr;
-    }
+    m_selectedStarSystemViewModel = nullptr;
+    m_starSystemViewModels.unpin();
     
     emit selectedStarSystemViewModelChanged();
     emit hasSelectedSystemChanged();
@@ -657,23 +809,74 @@ ggh::GalaxyCore::viewmodels::StarSystemViewModel* GalaxyController::getStarSyste
         return nullptr;
     }
     
-    return new ggh::GalaxyCore::viewmodels::StarSystemViewModel(starSystemModel, this);
+    return bindStarSystemViewModel(m_starSystemViewModels.acquire(systemId, starSystemModel));
+}
+
+ggh::GalaxyCore::viewmodels::StarSystemViewModel* GalaxyController::bindStarSystemViewModel(
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel* viewModel)
+{
+    // Panel edits move the system through the galaxy so lanes, routes and hit-testing follow
+    viewModel->setGalaxy(m_galaxyModel);
+    connect(viewModel, &ggh::GalaxyCore::viewmodels::StarSystemViewModel::positionChanged,
+            this, &GalaxyController::onGalaxyEdited, Qt::UniqueConnection);
+    return viewModel;
+}
+
+void GalaxyController::onGalaxyEdited()
+{
+    m_connectivityViewModel->refresh();
+    m_galaxyFactionsViewModel->syncWithGalaxy();
 }
 
 void GalaxyController::updateSelectedStarSystemViewModel()
 {
-    if (m_selectedStarSystemViewModel) {
-        m_selectedStarSystemViewModel->deleteLater();
-        m_selectedStarSystemViewModel = nullptr;
-    }
+    m_selectedStarSystemViewModel = nullptr;
+    m_starSystemViewModels.unpin();
     
     if (m_selectedSystemId != 0 && m_galaxyModel) {
         auto starSystemModel = m_galaxyModel->getStarSystem(m_selectedSystemId);
         if (starSystemModel) {
-            m_selectedStarSystemViewModel = new ggh::GalaxyCore::viewmodels::StarSystemViewModel(starSystemModel, this);
+            // Reselecting reuses the cached viewmodel; a new system recycles the least recently used one.
+            // Pinned, so hovering or listing other systems never rebinds the panel under the user.
+            m_selectedStarSystemViewModel = bindStarSystemViewModel(
+                m_starSystemViewModels.acquire(m_selectedSystemId, starSystemModel));
+            m_starSystemViewModels.pin(m_selectedSystemId);
         }
     }
     
     emit selectedStarSystemViewModelChanged();
     emit hasSelectedSystemChanged();
 }
+
+// Diagnostics
+
+QVariantMap GalaxyController::memoryReport() const
+{
+    ggh::GalaxyCore::utilities::MemoryReport report;
+    if (m_galaxyModel) {
+        m_galaxyModel->reportMemory(report);
+    }
+    if (m_galaxyViewModel) {
+        m_galaxyViewModel->reportMemory(report);
+    }
+    m_starSystemViewModels.reportMemory(report, "viewModels");
+    if (m_galaxyFactions) {
+        m_galaxyFactions->reportMemory(report);
+    }
+    if (m_galaxyFactionsViewModel && m_galaxyFactionsViewModel->factionListModel()) {
+        m_galaxyFactionsViewModel->factionListModel()->reportMemory(report);
+    }
+
+    QVariantMap categories;
+    for (const auto& [category, entry] : report.entries()) {
+        categories.insert(QString::fromStdString(category), QVariantMap{
+            {"bytes", static_cast<qulonglong>(entry.bytes)},
+            {"count", static_cast<qulonglong>(entry.count)}
+        });
+    }
+
+    return QVariantMap{
+        {"totalBytes", static_cast<qulonglong>(report.totalBytes())},
+        {"categories", categories}
+    };
+}
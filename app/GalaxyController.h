@@ -6,6 +6,7 @@
 #include <QtQml/qqml.h>
 #include <QString>
 #include <QSize>
+#include <QVariantMap>
 
 // GalaxyCore includes
 #include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
@@ -24,6 +25,12 @@
 #include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
 #include "ggh/modules/GalaxyFactions/viewmodels/GalaxyFactionsViewModel.h"
 
+// GalaxyNavigation includes
+#include "ggh/modules/GalaxyNavigation/viewmodels/RouteViewModel.h"
+
+// GalaxyAnalysis includes
+#include "ggh/modules/GalaxyAnalysis/viewmodels/ConnectivityViewModel.h"
+
 class GalaxyController : public QObject
 {
     Q_OBJECT
@@ -35,6 +42,8 @@ class GalaxyController : public QObject
     Q_PROPERTY(ggh::Galaxy::Exporter::ExporterObject* exporterObject READ exporterObject NOTIFY exporterObjectChanged)
     Q_PROPERTY(ggh::GalaxyFactories::XmlGalaxyImporter* xmlImporter READ xmlImporter NOTIFY xmlImporterChanged)
     Q_PROPERTY(ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel* galaxyFactionsViewModel READ galaxyFactionsViewModel NOTIFY galaxyFactionsViewModelChanged)
+    Q_PROPERTY(ggh::Galaxy::Navigation::viewmodels::RouteViewModel* routeViewModel READ routeViewModel NOTIFY routeViewModelChanged)
+    Q_PROPERTY(ggh::Galaxy::Analysis::viewmodels::ConnectivityViewModel* connectivityViewModel READ connectivityViewModel NOTIFY connectivityViewModelChanged)
     
     // System selection properties
     Q_PROPERTY(ggh::GalaxyCore::viewmodels::StarSystemViewModel* selectedStarSystemViewModel READ selectedStarSystemViewModel NOTIFY selectedStarSystemViewModelChanged)
@@ -56,6 +65,10 @@ class GalaxyController : public QObject
     Q_PROPERTY(double spiralTightness READ spiralTightness WRITE setSpiralTightness NOTIFY spiralTightnessChanged)
     Q_PROPERTY(double coreRadius READ coreRadius WRITE setCoreRadius NOTIFY coreRadiusChanged)
     Q_PROPERTY(double edgeRadius READ edgeRadius WRITE setEdgeRadius NOTIFY edgeRadiusChanged)
+    Q_PROPERTY(bool connectComponents READ connectComponents WRITE setConnectComponents NOTIFY connectComponentsChanged)
+    Q_PROPERTY(bool removeCrossings READ removeCrossings WRITE setRemoveCrossings NOTIFY removeCrossingsChanged)
+    Q_PROPERTY(bool lazyPlanets READ lazyPlanets WRITE setLazyPlanets NOTIFY lazyPlanetsChanged)
+    Q_PROPERTY(bool arenaAllocation READ arenaAllocation WRITE setArenaAllocation NOTIFY arenaAllocationChanged)
     Q_PROPERTY(bool randomizeParameters READ randomizeParameters WRITE setRandomizeParameters NOTIFY randomizeParametersChanged)
 
 public:
@@ -71,6 +84,8 @@ public:
     ggh::Galaxy::Exporter::ExporterObject* exporterObject() const;
     ggh::GalaxyFactories::XmlGalaxyImporter* xmlImporter() const;
     ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel* galaxyFactionsViewModel() const;
+    ggh::Galaxy::Navigation::viewmodels::RouteViewModel* routeViewModel() const;
+    ggh::Galaxy::Analysis::viewmodels::ConnectivityViewModel* connectivityViewModel() const;
     
     // System selection property getters
     ggh::GalaxyCore::viewmodels::StarSystemViewModel* selectedStarSystemViewModel() const;
@@ -92,6 +107,10 @@ public:
     double spiralTightness() const;
     double coreRadius() const;
     double edgeRadius() const;
+    bool connectComponents() const;
+    bool removeCrossings() const;
+    bool lazyPlanets() const;
+    bool arenaAllocation() const;
     bool randomizeParameters() const;
     
     // UI state property setters
@@ -108,6 +127,10 @@ public:
     void setSpiralTightness(double tightness);
     void setCoreRadius(double radius);
     void setEdgeRadius(double radius);
+    void setConnectComponents(bool connect);
+    void setRemoveCrossings(bool remove);
+    void setLazyPlanets(bool lazy);
+    void setArenaAllocation(bool arena);
     void setRandomizeParameters(bool randomize);
 
 public slots:
@@ -134,12 +157,17 @@ public slots:
     void setGalaxyDimensions(double width, double height);
     void setStarSystemCount(int count);
 
+    // Diagnostics
+    Q_INVOKABLE QVariantMap memoryReport() const;
+
 signals:
     void galaxyViewModelChanged();
     void galaxyGeneratorChanged();
     void exporterObjectChanged();
     void xmlImporterChanged();
     void galaxyFactionsViewModelChanged();
+    void routeViewModelChanged();
+    void connectivityViewModelChanged();
     
     // System selection signals
     void selectedStarSystemViewModelChanged();
@@ -161,6 +189,10 @@ signals:
     void spiralTightnessChanged();
     void coreRadiusChanged();
     void edgeRadiusChanged();
+    void connectComponentsChanged();
+    void removeCrossingsChanged();
+    void lazyPlanetsChanged();
+    void arenaAllocationChanged();
     void randomizeParametersChanged();
     
     void galaxyGenerationStarted();
@@ -176,6 +208,11 @@ signals:
 private:
     void initializeModels();
     void updateSelectedStarSystemViewModel();
+    // Hands a pooled star system viewmodel the galaxy and watches it for position edits
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel* bindStarSystemViewModel(
+        ggh::GalaxyCore::viewmodels::StarSystemViewModel* viewModel);
+    // Brings analyses cached against the lane graph up to date after systems or lanes were edited
+    void onGalaxyEdited();
     
     std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> m_galaxyModel;
     ggh::GalaxyCore::viewmodels::GalaxyViewModel* m_galaxyViewModel;
@@ -186,10 +223,19 @@ private:
     // GalaxyFactions model and view model
     std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> m_galaxyFactions;
     ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel* m_galaxyFactionsViewModel;
+
+    // Route planning view model
+    ggh::Galaxy::Navigation::viewmodels::RouteViewModel* m_routeViewModel;
+
+    // Lane network connectivity view model
+    ggh::Galaxy::Analysis::viewmodels::ConnectivityViewModel* m_connectivityViewModel;
     
     // System selection state
     quint32 m_selectedSystemId;
     ggh::GalaxyCore::viewmodels::StarSystemViewModel* m_selectedStarSystemViewModel;
+
+    // Star system viewmodels handed to QML, reused across selections and lookups
+    ggh::GalaxyCore::viewmodels::StarSystemViewModelPool m_starSystemViewModels;
     
     // UI state variables
     QString m_statusMessage;
@@ -207,6 +253,10 @@ private:
     double m_spiralTightness;
     double m_coreRadius;
     double m_edgeRadius;
+    bool m_connectComponents;
+    bool m_removeCrossings;
+    bool m_lazyPlanets;
+    bool m_arenaAllocation;
     bool m_randomizeParameters;
 };
 
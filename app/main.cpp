@@ -10,6 +10,7 @@
 
 // Import the GalaxyController
 #include "GalaxyController.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
 
 #ifdef _WIN32
 // #include <io.h>
@@ -28,6 +29,18 @@ int main(int argc, char *argv[])
     QQuickStyle::setStyle("Basic");
     
     QGuiApplication app(argc, argv);
+
+#ifdef GGH_ENABLE_TRACING
+    // GALAXY_TRACE_FILE=<path> records GGH_TRACE_SCOPE timings and dumps them on exit
+    using ggh::GalaxyCore::utilities::Tracer;
+    if (Tracer::enableFromEnvironment()) {
+        QObject::connect(&app, &QCoreApplication::aboutToQuit, [] {
+            if (!Tracer::flush()) {
+                qWarning() << "Failed to write trace file" << qgetenv(Tracer::ENVIRONMENT_VARIABLE);
+            }
+        });
+    }
+#endif
     
     // Set application properties
     app.setApplicationName("Galaxy Builder");
@@ -22,6 +22,7 @@ Item {
     property string currentFactionDescription: ""
     property string currentFactionColor: "#FF5722"
     property var currentResourceBonuses: []
+    property int currentResourceBonusCount: 0
     property var currentResourceStock: []
     property var currentControlledSystems: []
     
@@ -43,8 +44,10 @@ Item {
                     currentFactionDescription = factionDesc || ""
                     currentFactionColor = factionColor || "#FF5722"
                     
+                    // Totals are kept per resource type by the model, so this does not walk the systems
+                    currentResourceBonuses = factionsViewModel.resourceTotals(selectedFactionId)
+                    currentResourceBonusCount = factionsViewModel.resourceBonusCount(selectedFactionId)
                     // Load additional data (these would be populated from the model in a real implementation)
-                    currentResourceBonuses = []
                     currentResourceStock = []
                     currentControlledSystems = []
                     
@@ -129,7 +132,7 @@ Item {
                 id: statistics
                 Layout.fillWidth: true
                 systemCount: root.currentControlledSystems.length
-                resourceBonusCount: root.currentResourceBonuses.length
+                resourceBonusCount: root.currentResourceBonusCount
                 population: 0 // TODO: Calculate from controlled systems
                 militaryStrength: 0 // TODO: Calculate from controlled systems
             }
@@ -200,7 +203,7 @@ Item {
     }
     
     function getResourceBonusCount() {
-        return root.currentResourceBonuses.length.toString()
+        return root.currentResourceBonusCount.toString()
     }
     
     function getResourceBonuses() {
@@ -104,12 +104,27 @@ Dialog {
                 ColumnLayout {
                     anchors.fill: parent
 
+                    // The picker lists the top matches for the filter, never every system in the galaxy
+                    SystemSearchModel {
+                        id: homeworldSearch
+                        galaxy: controller ? controller.galaxyViewModel : null
+                        query: homeworldFilterField.text
+                        limit: 100
+                    }
+
+                    TextField {
+                        id: homeworldFilterField
+                        Layout.fillWidth: true
+                        placeholderText: "Filter systems by name..."
+                        Material.theme: Material.Dark
+                    }
+
                     ComboBox {
                         id: homeworldComboBox
                         Layout.fillWidth: true
                         Material.theme: Material.Dark
 
-                        model: controller && controller.galaxyViewModel ? controller.galaxyViewModel.starSystems : null
+                        model: homeworldSearch
                         textRole: "name"
                         valueRole: "systemId"
 
@@ -168,6 +183,13 @@ Dialog {
                         }
                     }
 
+                    Text {
+                        text: homeworldSearch.totalMatches > homeworldSearch.limit ? "Showing " + homeworldSearch.limit + " of " + homeworldSearch.totalMatches + " systems; type to narrow down" : homeworldSearch.totalMatches + " matching systems"
+                        color: "#808080"
+                        font.pixelSize: 11
+                        Layout.fillWidth: true
+                    }
+
                     Text {
                         text: homeworldComboBox.currentIndex >= 0 ? "Selected System ID: " + homeworldComboBox.currentValue : "No system selected"
                         color: "#cccccc"
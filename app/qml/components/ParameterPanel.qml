@@ -281,6 +281,150 @@ ScrollView {
                         Layout.preferredWidth: 35
                     }
                 }
+
+                CheckBox {
+                    text: "Connect Isolated Clusters"
+                    checked: controller ? controller.connectComponents : false
+                    onCheckedChanged: if (controller)
+                        controller.connectComponents = checked
+                    Layout.fillWidth: true
+                    Layout.columnSpan: 2
+
+                    indicator: Rectangle {
+                        implicitWidth: 18
+                        implicitHeight: 18
+                        x: parent.leftPadding
+                        y: parent.height / 2 - height / 2
+                        radius: 2
+                        border.color: parent.checked ? "#4080ff" : "#808080"
+                        border.width: 2
+                        color: parent.checked ? "#4080ff" : "transparent"
+
+                        Text {
+                            anchors.centerIn: parent
+                            text: "✓"
+                            color: "white"
+                            font.pixelSize: 12
+                            visible: parent.parent.checked
+                        }
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        font.pixelSize: 12
+                        color: "#ffffff"
+                        leftPadding: parent.indicator.width + parent.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
+
+                CheckBox {
+                    text: "Remove Crossing Lanes"
+                    checked: controller ? controller.removeCrossings : false
+                    onCheckedChanged: if (controller)
+                        controller.removeCrossings = checked
+                    Layout.fillWidth: true
+                    Layout.columnSpan: 2
+
+                    indicator: Rectangle {
+                        implicitWidth: 18
+                        implicitHeight: 18
+                        x: parent.leftPadding
+                        y: parent.height / 2 - height / 2
+                        radius: 2
+                        border.color: parent.checked ? "#4080ff" : "#808080"
+                        border.width: 2
+                        color: parent.checked ? "#4080ff" : "transparent"
+
+                        Text {
+                            anchors.centerIn: parent
+                            text: "✓"
+                            color: "white"
+                            font.pixelSize: 12
+                            visible: parent.parent.checked
+                        }
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        font.pixelSize: 12
+                        color: "#ffffff"
+                        leftPadding: parent.indicator.width + parent.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
+
+                CheckBox {
+                    text: "Load Planets On Demand"
+                    checked: controller ? controller.lazyPlanets : false
+                    onCheckedChanged: if (controller)
+                        controller.lazyPlanets = checked
+                    Layout.fillWidth: true
+                    Layout.columnSpan: 2
+
+                    indicator: Rectangle {
+                        implicitWidth: 18
+                        implicitHeight: 18
+                        x: parent.leftPadding
+                        y: parent.height / 2 - height / 2
+                        radius: 2
+                        border.color: parent.checked ? "#4080ff" : "#808080"
+                        border.width: 2
+                        color: parent.checked ? "#4080ff" : "transparent"
+
+                        Text {
+                            anchors.centerIn: parent
+                            text: "✓"
+                            color: "white"
+                            font.pixelSize: 12
+                            visible: parent.parent.checked
+                        }
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        font.pixelSize: 12
+                        color: "#ffffff"
+                        leftPadding: parent.indicator.width + parent.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
+
+                CheckBox {
+                    text: "Allocate From Arena"
+                    checked: controller ? controller.arenaAllocation : false
+                    onCheckedChanged: if (controller)
+                        controller.arenaAllocation = checked
+                    Layout.fillWidth: true
+                    Layout.columnSpan: 2
+
+                    indicator: Rectangle {
+                        implicitWidth: 18
+                        implicitHeight: 18
+                        x: parent.leftPadding
+                        y: parent.height / 2 - height / 2
+                        radius: 2
+                        border.color: parent.checked ? "#4080ff" : "#808080"
+                        border.width: 2
+                        color: parent.checked ? "#4080ff" : "transparent"
+
+                        Text {
+                            anchors.centerIn: parent
+                            text: "✓"
+                            color: "white"
+                            font.pixelSize: 12
+                            visible: parent.parent.checked
+                        }
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        font.pixelSize: 12
+                        color: "#ffffff"
+                        leftPadding: parent.indicator.width + parent.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
             }
         }
 
@@ -507,6 +651,118 @@ ScrollView {
                         verticalAlignment: Text.AlignVCenter
                     }
                 }
+
+                CheckBox {
+                    text: "Highlight Chokepoints"
+                    checked: controller && controller.connectivityViewModel ? controller.connectivityViewModel.highlightChokepoints : false
+                    onCheckedChanged: if (controller && controller.connectivityViewModel)
+                        controller.connectivityViewModel.highlightChokepoints = checked
+                    Layout.fillWidth: true
+
+                    indicator: Rectangle {
+                        implicitWidth: 18
+                        implicitHeight: 18
+                        x: parent.leftPadding
+                        y: parent.height / 2 - height / 2
+                        radius: 2
+                        border.color: parent.checked ? "#4080ff" : "#808080"
+                        border.width: 2
+                        color: parent.checked ? "#4080ff" : "transparent"
+
+                        Text {
+                            anchors.centerIn: parent
+                            text: "✓"
+                            color: "white"
+                            font.pixelSize: 12
+                            visible: parent.parent.checked
+                        }
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        font.pixelSize: 12
+                        color: "#ffffff"
+                        leftPadding: parent.indicator.width + parent.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
+
+                CheckBox {
+                    text: "Show Route Traffic Heat"
+                    checked: controller && controller.connectivityViewModel ? controller.connectivityViewModel.showCentralityHeat : false
+                    onCheckedChanged: {
+                        if (!controller || !controller.connectivityViewModel)
+                            return;
+                        var analysis = controller.connectivityViewModel;
+                        // Sample sources on large maps; exact scores are quick below a few thousand systems
+                        if (checked && !analysis.hasCentrality)
+                            analysis.computeCentrality(controller.systemCount > 5000 ? 0.05 : 0.0);
+                        analysis.showCentralityHeat = checked;
+                    }
+                    Layout.fillWidth: true
+
+                    indicator: Rectangle {
+                        implicitWidth: 18
+                        implicitHeight: 18
+                        x: parent.leftPadding
+                        y: parent.height / 2 - height / 2
+                        radius: 2
+                        border.color: parent.checked ? "#4080ff" : "#808080"
+                        border.width: 2
+                        color: parent.checked ? "#4080ff" : "transparent"
+
+                        Text {
+                            anchors.centerIn: parent
+                            text: "✓"
+                            color: "white"
+                            font.pixelSize: 12
+                            visible: parent.parent.checked
+                        }
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        font.pixelSize: 12
+                        color: "#ffffff"
+                        leftPadding: parent.indicator.width + parent.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
+
+                CheckBox {
+                    text: "Show Faction Borders"
+                    checked: controller && controller.galaxyFactionsViewModel ? controller.galaxyFactionsViewModel.showBorders : false
+                    onCheckedChanged: if (controller && controller.galaxyFactionsViewModel)
+                        controller.galaxyFactionsViewModel.showBorders = checked
+                    Layout.fillWidth: true
+
+                    indicator: Rectangle {
+                        implicitWidth: 18
+                        implicitHeight: 18
+                        x: parent.leftPadding
+                        y: parent.height / 2 - height / 2
+                        radius: 2
+                        border.color: parent.checked ? "#4080ff" : "#808080"
+                        border.width: 2
+                        color: parent.checked ? "#4080ff" : "transparent"
+
+                        Text {
+                            anchors.centerIn: parent
+                            text: "✓"
+                            color: "white"
+                            font.pixelSize: 12
+                            visible: parent.parent.checked
+                        }
+                    }
+
+                    contentItem: Text {
+                        text: parent.text
+                        font.pixelSize: 12
+                        color: "#ffffff"
+                        leftPadding: parent.indicator.width + parent.spacing
+                        verticalAlignment: Text.AlignVCenter
+                    }
+                }
             }
         }
 
@@ -1,6 +1,7 @@
 import QtQuick
 import QtQuick.Controls
 import GalaxyBuilderApp 1.0
+import GalaxyCore.ViewModels
 
 Rectangle {
     id: root
@@ -8,6 +9,14 @@ Rectangle {
     // Properties that will be bound from the parent
     property GalaxyController controller
     property bool hasSelectedSystem: controller && controller.selectedStarSystemViewModel
+    readonly property var starSystems: controller && controller.galaxyViewModel ? controller.galaxyViewModel.starSystems : null
+
+    // Edits made on the selected system also go to every other system in the multi-selection, in one batch
+    function applyToMultiSelection(role, value) {
+        if (starSystems && starSystems.selectionCount > 1 && starSystems.isSelected(controller.selectedStarSystemViewModel.systemId)) {
+            starSystems.applyToSelection(role, value);
+        }
+    }
 
     // Panel appearance
     color: "#252525"
@@ -96,6 +105,7 @@ Rectangle {
                             var currentType = controller.selectedStarSystemViewModel.starType;
                             var newType = (currentType + 1) % 8; // Assuming 8 star types
                             controller.selectedStarSystemViewModel.starType = newType;
+                            applyToMultiSelection(StarSystemListModel.StarTypeRole, newType);
                         }
                     }
                 }
@@ -115,6 +125,7 @@ Rectangle {
                             var currentSize = controller.selectedStarSystemViewModel.systemSize;
                             var newSize = (currentSize + 1) % 5; // Assuming 5 system sizes
                             controller.selectedStarSystemViewModel.systemSize = newSize;
+                            applyToMultiSelection(StarSystemListModel.SystemSizeRole, newSize);
                         }
                     }
                 }
@@ -0,0 +1,93 @@
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Layouts
+import GalaxyBuilderApp 1.0
+
+Rectangle {
+    id: root
+
+    // Controller providing the route view model
+    property GalaxyController controller
+    readonly property var routeViewModel: controller ? controller.routeViewModel : null
+
+    width: 220
+    height: content.implicitHeight + 16
+    color: "#303030"
+    border.color: "#606060"
+    border.width: 1
+    radius: 4
+
+    ColumnLayout {
+        id: content
+        anchors.fill: parent
+        anchors.margins: 8
+        spacing: 6
+
+        Text {
+            text: "Route Planner"
+            color: "#ffffff"
+            font.pixelSize: 12
+            font.bold: true
+        }
+
+        RowLayout {
+            spacing: 4
+
+            TextField {
+                id: fromField
+                Layout.fillWidth: true
+                placeholderText: "From ID"
+                validator: IntValidator {
+                    bottom: 0
+                }
+                text: controller && controller.selectedStarSystemViewModel ? controller.selectedStarSystemViewModel.systemId : ""
+            }
+
+            TextField {
+                id: toField
+                Layout.fillWidth: true
+                placeholderText: "To ID"
+                validator: IntValidator {
+                    bottom: 0
+                }
+            }
+        }
+
+        RowLayout {
+            spacing: 4
+
+            Button {
+                text: "Find"
+                Layout.fillWidth: true
+                enabled: routeViewModel !== null && fromField.acceptableInput && toField.acceptableInput
+                onClicked: routeViewModel.findRoute(parseInt(fromField.text), parseInt(toField.text))
+            }
+
+            Button {
+                text: "Clear"
+                Layout.fillWidth: true
+                enabled: routeViewModel !== null && routeViewModel.hasRoute
+                onClicked: routeViewModel.clearRoute()
+            }
+        }
+
+        Button {
+            Layout.fillWidth: true
+            text: routeViewModel && routeViewModel.hasLandmarks ? "Landmarks ready" : "Precompute landmarks"
+            enabled: routeViewModel !== null && !routeViewModel.hasLandmarks
+            onClicked: routeViewModel.buildLandmarks(16)
+        }
+
+        Text {
+            Layout.fillWidth: true
+            color: "#c0c0c0"
+            font.pixelSize: 10
+            wrapMode: Text.WordWrap
+            text: {
+                if (!routeViewModel || !routeViewModel.hasRoute)
+                    return "No route";
+                return routeViewModel.hopCount + " jumps, " + routeViewModel.totalDistance.toFixed(1) + " units";
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Layouts
+import GalaxyBuilderApp 1.0
+import GalaxyCore.ViewModels
+
+Rectangle {
+    id: root
+
+    // Controller providing the galaxy to filter
+    property GalaxyController controller
+
+    width: 220
+    height: content.implicitHeight + 16
+    color: "#303030"
+    border.color: "#606060"
+    border.width: 1
+    radius: 4
+
+    // Runs the query once through the engine; rows are only looked up, not re-evaluated
+    SystemFilterModel {
+        id: filterModel
+        galaxy: controller ? controller.galaxyViewModel : null
+        query: queryField.text
+    }
+
+    ColumnLayout {
+        id: content
+        anchors.fill: parent
+        anchors.margins: 8
+        spacing: 6
+
+        TextField {
+            id: queryField
+            Layout.fillWidth: true
+            placeholderText: "type = BlueStar and planets > 5"
+            ToolTip.visible: hovered && filterModel.errorString.length > 0
+            ToolTip.text: filterModel.errorString
+            color: filterModel.errorString.length > 0 ? "#ff8080" : "#ffffff"
+        }
+
+        ListView {
+            id: resultsView
+            Layout.fillWidth: true
+            Layout.preferredHeight: Math.min(contentHeight, 160)
+            visible: queryField.text.length > 0 && filterModel.errorString.length === 0
+            clip: true
+            model: filterModel
+
+            delegate: ItemDelegate {
+                width: resultsView.width
+                height: 22
+                contentItem: Text {
+                    text: model.name
+                    color: model.selected ? "#ffd700" : (parent.hovered ? "#ffffff" : "#cccccc")
+                    font.pixelSize: 11
+                    elide: Text.ElideRight
+                    verticalAlignment: Text.AlignVCenter
+                }
+                onClicked: {
+                    if (controller) {
+                        controller.selectSystem(model.systemId);
+                    }
+                }
+            }
+        }
+
+        RowLayout {
+            Layout.fillWidth: true
+            visible: queryField.text.length > 0
+
+            Text {
+                Layout.fillWidth: true
+                text: filterModel.errorString.length > 0 ? "Invalid query" : filterModel.matchCount + " matches"
+                color: "#808080"
+                font.pixelSize: 10
+            }
+
+            Button {
+                text: "Select all"
+                enabled: filterModel.matchCount > 0 && filterModel.errorString.length === 0
+                onClicked: controller.galaxyViewModel.starSystems.setSelection(filterModel.matchingSystemIds())
+            }
+        }
+    }
+}
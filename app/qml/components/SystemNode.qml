@@ -16,13 +16,12 @@ Item {
     property bool isSelected: false
     property bool showInfluenceRadius: false
     property bool showSystemNames: true
+    property bool isChokepoint: false
+    // Set by GalaxyView, whose single MouseArea hit-tests systems through the galaxy's spatial index
+    property bool isHovered: false
 
-    // Controller for handling clicks
     property GalaxyController controller
 
-    // Signal emitted when system is double-clicked
-    signal systemDoubleClicked(int systemId)
-
     // Calculate dynamic node size based on system size (radius 15-30)
     readonly property real nodeRadius: getSystemRadius(systemSize)
     readonly property real nodeDiameter: nodeRadius * 2
@@ -91,10 +90,24 @@ Item {
             }
         }
 
+        // Chokepoint indicator ring (system whose loss would split the lane network)
+        Rectangle {
+            id: chokepointRing
+            visible: isChokepoint && !isSelected
+            width: parent.width + 8
+            height: parent.height + 8
+            radius: (parent.width + 8) / 2
+            x: (parent.width - width) / 2
+            y: (parent.height - height) / 2
+            color: "transparent"
+            border.color: "#ff2040"
+            border.width: 2
+        }
+
         // Hover effect
         Rectangle {
             id: hoverRing
-            visible: mouseArea.containsMouse && !isSelected
+            visible: isHovered && !isSelected
             width: parent.width + 4
             height: parent.height + 4
             radius: (parent.width + 4) / 2
@@ -105,29 +118,6 @@ Item {
             border.width: 1
             opacity: 0.8
         }
-
-        // Click handling
-        MouseArea {
-            id: mouseArea
-            anchors.fill: parent
-            anchors.margins: -4  // Expand clickable area
-            z: 99
-            hoverEnabled: true
-            cursorShape: Qt.PointingHandCursor
-
-            onClicked: mouse => {
-                console.log("Single click detected - systemId:", systemId, "systemName:", systemName);
-                if (controller) {
-                    controller.selectSystem(systemId);
-                }
-            }
-
-            onDoubleClicked: {
-                console.log("Double click detected - systemId:", systemId, "systemName:", systemName);
-                // Emit signal to let parent handle dialog
-                systemDoubleClicked(systemId);
-            }
-        }
     }
 
     // System name label
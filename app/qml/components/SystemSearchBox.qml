@@ -0,0 +1,82 @@
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Layouts
+import GalaxyBuilderApp 1.0
+import GalaxyCore.ViewModels
+
+Rectangle {
+    id: root
+
+    // Controller providing the galaxy to search
+    property GalaxyController controller
+
+    // Emitted when a result is picked, with the system's galaxy position
+    signal systemChosen(int systemId, real x, real y)
+
+    width: 220
+    height: content.implicitHeight + 16
+    color: "#303030"
+    border.color: "#606060"
+    border.width: 1
+    radius: 4
+
+    // Only the top matches are ever materialised, however large the galaxy
+    SystemSearchModel {
+        id: searchModel
+        galaxy: controller ? controller.galaxyViewModel : null
+        query: searchField.text
+        limit: 10
+    }
+
+    ColumnLayout {
+        id: content
+        anchors.fill: parent
+        anchors.margins: 8
+        spacing: 6
+
+        TextField {
+            id: searchField
+            Layout.fillWidth: true
+            placeholderText: "Search systems..."
+            onAccepted: {
+                if (searchModel.totalMatches > 0) {
+                    resultsView.choose(0);
+                }
+            }
+        }
+
+        ListView {
+            id: resultsView
+            Layout.fillWidth: true
+            Layout.preferredHeight: contentHeight
+            visible: searchField.text.length > 0
+            interactive: false
+            model: searchModel
+
+            function choose(row) {
+                var item = searchModel.index(row, 0);
+                root.systemChosen(searchModel.data(item, SystemSearchModel.SystemIdRole), searchModel.data(item, SystemSearchModel.PositionXRole), searchModel.data(item, SystemSearchModel.PositionYRole));
+            }
+
+            delegate: ItemDelegate {
+                width: resultsView.width
+                height: 22
+                contentItem: Text {
+                    text: model.name
+                    color: parent.hovered ? "#ffffff" : "#cccccc"
+                    font.pixelSize: 11
+                    elide: Text.ElideRight
+                    verticalAlignment: Text.AlignVCenter
+                }
+                onClicked: resultsView.choose(index)
+            }
+        }
+
+        Text {
+            visible: searchField.text.length > 0
+            text: searchModel.totalMatches > searchModel.limit ? searchModel.limit + " of " + searchModel.totalMatches + " matches" : searchModel.totalMatches + " matches"
+            color: "#808080"
+            font.pixelSize: 10
+        }
+    }
+}
@@ -3,6 +3,7 @@ import QtQuick.Controls
 import QtQml
 import GalaxyBuilderApp 1.0
 import GalaxyCore.ViewModels 1.0
+import Galaxy.Factions.ViewModels 1.0
 
 Item {
     id: root
@@ -12,9 +13,47 @@ Item {
     property point panOffset: Qt.point(0, 0)
     property point lastMousePos: Qt.point(0, 0)
     property bool isPanning: false
+    property bool isRubberBanding: false
+    property point pressPos: Qt.point(0, 0)
+    property int hoveredSystemId: 0
+    // Nodes are drawn 15-30 units across; keep the pick radius at least a few screen pixels when zoomed out
+    readonly property real pickRadius: Math.max(30, 8 / zoomFactor)
+    readonly property var routeViewModel: controller ? controller.routeViewModel : null
+    readonly property var connectivityViewModel: controller ? controller.connectivityViewModel : null
+    readonly property var factionsViewModel: controller ? controller.galaxyFactionsViewModel : null
+    // bridgeCount notifies on every re-analysis, so chokepoint bindings re-evaluate with it
+    readonly property bool highlightChokepoints: connectivityViewModel !== null && connectivityViewModel.highlightChokepoints && connectivityViewModel.bridgeCount >= 0
+    readonly property bool showTrafficHeat: connectivityViewModel !== null && connectivityViewModel.showCentralityHeat && connectivityViewModel.hasCentrality
+
+    // Blue (quiet) to red (busiest) for a betweenness score relative to the maximum
+    function heatColor(score, maxScore) {
+        var heat = maxScore > 0 ? Math.min(1.0, score / maxScore) : 0.0;
+        return Qt.hsla((1.0 - heat) * 0.66, 1.0, 0.5, 1.0);
+    }
 
     // Signal emitted when a system is double-clicked
     signal systemDoubleClicked(int systemId)
+    // Signal emitted with the ids of the systems inside a Shift+drag rectangle
+    signal systemsRubberBandSelected(var systemIds)
+
+    onSystemsRubberBandSelected: function (systemIds) {
+        if (controller && controller.galaxyViewModel) {
+            controller.galaxyViewModel.starSystems.setSelection(systemIds);
+        }
+    }
+
+    // Maps a point in view coordinates into galaxy coordinates, undoing zoom and pan
+    function toGalaxy(x, y) {
+        return galaxyContainer.mapFromItem(root, x, y);
+    }
+
+    function systemUnder(x, y) {
+        if (!controller || !controller.galaxyViewModel) {
+            return 0;
+        }
+        var p = toGalaxy(x, y);
+        return controller.galaxyViewModel.systemAt(p.x, p.y, pickRadius);
+    }
 
     // Function to export galaxy content without UI elements
     function exportGalaxyImage(filePath, width, height) {
@@ -155,18 +194,35 @@ Item {
                     }
                 ]
 
+                // Faction regions and borders: one scene graph node for the whole galaxy
+                FactionBordersItem {
+                    x: 0
+                    y: 0
+                    width: controller ? controller.galaxyWidth : 0
+                    height: controller ? controller.galaxyHeight : 0
+                    factions: root.factionsViewModel
+                    visible: root.factionsViewModel !== null && root.factionsViewModel.showBorders
+                }
+
                 // Travel lanes - using actual C++ created travel lane data
                 Repeater {
                     id: travelLanesRepeater
                     model: controller && controller.galaxyViewModel && controller.showTravelLanes ? controller.galaxyViewModel.travelLanes : null
 
                     delegate: TravelLane {
+                        // hasRoute notifies on every route change, so this re-evaluates when the route is replaced
+                        readonly property bool onRoute: root.routeViewModel !== null && root.routeViewModel.hasRoute && root.routeViewModel.isLaneOnRoute(model.laneId)
+                        readonly property bool isBridge: root.highlightChokepoints && root.connectivityViewModel.isBridge(model.laneId)
+                        readonly property real heat: root.showTrafficHeat && root.connectivityViewModel.maxLaneBetweenness > 0 ? model.betweenness / root.connectivityViewModel.maxLaneBetweenness : -1
+
                         startX: model.fromX
                         startY: model.fromY
                         endX: model.toX
                         endY: model.toY
-                        laneOpacity: model.isActive ? 0.6 : 0.3
-                        laneColor: model.laneType === 0 ? "#00ffff" : "#ffff00"  // Different colors for different lane types
+                        laneOpacity: onRoute || isBridge ? 1.0 : (heat >= 0 ? 0.4 + 0.6 * heat : (model.isActive ? 0.6 : 0.3))
+                        laneColor: onRoute ? "#ff6600" : (isBridge ? "#ff2040" : (heat >= 0 ? root.heatColor(model.betweenness, root.connectivityViewModel.maxLaneBetweenness) : (model.laneType === 0 ? "#00ffff" : "#ffff00")))  // Different colors for different lane types
+                        laneWidth: onRoute || isBridge ? 3 : (heat >= 0 ? 1 + 2 * heat : 1)
+                        z: onRoute || isBridge ? 1 : 0
                     }
                 }
 
@@ -180,40 +236,102 @@ Item {
                         systemY: model.positionY
                         systemType: model.starType
                         systemSize: model.systemSize
-                        isSelected: controller && controller.selectedStarSystemViewModel ? (controller.selectedStarSystemViewModel.systemId === model.systemId) : false
+                        isSelected: model.selected || (controller && controller.selectedStarSystemViewModel ? (controller.selectedStarSystemViewModel.systemId === model.systemId) : false)
                         showInfluenceRadius: controller ? controller.showInfluenceRadius : false
                         showSystemNames: controller ? controller.showSystemNames : true
+                        isChokepoint: root.highlightChokepoints && root.connectivityViewModel.isArticulationPoint(model.systemId)
+                        isHovered: root.hoveredSystemId === model.systemId
                         controller: root.controller
-
-                        onSystemDoubleClicked: function (systemId) {
-                            root.systemDoubleClicked(systemId);
-                        }
                     }
                 }
             }
         }
 
-        // Mouse interaction
+        // Rubber band for Shift+drag selection, drawn in view coordinates
+        Rectangle {
+            id: rubberBand
+            visible: root.isRubberBanding
+            x: Math.min(root.pressPos.x, root.lastMousePos.x)
+            y: Math.min(root.pressPos.y, root.lastMousePos.y)
+            width: Math.abs(root.lastMousePos.x - root.pressPos.x)
+            height: Math.abs(root.lastMousePos.y - root.pressPos.y)
+            color: "#304080ff"
+            border.color: "#4080ff"
+            border.width: 1
+        }
+
+        // Mouse interaction: the one hit-testing surface for the map. Systems are found through
+        // GalaxyViewModel's spatial index rather than a MouseArea per node.
         MouseArea {
+            id: mapMouseArea
             anchors.fill: parent
             acceptedButtons: Qt.LeftButton
-            propagateComposedEvents: true
+            hoverEnabled: true
+            cursorShape: root.hoveredSystemId !== 0 ? Qt.PointingHandCursor : Qt.ArrowCursor
+
+            // Presses that move less than this are clicks, not drags
+            readonly property real dragThreshold: 4
+            property bool dragged: false
 
             onPressed: function (mouse) {
-                lastMousePos = Qt.point(mouse.x, mouse.y);
-                isPanning = true;
+                pressPos = Qt.point(mouse.x, mouse.y);
+                lastMousePos = pressPos;
+                dragged = false;
+                isRubberBanding = (mouse.modifiers & Qt.ShiftModifier) !== 0;
+                isPanning = !isRubberBanding;
             }
 
             onReleased: function (mouse) {
+                if (isRubberBanding) {
+                    var a = toGalaxy(pressPos.x, pressPos.y);
+                    var b = toGalaxy(mouse.x, mouse.y);
+                    if (dragged && controller && controller.galaxyViewModel) {
+                        root.systemsRubberBandSelected(controller.galaxyViewModel.systemsInRect(
+                            Qt.rect(Math.min(a.x, b.x), Math.min(a.y, b.y), Math.abs(b.x - a.x), Math.abs(b.y - a.y))));
+                    }
+                } else if (!dragged && controller) {
+                    var systemId = systemUnder(mouse.x, mouse.y);
+                    var systems = controller.galaxyViewModel ? controller.galaxyViewModel.starSystems : null;
+                    if (systemId !== 0) {
+                        controller.selectSystem(systemId);
+                        // Ctrl+click grows or shrinks the multi-selection; a plain click starts a new one
+                        if (systems && (mouse.modifiers & Qt.ControlModifier)) {
+                            systems.toggleSelected(systemId);
+                        } else if (systems) {
+                            systems.setSelection([systemId]);
+                        }
+                    } else if (systems) {
+                        systems.clearSelection();
+                    }
+                }
                 isPanning = false;
+                isRubberBanding = false;
+            }
+
+            onDoubleClicked: function (mouse) {
+                var systemId = systemUnder(mouse.x, mouse.y);
+                if (systemId !== 0) {
+                    root.systemDoubleClicked(systemId);
+                }
+            }
+
+            onExited: {
+                root.hoveredSystemId = 0;
             }
 
             onPositionChanged: function (mouse) {
+                if (!pressed) {
+                    root.hoveredSystemId = systemUnder(mouse.x, mouse.y);
+                    return;
+                }
+                if (Math.abs(mouse.x - pressPos.x) > dragThreshold || Math.abs(mouse.y - pressPos.y) > dragThreshold) {
+                    dragged = true;
+                }
                 if (isPanning) {
                     var delta = Qt.point(mouse.x - lastMousePos.x, mouse.y - lastMousePos.y);
                     panOffset = Qt.point(panOffset.x + delta.x, panOffset.y + delta.y);
-                    lastMousePos = Qt.point(mouse.x, mouse.y);
                 }
+                lastMousePos = Qt.point(mouse.x, mouse.y);
             }
 
             onWheel: function (wheel) {
@@ -255,6 +373,42 @@ Item {
             }
         }
 
+        // Route planner
+        RoutePlanner {
+            id: routePlanner
+            anchors.left: parent.left
+            anchors.top: parent.top
+            anchors.margins: 10
+
+            controller: root.controller
+        }
+
+        // System search: selects the chosen system and centres the view on it
+        SystemSearchBox {
+            id: systemSearchBox
+            anchors.left: parent.left
+            anchors.top: routePlanner.bottom
+            anchors.margins: 10
+
+            controller: root.controller
+
+            onSystemChosen: function (systemId, x, y) {
+                if (controller) {
+                    controller.selectSystem(systemId);
+                    root.panOffset = Qt.point(-(x - controller.galaxyWidth / 2) * root.zoomFactor, -(y - controller.galaxyHeight / 2) * root.zoomFactor);
+                }
+            }
+        }
+
+        // Query filter: narrows the system list and selects the matches
+        SystemFilterPanel {
+            anchors.left: parent.left
+            anchors.top: systemSearchBox.bottom
+            anchors.margins: 10
+
+            controller: root.controller
+        }
+
         // Zoom level indicator
         ZoomIndicator {
             anchors.left: parent.left
@@ -57,6 +57,7 @@ option(GALAXY_BUILDER_BUILD_TESTS "Build unit tests" OFF)
 option(GALAXY_BUILDER_BUILD_DOCS "Build documentation" OFF)
 option(GALAXY_BUILDER_ENABLE_LTO "Enable Link Time Optimization" ON)
 option(GALAXY_BUILDER_ENABLE_SANITIZERS "Enable sanitizers (Debug only)" OFF)
+option(GALAXY_BUILDER_ENABLE_TRACING "Compile in GGH_TRACE_SCOPE instrumentation" OFF)
 
 # Debug postfix for libraries and executables
 set(CMAKE_DEBUG_POSTFIX "d")
@@ -87,5 +88,6 @@ message(STATUS "Build type: ${CMAKE_BUILD_TYPE}")
 message(STATUS "C++ Compiler: ${CMAKE_CXX_COMPILER_ID} ${CMAKE_CXX_COMPILER_VERSION}")
 message(STATUS "C++ Standard: ${CMAKE_CXX_STANDARD}")
 message(STATUS "Install prefix: ${CMAKE_INSTALL_PREFIX}")
+message(STATUS "Tracing: ${GALAXY_BUILDER_ENABLE_TRACING}")
 message(STATUS "==========================================")
 message(STATUS "")
@@ -0,0 +1,91 @@
+#ifndef GGH_MODULES_GALAXYANALYSIS_MODELS_BETWEENNESS_CENTRALITY_H
+#define GGH_MODULES_GALAXYANALYSIS_MODELS_BETWEENNESS_CENTRALITY_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+
+namespace ggh::Galaxy::Analysis::models {
+
+/**
+ * @brief Settings for a betweenness computation.
+ */
+struct CentralityOptions {
+    double errorBound{0.0};            ///< 0 for exact scores; otherwise the additive error allowed on every normalised score
+    double failureProbability{0.1};    ///< Chance that some score misses the error bound (approximate mode only)
+    unsigned threadCount{0};           ///< Worker threads; 0 uses all cores
+    std::uint64_t seed{1};             ///< Seed for choosing sampled sources
+};
+
+/**
+ * @class BetweennessCentrality
+ * @brief Brandes betweenness of systems and lanes over the lane-length-weighted graph.
+ *
+ * A system's score is the fraction of shortest routes between other system pairs that pass
+ * through it; a lane's score is the fraction of all shortest routes that use it. Both are
+ * normalised to [0, 1]. Equal-length alternatives share the credit.
+ *
+ * Exact mode runs one Dijkstra plus a dependency sweep from every source, O(N (N + E) log N).
+ * Sources are claimed by worker threads, each with its own scratch space and score
+ * accumulators, which are summed once at the end. Approximate mode runs the same sweep from a
+ * uniform sample of sources and scales the result; the sample size comes from a Hoeffding bound
+ * with a union bound over all systems and lanes, so it grows only with log N.
+ */
+class BetweennessCentrality {
+public:
+    using NodeIndex = GalaxyCore::models::LaneGraph::NodeIndex;
+
+    /**
+     * @brief Computes the scores for the graph.
+     * @return False if the graph is empty.
+     */
+    bool compute(const GalaxyCore::models::LaneGraph& graph, const CentralityOptions& options = {});
+
+    void clear();
+
+    /**
+     * @brief Number of sampled sources needed for the requested error bound.
+     * @return The sample size, capped at the node count.
+     */
+    static std::size_t sampleSize(std::size_t nodeCount, std::size_t laneCount,
+                                  double errorBound, double failureProbability);
+
+    bool empty() const noexcept { return m_nodeScores.empty(); }
+    bool isExact() const noexcept { return m_exact; }
+    std::size_t sourceCount() const noexcept { return m_sourceCount; }
+
+    /**
+     * @brief Scores indexed by node index of the graph passed to compute().
+     */
+    const std::vector<double>& nodeScores() const noexcept { return m_nodeScores; }
+    double nodeScore(NodeIndex node) const { return m_nodeScores[node]; }
+
+    /**
+     * @brief Score of a lane, 0 if unknown.
+     */
+    double laneScore(GalaxyCore::utilities::LaneId lane) const;
+    const std::vector<GalaxyCore::utilities::LaneId>& laneIds() const noexcept { return m_laneIds; }
+    const std::vector<double>& laneScores() const noexcept { return m_laneScores; }   ///< Parallel to laneIds()
+
+    double maxNodeScore() const noexcept { return m_maxNodeScore; }
+    double maxLaneScore() const noexcept { return m_maxLaneScore; }
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    std::vector<double> m_nodeScores;
+    std::vector<GalaxyCore::utilities::LaneId> m_laneIds;
+    std::vector<double> m_laneScores;
+    std::unordered_map<GalaxyCore::utilities::LaneId, std::uint32_t> m_laneSlot;
+    double m_maxNodeScore{0.0};
+    double m_maxLaneScore{0.0};
+    std::size_t m_sourceCount{0};
+    bool m_exact{true};
+};
+
+} // namespace ggh::Galaxy::Analysis::models
+
+#endif // !GGH_MODULES_GALAXYANALYSIS_MODELS_BETWEENNESS_CENTRALITY_H
@@ -0,0 +1,39 @@
+#ifndef GGH_MODULES_GALAXYANALYSIS_MODELS_COMPONENT_BRIDGER_H
+#define GGH_MODULES_GALAXYANALYSIS_MODELS_COMPONENT_BRIDGER_H
+
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+
+namespace ggh::Galaxy::Analysis::models {
+
+/**
+ * @brief A lane to add between two systems in different components.
+ */
+struct BridgeLane {
+    GalaxyCore::utilities::SystemId from;
+    GalaxyCore::utilities::SystemId to;
+    double length;
+};
+
+/**
+ * @class ComponentBridger
+ * @brief Plans the cheapest set of lanes that joins every component of the lane graph.
+ *
+ * Runs Borůvka rounds over components: each component except the largest looks up, through a
+ * spatial grid, the nearest system outside itself, and the shortest such candidate per component
+ * is added. Every round at least halves the number of smaller components, and the result is the
+ * minimum spanning forest over components, so k components are joined by exactly k - 1 lanes.
+ */
+class ComponentBridger {
+public:
+    /**
+     * @brief Computes the lanes to add; the graph itself is not modified.
+     * @return The planned lanes, shortest-first within each round; empty if already connected.
+     */
+    std::vector<BridgeLane> plan(const GalaxyCore::models::LaneGraph& graph) const;
+};
+
+} // namespace ggh::Galaxy::Analysis::models
+
+#endif // !GGH_MODULES_GALAXYANALYSIS_MODELS_COMPONENT_BRIDGER_H
@@ -0,0 +1,68 @@
+#ifndef GGH_MODULES_GALAXYANALYSIS_MODELS_CONNECTIVITY_ANALYSIS_H
+#define GGH_MODULES_GALAXYANALYSIS_MODELS_CONNECTIVITY_ANALYSIS_H
+
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+
+namespace ggh::Galaxy::Analysis::models {
+
+/**
+ * @class ConnectivityAnalysis
+ * @brief Connected components, bridges and articulation points of the lane graph.
+ *
+ * Components come from a union-find pass over the lanes; bridges (lanes whose removal
+ * disconnects the graph) and articulation points (systems whose removal does) come from an
+ * iterative Tarjan low-link DFS, so deep graphs cannot overflow the call stack.
+ * Both passes are O(N + E). Parallel lanes between the same two systems are never bridges.
+ */
+class ConnectivityAnalysis {
+public:
+    using NodeIndex = GalaxyCore::models::LaneGraph::NodeIndex;
+
+    /**
+     * @brief Recomputes every result for the graph.
+     */
+    void analyze(const GalaxyCore::models::LaneGraph& graph);
+
+    void clear();
+
+    std::size_t componentCount() const noexcept { return m_componentSizes.size(); }
+
+    /**
+     * @brief Component number of a node; components are numbered from 0 by first node index.
+     */
+    std::uint32_t componentOf(NodeIndex node) const { return m_componentOf[node]; }
+
+    const std::vector<std::uint32_t>& componentSizes() const noexcept { return m_componentSizes; }
+    std::size_t largestComponentSize() const noexcept;
+
+    const std::vector<GalaxyCore::utilities::LaneId>& bridges() const noexcept { return m_bridges; }
+    const std::vector<GalaxyCore::utilities::SystemId>& articulationPoints() const noexcept { return m_articulationPoints; }
+
+    bool isBridge(GalaxyCore::utilities::LaneId lane) const { return m_bridgeSet.contains(lane); }
+    bool isArticulationPoint(GalaxyCore::utilities::SystemId id) const { return m_articulationSet.contains(id); }
+
+    /**
+     * @brief Revision of the graph the results were computed for.
+     */
+    std::uint64_t graphRevision() const noexcept { return m_graphRevision; }
+
+private:
+    void findComponents(const GalaxyCore::models::LaneGraph& graph);
+    void findBridgesAndArticulationPoints(const GalaxyCore::models::LaneGraph& graph);
+
+    std::vector<std::uint32_t> m_componentOf;
+    std::vector<std::uint32_t> m_componentSizes;
+    std::vector<GalaxyCore::utilities::LaneId> m_bridges;
+    std::vector<GalaxyCore::utilities::SystemId> m_articulationPoints;
+    std::unordered_set<GalaxyCore::utilities::LaneId> m_bridgeSet;
+    std::unordered_set<GalaxyCore::utilities::SystemId> m_articulationSet;
+    std::uint64_t m_graphRevision{0};
+};
+
+} // namespace ggh::Galaxy::Analysis::models
+
+#endif // !GGH_MODULES_GALAXYANALYSIS_MODELS_CONNECTIVITY_ANALYSIS_H
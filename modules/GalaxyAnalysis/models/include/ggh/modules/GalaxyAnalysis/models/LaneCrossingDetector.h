@@ -0,0 +1,58 @@
+#ifndef GGH_MODULES_GALAXYANALYSIS_MODELS_LANE_CROSSING_DETECTOR_H
+#define GGH_MODULES_GALAXYANALYSIS_MODELS_LANE_CROSSING_DETECTOR_H
+
+#include <span>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+
+namespace ggh::Galaxy::Analysis::models {
+
+/**
+ * @brief Two lanes whose segments cross; first < second.
+ */
+struct LaneCrossing {
+    GalaxyCore::utilities::LaneId first;
+    GalaxyCore::utilities::LaneId second;
+
+    bool operator==(const LaneCrossing&) const = default;
+};
+
+/**
+ * @class LaneCrossingDetector
+ * @brief Finds travel lanes whose straight segments cross.
+ *
+ * Lane segments are bucketed into a uniform grid by bounding box, with cells about one mean
+ * lane length wide, and only lanes sharing a cell are tested against each other. Each pair is
+ * tested in exactly one cell (the first cell their bounding boxes share), so no result needs
+ * de-duplication. For lanes of similar length spread over the map this costs O(E + K) expected,
+ * where K is the number of crossings.
+ *
+ * Lanes that share a system never count as crossing. A lane passing through another lane's
+ * system, or overlapping it collinearly, does.
+ */
+class LaneCrossingDetector {
+public:
+    /**
+     * @brief Finds every crossing pair of lanes.
+     * @param graph The lane graph whose lane segments are tested.
+     * @param cellSize Grid cell edge length; 0 uses the mean lane length.
+     * @return Crossings sorted by (first, second).
+     */
+    std::vector<LaneCrossing> find(const GalaxyCore::models::LaneGraph& graph, double cellSize = 0.0) const;
+
+    /**
+     * @brief Picks lanes to drop so that the longer lane of each crossing goes away.
+     *
+     * A lane is kept anyway if dropping it would split a component; when several candidates
+     * could restore a connection, the shortest are kept. Every component of the graph therefore
+     * stays connected.
+     * @return Lane ids to remove, sorted.
+     */
+    std::vector<GalaxyCore::utilities::LaneId> planRemovals(const GalaxyCore::models::LaneGraph& graph,
+                                                            std::span<const LaneCrossing> crossings) const;
+};
+
+} // namespace ggh::Galaxy::Analysis::models
+
+#endif // !GGH_MODULES_GALAXYANALYSIS_MODELS_LANE_CROSSING_DETECTOR_H
@@ -0,0 +1,44 @@
+#ifndef GGH_MODULES_GALAXYANALYSIS_MODELS_UNION_FIND_H
+#define GGH_MODULES_GALAXYANALYSIS_MODELS_UNION_FIND_H
+
+#include <cstdint>
+#include <vector>
+
+namespace ggh::Galaxy::Analysis::models {
+
+/**
+ * @class UnionFind
+ * @brief Disjoint-set forest with union by size and path halving.
+ *
+ * find() and unite() run in amortised near-constant time.
+ */
+class UnionFind {
+public:
+    using Index = std::uint32_t;
+
+    explicit UnionFind(std::size_t size = 0);
+
+    void reset(std::size_t size);
+
+    Index find(Index element);
+
+    /**
+     * @brief Merges the sets containing two elements.
+     * @return False if they were already in the same set.
+     */
+    bool unite(Index a, Index b);
+
+    bool connected(Index a, Index b) { return find(a) == find(b); }
+    std::size_t setSize(Index element) { return m_sizes[find(element)]; }
+    std::size_t setCount() const noexcept { return m_setCount; }
+    std::size_t size() const noexcept { return m_parents.size(); }
+
+private:
+    std::vector<Index> m_parents;
+    std::vector<Index> m_sizes;
+    std::size_t m_setCount{0};
+};
+
+} // namespace ggh::Galaxy::Analysis::models
+
+#endif // !GGH_MODULES_GALAXYANALYSIS_MODELS_UNION_FIND_H
@@ -0,0 +1,294 @@
+/**
+ * @file BetweennessCentrality.cpp
+ * @brief Implementation of the BetweennessCentrality class for GalaxyAnalysis module
+ */
+
+#include "ggh/modules/GalaxyAnalysis/models/BetweennessCentrality.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <thread>
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using NodeIndex = BetweennessCentrality::NodeIndex;
+
+constexpr double INFINITE_DISTANCE = std::numeric_limits<double>::infinity();
+
+/**
+ * @brief Copy of the graph with lanes renumbered densely, so the sweeps index flat arrays
+ */
+struct CompactGraph {
+    std::vector<std::uint32_t> offsets;   ///< Start of each node's half-edges, plus a sentinel
+    std::vector<NodeIndex> targets;
+    std::vector<std::uint32_t> lanes;     ///< Dense lane slot of each half-edge
+    std::vector<double> lengths;
+};
+
+struct HeapEntry {
+    double distance;
+    NodeIndex node;
+};
+
+// std::push_heap builds a max-heap; invert the comparison to pop the nearest node first
+struct GreaterDistance {
+    bool operator()(const HeapEntry& lhs, const HeapEntry& rhs) const noexcept {
+        return lhs.distance > rhs.distance;
+    }
+};
+
+/**
+ * @brief Scratch space and score accumulators owned by one worker thread
+ */
+class SourceSweep {
+public:
+    SourceSweep(std::size_t nodeCount, std::size_t laneCount)
+        : nodeScores(nodeCount, 0.0)
+        , laneScores(laneCount, 0.0)
+        , m_distance(nodeCount, INFINITE_DISTANCE)
+        , m_paths(nodeCount, 0.0)
+        , m_dependency(nodeCount, 0.0)
+    {
+        m_order.reserve(nodeCount);
+    }
+
+    std::vector<double> nodeScores;     ///< Unnormalised sums over this worker's sources
+    std::vector<double> laneScores;
+
+    /**
+     * @brief Adds the dependencies of one source to the accumulators
+     */
+    void run(const CompactGraph& graph, NodeIndex source)
+    {
+        // Dijkstra, counting equally short paths and recording nodes in settle order
+        m_distance[source] = 0.0;
+        m_paths[source] = 1.0;
+        m_heap.push_back({0.0, source});
+        while (!m_heap.empty()) {
+            std::pop_heap(m_heap.begin(), m_heap.end(), GreaterDistance{});
+            const auto [distance, node] = m_heap.back();
+            m_heap.pop_back();
+            // Entries are only pushed on strict improvement, so a stale one is always longer
+            if (distance > m_distance[node]) {
+                continue;
+            }
+            m_order.push_back(node);
+            for (auto edge = graph.offsets[node]; edge < graph.offsets[node + 1]; ++edge) {
+                const auto next = graph.targets[edge];
+                const double candidate = distance + graph.lengths[edge];
+                if (candidate < m_distance[next]) {
+                    m_distance[next] = candidate;
+                    m_paths[next] = m_paths[node];
+                    m_heap.push_back({candidate, next});
+                    std::push_heap(m_heap.begin(), m_heap.end(), GreaterDistance{});
+                } else if (candidate == m_distance[next]) {
+                    m_paths[next] += m_paths[node];
+                }
+            }
+        }
+
+        // Dependency sweep in reverse settle order. A neighbour is a predecessor exactly when it
+        // reproduces the node's distance bit for bit, which avoids storing predecessor lists.
+        for (auto it = m_order.rbegin(); it != m_order.rend(); ++it) {
+            const auto node = *it;
+            const double credit = (1.0 + m_dependency[node]) / m_paths[node];
+            for (auto edge = graph.offsets[node]; edge < graph.offsets[node + 1]; ++edge) {
+                const auto previous = graph.targets[edge];
+                if (m_distance[previous] + graph.lengths[edge] == m_distance[node] && previous != node) {
+                    const double share = m_paths[previous] * credit;
+                    laneScores[graph.lanes[edge]] += share;
+                    m_dependency[previous] += share;
+                }
+            }
+            if (node != source) {
+                nodeScores[node] += m_dependency[node];
+            }
+        }
+
+        // Only reached nodes were written, so resetting them is enough
+        for (auto node : m_order) {
+            m_distance[node] = INFINITE_DISTANCE;
+            m_paths[node] = 0.0;
+            m_dependency[node] = 0.0;
+        }
+        m_order.clear();
+    }
+
+private:
+    std::vector<double> m_distance;
+    std::vector<double> m_paths;        ///< Number of shortest paths from the source
+    std::vector<double> m_dependency;
+    std::vector<NodeIndex> m_order;
+    std::vector<HeapEntry> m_heap;
+};
+} // namespace
+
+/**
+ * @brief Computes exact or sampled betweenness scores in parallel
+ * @param graph The lane graph to analyse
+ * @param options Accuracy, threading and sampling settings
+ * @return False if the graph is empty
+ */
+bool BetweennessCentrality::compute(const LaneGraph& graph, const CentralityOptions& options)
+{
+    GGH_TRACE_SCOPE("BetweennessCentrality::compute");
+    clear();
+    const std::size_t nodeCount = graph.nodeCount();
+    if (nodeCount == 0) {
+        return false;
+    }
+
+    // Renumber lanes densely in first-seen order
+    CompactGraph compact;
+    compact.offsets.reserve(nodeCount + 1);
+    compact.offsets.push_back(0);
+    for (NodeIndex node = 0; node < nodeCount; ++node) {
+        const auto neighbours = graph.neighbours(node);
+        for (std::size_t i = 0; i < neighbours.size(); ++i) {
+            const auto [slot, inserted] = m_laneSlot.try_emplace(neighbours.lanes[i], static_cast<std::uint32_t>(m_laneIds.size()));
+            if (inserted) {
+                m_laneIds.push_back(neighbours.lanes[i]);
+            }
+            compact.targets.push_back(neighbours.nodes[i]);
+            compact.lanes.push_back(slot->second);
+            compact.lengths.push_back(neighbours.lengths[i]);
+        }
+        compact.offsets.push_back(static_cast<std::uint32_t>(compact.targets.size()));
+    }
+    const std::size_t laneCount = m_laneIds.size();
+
+    // Pick the sources: all of them, or a seeded uniform sample without replacement
+    std::vector<NodeIndex> sources(nodeCount);
+    std::iota(sources.begin(), sources.end(), NodeIndex{0});
+    const std::size_t sampled = options.errorBound > 0.0
+        ? sampleSize(nodeCount, laneCount, options.errorBound, options.failureProbability)
+        : nodeCount;
+    m_exact = sampled >= nodeCount;
+    if (!m_exact) {
+        std::mt19937_64 rng(options.seed);
+        for (std::size_t i = 0; i < sampled; ++i) {
+            std::uniform_int_distribution<std::size_t> pick(i, nodeCount - 1);
+            std::swap(sources[i], sources[pick(rng)]);
+        }
+        sources.resize(sampled);
+    }
+    m_sourceCount = sources.size();
+
+    unsigned threadCount = options.threadCount;
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, sources.size()));
+
+    // Workers claim sources one at a time and only ever write their own accumulators
+    std::vector<SourceSweep> sweeps;
+    sweeps.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        sweeps.emplace_back(nodeCount, laneCount);
+    }
+    std::atomic<std::size_t> nextSource{0};
+    auto worker = [&](SourceSweep& sweep) {
+        for (auto i = nextSource++; i < sources.size(); i = nextSource++) {
+            sweep.run(compact, sources[i]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker, std::ref(sweeps[i]));
+    }
+    worker(sweeps[0]);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Sum the accumulators and normalise. Every unordered pair is counted once from each end,
+    // and sampled sums are scaled up to the full source count.
+    const double n = static_cast<double>(nodeCount);
+    const double scale = n / static_cast<double>(m_sourceCount);
+    const double nodeNorm = nodeCount > 2 ? scale / ((n - 1.0) * (n - 2.0)) : 0.0;
+    const double laneNorm = nodeCount > 1 ? scale / (n * (n - 1.0)) : 0.0;
+
+    m_nodeScores.assign(nodeCount, 0.0);
+    m_laneScores.assign(laneCount, 0.0);
+    for (const auto& sweep : sweeps) {
+        for (std::size_t node = 0; node < nodeCount; ++node) {
+            m_nodeScores[node] += sweep.nodeScores[node];
+        }
+        for (std::size_t lane = 0; lane < laneCount; ++lane) {
+            m_laneScores[lane] += sweep.laneScores[lane];
+        }
+    }
+    for (auto& score : m_nodeScores) {
+        score = std::min(1.0, score * nodeNorm);
+        m_maxNodeScore = std::max(m_maxNodeScore, score);
+    }
+    for (auto& score : m_laneScores) {
+        score = std::min(1.0, score * laneNorm);
+        m_maxLaneScore = std::max(m_maxLaneScore, score);
+    }
+    return true;
+}
+
+/**
+ * @brief Drops all scores
+ */
+void BetweennessCentrality::clear()
+{
+    m_nodeScores.clear();
+    m_laneIds.clear();
+    m_laneScores.clear();
+    m_laneSlot.clear();
+    m_maxNodeScore = 0.0;
+    m_maxLaneScore = 0.0;
+    m_sourceCount = 0;
+    m_exact = true;
+}
+
+/**
+ * @brief Sample size from Hoeffding's inequality with a union bound over all scores
+ *
+ * Each source's contribution to a normalised score lies in [0, 1], so k sources estimate one
+ * score within ε with probability 1 - 2exp(-2kε²); requiring that for all N + E scores at once
+ * gives k = ln(2(N + E) / δ) / (2ε²).
+ */
+std::size_t BetweennessCentrality::sampleSize(std::size_t nodeCount, std::size_t laneCount,
+                                              double errorBound, double failureProbability)
+{
+    if (errorBound <= 0.0 || failureProbability <= 0.0 || failureProbability >= 1.0) {
+        return nodeCount;
+    }
+    const double scores = static_cast<double>(nodeCount + laneCount);
+    const double samples = std::log(2.0 * scores / failureProbability) / (2.0 * errorBound * errorBound);
+    return std::min(nodeCount, static_cast<std::size_t>(std::ceil(samples)));
+}
+
+/**
+ * @brief Score of a lane by id
+ * @return The normalised score, 0 for unknown lanes
+ */
+double BetweennessCentrality::laneScore(GalaxyCore::utilities::LaneId lane) const
+{
+    const auto it = m_laneSlot.find(lane);
+    return it != m_laneSlot.end() ? m_laneScores[it->second] : 0.0;
+}
+
+/**
+ * @brief Reports the score arrays and the lane lookup table
+ */
+void BetweennessCentrality::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+    report.add("analysis.centrality",
+               heapBytes(m_nodeScores) + heapBytes(m_laneIds) + heapBytes(m_laneScores) + heapBytes(m_laneSlot));
+}
+
+} // namespace ggh::Galaxy::Analysis::models
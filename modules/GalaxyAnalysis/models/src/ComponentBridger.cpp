@@ -0,0 +1,110 @@
+/**
+ * @file ComponentBridger.cpp
+ * @brief Implementation of the ComponentBridger class for GalaxyAnalysis module
+ */
+
+#include "ggh/modules/GalaxyAnalysis/models/ComponentBridger.h"
+#include "ggh/modules/GalaxyAnalysis/models/UnionFind.h"
+#include "ggh/modules/GalaxyCore/utilities/SpatialGrid.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+
+struct Candidate {
+    double length{std::numeric_limits<double>::infinity()};
+    LaneGraph::NodeIndex from{LaneGraph::INVALID_NODE};
+    LaneGraph::NodeIndex to{LaneGraph::INVALID_NODE};
+
+    bool operator<(const Candidate& other) const {
+        return std::tie(length, from, to) < std::tie(other.length, other.from, other.to);
+    }
+};
+} // namespace
+
+/**
+ * @brief Plans the shortest lanes that connect all components
+ * @param graph The lane graph to connect
+ * @return Lanes to add, empty if the graph is already connected
+ */
+std::vector<BridgeLane> ComponentBridger::plan(const LaneGraph& graph) const
+{
+    GGH_TRACE_SCOPE("ComponentBridger::plan");
+    const auto nodeCount = graph.nodeCount();
+    UnionFind sets(nodeCount);
+    for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+        for (auto neighbour : graph.neighbours(node).nodes) {
+            sets.unite(node, neighbour);
+        }
+    }
+
+    std::vector<BridgeLane> lanes;
+    if (sets.setCount() <= 1) {
+        return lanes;
+    }
+
+    std::vector<GalaxyCore::utilities::CartesianCoordinates<double>> positions;
+    positions.reserve(nodeCount);
+    for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+        positions.push_back(graph.position(node));
+    }
+    GalaxyCore::utilities::SpatialGrid grid;
+    grid.build(positions);
+
+    std::vector<Candidate> best(nodeCount);
+    while (sets.setCount() > 1) {
+        // The largest component does not search: it is reached by the others' candidates,
+        // which keeps the nearest-outside queries away from the bulk of the systems
+        LaneGraph::NodeIndex largest = sets.find(0);
+        for (LaneGraph::NodeIndex node = 1; node < nodeCount; ++node) {
+            const auto root = sets.find(node);
+            if (sets.setSize(root) > sets.setSize(largest)) {
+                largest = root;
+            }
+        }
+
+        std::fill(best.begin(), best.end(), Candidate{});
+        for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+            const auto root = sets.find(node);
+            if (root == largest) {
+                continue;
+            }
+            auto& candidate = best[root];
+            const auto other = grid.nearest(positions[node],
+                                            [&](auto index) { return sets.find(index) != root; },
+                                            candidate.length);
+            if (other == GalaxyCore::utilities::SpatialGrid::INVALID_INDEX) {
+                continue;
+            }
+            const Candidate found{GalaxyCore::utilities::calculateDistance(positions[node], positions[other]),
+                                  std::min<LaneGraph::NodeIndex>(node, other),
+                                  std::max<LaneGraph::NodeIndex>(node, other)};
+            if (found < candidate) {
+                candidate = found;
+            }
+        }
+
+        std::vector<Candidate> round;
+        for (const auto& candidate : best) {
+            if (candidate.from != LaneGraph::INVALID_NODE) {
+                round.push_back(candidate);
+            }
+        }
+        std::sort(round.begin(), round.end());
+        for (const auto& candidate : round) {
+            // Two components may have picked the same or an equivalent lane
+            if (sets.unite(candidate.from, candidate.to)) {
+                lanes.push_back({graph.systemId(candidate.from), graph.systemId(candidate.to), candidate.length});
+            }
+        }
+    }
+    return lanes;
+}
+
+} // namespace ggh::Galaxy::Analysis::models
@@ -0,0 +1,165 @@
+/**
+ * @file ConnectivityAnalysis.cpp
+ * @brief Implementation of the ConnectivityAnalysis class for GalaxyAnalysis module
+ */
+
+#include "ggh/modules/GalaxyAnalysis/models/ConnectivityAnalysis.h"
+#include "ggh/modules/GalaxyAnalysis/models/UnionFind.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+constexpr GalaxyCore::utilities::LaneId NO_LANE = std::numeric_limits<GalaxyCore::utilities::LaneId>::max();
+
+struct DfsFrame {
+    ConnectivityAnalysis::NodeIndex node;
+    GalaxyCore::utilities::LaneId parentLane;   ///< Lane used to enter the node; skipped once
+    std::uint32_t nextEdge;
+};
+} // namespace
+
+/**
+ * @brief Runs the component and Tarjan passes over the graph
+ * @param graph The lane graph to analyse
+ */
+void ConnectivityAnalysis::analyze(const GalaxyCore::models::LaneGraph& graph)
+{
+    GGH_TRACE_SCOPE("ConnectivityAnalysis::analyze");
+    clear();
+    findComponents(graph);
+    findBridgesAndArticulationPoints(graph);
+    m_graphRevision = graph.revision();
+}
+
+/**
+ * @brief Drops all results
+ */
+void ConnectivityAnalysis::clear()
+{
+    m_componentOf.clear();
+    m_componentSizes.clear();
+    m_bridges.clear();
+    m_articulationPoints.clear();
+    m_bridgeSet.clear();
+    m_articulationSet.clear();
+    m_graphRevision = 0;
+}
+
+/**
+ * @brief Size of the largest component, 0 for an empty graph
+ */
+std::size_t ConnectivityAnalysis::largestComponentSize() const noexcept
+{
+    return m_componentSizes.empty() ? 0 : *std::max_element(m_componentSizes.begin(), m_componentSizes.end());
+}
+
+/**
+ * @brief Labels components with a union-find pass over every lane
+ */
+void ConnectivityAnalysis::findComponents(const GalaxyCore::models::LaneGraph& graph)
+{
+    const auto nodeCount = graph.nodeCount();
+    UnionFind sets(nodeCount);
+    for (NodeIndex node = 0; node < nodeCount; ++node) {
+        for (auto neighbour : graph.neighbours(node).nodes) {
+            if (neighbour > node) {
+                sets.unite(node, neighbour);
+            }
+        }
+    }
+
+    // Number components densely in order of their first node
+    constexpr auto UNLABELLED = std::numeric_limits<std::uint32_t>::max();
+    std::vector<std::uint32_t> labelOfRoot(nodeCount, UNLABELLED);
+    m_componentOf.resize(nodeCount);
+    m_componentSizes.reserve(sets.setCount());
+    for (NodeIndex node = 0; node < nodeCount; ++node) {
+        auto& label = labelOfRoot[sets.find(node)];
+        if (label == UNLABELLED) {
+            label = static_cast<std::uint32_t>(m_componentSizes.size());
+            m_componentSizes.push_back(0);
+        }
+        m_componentOf[node] = label;
+        ++m_componentSizes[label];
+    }
+}
+
+/**
+ * @brief Iterative Tarjan low-link DFS for bridges and articulation points
+ */
+void ConnectivityAnalysis::findBridgesAndArticulationPoints(const GalaxyCore::models::LaneGraph& graph)
+{
+    const auto nodeCount = graph.nodeCount();
+    std::vector<std::uint32_t> discovery(nodeCount, 0);   // 0 = not visited yet
+    std::vector<std::uint32_t> low(nodeCount, 0);
+    std::vector<std::uint8_t> isArticulation(nodeCount, 0);
+    std::vector<DfsFrame> stack;
+    std::uint32_t time = 0;
+
+    for (NodeIndex root = 0; root < nodeCount; ++root) {
+        if (discovery[root] != 0) {
+            continue;
+        }
+        discovery[root] = low[root] = ++time;
+        stack.push_back({root, NO_LANE, 0});
+        std::size_t rootChildren = 0;
+
+        while (!stack.empty()) {
+            const auto node = stack.back().node;
+            const auto neighbours = graph.neighbours(node);
+            if (stack.back().nextEdge < neighbours.size()) {
+                const auto edge = stack.back().nextEdge++;
+                const auto lane = neighbours.lanes[edge];
+                const auto next = neighbours.nodes[edge];
+                if (lane == stack.back().parentLane) {
+                    continue;
+                }
+                if (discovery[next] == 0) {
+                    discovery[next] = low[next] = ++time;
+                    if (node == root) {
+                        ++rootChildren;
+                    }
+                    stack.push_back({next, lane, 0});
+                } else {
+                    low[node] = std::min(low[node], discovery[next]);
+                }
+                continue;
+            }
+
+            // All edges explored: fold the child's low-link into its parent
+            const auto child = stack.back();
+            stack.pop_back();
+            if (stack.empty()) {
+                break;
+            }
+            const auto parent = stack.back().node;
+            low[parent] = std::min(low[parent], low[child.node]);
+            if (low[child.node] > discovery[parent]) {
+                m_bridges.push_back(child.parentLane);
+            }
+            if (parent != root && low[child.node] >= discovery[parent]) {
+                isArticulation[parent] = 1;
+            }
+        }
+
+        if (rootChildren > 1) {
+            isArticulation[root] = 1;
+        }
+    }
+
+    for (NodeIndex node = 0; node < nodeCount; ++node) {
+        if (isArticulation[node]) {
+            m_articulationPoints.push_back(graph.systemId(node));
+        }
+    }
+    std::sort(m_bridges.begin(), m_bridges.end());
+    std::sort(m_articulationPoints.begin(), m_articulationPoints.end());
+    m_bridgeSet.insert(m_bridges.begin(), m_bridges.end());
+    m_articulationSet.insert(m_articulationPoints.begin(), m_articulationPoints.end());
+}
+
+} // namespace ggh::Galaxy::Analysis::models
@@ -0,0 +1,234 @@
+/**
+ * @file LaneCrossingDetector.cpp
+ * @brief Implementation of the LaneCrossingDetector class for GalaxyAnalysis module
+ */
+
+#include "ggh/modules/GalaxyAnalysis/models/LaneCrossingDetector.h"
+#include "ggh/modules/GalaxyAnalysis/models/UnionFind.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+struct Segment {
+    GalaxyCore::utilities::LaneId lane;
+    LaneGraph::NodeIndex from;
+    LaneGraph::NodeIndex to;
+    double length;
+    Coordinates a;
+    Coordinates b;
+    std::uint32_t minColumn{0};
+    std::uint32_t minRow{0};
+    std::uint32_t maxColumn{0};
+    std::uint32_t maxRow{0};
+};
+
+/**
+ * @brief Every lane once, taken from the block of its lower-indexed endpoint
+ */
+std::vector<Segment> collectSegments(const LaneGraph& graph)
+{
+    std::vector<Segment> segments;
+    segments.reserve(graph.edgeCount());
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        const auto neighbours = graph.neighbours(node);
+        for (std::size_t i = 0; i < neighbours.size(); ++i) {
+            if (node < neighbours.nodes[i]) {
+                segments.push_back({neighbours.lanes[i], node, neighbours.nodes[i], neighbours.lengths[i],
+                                    graph.position(node), graph.position(neighbours.nodes[i])});
+            }
+        }
+    }
+    return segments;
+}
+
+int orientation(const Coordinates& a, const Coordinates& b, const Coordinates& c)
+{
+    const double cross = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    return (cross > 0.0) - (cross < 0.0);
+}
+
+// p is known to be collinear with a-b; checks that it lies between them
+bool withinSegment(const Coordinates& a, const Coordinates& b, const Coordinates& p)
+{
+    return p.x >= std::min(a.x, b.x) && p.x <= std::max(a.x, b.x)
+        && p.y >= std::min(a.y, b.y) && p.y <= std::max(a.y, b.y);
+}
+
+bool segmentsCross(const Segment& s, const Segment& t)
+{
+    const int o1 = orientation(s.a, s.b, t.a);
+    const int o2 = orientation(s.a, s.b, t.b);
+    const int o3 = orientation(t.a, t.b, s.a);
+    const int o4 = orientation(t.a, t.b, s.b);
+    if (o1 * o2 < 0 && o3 * o4 < 0) {
+        return true;
+    }
+    // Touching or collinear overlap; shared systems were excluded by the caller
+    return (o1 == 0 && withinSegment(s.a, s.b, t.a)) || (o2 == 0 && withinSegment(s.a, s.b, t.b))
+        || (o3 == 0 && withinSegment(t.a, t.b, s.a)) || (o4 == 0 && withinSegment(t.a, t.b, s.b));
+}
+} // namespace
+
+/**
+ * @brief Finds all crossing lane pairs with a bucketed grid
+ * @param graph The lane graph to test
+ * @param cellSize Grid cell size, 0 for the mean lane length
+ * @return Crossing pairs, sorted
+ */
+std::vector<LaneCrossing> LaneCrossingDetector::find(const LaneGraph& graph, double cellSize) const
+{
+    GGH_TRACE_SCOPE("LaneCrossingDetector::find");
+    std::vector<LaneCrossing> crossings;
+    auto segments = collectSegments(graph);
+    if (segments.size() < 2) {
+        return crossings;
+    }
+
+    double minX = graph.position(0).x;
+    double minY = graph.position(0).y;
+    double maxX = minX;
+    double maxY = minY;
+    for (LaneGraph::NodeIndex node = 1; node < graph.nodeCount(); ++node) {
+        const auto& position = graph.position(node);
+        minX = std::min(minX, position.x);
+        minY = std::min(minY, position.y);
+        maxX = std::max(maxX, position.x);
+        maxY = std::max(maxY, position.y);
+    }
+    if (cellSize <= 0.0) {
+        double total = 0.0;
+        for (const auto& segment : segments) {
+            total += segment.length;
+        }
+        cellSize = total / static_cast<double>(segments.size());
+    }
+    // Keep the grid within a few cells per lane even for degenerate inputs
+    const double extent = std::max({maxX - minX, maxY - minY, 1e-9});
+    cellSize = std::max(cellSize, extent / std::sqrt(4.0 * static_cast<double>(segments.size())));
+    const auto columns = static_cast<std::uint32_t>((maxX - minX) / cellSize) + 1;
+    const auto rows = static_cast<std::uint32_t>((maxY - minY) / cellSize) + 1;
+    auto columnOf = [&](double x) {
+        return std::min(columns - 1, static_cast<std::uint32_t>(std::max(0.0, (x - minX) / cellSize)));
+    };
+    auto rowOf = [&](double y) {
+        return std::min(rows - 1, static_cast<std::uint32_t>(std::max(0.0, (y - minY) / cellSize)));
+    };
+
+    // Counting sort of segment indices into every cell their bounding box touches
+    std::vector<std::uint32_t> cellStart(static_cast<std::size_t>(columns) * rows + 1, 0);
+    for (auto& segment : segments) {
+        segment.minColumn = columnOf(std::min(segment.a.x, segment.b.x));
+        segment.maxColumn = columnOf(std::max(segment.a.x, segment.b.x));
+        segment.minRow = rowOf(std::min(segment.a.y, segment.b.y));
+        segment.maxRow = rowOf(std::max(segment.a.y, segment.b.y));
+        for (auto row = segment.minRow; row <= segment.maxRow; ++row) {
+            for (auto column = segment.minColumn; column <= segment.maxColumn; ++column) {
+                ++cellStart[static_cast<std::size_t>(row) * columns + column + 1];
+            }
+        }
+    }
+    for (std::size_t cell = 1; cell < cellStart.size(); ++cell) {
+        cellStart[cell] += cellStart[cell - 1];
+    }
+    std::vector<std::uint32_t> entries(cellStart.back());
+    std::vector<std::uint32_t> cursor(cellStart.begin(), cellStart.end() - 1);
+    for (std::uint32_t index = 0; index < segments.size(); ++index) {
+        const auto& segment = segments[index];
+        for (auto row = segment.minRow; row <= segment.maxRow; ++row) {
+            for (auto column = segment.minColumn; column <= segment.maxColumn; ++column) {
+                entries[cursor[static_cast<std::size_t>(row) * columns + column]++] = index;
+            }
+        }
+    }
+
+    for (std::uint32_t row = 0; row < rows; ++row) {
+        for (std::uint32_t column = 0; column < columns; ++column) {
+            const auto cell = static_cast<std::size_t>(row) * columns + column;
+            for (auto i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                const auto& s = segments[entries[i]];
+                for (auto j = i + 1; j < cellStart[cell + 1]; ++j) {
+                    const auto& t = segments[entries[j]];
+                    // Test each pair only in the first cell both bounding boxes cover
+                    if (std::max(s.minColumn, t.minColumn) != column || std::max(s.minRow, t.minRow) != row) {
+                        continue;
+                    }
+                    if (s.from == t.from || s.from == t.to || s.to == t.from || s.to == t.to) {
+                        continue;
+                    }
+                    if (segmentsCross(s, t)) {
+                        crossings.push_back({std::min(s.lane, t.lane), std::max(s.lane, t.lane)});
+                    }
+                }
+            }
+        }
+    }
+
+    std::sort(crossings.begin(), crossings.end(),
+              [](const auto& lhs, const auto& rhs) { return std::tie(lhs.first, lhs.second) < std::tie(rhs.first, rhs.second); });
+    return crossings;
+}
+
+/**
+ * @brief Chooses the lanes to remove so crossings disappear without disconnecting anything
+ * @param graph The lane graph the crossings were found in
+ * @param crossings Crossing pairs from find()
+ * @return Lane ids to remove, sorted
+ */
+std::vector<GalaxyCore::utilities::LaneId> LaneCrossingDetector::planRemovals(const LaneGraph& graph,
+                                                                              std::span<const LaneCrossing> crossings) const
+{
+    GGH_TRACE_SCOPE("LaneCrossingDetector::planRemovals");
+    const auto segments = collectSegments(graph);
+    std::unordered_map<GalaxyCore::utilities::LaneId, std::uint32_t> segmentOf;
+    segmentOf.reserve(segments.size());
+    for (std::uint32_t index = 0; index < segments.size(); ++index) {
+        segmentOf.emplace(segments[index].lane, index);
+    }
+
+    // The longer lane of each pair (ties go to the higher id) is a removal candidate
+    auto longer = [&](std::uint32_t a, std::uint32_t b) {
+        return std::tie(segments[a].length, segments[a].lane) > std::tie(segments[b].length, segments[b].lane) ? a : b;
+    };
+    std::unordered_set<std::uint32_t> candidateSet;
+    for (const auto& crossing : crossings) {
+        const auto first = segmentOf.find(crossing.first);
+        const auto second = segmentOf.find(crossing.second);
+        if (first != segmentOf.end() && second != segmentOf.end()) {
+            candidateSet.insert(longer(first->second, second->second));
+        }
+    }
+
+    // Kruskal-style: keep every other lane, then keep a candidate only if its endpoints are not
+    // yet joined, trying the shortest candidates first
+    UnionFind sets(graph.nodeCount());
+    for (std::uint32_t index = 0; index < segments.size(); ++index) {
+        if (!candidateSet.contains(index)) {
+            sets.unite(segments[index].from, segments[index].to);
+        }
+    }
+    std::vector<std::uint32_t> candidates(candidateSet.begin(), candidateSet.end());
+    std::sort(candidates.begin(), candidates.end(), [&](auto a, auto b) {
+        return std::tie(segments[a].length, segments[a].lane) < std::tie(segments[b].length, segments[b].lane);
+    });
+
+    std::vector<GalaxyCore::utilities::LaneId> removals;
+    for (auto index : candidates) {
+        if (!sets.unite(segments[index].from, segments[index].to)) {
+            removals.push_back(segments[index].lane);
+        }
+    }
+    std::sort(removals.begin(), removals.end());
+    return removals;
+}
+
+} // namespace ggh::Galaxy::Analysis::models
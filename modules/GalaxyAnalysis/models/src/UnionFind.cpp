@@ -0,0 +1,65 @@
+/**
+ * @file UnionFind.cpp
+ * @brief Implementation of the UnionFind class for GalaxyAnalysis module
+ */
+
+#include "ggh/modules/GalaxyAnalysis/models/UnionFind.h"
+
+#include <numeric>
+#include <utility>
+
+namespace ggh::Galaxy::Analysis::models {
+
+/**
+ * @brief Constructs a forest of singleton sets
+ * @param size Number of elements
+ */
+UnionFind::UnionFind(std::size_t size)
+{
+    reset(size);
+}
+
+/**
+ * @brief Resets to singleton sets
+ * @param size Number of elements
+ */
+void UnionFind::reset(std::size_t size)
+{
+    m_parents.resize(size);
+    std::iota(m_parents.begin(), m_parents.end(), Index{0});
+    m_sizes.assign(size, 1);
+    m_setCount = size;
+}
+
+/**
+ * @brief Finds the representative of an element's set, halving the path on the way
+ */
+UnionFind::Index UnionFind::find(Index element)
+{
+    while (m_parents[element] != element) {
+        m_parents[element] = m_parents[m_parents[element]];
+        element = m_parents[element];
+    }
+    return element;
+}
+
+/**
+ * @brief Merges two sets, hanging the smaller tree under the larger
+ */
+bool UnionFind::unite(Index a, Index b)
+{
+    a = find(a);
+    b = find(b);
+    if (a == b) {
+        return false;
+    }
+    if (m_sizes[a] < m_sizes[b]) {
+        std::swap(a, b);
+    }
+    m_parents[b] = a;
+    m_sizes[a] += m_sizes[b];
+    --m_setCount;
+    return true;
+}
+
+} // namespace ggh::Galaxy::Analysis::models
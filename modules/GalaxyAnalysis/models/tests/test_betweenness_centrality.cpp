@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyAnalysis/models/BetweennessCentrality.h"
+
+#include <cmath>
+#include <random>
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+// Random geometric graph: each system is joined to its three nearest neighbours by index order
+void buildRandomGraph(LaneGraph& graph, std::size_t systems, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    std::vector<LaneGraph::NodeRecord> nodes;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= systems; ++id) {
+        nodes.push_back({id, Coordinates(coordinate(rng), coordinate(rng))});
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const auto& a, const auto& b) { return a.position.x < b.position.x; });
+    std::vector<LaneGraph::EdgeRecord> edges;
+    GalaxyCore::utilities::LaneId lane = 1;
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        for (std::size_t j = i + 1; j < std::min(nodes.size(), i + 4); ++j) {
+            edges.push_back({lane++, nodes[i].id, nodes[j].id});
+        }
+    }
+    graph.build(nodes, edges);
+}
+} // namespace
+
+TEST(BetweennessCentralityTest, PathGraphScores) {
+    // 1 - 2 - 3 - 4: the inner systems lie on 2 of the 3 pairs that avoid them
+    LaneGraph graph;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= 4; ++id) {
+        graph.addNode(id, Coordinates(static_cast<double>(id), 0.0));
+    }
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 2, 3);
+    graph.addEdge(3, 3, 4);
+
+    BetweennessCentrality centrality;
+    ASSERT_TRUE(centrality.compute(graph, {.threadCount = 1}));
+    EXPECT_TRUE(centrality.isExact());
+    EXPECT_DOUBLE_EQ(centrality.nodeScore(graph.indexOf(1)), 0.0);
+    EXPECT_DOUBLE_EQ(centrality.nodeScore(graph.indexOf(2)), 2.0 / 3.0);
+    EXPECT_DOUBLE_EQ(centrality.nodeScore(graph.indexOf(3)), 2.0 / 3.0);
+
+    // The middle lane carries 4 of the 6 pairs, the outer lanes 3 each
+    EXPECT_DOUBLE_EQ(centrality.laneScore(2), 4.0 / 6.0);
+    EXPECT_DOUBLE_EQ(centrality.laneScore(1), 3.0 / 6.0);
+    EXPECT_DOUBLE_EQ(centrality.maxLaneScore(), 4.0 / 6.0);
+}
+
+TEST(BetweennessCentralityTest, EqualRoutesShareCredit) {
+    // Square 1-2-3-4: the two routes between opposite corners are equally long
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(1.0, 0.0));
+    graph.addNode(3, Coordinates(1.0, 1.0));
+    graph.addNode(4, Coordinates(0.0, 1.0));
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 2, 3);
+    graph.addEdge(3, 3, 4);
+    graph.addEdge(4, 4, 1);
+
+    BetweennessCentrality centrality;
+    ASSERT_TRUE(centrality.compute(graph, {.threadCount = 1}));
+    for (LaneGraph::NodeIndex node = 0; node < 4; ++node) {
+        // Half of the one opposite pair out of the three pairs that avoid the system
+        EXPECT_DOUBLE_EQ(centrality.nodeScore(node), 0.5 / 3.0);
+    }
+}
+
+TEST(BetweennessCentralityTest, ParallelMatchesSingleThreaded) {
+    LaneGraph graph;
+    buildRandomGraph(graph, 600, 4);
+
+    BetweennessCentrality serial;
+    BetweennessCentrality parallel;
+    ASSERT_TRUE(serial.compute(graph, {.threadCount = 1}));
+    ASSERT_TRUE(parallel.compute(graph, {.threadCount = 4}));
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        ASSERT_NEAR(serial.nodeScore(node), parallel.nodeScore(node), 1e-12);
+    }
+    for (auto lane : serial.laneIds()) {
+        ASSERT_NEAR(serial.laneScore(lane), parallel.laneScore(lane), 1e-12);
+    }
+}
+
+TEST(BetweennessCentralityTest, SampledScoresStayWithinErrorBound) {
+    LaneGraph graph;
+    buildRandomGraph(graph, 2000, 6);
+
+    BetweennessCentrality exact;
+    ASSERT_TRUE(exact.compute(graph));
+
+    CentralityOptions options;
+    options.errorBound = 0.1;
+    options.failureProbability = 0.1;
+    options.seed = 42;
+    BetweennessCentrality approximate;
+    ASSERT_TRUE(approximate.compute(graph, options));
+    EXPECT_FALSE(approximate.isExact());
+    EXPECT_EQ(approximate.sourceCount(), BetweennessCentrality::sampleSize(graph.nodeCount(), graph.edgeCount(), 0.1, 0.1));
+    EXPECT_LT(approximate.sourceCount(), graph.nodeCount());
+
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        ASSERT_NEAR(approximate.nodeScore(node), exact.nodeScore(node), 0.1);
+    }
+    for (auto lane : exact.laneIds()) {
+        ASSERT_NEAR(approximate.laneScore(lane), exact.laneScore(lane), 0.1);
+    }
+}
+
+TEST(BetweennessCentralityTest, SampleSizeGrowsLogarithmically) {
+    const auto small = BetweennessCentrality::sampleSize(10000000, 0, 0.05, 0.1);
+    const auto large = BetweennessCentrality::sampleSize(100000000, 0, 0.05, 0.1);
+    EXPECT_LT(large - small, small / 5);
+    EXPECT_EQ(BetweennessCentrality::sampleSize(50, 100, 0.05, 0.1), 50u);
+    EXPECT_EQ(BetweennessCentrality::sampleSize(50, 100, 0.0, 0.1), 50u);
+}
+
+TEST(BetweennessCentralityTest, EmptyGraphHasNoScores) {
+    LaneGraph graph;
+    BetweennessCentrality centrality;
+    EXPECT_FALSE(centrality.compute(graph));
+    EXPECT_TRUE(centrality.empty());
+    EXPECT_DOUBLE_EQ(centrality.laneScore(7), 0.0);
+}
+
+} // namespace ggh::Galaxy::Analysis::models
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyAnalysis/models/ComponentBridger.h"
+#include "ggh/modules/GalaxyAnalysis/models/ConnectivityAnalysis.h"
+
+#include <random>
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+} // namespace
+
+TEST(ComponentBridgerTest, ConnectedGraphNeedsNoLanes) {
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(1.0, 0.0));
+    graph.addEdge(1, 1, 2);
+
+    EXPECT_TRUE(ComponentBridger{}.plan(graph).empty());
+}
+
+TEST(ComponentBridgerTest, JoinsIslandsWithShortestLanes) {
+    // Three islands on a line: {1,2} at x=0..1, {3} at x=5, {4,5} at x=20..21
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(1.0, 0.0));
+    graph.addNode(3, Coordinates(5.0, 0.0));
+    graph.addNode(4, Coordinates(20.0, 0.0));
+    graph.addNode(5, Coordinates(21.0, 0.0));
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 4, 5);
+
+    const auto lanes = ComponentBridger{}.plan(graph);
+    ASSERT_EQ(lanes.size(), 2u);
+    double total = 0.0;
+    for (const auto& lane : lanes) {
+        total += lane.length;
+    }
+    // 2 -> 3 (4 units) and 3 -> 4 (15 units)
+    EXPECT_DOUBLE_EQ(total, 19.0);
+}
+
+TEST(ComponentBridgerTest, ResultConnectsRandomIslandsWithMinimumLaneCount) {
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    LaneGraph graph;
+    constexpr GalaxyCore::utilities::SystemId count = 3000;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= count; ++id) {
+        graph.addNode(id, Coordinates(coordinate(rng), coordinate(rng)));
+    }
+    // Chain systems in small groups so there are many islands
+    GalaxyCore::utilities::LaneId lane = 1;
+    for (GalaxyCore::utilities::SystemId id = 1; id < count; ++id) {
+        if (id % 7 != 0) {
+            graph.addEdge(lane++, id, id + 1);
+        }
+    }
+
+    ConnectivityAnalysis before;
+    before.analyze(graph);
+    ASSERT_GT(before.componentCount(), 1u);
+
+    const auto lanes = ComponentBridger{}.plan(graph);
+    EXPECT_EQ(lanes.size(), before.componentCount() - 1);
+    for (const auto& bridge : lanes) {
+        ASSERT_TRUE(graph.addEdge(lane++, bridge.from, bridge.to));
+    }
+
+    ConnectivityAnalysis after;
+    after.analyze(graph);
+    EXPECT_EQ(after.componentCount(), 1u);
+}
+
+} // namespace ggh::Galaxy::Analysis::models
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyAnalysis/models/ConnectivityAnalysis.h"
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+} // namespace
+
+class ConnectivityAnalysisTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // Triangle 1-2-3, joined to triangle 4-5-6 by lane 3-4, plus a pendant 7 off 6
+        // and an isolated pair 8-9 joined by two parallel lanes
+        for (GalaxyCore::utilities::SystemId id = 1; id <= 9; ++id) {
+            graph.addNode(id, Coordinates(static_cast<double>(id), 0.0));
+        }
+        graph.addEdge(1, 1, 2);
+        graph.addEdge(2, 2, 3);
+        graph.addEdge(3, 3, 1);
+        graph.addEdge(4, 3, 4);
+        graph.addEdge(5, 4, 5);
+        graph.addEdge(6, 5, 6);
+        graph.addEdge(7, 6, 4);
+        graph.addEdge(8, 6, 7);
+        graph.addEdge(9, 8, 9);
+        graph.addEdge(10, 9, 8);
+    }
+
+    LaneGraph graph;
+};
+
+TEST_F(ConnectivityAnalysisTest, FindsComponents) {
+    ConnectivityAnalysis analysis;
+    analysis.analyze(graph);
+
+    EXPECT_EQ(analysis.componentCount(), 2u);
+    EXPECT_EQ(analysis.largestComponentSize(), 7u);
+    EXPECT_EQ(analysis.componentOf(graph.indexOf(1)), analysis.componentOf(graph.indexOf(7)));
+    EXPECT_NE(analysis.componentOf(graph.indexOf(1)), analysis.componentOf(graph.indexOf(8)));
+    EXPECT_EQ(analysis.graphRevision(), graph.revision());
+}
+
+TEST_F(ConnectivityAnalysisTest, FindsBridgesButNotParallelLanes) {
+    ConnectivityAnalysis analysis;
+    analysis.analyze(graph);
+
+    EXPECT_EQ(analysis.bridges(), (std::vector<GalaxyCore::utilities::LaneId>{4, 8}));
+    EXPECT_TRUE(analysis.isBridge(4));
+    EXPECT_FALSE(analysis.isBridge(9));
+    EXPECT_FALSE(analysis.isBridge(1));
+}
+
+TEST_F(ConnectivityAnalysisTest, FindsArticulationPoints) {
+    ConnectivityAnalysis analysis;
+    analysis.analyze(graph);
+
+    EXPECT_EQ(analysis.articulationPoints(), (std::vector<GalaxyCore::utilities::SystemId>{3, 4, 6}));
+    EXPECT_TRUE(analysis.isArticulationPoint(6));
+    EXPECT_FALSE(analysis.isArticulationPoint(1));
+}
+
+TEST(ConnectivityAnalysisLongPathTest, HandlesDeepGraphsWithoutRecursion) {
+    LaneGraph graph;
+    constexpr GalaxyCore::utilities::SystemId count = 200000;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= count; ++id) {
+        graph.addNode(id, Coordinates(static_cast<double>(id), 0.0));
+        if (id > 1) {
+            graph.addEdge(id, id - 1, id);
+        }
+    }
+
+    ConnectivityAnalysis analysis;
+    analysis.analyze(graph);
+    EXPECT_EQ(analysis.componentCount(), 1u);
+    EXPECT_EQ(analysis.bridges().size(), count - 1);
+    EXPECT_EQ(analysis.articulationPoints().size(), count - 2);
+}
+
+} // namespace ggh::Galaxy::Analysis::models
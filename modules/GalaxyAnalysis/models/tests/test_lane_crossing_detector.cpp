@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyAnalysis/models/LaneCrossingDetector.h"
+#include "ggh/modules/GalaxyAnalysis/models/ConnectivityAnalysis.h"
+
+#include <algorithm>
+#include <random>
+
+namespace ggh::Galaxy::Analysis::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+// Proper-crossing test for the O(E^2) reference; random positions make touching cases vanishingly rare
+bool crossesByBruteForce(const Coordinates& a, const Coordinates& b, const Coordinates& c, const Coordinates& d) {
+    auto side = [](const Coordinates& p, const Coordinates& q, const Coordinates& r) {
+        const double cross = (q.x - p.x) * (r.y - p.y) - (q.y - p.y) * (r.x - p.x);
+        return (cross > 0.0) - (cross < 0.0);
+    };
+    return side(a, b, c) * side(a, b, d) < 0 && side(c, d, a) * side(c, d, b) < 0;
+}
+
+LaneGraph makeRandomGraph(std::size_t systems, std::size_t lanes, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    LaneGraph graph;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= systems; ++id) {
+        graph.addNode(id, Coordinates(coordinate(rng), coordinate(rng)));
+    }
+    // Lanes between nearby systems, like the generator's radius-limited lanes
+    std::uniform_int_distribution<GalaxyCore::utilities::SystemId> pick(1, static_cast<GalaxyCore::utilities::SystemId>(systems));
+    GalaxyCore::utilities::LaneId lane = 1;
+    while (lane <= lanes) {
+        const auto from = pick(rng);
+        const auto to = pick(rng);
+        const auto distance = GalaxyCore::utilities::calculateDistance(graph.position(graph.indexOf(from)),
+                                                                        graph.position(graph.indexOf(to)));
+        if (from != to && distance < 120.0) {
+            graph.addEdge(lane++, from, to);
+        }
+    }
+    return graph;
+}
+} // namespace
+
+TEST(LaneCrossingDetectorTest, FindsSimpleCrossing) {
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(10.0, 10.0));
+    graph.addNode(3, Coordinates(0.0, 10.0));
+    graph.addNode(4, Coordinates(10.0, 0.0));
+    graph.addEdge(7, 1, 2);
+    graph.addEdge(3, 3, 4);
+
+    const auto crossings = LaneCrossingDetector{}.find(graph);
+    ASSERT_EQ(crossings.size(), 1u);
+    EXPECT_EQ(crossings.front(), (LaneCrossing{3, 7}));
+}
+
+TEST(LaneCrossingDetectorTest, SharedSystemIsNotACrossing) {
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(10.0, 0.0));
+    graph.addNode(3, Coordinates(10.0, 10.0));
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 1, 3);
+    graph.addEdge(3, 2, 3);
+
+    EXPECT_TRUE(LaneCrossingDetector{}.find(graph).empty());
+}
+
+TEST(LaneCrossingDetectorTest, LaneThroughAnotherSystemCountsAsCrossing) {
+    // Lane 1 runs straight through system 3, which lane 2 starts from
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(10.0, 0.0));
+    graph.addNode(3, Coordinates(5.0, 0.0));
+    graph.addNode(4, Coordinates(5.0, 5.0));
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 3, 4);
+
+    const auto crossings = LaneCrossingDetector{}.find(graph);
+    ASSERT_EQ(crossings.size(), 1u);
+    EXPECT_EQ(crossings.front(), (LaneCrossing{1, 2}));
+}
+
+TEST(LaneCrossingDetectorTest, CollinearOverlapCountsAsCrossing) {
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(6.0, 0.0));
+    graph.addNode(3, Coordinates(4.0, 0.0));
+    graph.addNode(4, Coordinates(10.0, 0.0));
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 3, 4);
+
+    EXPECT_EQ(LaneCrossingDetector{}.find(graph).size(), 1u);
+}
+
+TEST(LaneCrossingDetectorTest, MatchesBruteForceOnRandomGraph) {
+    const auto graph = makeRandomGraph(400, 1200, 17);
+
+    std::vector<LaneGraph::EdgeRecord> lanes;
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        const auto neighbours = graph.neighbours(node);
+        for (std::size_t i = 0; i < neighbours.size(); ++i) {
+            if (node < neighbours.nodes[i]) {
+                lanes.push_back({neighbours.lanes[i], node, neighbours.nodes[i]});
+            }
+        }
+    }
+    std::vector<LaneCrossing> expected;
+    for (std::size_t i = 0; i < lanes.size(); ++i) {
+        for (std::size_t j = i + 1; j < lanes.size(); ++j) {
+            const auto& s = lanes[i];
+            const auto& t = lanes[j];
+            if (s.from == t.from || s.from == t.to || s.to == t.from || s.to == t.to) {
+                continue;
+            }
+            if (crossesByBruteForce(graph.position(s.from), graph.position(s.to),
+                                    graph.position(t.from), graph.position(t.to))) {
+                expected.push_back({std::min(s.lane, t.lane), std::max(s.lane, t.lane)});
+            }
+        }
+    }
+    std::sort(expected.begin(), expected.end(),
+              [](const auto& a, const auto& b) { return std::tie(a.first, a.second) < std::tie(b.first, b.second); });
+
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(LaneCrossingDetector{}.find(graph), expected);
+    // The result must not depend on the grid resolution
+    EXPECT_EQ(LaneCrossingDetector{}.find(graph, 15.0), expected);
+    EXPECT_EQ(LaneCrossingDetector{}.find(graph, 5000.0), expected);
+}
+
+TEST(LaneCrossingDetectorTest, RemovalKeepsBridgeLane) {
+    // The long lane 1 is the only link to system 2, so it survives even though it crosses lane 2
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(20.0, 20.0));
+    graph.addNode(3, Coordinates(0.0, 10.0));
+    graph.addNode(4, Coordinates(10.0, 0.0));
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 3, 4);
+    graph.addEdge(3, 1, 3);
+
+    LaneCrossingDetector detector;
+    const auto crossings = detector.find(graph);
+    ASSERT_EQ(crossings.size(), 1u);
+    EXPECT_TRUE(detector.planRemovals(graph, crossings).empty());
+
+    // With a detour 1 -> 4 -> 2 available, the long lane goes
+    graph.addEdge(4, 1, 4);
+    graph.addEdge(5, 4, 2);
+    EXPECT_EQ(detector.planRemovals(graph, detector.find(graph)), (std::vector<GalaxyCore::utilities::LaneId>{1}));
+}
+
+TEST(LaneCrossingDetectorTest, RemovalPreservesConnectivity) {
+    auto graph = makeRandomGraph(600, 1500, 23);
+    ConnectivityAnalysis before;
+    before.analyze(graph);
+
+    LaneCrossingDetector detector;
+    const auto crossings = detector.find(graph);
+    const auto removals = detector.planRemovals(graph, crossings);
+    ASSERT_FALSE(removals.empty());
+    for (auto lane : removals) {
+        graph.removeEdge(lane);
+    }
+
+    ConnectivityAnalysis after;
+    after.analyze(graph);
+    EXPECT_EQ(after.componentCount(), before.componentCount());
+    EXPECT_LT(detector.find(graph).size(), crossings.size() / 4);
+}
+
+} // namespace ggh::Galaxy::Analysis::models
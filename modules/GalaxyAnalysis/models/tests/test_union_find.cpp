@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyAnalysis/models/UnionFind.h"
+
+namespace ggh::Galaxy::Analysis::models {
+
+TEST(UnionFindTest, StartsAsSingletons) {
+    UnionFind sets(4);
+    EXPECT_EQ(sets.setCount(), 4u);
+    EXPECT_FALSE(sets.connected(0, 1));
+    EXPECT_EQ(sets.setSize(2), 1u);
+}
+
+TEST(UnionFindTest, UniteMergesAndTracksSizes) {
+    UnionFind sets(6);
+    EXPECT_TRUE(sets.unite(0, 1));
+    EXPECT_TRUE(sets.unite(2, 3));
+    EXPECT_TRUE(sets.unite(1, 3));
+    EXPECT_FALSE(sets.unite(0, 2));
+
+    EXPECT_EQ(sets.setCount(), 3u);
+    EXPECT_TRUE(sets.connected(0, 3));
+    EXPECT_EQ(sets.setSize(2), 4u);
+    EXPECT_FALSE(sets.connected(4, 5));
+}
+
+TEST(UnionFindTest, ResetRestoresSingletons) {
+    UnionFind sets(3);
+    sets.unite(0, 2);
+    sets.reset(5);
+    EXPECT_EQ(sets.size(), 5u);
+    EXPECT_EQ(sets.setCount(), 5u);
+    EXPECT_FALSE(sets.connected(0, 2));
+}
+
+} // namespace ggh::Galaxy::Analysis::models
@@ -0,0 +1,157 @@
+/**
+ * @file ConnectivityViewModel.h
+ * @brief ViewModel exposing lane graph connectivity analysis to QML
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#ifndef GGH_MODULES_GALAXYANALYSIS_VIEWMODELS_CONNECTIVITY_VIEW_MODEL_H
+#define GGH_MODULES_GALAXYANALYSIS_VIEWMODELS_CONNECTIVITY_VIEW_MODEL_H
+
+#include <QObject>
+#include <QVariantList>
+#include <QtQml/qqmlregistration.h>
+#include <cstdint>
+#include <memory>
+
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+#include "ggh/modules/GalaxyAnalysis/models/BetweennessCentrality.h"
+#include "ggh/modules/GalaxyAnalysis/models/ConnectivityAnalysis.h"
+
+namespace ggh::Galaxy::Analysis::viewmodels
+{
+
+/**
+ * @class ConnectivityViewModel
+ * @brief Holds the connectivity analysis of the current galaxy for display
+ *
+ * Reports how many disconnected clusters the galaxy has and which lanes (bridges) and
+ * systems (articulation points) are chokepoints whose loss would split the lane network.
+ * Lookups from QML delegates are O(1).
+ *
+ * On request it also computes betweenness centrality and writes the scores onto the galaxy's
+ * star systems and travel lanes, where the list models expose them as the "betweenness" role.
+ * Once the lane graph changes the scores no longer describe it; refresh() resets them to zero.
+ */
+class ConnectivityViewModel : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(int componentCount READ componentCount NOTIFY analysisChanged)
+    Q_PROPERTY(int largestComponentSize READ largestComponentSize NOTIFY analysisChanged)
+    Q_PROPERTY(int bridgeCount READ bridgeCount NOTIFY analysisChanged)
+    Q_PROPERTY(int articulationPointCount READ articulationPointCount NOTIFY analysisChanged)
+    Q_PROPERTY(QVariantList bridgeLaneIds READ bridgeLaneIds NOTIFY analysisChanged)
+    Q_PROPERTY(QVariantList articulationSystemIds READ articulationSystemIds NOTIFY analysisChanged)
+    Q_PROPERTY(bool highlightChokepoints READ highlightChokepoints WRITE setHighlightChokepoints NOTIFY highlightChokepointsChanged)
+    Q_PROPERTY(bool hasCentrality READ hasCentrality NOTIFY centralityChanged)
+    Q_PROPERTY(bool centralityExact READ centralityExact NOTIFY centralityChanged)
+    Q_PROPERTY(double maxSystemBetweenness READ maxSystemBetweenness NOTIFY centralityChanged)
+    Q_PROPERTY(double maxLaneBetweenness READ maxLaneBetweenness NOTIFY centralityChanged)
+    Q_PROPERTY(bool showCentralityHeat READ showCentralityHeat WRITE setShowCentralityHeat NOTIFY showCentralityHeatChanged)
+    QML_ELEMENT
+public:
+    /**
+     * @brief Default constructor
+     * @param parent QObject parent
+     */
+    explicit ConnectivityViewModel(QObject* parent = nullptr);
+
+    /**
+     * @brief Sets the galaxy to analyse and runs the analysis
+     * @param galaxy The galaxy model
+     */
+    void setGalaxy(std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> galaxy);
+
+    int componentCount() const;
+    int largestComponentSize() const;
+    int bridgeCount() const;
+    int articulationPointCount() const;
+    QVariantList bridgeLaneIds() const;
+    QVariantList articulationSystemIds() const;
+    bool highlightChokepoints() const;
+    void setHighlightChokepoints(bool highlight);
+    bool hasCentrality() const;
+    bool centralityExact() const;
+    double maxSystemBetweenness() const;
+    double maxLaneBetweenness() const;
+    bool showCentralityHeat() const;
+    void setShowCentralityHeat(bool show);
+
+    /**
+     * @brief Recomputes the analysis for the current galaxy
+     */
+    Q_INVOKABLE void analyze();
+
+    /**
+     * @brief Brings the results in line with the galaxy's current lane graph after an edit
+     *
+     * Re-runs the analysis if the graph's revision moved on, and drops betweenness scores
+     * computed for an earlier revision.
+     */
+    Q_INVOKABLE void refresh();
+
+    /**
+     * @brief Checks whether removing a travel lane would disconnect part of the galaxy
+     * @param laneId The lane ID
+     * @return True if the lane is a bridge
+     */
+    Q_INVOKABLE bool isBridge(quint32 laneId) const;
+
+    /**
+     * @brief Checks whether removing a star system would disconnect part of the galaxy
+     * @param systemId The system ID
+     * @return True if the system is an articulation point
+     */
+    Q_INVOKABLE bool isArticulationPoint(quint32 systemId) const;
+
+    /**
+     * @brief Gets the cluster a star system belongs to
+     * @param systemId The system ID
+     * @return The component number, or -1 for an unknown system
+     */
+    Q_INVOKABLE int componentOf(quint32 systemId) const;
+
+    /**
+     * @brief Computes betweenness scores and stores them on the galaxy's systems and lanes
+     * @param errorBound 0 for exact scores, otherwise the allowed error of sampled scores
+     * @return True if scores were computed
+     */
+    Q_INVOKABLE bool computeCentrality(double errorBound = 0.0);
+
+signals:
+    /**
+     * @brief Signal emitted when the analysis is recomputed or cleared
+     */
+    void analysisChanged();
+
+    /**
+     * @brief Signal emitted when chokepoint highlighting is toggled
+     */
+    void highlightChokepointsChanged();
+
+    /**
+     * @brief Signal emitted when betweenness scores are written to the galaxy or dropped
+     */
+    void centralityChanged();
+
+    /**
+     * @brief Signal emitted when the traffic heat map is toggled
+     */
+    void showCentralityHeatChanged();
+
+private:
+    /**
+     * @brief Resets the scores written onto the galaxy and forgets the last centrality run
+     */
+    void dropCentrality();
+
+    std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> m_galaxy; ///< The galaxy being analysed
+    ggh::Galaxy::Analysis::models::ConnectivityAnalysis m_analysis; ///< Results for the galaxy's lane graph
+    ggh::Galaxy::Analysis::models::BetweennessCentrality m_centrality; ///< Scores from the last centrality run
+    std::uint64_t m_centralityRevision{0}; ///< Lane graph revision the scores were computed for
+    bool m_highlightChokepoints; ///< Whether the view should highlight bridges and articulation points
+    bool m_showCentralityHeat; ///< Whether the view should colour by betweenness
+};
+}
+
+#endif // !GGH_MODULES_GALAXYANALYSIS_VIEWMODELS_CONNECTIVITY_VIEW_MODEL_H
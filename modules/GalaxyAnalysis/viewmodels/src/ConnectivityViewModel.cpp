@@ -0,0 +1,209 @@
+/**
+ * @file ConnectivityViewModel.cpp
+ * @brief Implementation of ConnectivityViewModel
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#include "ggh/modules/GalaxyAnalysis/viewmodels/ConnectivityViewModel.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+#include <QtLogging>
+
+namespace ggh::Galaxy::Analysis::viewmodels {
+
+ConnectivityViewModel::ConnectivityViewModel(QObject* parent)
+    : QObject(parent)
+    , m_galaxy(nullptr)
+    , m_highlightChokepoints(false)
+    , m_showCentralityHeat(false)
+{
+}
+
+void ConnectivityViewModel::setGalaxy(std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> galaxy)
+{
+    dropCentrality();
+    m_galaxy = std::move(galaxy);
+    analyze();
+}
+
+int ConnectivityViewModel::componentCount() const
+{
+    return static_cast<int>(m_analysis.componentCount());
+}
+
+int ConnectivityViewModel::largestComponentSize() const
+{
+    return static_cast<int>(m_analysis.largestComponentSize());
+}
+
+int ConnectivityViewModel::bridgeCount() const
+{
+    return static_cast<int>(m_analysis.bridges().size());
+}
+
+int ConnectivityViewModel::articulationPointCount() const
+{
+    return static_cast<int>(m_analysis.articulationPoints().size());
+}
+
+QVariantList ConnectivityViewModel::bridgeLaneIds() const
+{
+    QVariantList ids;
+    ids.reserve(static_cast<qsizetype>(m_analysis.bridges().size()));
+    for (auto id : m_analysis.bridges()) {
+        ids.append(QVariant::fromValue<quint32>(id));
+    }
+    return ids;
+}
+
+QVariantList ConnectivityViewModel::articulationSystemIds() const
+{
+    QVariantList ids;
+    ids.reserve(static_cast<qsizetype>(m_analysis.articulationPoints().size()));
+    for (auto id : m_analysis.articulationPoints()) {
+        ids.append(QVariant::fromValue<quint32>(id));
+    }
+    return ids;
+}
+
+bool ConnectivityViewModel::highlightChokepoints() const
+{
+    return m_highlightChokepoints;
+}
+
+void ConnectivityViewModel::setHighlightChokepoints(bool highlight)
+{
+    if (m_highlightChokepoints != highlight) {
+        m_highlightChokepoints = highlight;
+        emit highlightChokepointsChanged();
+    }
+}
+
+bool ConnectivityViewModel::hasCentrality() const
+{
+    return !m_centrality.empty();
+}
+
+bool ConnectivityViewModel::centralityExact() const
+{
+    return m_centrality.isExact();
+}
+
+double ConnectivityViewModel::maxSystemBetweenness() const
+{
+    return m_centrality.maxNodeScore();
+}
+
+double ConnectivityViewModel::maxLaneBetweenness() const
+{
+    return m_centrality.maxLaneScore();
+}
+
+bool ConnectivityViewModel::showCentralityHeat() const
+{
+    return m_showCentralityHeat;
+}
+
+void ConnectivityViewModel::setShowCentralityHeat(bool show)
+{
+    if (m_showCentralityHeat != show) {
+        m_showCentralityHeat = show;
+        emit showCentralityHeatChanged();
+    }
+}
+
+void ConnectivityViewModel::analyze()
+{
+    GGH_TRACE_SCOPE("ConnectivityViewModel::analyze");
+    if (m_galaxy) {
+        m_analysis.analyze(m_galaxy->laneGraph());
+    } else {
+        m_analysis.clear();
+    }
+    emit analysisChanged();
+}
+
+void ConnectivityViewModel::refresh()
+{
+    if (!m_galaxy) {
+        return;
+    }
+    const auto revision = m_galaxy->laneGraph().revision();
+    if (m_analysis.graphRevision() != revision) {
+        analyze();
+    }
+    if (m_centralityRevision != revision) {
+        dropCentrality();
+    }
+}
+
+void ConnectivityViewModel::dropCentrality()
+{
+    if (m_centrality.empty()) {
+        return;
+    }
+    // Scores from another lane graph would keep colouring the list models' betweenness role
+    if (m_galaxy) {
+        for (const auto& system : m_galaxy->getAllStarSystems()) {
+            system->setBetweenness(0.0);
+        }
+        for (const auto& lane : m_galaxy->getAllTravelLanes()) {
+            lane->setBetweenness(0.0);
+        }
+    }
+    m_centrality.clear();
+    emit centralityChanged();
+}
+
+bool ConnectivityViewModel::isBridge(quint32 laneId) const
+{
+    return m_analysis.isBridge(laneId);
+}
+
+bool ConnectivityViewModel::isArticulationPoint(quint32 systemId) const
+{
+    return m_analysis.isArticulationPoint(systemId);
+}
+
+int ConnectivityViewModel::componentOf(quint32 systemId) const
+{
+    if (!m_galaxy) {
+        return -1;
+    }
+    const auto node = m_galaxy->laneGraph().indexOf(systemId);
+    if (node == ggh::GalaxyCore::models::LaneGraph::INVALID_NODE) {
+        return -1;
+    }
+    return static_cast<int>(m_analysis.componentOf(node));
+}
+
+bool ConnectivityViewModel::computeCentrality(double errorBound)
+{
+    GGH_TRACE_SCOPE("ConnectivityViewModel::computeCentrality");
+    if (!m_galaxy) {
+        qWarning("ConnectivityViewModel::computeCentrality: no galaxy set");
+        return false;
+    }
+
+    const auto& graph = m_galaxy->laneGraph();
+    ggh::Galaxy::Analysis::models::CentralityOptions options;
+    options.errorBound = errorBound;
+    if (!m_centrality.compute(graph, options)) {
+        emit centralityChanged();
+        return false;
+    }
+    m_centralityRevision = graph.revision();
+
+    for (ggh::Galaxy::Analysis::models::BetweennessCentrality::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        if (auto system = m_galaxy->getStarSystem(graph.systemId(node))) {
+            system->setBetweenness(m_centrality.nodeScore(node));
+        }
+    }
+    for (const auto& lane : m_galaxy->getAllTravelLanes()) {
+        lane->setBetweenness(m_centrality.laneScore(lane->getId()));
+    }
+    emit centralityChanged();
+    return true;
+}
+
+} // namespace ggh::Galaxy::Analysis::viewmodels
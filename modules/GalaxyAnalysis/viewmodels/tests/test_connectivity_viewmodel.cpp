@@ -0,0 +1,170 @@
+/**
+ * @file test_connectivity_viewmodel.cpp
+ * @brief Unit tests for ConnectivityViewModel
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#include <QtTest/QtTest>
+#include <QSignalSpy>
+
+#include "ggh/modules/GalaxyAnalysis/viewmodels/ConnectivityViewModel.h"
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+
+using ggh::Galaxy::Analysis::viewmodels::ConnectivityViewModel;
+
+class TestConnectivityViewModel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    /**
+     * @brief Test that setting a galaxy reports its clusters and chokepoints
+     */
+    void testAnalysis();
+
+    /**
+     * @brief Test that re-analysing picks up lane changes
+     */
+    void testReanalyzeAfterChange();
+
+    /**
+     * @brief Test toggling chokepoint highlighting
+     */
+    void testHighlightChokepoints();
+
+    /**
+     * @brief Test that lookups without a galaxy fail gracefully
+     */
+    void testWithoutGalaxy();
+
+    /**
+     * @brief Test that centrality scores are written onto systems and lanes
+     */
+    void testComputeCentrality();
+
+    /**
+     * @brief Test that refreshing after a lane edit re-analyses and drops stale centrality scores
+     */
+    void testRefreshAfterLaneEdit();
+
+private:
+    std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> m_galaxy;
+};
+
+void TestConnectivityViewModel::init()
+{
+    using Coordinates = ggh::GalaxyCore::utilities::CartesianCoordinates<double>;
+    // Chain 1-2-3 plus an isolated system 4
+    m_galaxy = std::make_shared<ggh::GalaxyCore::models::GalaxyModel>(100, 100);
+    m_galaxy->addStarSystem(1, "Alpha", Coordinates(0.0, 0.0));
+    m_galaxy->addStarSystem(2, "Beta", Coordinates(10.0, 0.0));
+    m_galaxy->addStarSystem(3, "Gamma", Coordinates(20.0, 0.0));
+    m_galaxy->addStarSystem(4, "Delta", Coordinates(90.0, 90.0));
+    m_galaxy->addTravelLane(10, 1, 2);
+    m_galaxy->addTravelLane(11, 2, 3);
+}
+
+void TestConnectivityViewModel::testAnalysis()
+{
+    ConnectivityViewModel viewModel;
+    QSignalSpy analysisSpy(&viewModel, &ConnectivityViewModel::analysisChanged);
+    viewModel.setGalaxy(m_galaxy);
+
+    QCOMPARE(analysisSpy.count(), 1);
+    QCOMPARE(viewModel.componentCount(), 2);
+    QCOMPARE(viewModel.largestComponentSize(), 3);
+    QCOMPARE(viewModel.bridgeCount(), 2);
+    QCOMPARE(viewModel.articulationPointCount(), 1);
+    QVERIFY(viewModel.isBridge(10));
+    QVERIFY(viewModel.isArticulationPoint(2));
+    QVERIFY(!viewModel.isArticulationPoint(1));
+    QCOMPARE(viewModel.componentOf(1), viewModel.componentOf(3));
+    QVERIFY(viewModel.componentOf(1) != viewModel.componentOf(4));
+}
+
+void TestConnectivityViewModel::testReanalyzeAfterChange()
+{
+    ConnectivityViewModel viewModel;
+    viewModel.setGalaxy(m_galaxy);
+
+    m_galaxy->addTravelLane(12, 3, 1);
+    m_galaxy->addTravelLane(13, 3, 4);
+    viewModel.analyze();
+
+    QCOMPARE(viewModel.componentCount(), 1);
+    QVERIFY(!viewModel.isBridge(10));
+    QVERIFY(viewModel.isBridge(13));
+    QCOMPARE(viewModel.articulationSystemIds(), (QVariantList{3u}));
+}
+
+void TestConnectivityViewModel::testHighlightChokepoints()
+{
+    ConnectivityViewModel viewModel;
+    QSignalSpy highlightSpy(&viewModel, &ConnectivityViewModel::highlightChokepointsChanged);
+
+    viewModel.setHighlightChokepoints(true);
+    viewModel.setHighlightChokepoints(true);
+    QVERIFY(viewModel.highlightChokepoints());
+    QCOMPARE(highlightSpy.count(), 1);
+}
+
+void TestConnectivityViewModel::testWithoutGalaxy()
+{
+    ConnectivityViewModel viewModel;
+    viewModel.analyze();
+    QCOMPARE(viewModel.componentCount(), 0);
+    QCOMPARE(viewModel.componentOf(1), -1);
+    QVERIFY(!viewModel.isBridge(10));
+}
+
+void TestConnectivityViewModel::testComputeCentrality()
+{
+    ConnectivityViewModel viewModel;
+    viewModel.setGalaxy(m_galaxy);
+    QSignalSpy centralitySpy(&viewModel, &ConnectivityViewModel::centralityChanged);
+
+    QVERIFY(viewModel.computeCentrality());
+    QCOMPARE(centralitySpy.count(), 1);
+    QVERIFY(viewModel.hasCentrality());
+    QVERIFY(viewModel.centralityExact());
+
+    // Beta sits between Alpha and Gamma: one of the three pairs that avoid it
+    QCOMPARE(m_galaxy->getStarSystem(2)->getBetweenness(), 1.0 / 3.0);
+    QCOMPARE(m_galaxy->getStarSystem(1)->getBetweenness(), 0.0);
+    QCOMPARE(viewModel.maxSystemBetweenness(), 1.0 / 3.0);
+    QVERIFY(m_galaxy->getTravelLane(10)->getBetweenness() > 0.0);
+
+    viewModel.setGalaxy(m_galaxy);
+    QVERIFY(!viewModel.hasCentrality());
+}
+
+void TestConnectivityViewModel::testRefreshAfterLaneEdit()
+{
+    ConnectivityViewModel viewModel;
+    viewModel.setGalaxy(m_galaxy);
+    QVERIFY(viewModel.computeCentrality());
+    QSignalSpy analysisSpy(&viewModel, &ConnectivityViewModel::analysisChanged);
+    QSignalSpy centralitySpy(&viewModel, &ConnectivityViewModel::centralityChanged);
+
+    // Nothing changed yet
+    viewModel.refresh();
+    QCOMPARE(analysisSpy.count(), 0);
+    QCOMPARE(centralitySpy.count(), 0);
+    QVERIFY(viewModel.hasCentrality());
+
+    m_galaxy->addTravelLane(12, 3, 1);
+    viewModel.refresh();
+
+    QCOMPARE(analysisSpy.count(), 1);
+    QVERIFY(!viewModel.isBridge(10));
+    QCOMPARE(centralitySpy.count(), 1);
+    QVERIFY(!viewModel.hasCentrality());
+    QCOMPARE(m_galaxy->getStarSystem(2)->getBetweenness(), 0.0);
+    QCOMPARE(m_galaxy->getTravelLane(10)->getBetweenness(), 0.0);
+}
+
+QTEST_MAIN(TestConnectivityViewModel)
+#include "test_connectivity_viewmodel.moc"
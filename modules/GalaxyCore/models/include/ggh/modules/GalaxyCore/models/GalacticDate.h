@@ -1,6 +1,7 @@
 #ifndef GGH_GALAXYCORE_MODELS_GALACTIC_DATE_H
 #define GGH_GALAXYCORE_MODELS_GALACTIC_DATE_H
 
+#include <cstdint>
 #include <string>
 
 namespace ggh::GalaxyCore::models {
@@ -10,6 +11,12 @@ namespace ggh::GalaxyCore::models {
  */
 class GalacticDate {
 public:
+    using DayNumber = std::int32_t;   ///< Days since 0-01-01 in the 12 x 30-day calendar operator+= uses
+
+    static constexpr int DAYS_PER_MONTH = 30;
+    static constexpr int MONTHS_PER_YEAR = 12;
+    static constexpr int DAYS_PER_YEAR = DAYS_PER_MONTH * MONTHS_PER_YEAR;
+
     GalacticDate(int year, int month, int day, std::string_view date_postfix = "G") 
         : m_year(year), m_month(month), m_day(day), m_date_postfix(date_postfix) {}
 
@@ -53,8 +60,29 @@ public:
         return GalacticDate(year, month, day, postfix);
     }
 
+    /**
+     * @brief Compact, totally ordered day count for indexing and comparing dates.
+     */
+    DayNumber toDayNumber() const noexcept {
+        return m_year * DAYS_PER_YEAR + (m_month - 1) * DAYS_PER_MONTH + (m_day - 1);
+    }
+
+    static GalacticDate fromDayNumber(DayNumber dayNumber, std::string_view date_postfix = "G") {
+        // Floor division so days before year 0 still map to months 1-12 and days 1-30
+        DayNumber year = dayNumber / DAYS_PER_YEAR;
+        DayNumber dayOfYear = dayNumber % DAYS_PER_YEAR;
+        if (dayOfYear < 0) {
+            dayOfYear += DAYS_PER_YEAR;
+            --year;
+        }
+        return GalacticDate(year, dayOfYear / DAYS_PER_MONTH + 1, dayOfYear % DAYS_PER_MONTH + 1, date_postfix);
+    }
+
+    /**
+     * @brief Days between two dates, counted in the same 12 x 30-day calendar as operator+=
+     */
     int operator-(const GalacticDate& other) const {
-        return (m_year - other.m_year) * 365 + (m_month - other.m_month) * 30 + (m_day - other.m_day);
+        return toDayNumber() - other.toDayNumber();
     }
 
     GalacticDate& operator+=(int days) {
@@ -0,0 +1,114 @@
+#ifndef GGH_GALAXYCORE_MODELS_GALAXY_ARENA_H
+#define GGH_GALAXYCORE_MODELS_GALAXY_ARENA_H
+
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+/**
+ * @file GalaxyArena.h
+ * @brief Memory that one galaxy's star systems, planets, lanes and hash nodes are carved from.
+ *
+ * A std::pmr::monotonic_buffer_resource takes memory from the heap in growing chunks and only gives
+ * it back all at once; a std::pmr::synchronized_pool_resource on top hands out blocks by size class
+ * and recycles the ones freed while the galaxy is edited. Building a galaxy is then mostly bump
+ * allocation, and dropping it returns a handful of chunks instead of one block per object.
+ *
+ * Objects allocated through an Allocator keep the arena alive, so systems a viewmodel still holds
+ * after the galaxy is gone stay valid; the chunks are released with the last of them.
+ */
+namespace ggh::GalaxyCore::models
+{
+class GalaxyArena {
+public:
+    /**
+     * @brief Allocator drawing from an arena and sharing its ownership, for std::allocate_shared.
+     */
+    template <typename T>
+    class Allocator {
+    public:
+        using value_type = T;
+
+        explicit Allocator(std::shared_ptr<GalaxyArena> arena) noexcept : m_arena(std::move(arena)) {}
+        template <typename U>
+        Allocator(const Allocator<U>& other) noexcept : m_arena(other.m_arena) {}
+
+        T* allocate(std::size_t count) {
+            return static_cast<T*>(m_arena->resource()->allocate(count * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* pointer, std::size_t count) noexcept {
+            m_arena->resource()->deallocate(pointer, count * sizeof(T), alignof(T));
+        }
+
+        template <typename U>
+        bool operator==(const Allocator<U>& other) const noexcept { return m_arena == other.m_arena; }
+
+    private:
+        template <typename U>
+        friend class Allocator;
+
+        std::shared_ptr<GalaxyArena> m_arena;
+    };
+
+    /**
+     * @param initialBytes Size of the first chunk taken from the heap; later chunks grow geometrically.
+     */
+    explicit GalaxyArena(std::size_t initialBytes = 64 * 1024);
+
+    GalaxyArena(const GalaxyArena&) = delete;
+    GalaxyArena& operator=(const GalaxyArena&) = delete;
+
+    /**
+     * @brief The pool, for std::pmr containers; safe to use from several threads.
+     */
+    std::pmr::memory_resource* resource() noexcept { return &m_pool; }
+
+    /**
+     * @brief Bytes taken from the heap so far, in use or not.
+     */
+    std::size_t bytesReserved() const noexcept { return m_upstream.bytes(); }
+
+private:
+    // Counts what the monotonic buffer takes from the heap
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        std::size_t bytes() const noexcept { return m_bytes; }
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        std::size_t m_bytes{0};
+    };
+
+    CountingResource m_upstream;
+    std::pmr::monotonic_buffer_resource m_monotonic;
+    std::pmr::synchronized_pool_resource m_pool;
+};
+
+/**
+ * @brief std::allocate_shared from an arena, or std::make_shared without one.
+ */
+template <typename T, typename... Args>
+std::shared_ptr<T> allocateShared(const std::shared_ptr<GalaxyArena>& arena, Args&&... args) {
+    if (!arena) {
+        return std::make_shared<T>(std::forward<Args>(args)...);
+    }
+    return std::allocate_shared<T>(GalaxyArena::Allocator<T>(arena), std::forward<Args>(args)...);
+}
+
+/**
+ * @brief Approximate control block bytes of an object made by allocateShared with this arena.
+ *
+ * std::allocate_shared keeps a copy of the allocator in the control block, and ours holds the arena.
+ */
+inline std::size_t sharedControlBlockBytes(const std::shared_ptr<GalaxyArena>& arena) noexcept {
+    return utilities::memory::SHARED_CONTROL_BLOCK_BYTES + (arena ? sizeof(GalaxyArena::Allocator<std::byte>) : 0);
+}
+} // namespace ggh::GalaxyCore::models
+
+#endif // !GGH_GALAXYCORE_MODELS_GALAXY_ARENA_H
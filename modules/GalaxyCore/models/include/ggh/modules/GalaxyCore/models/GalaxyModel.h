@@ -2,9 +2,17 @@
 #define GGH_GALAXYCORE_MODELS_GALAXY_MODEL_H
 
 #include <memory>
+#include <memory_resource>
+#include <string_view>
+#include <unordered_map>
 
 #include "ggh/modules/GalaxyCore/utilities/Common.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyCore/models/GalaxyArena.h"
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+#include "ggh/modules/GalaxyCore/models/PlanetCatalogue.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
+#include "ggh/modules/GalaxyCore/models/SystemNameIndex.h"
 #include "ggh/modules/GalaxyCore/models/TravelLaneModel.h"
 /**
  * @file GalaxyModel.h
@@ -12,6 +20,9 @@
  *
  * This file defines the GalaxyModel class, which encapsulates the properties and behaviors of a galaxy,
  * including its star systems and travel lanes.
+ *
+ * A galaxy built with a GalaxyArena allocates its hash nodes from it, as well as the systems made
+ * by makeStarSystem(), their planets and the lanes it creates itself.
  */ 
 namespace ggh::GalaxyCore::models
 {
@@ -21,8 +32,14 @@ public:
      * @brief Constructs a GalaxyModel with the specified width and height.
      * @param width The width of the galaxy.
      * @param height The height of the galaxy.
+     * @param arena Memory for the galaxy's objects; without one they come from the heap.
      */
-    GalaxyModel(int width, int height);
+    GalaxyModel(int width, int height, std::shared_ptr<GalaxyArena> arena = nullptr);
+
+    // Star systems point back at the galaxy's name index, so a galaxy stays where it was built
+    GalaxyModel(const GalaxyModel&) = delete;
+    GalaxyModel& operator=(const GalaxyModel&) = delete;
+    ~GalaxyModel();
 
     // Getters
     int getWidth() const noexcept;
@@ -32,11 +49,29 @@ public:
     void setWidth(int width);
     void setHeight(int height);
 
+    /**
+     * @brief Gets the arena the galaxy allocates from, nullptr if it uses the heap.
+     */
+    const std::shared_ptr<GalaxyArena>& arena() const noexcept;
+
+    /**
+     * @brief Creates a star system, from the galaxy's arena if it has one, without adding it.
+     *
+     * Planets later added to the system come from the same arena.
+     */
+    std::shared_ptr<StarSystemModel> makeStarSystem(SystemId id, std::string_view name,
+                                                    const utilities::CartesianCoordinates<double>& position,
+                                                    StarType type = StarType::YellowStar) const;
+
+    /// Whether addStarSystem indexes the system's name now or leaves it to rebuildNameIndex()
+    enum class NameIndexing { Immediate, Deferred };
+
     /**
      * @brief Adds a star system to the galaxy.
      * @param system The star system to add.
+     * @param indexing Deferred for bulk loads, which call rebuildNameIndex() once all systems are in.
      */
-    void addStarSystem(std::shared_ptr<StarSystemModel>&& system);
+    void addStarSystem(std::shared_ptr<StarSystemModel>&& system, NameIndexing indexing = NameIndexing::Immediate);
 
     /**
      * @brief Adds a star system with the given ID, name, position, and type.
@@ -55,7 +90,7 @@ public:
     std::shared_ptr<StarSystemModel> getStarSystem(SystemId id) const;
 
     /**
-     * @brief Removes a star system by its ID.
+     * @brief Removes a star system by its ID, together with every travel lane touching it.
      * @param id The unique identifier of the star system to remove.
      * @return True if the system was removed, false if it was not found.
      */
@@ -67,6 +102,31 @@ public:
      */
     std::vector<std::shared_ptr<StarSystemModel>> getAllStarSystems() const;
 
+    /**
+     * @brief Finds a star system by its exact name in O(log N).
+     * @param name The name, compared case-sensitively.
+     * @return The system with the lowest ID carrying the name, nullptr if there is none.
+     */
+    std::shared_ptr<StarSystemModel> findStarSystemByName(std::string_view name) const;
+
+    /**
+     * @brief Gets the case-insensitive name index over the star systems, kept in sync on add, remove and rename.
+     */
+    const SystemNameIndex& nameIndex() const noexcept;
+
+    /**
+     * @brief Rebuilds the name index from every star system's name in O(N log N).
+     */
+    void rebuildNameIndex();
+
+    /**
+     * @brief Moves a star system and refreshes the cached lengths of its lanes.
+     * @param id The unique identifier of the star system.
+     * @param position The new position.
+     * @return True if the system exists.
+     */
+    bool setStarSystemPosition(SystemId id, const utilities::CartesianCoordinates<double>& position);
+
     /**
      * @brief Adds a travel lane to the galaxy.
      * @param lane The travel lane to add.
@@ -103,12 +163,49 @@ public:
      */
     std::vector<std::shared_ptr<TravelLaneModel>> getAllTravelLanes() const;
 
+    /**
+     * @brief Gets the travel lanes touching a star system, in O(degree).
+     * @param systemId The unique identifier of the star system.
+     * @return The lanes connected to the system; empty if it is unknown.
+     */
+    std::vector<std::shared_ptr<TravelLaneModel>> lanesOf(SystemId systemId) const;
+
+    /**
+     * @brief Gets the adjacency index over star systems and travel lanes.
+     */
+    const LaneGraph& laneGraph() const noexcept;
+
+    /**
+     * @brief Rebuilds the adjacency index from scratch in O(N + E), dropping any slack.
+     */
+    void rebuildLaneGraph();
+
+    /**
+     * @brief Gets the columnar planet catalogue as of the last rebuildPlanetCatalogue() call.
+     */
+    const PlanetCatalogue& planetCatalogue() const noexcept;
+
+    /**
+     * @brief Rebuilds the planet catalogue from every star system's planets, in parallel.
+     * @param threadCount Worker threads; 0 uses the hardware concurrency.
+     */
+    void rebuildPlanetCatalogue(unsigned threadCount = 0);
+
     /**
      * @brief Converts the galaxy model to an XML representation.
      * @return A string containing the XML representation of the galaxy.
      */
     std::string toXml() const;
 
+    /**
+     * @brief Adds the bytes owned by this galaxy, its star systems and travel lanes to a memory report.
+     *
+     * Name strings, shared_ptr control blocks and the id hash tables go to their own
+     * "galaxy.names", "galaxy.sharedControlBlocks" and "galaxy.hashBuckets" categories.
+     * @param report The report to accumulate into.
+     */
+    void reportMemory(utilities::MemoryReport& report) const;
+
     /**
      * @brief Gets the XML tag name for the galaxy model.
      * @return A string containing the XML tag name.
@@ -120,8 +217,12 @@ public:
  private:
     int m_width;  ///< Width of the galaxy
     int m_height; ///< Height of the galaxy
-    std::unordered_map<utilities::SystemId, std::shared_ptr<StarSystemModel>> m_starSystems{}; ///< Map of star systems by their unique IDs
-    std::unordered_map<utilities::LaneId, std::shared_ptr<TravelLaneModel>> m_travelLanes{}; ///< Map of travel lanes by their unique IDs
+    std::shared_ptr<GalaxyArena> m_arena; ///< Declared before the maps, whose nodes may live in it
+    std::pmr::unordered_map<utilities::SystemId, std::shared_ptr<StarSystemModel>> m_starSystems; ///< Map of star systems by their unique IDs
+    std::pmr::unordered_map<utilities::LaneId, std::shared_ptr<TravelLaneModel>> m_travelLanes; ///< Map of travel lanes by their unique IDs
+    LaneGraph m_laneGraph{}; ///< Adjacency index kept in sync with the two maps above
+    SystemNameIndex m_nameIndex{}; ///< Star systems by name, kept in sync with m_starSystems
+    PlanetCatalogue m_planetCatalogue{}; ///< Snapshot of every planet, refreshed on demand
 
     // Additional properties and methods can be added as needed
     // For example, methods to manage travel lanes, serialize to XML, etc.
@@ -0,0 +1,87 @@
+#ifndef GGH_GALAXYCORE_MODELS_GALAXY_SPATIAL_INDEX_H
+#define GGH_GALAXYCORE_MODELS_GALAXY_SPATIAL_INDEX_H
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyCore/utilities/SpatialGrid.h"
+
+/**
+ * @file GalaxySpatialIndex.h
+ * @brief Point and lane hit-testing over a galaxy's lane graph.
+ *
+ * Systems are bucketed by position in a SpatialGrid. Lanes are bucketed by sample points spaced
+ * at most one sample step apart along each lane, so every point of a lane lies within half a step
+ * of one of its samples; a nearest-lane query only has to look at samples within the pick radius
+ * plus half a step. Clicks, hovers and rubber-band rectangles therefore touch a handful of grid
+ * cells instead of every system.
+ *
+ * The index is bound to the graph it was built from and goes stale when the graph's revision
+ * changes; owners check isValidFor() and rebuild.
+ */
+namespace ggh::GalaxyCore::models
+{
+class GalaxySpatialIndex {
+public:
+    static constexpr utilities::SystemId NO_SYSTEM = 0;
+    static constexpr utilities::LaneId NO_LANE = 0;
+
+    /**
+     * @brief Rebuilds the index from the graph's node positions and lanes in O(N + E).
+     */
+    void build(const LaneGraph& graph);
+
+    /**
+     * @brief True if the index was built from this graph and the graph has not changed since.
+     */
+    bool isValidFor(const LaneGraph& graph) const noexcept;
+
+    void clear();
+
+    /**
+     * @brief The system closest to a point, if it is within the radius.
+     * @return Its id, or NO_SYSTEM; ties go to the system inserted first.
+     */
+    utilities::SystemId systemAt(double x, double y, double radius) const;
+
+    /**
+     * @brief Every system inside an axis-aligned rectangle; corners may be given in any order.
+     * @param systems Receives the system ids in graph node order.
+     */
+    void systemsInRect(double x1, double y1, double x2, double y2, std::vector<utilities::SystemId>& systems) const;
+
+    /**
+     * @brief The lane whose segment passes closest to a point, within a pick radius.
+     * @param distance If given, receives the point's distance to the lane.
+     * @return Its id, or NO_LANE; ties go to the lower lane id.
+     */
+    utilities::LaneId nearestLane(double x, double y, double maxDistance, double* distance = nullptr) const;
+
+    std::size_t systemCount() const noexcept { return m_systems.size(); }
+    std::size_t laneCount() const noexcept { return m_lanes.size(); }
+
+    void reportMemory(utilities::MemoryReport& report) const;
+
+private:
+    struct Lane {
+        utilities::LaneId id;
+        LaneGraph::NodeIndex from;
+        LaneGraph::NodeIndex to;
+    };
+
+    const LaneGraph* m_graph{nullptr};
+    std::uint64_t m_revision{0};
+    std::vector<utilities::SystemId> m_systems;           ///< System id per graph node
+    std::vector<utilities::CartesianCoordinates<double>> m_positions;
+    utilities::SpatialGrid m_systemGrid;
+    std::vector<Lane> m_lanes;
+    std::vector<std::uint32_t> m_sampleLanes;             ///< Lane index of each sample in m_laneGrid
+    utilities::SpatialGrid m_laneGrid;
+    double m_sampleStep{0.0};
+};
+} // namespace ggh::GalaxyCore::models
+
+#endif // !GGH_GALAXYCORE_MODELS_GALAXY_SPATIAL_INDEX_H
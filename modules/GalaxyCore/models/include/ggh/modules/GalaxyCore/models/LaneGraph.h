@@ -0,0 +1,149 @@
+#ifndef GGH_GALAXYCORE_MODELS_LANE_GRAPH_H
+#define GGH_GALAXYCORE_MODELS_LANE_GRAPH_H
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/utilities/Common.h"
+#include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+
+/**
+ * @file LaneGraph.h
+ * @brief Compressed-sparse-row adjacency index over star systems and travel lanes.
+ *
+ * Systems are mapped to dense node indices; each node owns a contiguous block of half-edges
+ * (neighbour node, lane id, cached lane length) inside shared edge arrays. Blocks carry a little
+ * slack so lanes can be added and removed in O(degree); when too much space is wasted the arrays
+ * are compacted in O(N + E). Every lane appears once in the block of each of its endpoints.
+ */
+namespace ggh::GalaxyCore::models
+{
+class LaneGraph {
+public:
+    using NodeIndex = std::uint32_t;
+    static constexpr NodeIndex INVALID_NODE = std::numeric_limits<NodeIndex>::max();
+
+    /**
+     * @brief Half-edges leaving one node, as parallel spans into the edge arrays.
+     */
+    struct Neighbours {
+        std::span<const NodeIndex> nodes;          ///< Neighbour node indices
+        std::span<const utilities::LaneId> lanes;  ///< Lane connecting to each neighbour
+        std::span<const double> lengths;           ///< Cached length of each lane
+
+        std::size_t size() const noexcept { return nodes.size(); }
+    };
+
+    struct NodeRecord {
+        utilities::SystemId id;
+        utilities::CartesianCoordinates<double> position;
+    };
+
+    struct EdgeRecord {
+        utilities::LaneId lane;
+        utilities::SystemId from;
+        utilities::SystemId to;
+    };
+
+    /**
+     * @brief Replaces the graph with the given systems and lanes in O(N + E), without slack.
+     *
+     * Lanes with unknown or equal endpoints and duplicate lane ids are skipped.
+     */
+    void build(std::span<const NodeRecord> nodes, std::span<const EdgeRecord> edges);
+
+    /**
+     * @brief Adds a node for a system, or updates its position if it already exists.
+     * @return The dense index of the node.
+     */
+    NodeIndex addNode(utilities::SystemId id, const utilities::CartesianCoordinates<double>& position);
+
+    /**
+     * @brief Removes a system's node together with all lanes touching it.
+     * @return The ids of the lanes that were removed.
+     */
+    std::vector<utilities::LaneId> removeNode(utilities::SystemId id);
+
+    /**
+     * @brief Adds an undirected lane between two existing, distinct nodes.
+     * @return False if either system is unknown, the endpoints are equal, or the lane id is in use.
+     */
+    bool addEdge(utilities::LaneId lane, utilities::SystemId from, utilities::SystemId to);
+
+    /**
+     * @brief Removes a lane from both endpoint blocks.
+     * @return False if the lane is unknown.
+     */
+    bool removeEdge(utilities::LaneId lane);
+
+    /**
+     * @brief Moves a node and refreshes the cached lengths of its lanes.
+     * @return False if the system is unknown.
+     */
+    bool setPosition(utilities::SystemId id, const utilities::CartesianCoordinates<double>& position);
+
+    /**
+     * @brief Rewrites the edge arrays without slack, in O(N + E).
+     */
+    void compact();
+
+    void clear();
+
+    // Queries
+    std::size_t nodeCount() const noexcept { return m_systemIds.size(); }
+    std::size_t edgeCount() const noexcept { return m_endpoints.size(); }
+    NodeIndex indexOf(utilities::SystemId id) const;
+    utilities::SystemId systemId(NodeIndex node) const { return m_systemIds[node]; }
+    const utilities::CartesianCoordinates<double>& position(NodeIndex node) const { return m_positions[node]; }
+    std::size_t degree(NodeIndex node) const { return m_degrees[node]; }
+    Neighbours neighbours(NodeIndex node) const;
+
+    /**
+     * @brief Lane ids touching a system, in O(1); empty if the system is unknown.
+     */
+    std::span<const utilities::LaneId> lanesOf(utilities::SystemId id) const;
+
+    /**
+     * @brief Endpoints of a lane, or {0, 0} if the lane is unknown.
+     */
+    std::pair<utilities::SystemId, utilities::SystemId> endpoints(utilities::LaneId lane) const;
+
+    bool containsLane(utilities::LaneId lane) const { return m_endpoints.contains(lane); }
+
+    /**
+     * @brief Counter bumped on every structural or length change; lets caches detect staleness.
+     */
+    std::uint64_t revision() const noexcept { return m_revision; }
+
+    void reportMemory(utilities::MemoryReport& report) const;
+
+private:
+    void appendHalfEdge(NodeIndex from, NodeIndex to, utilities::LaneId lane, double length);
+    void removeHalfEdge(NodeIndex from, utilities::LaneId lane);
+    void setHalfEdgeLength(NodeIndex from, utilities::LaneId lane, double length);
+    void compactIfWasteful();
+
+    // Per node
+    std::vector<std::uint32_t> m_offsets;      ///< Start of the node's block in the edge arrays
+    std::vector<std::uint32_t> m_degrees;      ///< Used entries in the block
+    std::vector<std::uint32_t> m_capacities;   ///< Allocated entries in the block
+    std::vector<utilities::SystemId> m_systemIds;
+    std::vector<utilities::CartesianCoordinates<double>> m_positions;
+    std::unordered_map<utilities::SystemId, NodeIndex> m_indexOf;
+
+    // Per half-edge slot
+    std::vector<NodeIndex> m_targets;
+    std::vector<utilities::LaneId> m_laneIds;
+    std::vector<double> m_lengths;
+
+    std::unordered_map<utilities::LaneId, std::pair<utilities::SystemId, utilities::SystemId>> m_endpoints;
+    std::uint64_t m_revision{0};
+};
+} // namespace ggh::GalaxyCore::models
+
+#endif // !GGH_GALAXYCORE_MODELS_LANE_GRAPH_H
@@ -0,0 +1,121 @@
+#ifndef GGH_GALAXYCORE_MODELS_PLANET_CATALOGUE_H
+#define GGH_GALAXYCORE_MODELS_PLANET_CATALOGUE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/PlanetModel.h"
+#include "ggh/modules/GalaxyCore/utilities/Common.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+
+/**
+ * @file PlanetCatalogue.h
+ * @brief Galaxy-wide columnar copy of every planet, for questions across all star systems.
+ *
+ * Each planet attribute lives in its own contiguous array indexed by row, with the owning system
+ * and the planet's position in that system's planet list as the back-reference. Rows are grouped
+ * by system in ascending id order, planets in their system's order. On top of the columns sit:
+ *
+ * - one bitmap per PlanetType, one bit per row
+ * - per numeric column, the values in ascending order with their rows, so a range is two binary searches
+ *
+ * A query ANDs a type mask with inclusive ranges: it walks whichever is narrower, the rows of the
+ * selected types or the narrowest range's slice, and checks the rest on the columns.
+ *
+ * The catalogue is a snapshot; GalaxyModel::rebuildPlanetCatalogue() refreshes it after
+ * generation or import.
+ */
+namespace ggh::GalaxyCore::models
+{
+class GalaxyModel;
+
+class PlanetCatalogue {
+public:
+    using Row = std::uint32_t;
+
+    enum class Column { Size, Mass, Moons, OrbitalRadius, MinTemperature, MaxTemperature };
+    static constexpr std::size_t COLUMN_COUNT = 6;
+    static constexpr std::size_t PLANET_TYPE_COUNT = 8;
+    static constexpr std::uint32_t ALL_TYPES = (std::uint32_t{1} << PLANET_TYPE_COUNT) - 1;
+
+    /**
+     * @brief Inclusive bounds on one column; an unset side is unbounded.
+     */
+    struct Range {
+        Column column;
+        double min{-std::numeric_limits<double>::infinity()};
+        double max{std::numeric_limits<double>::infinity()};
+    };
+
+    struct Query {
+        std::uint32_t typeMask{ALL_TYPES};   ///< Bit per PlanetType value
+        std::vector<Range> ranges;
+    };
+
+    /**
+     * @brief Copies every planet of the galaxy into the columns and builds the indices.
+     * @param threadCount Worker threads; 0 uses the hardware concurrency.
+     */
+    void build(const GalaxyModel& galaxy, unsigned threadCount = 0);
+
+    void clear();
+
+    std::size_t size() const noexcept { return m_types.size(); }
+    bool empty() const noexcept { return m_types.empty(); }
+
+    // Columns
+    PlanetType type(Row row) const noexcept { return static_cast<PlanetType>(m_types[row]); }
+    double value(Column column, Row row) const noexcept;
+    utilities::SystemId systemOf(Row row) const noexcept { return m_systems[row]; }
+    std::uint32_t planetIndexOf(Row row) const noexcept { return m_planetIndices[row]; }
+
+    /**
+     * @brief One bit per row, set where the planet has the given type.
+     */
+    std::span<const std::uint64_t> typeBitmap(PlanetType type) const noexcept;
+    std::size_t countOfType(PlanetType type) const noexcept;
+
+    /**
+     * @brief Rows whose value in a column lies in [min, max], in ascending value order, in O(log N).
+     */
+    std::span<const Row> rowsInRange(Column column, double min, double max) const;
+
+    /**
+     * @brief Rows matching every condition of a query, in ascending row order.
+     */
+    std::vector<Row> find(const Query& query) const;
+
+    void reportMemory(utilities::MemoryReport& report) const;
+
+private:
+    // A column's values in ascending order, with the row each came from
+    struct SortedColumn {
+        std::vector<double> values;
+        std::vector<Row> rows;
+    };
+
+    const std::vector<double>& column(Column column) const noexcept;
+    bool inRanges(Row row, const std::vector<Range>& ranges) const noexcept;
+    static std::size_t wordCount(std::size_t rows) noexcept { return (rows + 63) / 64; }
+
+    std::vector<std::uint8_t> m_types;
+    std::vector<double> m_sizes;
+    std::vector<double> m_masses;
+    std::vector<double> m_moons;   ///< Stored as double so every column ranges the same way
+    std::vector<double> m_orbitalRadii;
+    std::vector<double> m_minTemperatures;
+    std::vector<double> m_maxTemperatures;
+    std::vector<utilities::SystemId> m_systems;
+    std::vector<std::uint32_t> m_planetIndices;
+
+    std::array<std::vector<std::uint64_t>, PLANET_TYPE_COUNT> m_typeBitmaps;
+    std::array<std::size_t, PLANET_TYPE_COUNT> m_typeCounts{};
+    std::array<SortedColumn, COLUMN_COUNT> m_sortedColumns;
+};
+} // namespace ggh::GalaxyCore::models
+
+#endif // !GGH_GALAXYCORE_MODELS_PLANET_CATALOGUE_H
@@ -2,6 +2,7 @@
 #define GHH_GALAXYCORE_MODELS_PLANETMODEL_H
 
 #include "ggh/modules/GalaxyCore/utilities/Common.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
 
 namespace ggh::GalaxyCore::models {
 
@@ -37,6 +38,12 @@ public:
     // Serialization methods
     std::string toXml() const;
 
+    /**
+     * @brief Adds the bytes owned by this planet to a memory report.
+     * @param report The report to accumulate into.
+     */
+    void reportMemory(utilities::MemoryReport& report) const;
+
         /**
      * @brief Gets the XML tag name for the model.
      * @return A string containing the XML tag name.
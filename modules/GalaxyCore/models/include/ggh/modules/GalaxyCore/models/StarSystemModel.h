@@ -5,13 +5,46 @@
 #include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
 #include "ggh/modules/GalaxyCore/models/PlanetModel.h"
 
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace ggh::GalaxyCore::models {
+class GalaxyArena;
+class SystemNameIndex;
+
 using SystemId = ggh::GalaxyCore::utilities::SystemId;
 using StarType = ggh::GalaxyCore::utilities::StarType;
 using SystemSize = ggh::GalaxyCore::utilities::SystemSize;
+
+/**
+ * @brief Produces a system's planets on demand, so a system can hold a key instead of the planets.
+ *
+ * The key is the source's own: a generator seed, or where an importer finds the system in its
+ * file. Both functions must give the same answer for the same arguments, so planets produced on
+ * first access equal the ones that would have been produced up front.
+ */
+class PlanetSource {
+public:
+    virtual ~PlanetSource() = default;
+
+    // Appends the planets for a key; the system decides where they are allocated
+    virtual void generate(std::uint64_t key, SystemSize size, const std::string& systemName,
+                          std::vector<Planet>& planets) const = 0;
+    // How many planets generate() appends, without creating them
+    virtual std::size_t count(std::uint64_t key, SystemSize size) const = 0;
+};
+
 /**
  * @class StarSystemModel
  * @brief Represents a star system with properties such as position, type, size, and name.
+ *
+ * While the system belongs to a GalaxyModel, renaming it also updates that galaxy's name index.
+ *
+ * Planets may be deferred: the system keeps a source and a key, and the planets are produced on
+ * the first getPlanets() call or on any change that depends on them. Producing them mutates the planet
+ * list of a const system, so the first read must not race with another read of the same system.
  */
 class StarSystemModel {
 public:
@@ -23,20 +56,38 @@ public:
     StarType getStarType() const noexcept;
     SystemSize getSystemSize() const noexcept;
     const std::string& getName() const noexcept;
-    const std::vector<std::shared_ptr<GalaxyCore::models::Planet>>& getPlanets() const noexcept;
+    const std::vector<std::shared_ptr<GalaxyCore::models::Planet>>& getPlanets() const;
+    // Number of planets, without generating deferred ones
+    std::size_t planetCount() const;
+    bool hasDeferredPlanets() const noexcept;
+    double getBetweenness() const noexcept;
 
     std::string toXml() const;
 
+    /**
+     * @brief Adds the bytes owned by this star system and its planets to a memory report.
+     * @param report The report to accumulate into.
+     */
+    void reportMemory(utilities::MemoryReport& report) const;
+
     // Setters
     void setPosition(const utilities::CartesianCoordinates<double>& position);
     void setStarType(StarType type);
     void setSystemSize(SystemSize size);
     void setName(const std::string& name);
+    void setBetweenness(double score);
 
     // Planet management
     void addPlanet(Planet&& planet);
     bool removePlanet(std::shared_ptr<Planet> planet);
 
+    /**
+     * @brief Replaces the planets with ones produced by a source on first access.
+     * @param source Producer of the planets; shared by the systems deferring to it.
+     * @param key Key handed to the source.
+     */
+    void deferPlanets(std::shared_ptr<const PlanetSource> source, std::uint64_t key);
+
         /**
      * @brief Gets the XML tag name for the model.
      * @return A string containing the XML tag name.
@@ -46,12 +97,24 @@ public:
     }
 
 private:
+    friend class GalaxyModel;
+
+    // Runs the deferred source, if any
+    void generateDeferredPlanets() const;
+    // A shared planet, from m_arena when the system has one
+    std::shared_ptr<Planet> makePlanet(Planet&& planet) const;
+
+    SystemNameIndex* m_nameIndex{nullptr};  // Name index of the galaxy holding the system, if any
+    std::shared_ptr<GalaxyArena> m_arena;  // Arena of the galaxy that created the system, if any; planets come from it
     SystemId m_id;  // Unique identifier for the star system
     utilities::CartesianCoordinates<double> m_position;  // Position of the star system in Cartesian coordinates
     StarType m_starType;  // Type of the star in the system
     SystemSize m_systemSize;  // Size category of the star system
     std::string m_name;  // Name of the star system
-    std::vector<std::shared_ptr<Planet>> m_planets;  // List of planets in the star system
+    mutable std::vector<std::shared_ptr<Planet>> m_planets;  // List of planets in the star system; filled late when deferred
+    mutable std::shared_ptr<const PlanetSource> m_planetSource;  // Set while the planets are deferred
+    std::uint64_t m_planetKey{0};  // Key for m_planetSource
+    double m_betweenness{0.0};  // Share of shortest routes passing through the system, from the last centrality analysis
 };
 }
 
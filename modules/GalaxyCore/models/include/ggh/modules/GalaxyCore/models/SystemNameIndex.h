@@ -0,0 +1,95 @@
+#ifndef GGH_GALAXYCORE_MODELS_SYSTEM_NAME_INDEX_H
+#define GGH_GALAXYCORE_MODELS_SYSTEM_NAME_INDEX_H
+
+#include <cstddef>
+#include <string>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/utilities/Common.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+
+/**
+ * @file SystemNameIndex.h
+ * @brief Case-insensitive name lookup over a galaxy's star systems.
+ *
+ * Names are case-folded (ASCII letters only; other UTF-8 bytes compare as-is) and kept in two
+ * arrays sorted by (folded name, system id): the bulk of the names, and a short run of recent
+ * insertions that is merged into the bulk once it outgrows the square root of its size. All names
+ * sharing a prefix form one contiguous block in each run, found by binary search, so an insertion
+ * costs O(sqrt N) amortized; bulk loads go through build(), which sorts once in O(N log N).
+ * Erasing or renaming shifts the arrays and costs O(N). Substring queries scan the folded names, which sit contiguously in memory.
+ *
+ * Every edit leaves both runs sorted, so the const queries never write and may run concurrently.
+ */
+namespace ggh::GalaxyCore::models
+{
+class SystemNameIndex {
+public:
+    struct Entry {
+        std::string key;          ///< Case-folded name
+        utilities::SystemId id;
+    };
+
+    /**
+     * @brief Case-folds a name the way the index compares names.
+     */
+    static std::string fold(std::string_view name);
+
+    void insert(utilities::SystemId id, std::string_view name);
+
+    /**
+     * @brief Replaces the whole index with the given names, sorting them once.
+     */
+    void build(std::span<const std::pair<utilities::SystemId, std::string_view>> names);
+
+    /**
+     * @brief Removes a system that was inserted under the given name.
+     * @return False if the index had no such entry.
+     */
+    bool erase(utilities::SystemId id, std::string_view name);
+
+    void rename(utilities::SystemId id, std::string_view oldName, std::string_view newName);
+
+    void clear();
+
+    std::size_t size() const noexcept { return m_entries.size() + m_recent.size(); }
+    bool empty() const noexcept { return size() == 0; }
+
+    /**
+     * @brief Every system whose name equals the given one, ignoring case, in id order.
+     */
+    std::vector<utilities::SystemId> equalIds(std::string_view name) const;
+
+    /**
+     * @brief Systems whose name starts with a prefix, ignoring case, in name order.
+     * @param limit Most ids to append to the result.
+     * @param result Receives up to limit ids.
+     * @return The number of matches, including those past the limit; O(log N + limit).
+     */
+    std::size_t prefixSearch(std::string_view prefix, std::size_t limit, std::vector<utilities::SystemId>& result) const;
+
+    /**
+     * @brief Systems whose name contains the text, ignoring case.
+     *
+     * Names starting with the text rank first, then the other matches, each group in name order.
+     * @param limit Most ids to append to the result.
+     * @param result Receives up to limit ids.
+     * @return The number of matches, including those past the limit; O(total name length).
+     */
+    std::size_t search(std::string_view text, std::size_t limit, std::vector<utilities::SystemId>& result) const;
+
+    void reportMemory(utilities::MemoryReport& report) const;
+
+private:
+    // Merges the recent run into the sorted entries once it outgrows sqrt(N)
+    void mergeRecentIfLarge();
+
+    std::vector<Entry> m_entries;   ///< Sorted by (key, id)
+    std::vector<Entry> m_recent;    ///< Sorted by (key, id); inserted since the last merge
+};
+} // namespace ggh::GalaxyCore::models
+
+#endif // !GGH_GALAXYCORE_MODELS_SYSTEM_NAME_INDEX_H
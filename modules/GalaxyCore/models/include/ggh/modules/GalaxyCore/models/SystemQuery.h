@@ -0,0 +1,108 @@
+#ifndef GGH_GALAXYCORE_MODELS_SYSTEM_QUERY_H
+#define GGH_GALAXYCORE_MODELS_SYSTEM_QUERY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
+#include "ggh/modules/GalaxyCore/utilities/Common.h"
+#include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
+
+/**
+ * @file SystemQuery.h
+ * @brief Conjunctive filter over star systems, built in code or parsed from a small text language.
+ *
+ * Every condition added narrows the result; a query with no conditions matches every system.
+ * The text form joins terms with `and`:
+ *
+ *     type = BlueStar and planets > 5 and within 300 of 42 and unowned
+ *
+ * Terms:
+ * - `type = T`, `type in (T1, T2)` with T one of RedDwarf, YellowStar, BlueStar, WhiteDwarf,
+ *   RedGiant, Neutron, BlackHole
+ * - `size = S`, `size in (S1, S2)` with S one of Small, Medium, Large, Huge
+ * - `planets <op> N` with op one of `<`, `<=`, `=`, `>=`, `>`
+ * - `within R of ID` (around a system) or `within R of (X, Y)` (around a point)
+ * - `name ~ "text"` (case-insensitive substring)
+ * - `owned`, `unowned` (needs an ownership lookup on the engine)
+ *
+ * Keywords and enum names are case-insensitive. Queries run through SystemQueryEngine.
+ */
+namespace ggh::GalaxyCore::models
+{
+class SystemQuery {
+public:
+    enum class Comparison { Less, LessEqual, Equal, GreaterEqual, Greater };
+
+    using Predicate = std::function<bool(const StarSystemModel&)>;
+
+    /**
+     * @brief A disc around a point or around a system resolved when the query runs.
+     */
+    struct Circle {
+        std::optional<utilities::SystemId> anchor;
+        utilities::CartesianCoordinates<double> centre;
+        double radius;
+    };
+
+    /**
+     * @brief Parses the text form.
+     * @throws std::invalid_argument naming the offending position if the text is malformed.
+     */
+    static SystemQuery parse(std::string_view text);
+
+    SystemQuery& starTypes(std::initializer_list<StarType> types);
+    SystemQuery& systemSizes(std::initializer_list<SystemSize> sizes);
+    // Same as starTypes/systemSizes, with one bit per enum value
+    SystemQuery& restrictStarTypes(std::uint32_t mask);
+    SystemQuery& restrictSystemSizes(std::uint32_t mask);
+    SystemQuery& planetCount(Comparison comparison, std::size_t count);
+    SystemQuery& within(const utilities::CartesianCoordinates<double>& centre, double radius);
+    SystemQuery& withinOf(utilities::SystemId system, double radius);
+    SystemQuery& inRect(double x1, double y1, double x2, double y2);
+    SystemQuery& nameContains(std::string_view text);
+    SystemQuery& owned(bool owned);
+    // Arbitrary condition, checked after every built-in one
+    SystemQuery& where(Predicate predicate);
+
+    std::uint32_t starTypeMask() const noexcept { return m_starTypeMask; }
+    std::uint32_t systemSizeMask() const noexcept { return m_systemSizeMask; }
+    std::size_t minPlanets() const noexcept { return m_minPlanets; }
+    std::size_t maxPlanets() const noexcept { return m_maxPlanets; }
+    const std::vector<Circle>& circles() const noexcept { return m_circles; }
+    bool hasRect() const noexcept { return m_hasRect; }
+    double rectMinX() const noexcept { return m_minX; }
+    double rectMinY() const noexcept { return m_minY; }
+    double rectMaxX() const noexcept { return m_maxX; }
+    double rectMaxY() const noexcept { return m_maxY; }
+    const std::vector<std::string>& nameFragments() const noexcept { return m_nameFragments; }   ///< Case-folded
+    const std::optional<bool>& ownership() const noexcept { return m_owned; }
+    const std::vector<Predicate>& predicates() const noexcept { return m_predicates; }
+
+    static constexpr std::uint32_t ALL = std::numeric_limits<std::uint32_t>::max();
+
+private:
+    std::uint32_t m_starTypeMask{ALL};      ///< Bit per StarType value
+    std::uint32_t m_systemSizeMask{ALL};    ///< Bit per SystemSize value
+    std::size_t m_minPlanets{0};
+    std::size_t m_maxPlanets{std::numeric_limits<std::size_t>::max()};
+    std::vector<Circle> m_circles;
+    bool m_hasRect{false};
+    double m_minX{0.0};
+    double m_minY{0.0};
+    double m_maxX{0.0};
+    double m_maxY{0.0};
+    std::vector<std::string> m_nameFragments;
+    std::optional<bool> m_owned;
+    std::vector<Predicate> m_predicates;
+};
+} // namespace ggh::GalaxyCore::models
+
+#endif // !GGH_GALAXYCORE_MODELS_SYSTEM_QUERY_H
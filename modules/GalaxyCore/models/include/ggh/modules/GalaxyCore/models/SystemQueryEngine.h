@@ -0,0 +1,136 @@
+#ifndef GGH_GALAXYCORE_MODELS_SYSTEM_QUERY_ENGINE_H
+#define GGH_GALAXYCORE_MODELS_SYSTEM_QUERY_ENGINE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+#include "ggh/modules/GalaxyCore/models/SystemQuery.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyCore/utilities/SpatialGrid.h"
+
+/**
+ * @file SystemQueryEngine.h
+ * @brief Plans and runs SystemQuery filters over a columnar snapshot of a galaxy's star systems.
+ *
+ * build() copies the fields queries look at into parallel columns sorted by system id (position,
+ * star type, size, planet count, case-folded name), keeps one row list per star type and buckets
+ * the positions in a SpatialGrid. A query is then planned against three access paths:
+ *
+ * - SpatialRange: only the rows in the grid cells under the query's discs and rectangle
+ * - StarTypeRows: only the rows of the star types the query allows
+ * - ColumnScan: every row
+ *
+ * The planner estimates how many rows each path yields (the area share of the spatial bounds,
+ * the exact row count of the allowed types) and takes the smallest. Every other condition is
+ * checked on the candidates, cheapest columns first and custom predicates last.
+ *
+ * The snapshot does not follow later edits. update() re-reads edited systems in place; systems
+ * added or removed need a rebuild.
+ */
+namespace ggh::GalaxyCore::models
+{
+/**
+ * @brief How the engine intends to run a query.
+ */
+struct SystemQueryPlan {
+    enum class Access { Empty, ColumnScan, StarTypeRows, SpatialRange };
+
+    Access access{Access::ColumnScan};
+    std::size_t estimatedRows{0};   ///< Candidates the access path is expected to yield
+
+    /**
+     * @brief One-line human-readable summary, e.g. for a debug overlay.
+     */
+    std::string describe() const;
+};
+
+class SystemQueryEngine {
+public:
+    /// Answers whether a faction owns the system; needed by `owned` and `unowned` conditions
+    using OwnershipLookup = std::function<bool(utilities::SystemId)>;
+
+    /**
+     * @brief Snapshots the galaxy's star systems in O(N log N).
+     */
+    void build(const GalaxyModel& galaxy);
+
+    /**
+     * @brief Re-reads the columns of systems already in the snapshot after they were edited.
+     *
+     * O(log N) per system, plus one O(N) re-bucketing of the positions if any system moved.
+     * @return False if a system is not in the snapshot; the caller should build() again.
+     */
+    bool update(std::span<const std::shared_ptr<StarSystemModel>> systems);
+
+    void clear();
+
+    std::size_t size() const noexcept { return m_ids.size(); }
+
+    void setOwnershipLookup(OwnershipLookup lookup);
+
+    /**
+     * @brief Picks the access path for a query without running it.
+     */
+    SystemQueryPlan plan(const SystemQuery& query) const;
+
+    /**
+     * @brief Runs a query.
+     * @param plan If given, receives the plan that was used.
+     * @return The matching system ids in ascending order.
+     * @throws std::logic_error if the query has ownership conditions and no lookup was set.
+     */
+    std::vector<utilities::SystemId> execute(const SystemQuery& query, SystemQueryPlan* plan = nullptr) const;
+
+    void reportMemory(utilities::MemoryReport& report) const;
+
+private:
+    using Row = std::uint32_t;
+
+    // The query's discs with anchors resolved to positions, plus their common bounding box
+    struct Bounds {
+        std::vector<SystemQuery::Circle> circles;
+        bool spatial{false};
+        bool empty{false};
+        double minX{0.0};
+        double minY{0.0};
+        double maxX{0.0};
+        double maxY{0.0};
+    };
+
+    Bounds resolveBounds(const SystemQuery& query) const;
+    SystemQueryPlan plan(const SystemQuery& query, const Bounds& bounds) const;
+    bool accepts(Row row, const SystemQuery& query, const Bounds& bounds, SystemQueryPlan::Access access) const;
+    Row rowOf(utilities::SystemId id) const;
+    // Buckets the position column and records its extent
+    void indexPositions();
+
+    static constexpr std::size_t STAR_TYPE_COUNT = 7;
+    static constexpr Row NO_ROW = static_cast<Row>(-1);
+
+    // One entry per system, sorted by id
+    std::vector<utilities::SystemId> m_ids;
+    std::vector<utilities::CartesianCoordinates<double>> m_positions;
+    std::vector<std::uint8_t> m_starTypes;
+    std::vector<std::uint8_t> m_systemSizes;
+    std::vector<std::uint32_t> m_planetCounts;
+    std::vector<std::string> m_foldedNames;
+    std::vector<std::shared_ptr<StarSystemModel>> m_systems;   ///< For custom predicates
+
+    std::array<std::vector<Row>, STAR_TYPE_COUNT> m_rowsByStarType;
+    utilities::SpatialGrid m_grid;
+    double m_minX{0.0};
+    double m_minY{0.0};
+    double m_maxX{0.0};
+    double m_maxY{0.0};
+    OwnershipLookup m_ownership;
+};
+} // namespace ggh::GalaxyCore::models
+
+#endif // !GGH_GALAXYCORE_MODELS_SYSTEM_QUERY_ENGINE_H
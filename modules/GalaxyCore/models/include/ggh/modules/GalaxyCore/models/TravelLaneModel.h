@@ -60,12 +60,30 @@ public:
      */
     double getLength() const noexcept;
 
+    /**
+     * @brief Get the share of shortest routes that use this lane, from the last centrality analysis.
+     * @return The normalised betweenness score in [0, 1].
+     */
+    double getBetweenness() const noexcept;
+
+    /**
+     * @brief Set the betweenness score of the lane.
+     * @param score The normalised betweenness score.
+     */
+    void setBetweenness(double score) noexcept;
+
     /**
      * @brief Converts the travel lane to a string representation.
      * @return A xml representation of the travel lane.
      */
     std::string toXml() const;
 
+    /**
+     * @brief Adds the bytes owned by this travel lane (connected systems are owned by the galaxy) to a memory report.
+     * @param report The report to accumulate into.
+     */
+    void reportMemory(utilities::MemoryReport& report) const;
+
     /**
      * @brief Gets the XML tag name for the model.
      * @return A string containing the XML tag name.
@@ -78,6 +96,7 @@ private:
     utilities::LaneId m_id; ///< Lane identifier
     std::shared_ptr<StarSystemModel> m_fromSystem; ///< System identifier of the starting system
     std::shared_ptr<StarSystemModel> m_toSystem; ///< System identifier of the destination system
+    double m_betweenness{0.0}; ///< Betweenness score from the last centrality analysis
 
 };
 }
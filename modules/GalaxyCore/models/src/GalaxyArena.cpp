@@ -0,0 +1,20 @@
+#include "ggh/modules/GalaxyCore/models/GalaxyArena.h"
+
+namespace ggh::GalaxyCore::models {
+
+GalaxyArena::GalaxyArena(std::size_t initialBytes)
+    : m_monotonic(initialBytes, &m_upstream), m_pool(&m_monotonic) {
+}
+
+void* GalaxyArena::CountingResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    // Only the pool calls the monotonic buffer, and the pool calls it under its lock
+    void* pointer = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    m_bytes += bytes;
+    return pointer;
+}
+
+void GalaxyArena::CountingResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    m_bytes -= bytes;
+}
+} // namespace ggh::GalaxyCore::models
@@ -1,20 +1,52 @@
 #include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
 
 namespace ggh::GalaxyCore::models {
-GalaxyModel::GalaxyModel(int width, int height)
-    : m_width(width), m_height(height) {
+GalaxyModel::GalaxyModel(int width, int height, std::shared_ptr<GalaxyArena> arena)
+    : m_width(width), m_height(height), m_arena(std::move(arena)),
+      m_starSystems(m_arena ? m_arena->resource() : std::pmr::get_default_resource()),
+      m_travelLanes(m_arena ? m_arena->resource() : std::pmr::get_default_resource()) {
     // Initialize the galaxy with default values
     }
 
-void GalaxyModel::addStarSystem(std::shared_ptr<StarSystemModel>&& system) {
+GalaxyModel::~GalaxyModel() {
+    // Systems may outlive the galaxy through viewmodels; stop them reporting renames here
+    for (const auto& [id, system] : m_starSystems) {
+        if (system->m_nameIndex == &m_nameIndex) {
+            system->m_nameIndex = nullptr;
+        }
+    }
+}
+
+void GalaxyModel::addStarSystem(std::shared_ptr<StarSystemModel>&& system, NameIndexing indexing) {
     if (system) {
-        m_starSystems[system->getId()] = std::move(system);
+        m_laneGraph.addNode(system->getId(), system->getPosition());
+        auto& slot = m_starSystems[system->getId()];
+        if (slot) {
+            m_nameIndex.erase(slot->getId(), slot->getName());
+            slot->m_nameIndex = nullptr;
+        }
+        if (indexing == NameIndexing::Immediate) {
+            m_nameIndex.insert(system->getId(), system->getName());
+        }
+        system->m_nameIndex = &m_nameIndex;
+        slot = std::move(system);
     }
 }
 
 void GalaxyModel::addStarSystem(SystemId id, const std::string& name, const utilities::CartesianCoordinates<double>& position, StarType type) {
-    auto system{std::make_shared<StarSystemModel>(id, name, position, type)};
-    addStarSystem(std::move(system));
+    addStarSystem(makeStarSystem(id, name, position, type));
+}
+
+const std::shared_ptr<GalaxyArena>& GalaxyModel::arena() const noexcept {
+    return m_arena;
+}
+
+std::shared_ptr<StarSystemModel> GalaxyModel::makeStarSystem(SystemId id, std::string_view name,
+                                                             const utilities::CartesianCoordinates<double>& position,
+                                                             StarType type) const {
+    auto system = allocateShared<StarSystemModel>(m_arena, id, name, position, type);
+    system->m_arena = m_arena;
+    return system;
 }
 
 std::shared_ptr<StarSystemModel> GalaxyModel::getStarSystem(SystemId id) const {
@@ -28,12 +60,28 @@ std::shared_ptr<StarSystemModel> GalaxyModel::getStarSystem(SystemId id) const {
 bool GalaxyModel::removeStarSystem(SystemId id) {
     auto it = m_starSystems.find(id);
     if (it != m_starSystems.end()) {
+        // Drop the system's lanes too, so no lane keeps the removed system alive
+        for (auto laneId : m_laneGraph.removeNode(id)) {
+            m_travelLanes.erase(laneId);
+        }
+        m_nameIndex.erase(id, it->second->getName());
+        it->second->m_nameIndex = nullptr;
         m_starSystems.erase(it);
         return true;
     }
     return false;
 }
 
+bool GalaxyModel::setStarSystemPosition(SystemId id, const utilities::CartesianCoordinates<double>& position) {
+    auto system = getStarSystem(id);
+    if (!system) {
+        return false;
+    }
+    system->setPosition(position);
+    m_laneGraph.setPosition(id, position);
+    return true;
+}
+
 std::vector<std::shared_ptr<StarSystemModel>> GalaxyModel::getAllStarSystems() const {
     std::vector<std::shared_ptr<StarSystemModel>> systems;
     for (const auto& pair : m_starSystems) {
@@ -42,15 +90,42 @@ std::vector<std::shared_ptr<StarSystemModel>> GalaxyModel::getAllStarSystems() c
     return systems;
 }
 
+std::shared_ptr<StarSystemModel> GalaxyModel::findStarSystemByName(std::string_view name) const {
+    // Candidates differ from the name at most in letter case
+    for (const auto id : m_nameIndex.equalIds(name)) {
+        auto system = getStarSystem(id);
+        if (system && system->getName() == name) {
+            return system;
+        }
+    }
+    return nullptr;
+}
+
+const SystemNameIndex& GalaxyModel::nameIndex() const noexcept {
+    return m_nameIndex;
+}
+
+void GalaxyModel::rebuildNameIndex() {
+    std::vector<std::pair<SystemId, std::string_view>> names;
+    names.reserve(m_starSystems.size());
+    for (const auto& [id, system] : m_starSystems) {
+        names.emplace_back(id, system->getName());
+    }
+    m_nameIndex.build(names);
+}
+
 void GalaxyModel::addTravelLane(std::shared_ptr<TravelLaneModel>&& lane) {
     if (lane) {
+        // Replacing a lane id re-indexes it; lanes between unknown systems are stored but not indexed
+        m_laneGraph.removeEdge(lane->getId());
+        m_laneGraph.addEdge(lane->getId(), lane->getFromSystem()->getId(), lane->getToSystem()->getId());
         m_travelLanes[lane->getId()] = std::move(lane);
     }
 }
 
 void GalaxyModel::addTravelLane(utilities::LaneId id, std::shared_ptr<StarSystemModel> fromSystem, std::shared_ptr<StarSystemModel> toSystem) {
     if (fromSystem && toSystem && fromSystem->getId() != toSystem->getId()) {
-        auto lane{std::make_shared<TravelLaneModel>(id, fromSystem, toSystem)};
+        auto lane{allocateShared<TravelLaneModel>(m_arena, id, fromSystem, toSystem)};
         addTravelLane(std::move(lane));
     }
 }
@@ -73,6 +148,7 @@ std::shared_ptr<TravelLaneModel> GalaxyModel::getTravelLane(utilities::LaneId id
 bool GalaxyModel::removeTravelLane(utilities::LaneId id) {
     auto it = m_travelLanes.find(id);
     if (it != m_travelLanes.end()) {
+        m_laneGraph.removeEdge(id);
         m_travelLanes.erase(it);
         return true;
     }
@@ -87,6 +163,36 @@ std::vector<std::shared_ptr<TravelLaneModel>> GalaxyModel::getAllTravelLanes() c
     return lanes;
 }
 
+std::vector<std::shared_ptr<TravelLaneModel>> GalaxyModel::lanesOf(SystemId systemId) const {
+    std::vector<std::shared_ptr<TravelLaneModel>> lanes;
+    const auto laneIds = m_laneGraph.lanesOf(systemId);
+    lanes.reserve(laneIds.size());
+    for (auto laneId : laneIds) {
+        lanes.push_back(getTravelLane(laneId));
+    }
+    return lanes;
+}
+
+const LaneGraph& GalaxyModel::laneGraph() const noexcept {
+    return m_laneGraph;
+}
+
+void GalaxyModel::rebuildLaneGraph() {
+    std::vector<LaneGraph::NodeRecord> nodes;
+    nodes.reserve(m_starSystems.size());
+    for (const auto& [id, system] : m_starSystems) {
+        nodes.push_back({id, system->getPosition()});
+    }
+
+    std::vector<LaneGraph::EdgeRecord> edges;
+    edges.reserve(m_travelLanes.size());
+    for (const auto& [id, lane] : m_travelLanes) {
+        edges.push_back({id, lane->getFromSystem()->getId(), lane->getToSystem()->getId()});
+    }
+
+    m_laneGraph.build(nodes, edges);
+}
+
 std::string GalaxyModel::toXml() const {
     std::string xml{"<Galaxy>"};
     
@@ -102,6 +208,33 @@ std::string GalaxyModel::toXml() const {
     return xml;
 }
 
+const PlanetCatalogue& GalaxyModel::planetCatalogue() const noexcept {
+    return m_planetCatalogue;
+}
+
+void GalaxyModel::rebuildPlanetCatalogue(unsigned threadCount) {
+    m_planetCatalogue.build(*this, threadCount);
+}
+
+void GalaxyModel::reportMemory(utilities::MemoryReport& report) const {
+    using namespace utilities::memory;
+    report.add("galaxy", sizeof(GalaxyModel), 1);
+    report.add("galaxy.hashBuckets", heapBytes(m_starSystems) + heapBytes(m_travelLanes));
+    // Systems and lanes come from allocateShared, so each carries a control block sized by the arena
+    const auto sharedBlocks = m_starSystems.size() + m_travelLanes.size();
+    report.add("galaxy.sharedControlBlocks", sharedBlocks * sharedControlBlockBytes(m_arena), sharedBlocks);
+
+    m_laneGraph.reportMemory(report);
+    m_nameIndex.reportMemory(report);
+    m_planetCatalogue.reportMemory(report);
+    for (const auto& [id, system] : m_starSystems) {
+        system->reportMemory(report);
+    }
+    for (const auto& [id, lane] : m_travelLanes) {
+        lane->reportMemory(report);
+    }
+}
+
 int GalaxyModel::getWidth() const noexcept {
     return m_width;
 }
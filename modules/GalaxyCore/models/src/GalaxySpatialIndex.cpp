@@ -0,0 +1,140 @@
+#include "ggh/modules/GalaxyCore/models/GalaxySpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+namespace ggh::GalaxyCore::models {
+
+namespace {
+// Distance from a point to the segment a-b
+double segmentDistance(const utilities::CartesianCoordinates<double>& point,
+                       const utilities::CartesianCoordinates<double>& a,
+                       const utilities::CartesianCoordinates<double>& b) {
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double lengthSquared = dx * dx + dy * dy;
+    double t = 0.0;
+    if (lengthSquared > 0.0) {
+        t = std::clamp(((point.x - a.x) * dx + (point.y - a.y) * dy) / lengthSquared, 0.0, 1.0);
+    }
+    return std::hypot(point.x - (a.x + t * dx), point.y - (a.y + t * dy));
+}
+} // namespace
+
+void GalaxySpatialIndex::build(const LaneGraph& graph) {
+    GGH_TRACE_SCOPE("GalaxySpatialIndex::build");
+    clear();
+    m_graph = &graph;
+    m_revision = graph.revision();
+
+    const auto nodeCount = graph.nodeCount();
+    m_systems.reserve(nodeCount);
+    m_positions.reserve(nodeCount);
+    for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+        m_systems.push_back(graph.systemId(node));
+        m_positions.push_back(graph.position(node));
+    }
+    m_systemGrid.build(m_positions);
+
+    // Every lane sits in both endpoint blocks; keep the copy seen from the lower node
+    double totalLength = 0.0;
+    m_lanes.reserve(graph.edgeCount());
+    for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+        const auto neighbours = graph.neighbours(node);
+        for (std::size_t i = 0; i < neighbours.size(); ++i) {
+            if (neighbours.nodes[i] > node) {
+                m_lanes.push_back({neighbours.lanes[i], node, neighbours.nodes[i]});
+                totalLength += neighbours.lengths[i];
+            }
+        }
+    }
+    if (m_lanes.empty()) {
+        return;
+    }
+
+    // Sampling at the mean lane length gives about two samples per lane, however long the longest is
+    m_sampleStep = std::max(totalLength / static_cast<double>(m_lanes.size()), 1e-9);
+    std::vector<utilities::CartesianCoordinates<double>> samples;
+    samples.reserve(2 * m_lanes.size());
+    for (std::uint32_t lane = 0; lane < m_lanes.size(); ++lane) {
+        const auto& a = m_positions[m_lanes[lane].from];
+        const auto& b = m_positions[m_lanes[lane].to];
+        const auto pieces = std::max(1.0, std::ceil(utilities::calculateDistance(a, b) / m_sampleStep));
+        for (double piece = 0.0; piece < pieces; piece += 1.0) {
+            const double t = (piece + 0.5) / pieces;
+            samples.emplace_back(a.x + t * (b.x - a.x), a.y + t * (b.y - a.y));
+            m_sampleLanes.push_back(lane);
+        }
+    }
+    m_laneGrid.build(samples);
+}
+
+bool GalaxySpatialIndex::isValidFor(const LaneGraph& graph) const noexcept {
+    return m_graph == &graph && m_revision == graph.revision();
+}
+
+void GalaxySpatialIndex::clear() {
+    m_graph = nullptr;
+    m_revision = 0;
+    m_systems.clear();
+    m_positions.clear();
+    m_systemGrid.build({});
+    m_lanes.clear();
+    m_sampleLanes.clear();
+    m_laneGrid.build({});
+    m_sampleStep = 0.0;
+}
+
+utilities::SystemId GalaxySpatialIndex::systemAt(double x, double y, double radius) const {
+    const auto node = m_systemGrid.nearest(utilities::CartesianCoordinates<double>(x, y),
+                                           [](utilities::SpatialGrid::Index) { return true; }, radius);
+    return node != utilities::SpatialGrid::INVALID_INDEX ? m_systems[node] : NO_SYSTEM;
+}
+
+void GalaxySpatialIndex::systemsInRect(double x1, double y1, double x2, double y2,
+                                       std::vector<utilities::SystemId>& systems) const {
+    systems.clear();
+    std::vector<utilities::SpatialGrid::Index> nodes;
+    m_systemGrid.forEachInRect(std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2),
+                               [&nodes](utilities::SpatialGrid::Index node) { nodes.push_back(node); });
+    std::sort(nodes.begin(), nodes.end());
+    systems.reserve(nodes.size());
+    for (const auto node : nodes) {
+        systems.push_back(m_systems[node]);
+    }
+}
+
+utilities::LaneId GalaxySpatialIndex::nearestLane(double x, double y, double maxDistance, double* distance) const {
+    const utilities::CartesianCoordinates<double> point(x, y);
+    utilities::LaneId best = NO_LANE;
+    double bestDistance = maxDistance;
+
+    // A lane within maxDistance has a sample within maxDistance plus half a step of the point
+    m_laneGrid.forEachInRadius(point, maxDistance + 0.5 * m_sampleStep,
+                               [&](utilities::SpatialGrid::Index sample, double) {
+        const auto& lane = m_lanes[m_sampleLanes[sample]];
+        const double d = segmentDistance(point, m_positions[lane.from], m_positions[lane.to]);
+        if (d <= maxDistance && (best == NO_LANE || d < bestDistance || (d == bestDistance && lane.id < best))) {
+            best = lane.id;
+            bestDistance = d;
+        }
+    });
+    if (distance && best != NO_LANE) {
+        *distance = bestDistance;
+    }
+    return best;
+}
+
+void GalaxySpatialIndex::reportMemory(utilities::MemoryReport& report) const {
+    using namespace utilities::memory;
+    // Each grid keeps a copy of its points plus one cell offset and one entry per point, roughly
+    const auto gridBytes = [](std::size_t points) {
+        return points * (sizeof(utilities::CartesianCoordinates<double>) + 2 * sizeof(utilities::SpatialGrid::Index));
+    };
+    report.add("galaxy.spatialIndex",
+               heapBytes(m_systems) + heapBytes(m_positions) + heapBytes(m_lanes) + heapBytes(m_sampleLanes)
+                   + gridBytes(m_systemGrid.size()) + gridBytes(m_laneGrid.size()));
+}
+} // namespace ggh::GalaxyCore::models
@@ -0,0 +1,308 @@
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+
+#include <algorithm>
+
+namespace ggh::GalaxyCore::models {
+
+namespace {
+constexpr std::uint32_t MIN_BLOCK_CAPACITY = 4;
+}
+
+void LaneGraph::build(std::span<const NodeRecord> nodes, std::span<const EdgeRecord> edges) {
+    clear();
+    m_systemIds.reserve(nodes.size());
+    m_positions.reserve(nodes.size());
+    m_indexOf.reserve(nodes.size());
+    for (const auto& record : nodes) {
+        if (m_indexOf.emplace(record.id, static_cast<NodeIndex>(m_systemIds.size())).second) {
+            m_systemIds.push_back(record.id);
+            m_positions.push_back(record.position);
+        }
+    }
+
+    // Count degrees, then prefix-sum them into block offsets
+    std::vector<std::pair<NodeIndex, NodeIndex>> accepted;
+    accepted.reserve(edges.size());
+    m_endpoints.reserve(edges.size());
+    m_degrees.assign(m_systemIds.size(), 0);
+    for (const auto& edge : edges) {
+        const auto a = indexOf(edge.from);
+        const auto b = indexOf(edge.to);
+        if (a == INVALID_NODE || b == INVALID_NODE || a == b
+            || !m_endpoints.emplace(edge.lane, std::make_pair(edge.from, edge.to)).second) {
+            accepted.emplace_back(INVALID_NODE, INVALID_NODE);
+            continue;
+        }
+        accepted.emplace_back(a, b);
+        ++m_degrees[a];
+        ++m_degrees[b];
+    }
+
+    m_offsets.resize(m_systemIds.size());
+    std::uint32_t offset = 0;
+    for (std::size_t node = 0; node < m_systemIds.size(); ++node) {
+        m_offsets[node] = offset;
+        offset += m_degrees[node];
+    }
+    m_capacities = m_degrees;
+    m_targets.resize(offset);
+    m_laneIds.resize(offset);
+    m_lengths.resize(offset);
+
+    std::fill(m_degrees.begin(), m_degrees.end(), 0u);
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        const auto [a, b] = accepted[i];
+        if (a == INVALID_NODE) {
+            continue;
+        }
+        const double length = utilities::calculateDistance(m_positions[a], m_positions[b]);
+        for (const auto& [from, to] : {std::make_pair(a, b), std::make_pair(b, a)}) {
+            const auto slot = m_offsets[from] + m_degrees[from]++;
+            m_targets[slot] = to;
+            m_laneIds[slot] = edges[i].lane;
+            m_lengths[slot] = length;
+        }
+    }
+}
+
+LaneGraph::NodeIndex LaneGraph::addNode(utilities::SystemId id, const utilities::CartesianCoordinates<double>& position) {
+    auto it = m_indexOf.find(id);
+    if (it != m_indexOf.end()) {
+        setPosition(id, position);
+        return it->second;
+    }
+
+    const auto node = static_cast<NodeIndex>(m_systemIds.size());
+    m_indexOf.emplace(id, node);
+    m_systemIds.push_back(id);
+    m_positions.push_back(position);
+    m_offsets.push_back(static_cast<std::uint32_t>(m_targets.size()));
+    m_degrees.push_back(0);
+    m_capacities.push_back(0);
+    ++m_revision;
+    return node;
+}
+
+std::vector<utilities::LaneId> LaneGraph::removeNode(utilities::SystemId id) {
+    const auto node = indexOf(id);
+    if (node == INVALID_NODE) {
+        return {};
+    }
+
+    const auto lanes = lanesOf(id);
+    std::vector<utilities::LaneId> removed(lanes.begin(), lanes.end());
+    for (auto lane : removed) {
+        removeEdge(lane);
+    }
+
+    // Swap the last node into the freed index and repoint its neighbours
+    const auto last = static_cast<NodeIndex>(m_systemIds.size() - 1);
+    if (node != last) {
+        m_offsets[node] = m_offsets[last];
+        m_degrees[node] = m_degrees[last];
+        m_capacities[node] = m_capacities[last];
+        m_systemIds[node] = m_systemIds[last];
+        m_positions[node] = m_positions[last];
+        m_indexOf[m_systemIds[node]] = node;
+
+        const auto begin = m_offsets[node];
+        for (auto i = begin; i < begin + m_degrees[node]; ++i) {
+            const auto neighbour = m_targets[i];
+            const auto neighbourBegin = m_offsets[neighbour];
+            for (auto j = neighbourBegin; j < neighbourBegin + m_degrees[neighbour]; ++j) {
+                if (m_targets[j] == last) {
+                    m_targets[j] = node;
+                }
+            }
+        }
+    }
+
+    m_offsets.pop_back();
+    m_degrees.pop_back();
+    m_capacities.pop_back();
+    m_systemIds.pop_back();
+    m_positions.pop_back();
+    m_indexOf.erase(id);
+    ++m_revision;
+    return removed;
+}
+
+bool LaneGraph::addEdge(utilities::LaneId lane, utilities::SystemId from, utilities::SystemId to) {
+    const auto a = indexOf(from);
+    const auto b = indexOf(to);
+    if (a == INVALID_NODE || b == INVALID_NODE || a == b || m_endpoints.contains(lane)) {
+        return false;
+    }
+
+    const double length = utilities::calculateDistance(m_positions[a], m_positions[b]);
+    appendHalfEdge(a, b, lane, length);
+    appendHalfEdge(b, a, lane, length);
+    m_endpoints.emplace(lane, std::make_pair(from, to));
+    ++m_revision;
+    return true;
+}
+
+bool LaneGraph::removeEdge(utilities::LaneId lane) {
+    auto it = m_endpoints.find(lane);
+    if (it == m_endpoints.end()) {
+        return false;
+    }
+
+    removeHalfEdge(indexOf(it->second.first), lane);
+    removeHalfEdge(indexOf(it->second.second), lane);
+    m_endpoints.erase(it);
+    ++m_revision;
+    return true;
+}
+
+bool LaneGraph::setPosition(utilities::SystemId id, const utilities::CartesianCoordinates<double>& position) {
+    const auto node = indexOf(id);
+    if (node == INVALID_NODE) {
+        return false;
+    }
+
+    m_positions[node] = position;
+    const auto begin = m_offsets[node];
+    for (auto i = begin; i < begin + m_degrees[node]; ++i) {
+        const auto neighbour = m_targets[i];
+        const double length = utilities::calculateDistance(position, m_positions[neighbour]);
+        m_lengths[i] = length;
+        setHalfEdgeLength(neighbour, m_laneIds[i], length);
+    }
+    ++m_revision;
+    return true;
+}
+
+void LaneGraph::compact() {
+    std::vector<NodeIndex> targets;
+    std::vector<utilities::LaneId> laneIds;
+    std::vector<double> lengths;
+    const std::size_t halfEdges = 2 * m_endpoints.size();
+    targets.reserve(halfEdges);
+    laneIds.reserve(halfEdges);
+    lengths.reserve(halfEdges);
+
+    for (std::size_t node = 0; node < m_systemIds.size(); ++node) {
+        const auto begin = m_offsets[node];
+        const auto end = begin + m_degrees[node];
+        m_offsets[node] = static_cast<std::uint32_t>(targets.size());
+        m_capacities[node] = m_degrees[node];
+        targets.insert(targets.end(), m_targets.begin() + begin, m_targets.begin() + end);
+        laneIds.insert(laneIds.end(), m_laneIds.begin() + begin, m_laneIds.begin() + end);
+        lengths.insert(lengths.end(), m_lengths.begin() + begin, m_lengths.begin() + end);
+    }
+
+    m_targets = std::move(targets);
+    m_laneIds = std::move(laneIds);
+    m_lengths = std::move(lengths);
+}
+
+void LaneGraph::clear() {
+    m_offsets.clear();
+    m_degrees.clear();
+    m_capacities.clear();
+    m_systemIds.clear();
+    m_positions.clear();
+    m_indexOf.clear();
+    m_targets.clear();
+    m_laneIds.clear();
+    m_lengths.clear();
+    m_endpoints.clear();
+    ++m_revision;
+}
+
+LaneGraph::NodeIndex LaneGraph::indexOf(utilities::SystemId id) const {
+    auto it = m_indexOf.find(id);
+    return it != m_indexOf.end() ? it->second : INVALID_NODE;
+}
+
+LaneGraph::Neighbours LaneGraph::neighbours(NodeIndex node) const {
+    const std::size_t begin = m_offsets[node];
+    const std::size_t count = m_degrees[node];
+    return Neighbours{
+        std::span<const NodeIndex>(m_targets).subspan(begin, count),
+        std::span<const utilities::LaneId>(m_laneIds).subspan(begin, count),
+        std::span<const double>(m_lengths).subspan(begin, count)
+    };
+}
+
+std::span<const utilities::LaneId> LaneGraph::lanesOf(utilities::SystemId id) const {
+    const auto node = indexOf(id);
+    if (node == INVALID_NODE) {
+        return {};
+    }
+    return std::span<const utilities::LaneId>(m_laneIds).subspan(m_offsets[node], m_degrees[node]);
+}
+
+std::pair<utilities::SystemId, utilities::SystemId> LaneGraph::endpoints(utilities::LaneId lane) const {
+    auto it = m_endpoints.find(lane);
+    return it != m_endpoints.end() ? it->second : std::make_pair(utilities::SystemId{0}, utilities::SystemId{0});
+}
+
+void LaneGraph::reportMemory(utilities::MemoryReport& report) const {
+    using namespace utilities::memory;
+    report.add("galaxy.laneGraph",
+               heapBytes(m_offsets) + heapBytes(m_degrees) + heapBytes(m_capacities)
+                   + heapBytes(m_systemIds) + heapBytes(m_positions) + heapBytes(m_indexOf)
+                   + heapBytes(m_targets) + heapBytes(m_laneIds) + heapBytes(m_lengths)
+                   + heapBytes(m_endpoints));
+}
+
+void LaneGraph::appendHalfEdge(NodeIndex from, NodeIndex to, utilities::LaneId lane, double length) {
+    if (m_degrees[from] == m_capacities[from]) {
+        // Relocate the block to the end of the arrays with room to grow
+        const auto oldBegin = m_offsets[from];
+        const auto newBegin = static_cast<std::uint32_t>(m_targets.size());
+        const auto newCapacity = std::max(MIN_BLOCK_CAPACITY, 2 * m_capacities[from]);
+        m_targets.resize(newBegin + newCapacity);
+        m_laneIds.resize(newBegin + newCapacity);
+        m_lengths.resize(newBegin + newCapacity);
+        std::copy_n(m_targets.begin() + oldBegin, m_degrees[from], m_targets.begin() + newBegin);
+        std::copy_n(m_laneIds.begin() + oldBegin, m_degrees[from], m_laneIds.begin() + newBegin);
+        std::copy_n(m_lengths.begin() + oldBegin, m_degrees[from], m_lengths.begin() + newBegin);
+        m_offsets[from] = newBegin;
+        m_capacities[from] = newCapacity;
+    }
+
+    const auto slot = m_offsets[from] + m_degrees[from];
+    m_targets[slot] = to;
+    m_laneIds[slot] = lane;
+    m_lengths[slot] = length;
+    ++m_degrees[from];
+
+    compactIfWasteful();
+}
+
+void LaneGraph::removeHalfEdge(NodeIndex from, utilities::LaneId lane) {
+    const auto begin = m_offsets[from];
+    const auto last = begin + m_degrees[from] - 1;
+    for (auto i = begin; i <= last; ++i) {
+        if (m_laneIds[i] == lane) {
+            m_targets[i] = m_targets[last];
+            m_laneIds[i] = m_laneIds[last];
+            m_lengths[i] = m_lengths[last];
+            --m_degrees[from];
+            return;
+        }
+    }
+}
+
+void LaneGraph::setHalfEdgeLength(NodeIndex from, utilities::LaneId lane, double length) {
+    const auto begin = m_offsets[from];
+    for (auto i = begin; i < begin + m_degrees[from]; ++i) {
+        if (m_laneIds[i] == lane) {
+            m_lengths[i] = length;
+            return;
+        }
+    }
+}
+
+void LaneGraph::compactIfWasteful() {
+    // Relocations leave holes behind; reclaim them once they outweigh the live half-edges
+    const std::size_t live = 2 * m_endpoints.size() + 2;
+    if (m_targets.size() > 4 * live + 1024) {
+        compact();
+    }
+}
+
+} // namespace ggh::GalaxyCore::models
@@ -0,0 +1,268 @@
+#include "ggh/modules/GalaxyCore/models/PlanetCatalogue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <stdexcept>
+#include <thread>
+
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+namespace ggh::GalaxyCore::models {
+
+namespace {
+// Runs task(0..taskCount-1) on up to threadCount threads, the calling thread included; workers
+// claim tasks from a shared counter so uneven tasks still balance
+template <typename Task>
+void runTasks(std::size_t taskCount, unsigned threadCount, Task&& task) {
+    threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, taskCount));
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for (auto index = next++; index < taskCount; index = next++) {
+            task(index);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount > 0 ? threadCount - 1 : 0);
+    for (unsigned i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+// Systems copied per fill task; large enough to amortise the claim, small enough to balance
+constexpr std::size_t SYSTEMS_PER_TASK = 512;
+} // namespace
+
+void PlanetCatalogue::build(const GalaxyModel& galaxy, unsigned threadCount) {
+    GGH_TRACE_SCOPE("PlanetCatalogue::build");
+    clear();
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    auto systems = galaxy.getAllStarSystems();
+    std::sort(systems.begin(), systems.end(), [](const auto& a, const auto& b) { return a->getId() < b->getId(); });
+
+    // First row of each system, so fill tasks write disjoint slices. This pass also generates any
+    // deferred planets, on this thread, before the workers read them
+    std::vector<std::size_t> firstRow(systems.size() + 1, 0);
+    for (std::size_t i = 0; i < systems.size(); ++i) {
+        firstRow[i + 1] = firstRow[i] + systems[i]->getPlanets().size();
+    }
+    const auto rows = firstRow.back();
+    if (rows > std::numeric_limits<Row>::max()) {
+        throw std::length_error("PlanetCatalogue: too many planets");
+    }
+
+    m_types.resize(rows);
+    m_sizes.resize(rows);
+    m_masses.resize(rows);
+    m_moons.resize(rows);
+    m_orbitalRadii.resize(rows);
+    m_minTemperatures.resize(rows);
+    m_maxTemperatures.resize(rows);
+    m_systems.resize(rows);
+    m_planetIndices.resize(rows);
+
+    runTasks((systems.size() + SYSTEMS_PER_TASK - 1) / SYSTEMS_PER_TASK, threadCount, [&](std::size_t task) {
+        const auto end = std::min(systems.size(), (task + 1) * SYSTEMS_PER_TASK);
+        for (auto i = task * SYSTEMS_PER_TASK; i < end; ++i) {
+            const auto& planets = systems[i]->getPlanets();
+            for (std::size_t p = 0; p < planets.size(); ++p) {
+                const auto row = firstRow[i] + p;
+                const auto& planet = *planets[p];
+                m_types[row] = static_cast<std::uint8_t>(planet.type());
+                m_sizes[row] = planet.size();
+                m_masses[row] = planet.mass();
+                m_moons[row] = static_cast<double>(planet.numberOfMoons());
+                m_orbitalRadii[row] = planet.orbitalRadius();
+                m_minTemperatures[row] = planet.minTemperature();
+                m_maxTemperatures[row] = planet.maxTemperature();
+                m_systems[row] = systems[i]->getId();
+                m_planetIndices[row] = static_cast<std::uint32_t>(p);
+            }
+        }
+    });
+
+    // One task per sorted column plus one for the type bitmaps; they read the columns and write apart
+    runTasks(COLUMN_COUNT + 1, threadCount, [&](std::size_t task) {
+        if (task == COLUMN_COUNT) {
+            for (auto& bitmap : m_typeBitmaps) {
+                bitmap.assign(wordCount(rows), 0);
+            }
+            for (Row row = 0; row < rows; ++row) {
+                const auto type = m_types[row];
+                if (type < PLANET_TYPE_COUNT) {
+                    m_typeBitmaps[type][row / 64] |= std::uint64_t{1} << (row % 64);
+                    ++m_typeCounts[type];
+                }
+            }
+            return;
+        }
+
+        const auto& values = column(static_cast<Column>(task));
+        auto& sorted = m_sortedColumns[task];
+        sorted.rows.resize(rows);
+        for (Row row = 0; row < rows; ++row) {
+            sorted.rows[row] = row;
+        }
+        // Ties keep row order so the result does not depend on the thread count
+        std::sort(sorted.rows.begin(), sorted.rows.end(), [&values](Row a, Row b) {
+            return values[a] < values[b] || (values[a] == values[b] && a < b);
+        });
+        sorted.values.resize(rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            sorted.values[i] = values[sorted.rows[i]];
+        }
+    });
+}
+
+void PlanetCatalogue::clear() {
+    m_types.clear();
+    m_sizes.clear();
+    m_masses.clear();
+    m_moons.clear();
+    m_orbitalRadii.clear();
+    m_minTemperatures.clear();
+    m_maxTemperatures.clear();
+    m_systems.clear();
+    m_planetIndices.clear();
+    for (auto& bitmap : m_typeBitmaps) {
+        bitmap.clear();
+    }
+    m_typeCounts.fill(0);
+    for (auto& sorted : m_sortedColumns) {
+        sorted.values.clear();
+        sorted.rows.clear();
+    }
+}
+
+const std::vector<double>& PlanetCatalogue::column(Column column) const noexcept {
+    switch (column) {
+        case Column::Size:
+            return m_sizes;
+        case Column::Mass:
+            return m_masses;
+        case Column::Moons:
+            return m_moons;
+        case Column::OrbitalRadius:
+            return m_orbitalRadii;
+        case Column::MinTemperature:
+            return m_minTemperatures;
+        case Column::MaxTemperature:
+            break;
+    }
+    return m_maxTemperatures;
+}
+
+double PlanetCatalogue::value(Column column, Row row) const noexcept {
+    return this->column(column)[row];
+}
+
+std::span<const std::uint64_t> PlanetCatalogue::typeBitmap(PlanetType type) const noexcept {
+    const auto index = static_cast<std::size_t>(type);
+    return index < PLANET_TYPE_COUNT ? std::span<const std::uint64_t>(m_typeBitmaps[index]) : std::span<const std::uint64_t>();
+}
+
+std::size_t PlanetCatalogue::countOfType(PlanetType type) const noexcept {
+    const auto index = static_cast<std::size_t>(type);
+    return index < PLANET_TYPE_COUNT ? m_typeCounts[index] : 0;
+}
+
+std::span<const PlanetCatalogue::Row> PlanetCatalogue::rowsInRange(Column column, double min, double max) const {
+    const auto& sorted = m_sortedColumns[static_cast<std::size_t>(column)];
+    if (!(min <= max)) {
+        return {};
+    }
+    const auto first = std::lower_bound(sorted.values.begin(), sorted.values.end(), min);
+    const auto last = std::upper_bound(first, sorted.values.end(), max);
+    return std::span<const Row>(sorted.rows).subspan(static_cast<std::size_t>(first - sorted.values.begin()),
+                                                    static_cast<std::size_t>(last - first));
+}
+
+bool PlanetCatalogue::inRanges(Row row, const std::vector<Range>& ranges) const noexcept {
+    return std::all_of(ranges.begin(), ranges.end(), [&](const Range& range) {
+        const auto v = value(range.column, row);
+        return v >= range.min && v <= range.max;
+    });
+}
+
+std::vector<PlanetCatalogue::Row> PlanetCatalogue::find(const Query& query) const {
+    GGH_TRACE_SCOPE("PlanetCatalogue::find");
+    std::vector<Row> rows;
+    const auto typeMask = query.typeMask & ALL_TYPES;
+    if (typeMask == 0 || empty()) {
+        return rows;
+    }
+
+    std::size_t typeRows = 0;
+    for (std::size_t type = 0; type < PLANET_TYPE_COUNT; ++type) {
+        if (typeMask & (std::uint32_t{1} << type)) {
+            typeRows += m_typeCounts[type];
+        }
+    }
+
+    // The narrowest range slice, if any is narrower than the rows of the selected types
+    std::span<const Row> slice;
+    bool useSlice = false;
+    for (const auto& range : query.ranges) {
+        const auto candidate = rowsInRange(range.column, range.min, range.max);
+        if (candidate.empty()) {
+            return rows;
+        }
+        if (candidate.size() < typeRows && (!useSlice || candidate.size() < slice.size())) {
+            slice = candidate;
+            useSlice = true;
+        }
+    }
+
+    if (useSlice) {
+        for (const auto row : slice) {
+            if ((typeMask & (std::uint32_t{1} << m_types[row])) && inRanges(row, query.ranges)) {
+                rows.push_back(row);
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    // OR the selected bitmaps a word at a time and walk the set bits
+    rows.reserve(query.ranges.empty() ? typeRows : 0);
+    for (std::size_t word = 0; word < wordCount(size()); ++word) {
+        std::uint64_t bits = 0;
+        for (std::size_t type = 0; type < PLANET_TYPE_COUNT; ++type) {
+            if (typeMask & (std::uint32_t{1} << type)) {
+                bits |= m_typeBitmaps[type][word];
+            }
+        }
+        while (bits) {
+            const auto row = static_cast<Row>(word * 64 + static_cast<std::size_t>(std::countr_zero(bits)));
+            bits &= bits - 1;
+            if (inRanges(row, query.ranges)) {
+                rows.push_back(row);
+            }
+        }
+    }
+    return rows;
+}
+
+void PlanetCatalogue::reportMemory(utilities::MemoryReport& report) const {
+    using namespace utilities::memory;
+    std::size_t bytes = heapBytes(m_types) + heapBytes(m_sizes) + heapBytes(m_masses) + heapBytes(m_moons)
+                        + heapBytes(m_orbitalRadii) + heapBytes(m_minTemperatures) + heapBytes(m_maxTemperatures)
+                        + heapBytes(m_systems) + heapBytes(m_planetIndices);
+    for (const auto& bitmap : m_typeBitmaps) {
+        bytes += heapBytes(bitmap);
+    }
+    for (const auto& sorted : m_sortedColumns) {
+        bytes += heapBytes(sorted.values) + heapBytes(sorted.rows);
+    }
+    report.add("galaxy.planetCatalogue", bytes, size());
+}
+} // namespace ggh::GalaxyCore::models
@@ -22,6 +22,11 @@ double Planet::orbitalRadius() const { return m_orbitalRadius; }
 double Planet::maxTemperature() const { return m_maxTemperature; }
 double Planet::minTemperature() const { return m_minTemperature; }
 
+void Planet::reportMemory(utilities::MemoryReport& report) const {
+    report.add("planets", sizeof(Planet), 1);
+    report.add("galaxy.names", utilities::memory::heapBytes(m_name), 1);
+}
+
 void Planet::setName(const std::string& name) { m_name = name; }
 void Planet::setType(PlanetType type) { m_type = type; }
 void Planet::setSize(double size) { m_size = size; }
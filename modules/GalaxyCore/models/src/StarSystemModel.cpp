@@ -1,5 +1,8 @@
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 
+#include "ggh/modules/GalaxyCore/models/GalaxyArena.h"
+#include "ggh/modules/GalaxyCore/models/SystemNameIndex.h"
+
 namespace ggh::GalaxyCore::models
 {
     StarSystemModel::StarSystemModel(SystemId id, std::string_view name, const utilities::CartesianCoordinates<double> &position, StarType type)
@@ -17,20 +20,33 @@ namespace ggh::GalaxyCore::models
     }
     void StarSystemModel::setSystemSize(SystemSize size)
     {
+        // Deferred planets depend on the size class they were rolled for
+        generateDeferredPlanets();
         m_systemSize = size;
     }
+    void StarSystemModel::setBetweenness(double score)
+    {
+        m_betweenness = score;
+    }
     void StarSystemModel::setName(const std::string &name)
     {
+        // Deferred planets are named after the system they were rolled for
+        generateDeferredPlanets();
+        if (m_nameIndex) {
+            m_nameIndex->rename(m_id, m_name, name);
+        }
         m_name = name;
     }
 
     void StarSystemModel::addPlanet(Planet&& planet)
     {
-        m_planets.push_back(std::make_shared<Planet>(std::move(planet)));
+        generateDeferredPlanets();
+        m_planets.push_back(makePlanet(std::move(planet)));
     }
 
     bool StarSystemModel::removePlanet(std::shared_ptr<Planet> planet)
     {
+        generateDeferredPlanets();
         auto it = std::remove_if(m_planets.begin(), m_planets.end(),
                                  [&planet](std::shared_ptr<Planet> p) { return p->name() == planet->name(); });
         if (it != m_planets.end()) {
@@ -40,12 +56,40 @@ namespace ggh::GalaxyCore::models
         return false;
     }
 
+    void StarSystemModel::deferPlanets(std::shared_ptr<const PlanetSource> source, std::uint64_t key)
+    {
+        m_planets.clear();
+        m_planetSource = std::move(source);
+        m_planetKey = key;
+    }
+
+    void StarSystemModel::generateDeferredPlanets() const
+    {
+        if (m_planetSource) {
+            // Dropped only once generation succeeded, so a throwing source is retried on the next read
+            std::vector<Planet> planets;
+            m_planetSource->generate(m_planetKey, m_systemSize, m_name, planets);
+            m_planets.clear();
+            m_planets.reserve(planets.size());
+            for (auto &planet : planets)
+            {
+                m_planets.push_back(makePlanet(std::move(planet)));
+            }
+            m_planetSource.reset();
+        }
+    }
+
+    std::shared_ptr<Planet> StarSystemModel::makePlanet(Planet &&planet) const
+    {
+        return allocateShared<Planet>(m_arena, std::move(planet));
+    }
+
     std::string StarSystemModel::toXml() const
     {
         // Convert star system data to XML format
         std::string xml{std::format("<StarSystem id=\"{}\" name=\"{}\" positionX=\"{}\" positionY=\"{}\" starType=\"{}\" systemSize=\"{}\">",
                           m_id, m_name, m_position.x, m_position.y, static_cast<int>(m_starType), static_cast<int>(m_systemSize))};
-        for (auto &planet : m_planets)
+        for (auto &planet : getPlanets())
         {
             xml += planet->toXml();
         }
@@ -53,10 +97,31 @@ namespace ggh::GalaxyCore::models
         return xml;
     }
 
+    void StarSystemModel::reportMemory(utilities::MemoryReport &report) const
+    {
+        report.add("starSystems", sizeof(StarSystemModel) + utilities::memory::heapBytes(m_planets), 1);
+        report.add("galaxy.names", utilities::memory::heapBytes(m_name), 1);
+        report.add("galaxy.sharedControlBlocks", m_planets.size() * sharedControlBlockBytes(m_arena), m_planets.size());
+        for (const auto &planet : m_planets)
+        {
+            planet->reportMemory(report);
+        }
+    }
+
     SystemId StarSystemModel::getId() const noexcept { return m_id; }
     const utilities::CartesianCoordinates<double> &StarSystemModel::getPosition() const noexcept { return m_position; }
     StarType StarSystemModel::getStarType() const noexcept { return m_starType; }
     SystemSize StarSystemModel::getSystemSize() const noexcept { return m_systemSize; }
     const std::string &StarSystemModel::getName() const noexcept { return m_name; }
-    const std::vector<std::shared_ptr<Planet>> &StarSystemModel::getPlanets() const noexcept { return m_planets; }
+    const std::vector<std::shared_ptr<Planet>> &StarSystemModel::getPlanets() const
+    {
+        generateDeferredPlanets();
+        return m_planets;
+    }
+    std::size_t StarSystemModel::planetCount() const
+    {
+        return m_planetSource ? m_planetSource->count(m_planetKey, m_systemSize) : m_planets.size();
+    }
+    bool StarSystemModel::hasDeferredPlanets() const noexcept { return m_planetSource != nullptr; }
+    double StarSystemModel::getBetweenness() const noexcept { return m_betweenness; }
 } // namespace ggh::GalaxyCore::models
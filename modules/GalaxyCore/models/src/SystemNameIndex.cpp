@@ -0,0 +1,186 @@
+#include "ggh/modules/GalaxyCore/models/SystemNameIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <span>
+#include <tuple>
+
+namespace ggh::GalaxyCore::models {
+
+namespace {
+using Entry = SystemNameIndex::Entry;
+
+constexpr std::size_t MIN_RECENT_RUN = 64;
+
+bool entryLess(const Entry& a, const Entry& b) {
+    return std::tie(a.key, a.id) < std::tie(b.key, b.id);
+}
+
+// Removes an exact entry from a sorted run
+bool eraseSorted(std::vector<Entry>& run, const Entry& target) {
+    const auto it = std::lower_bound(run.begin(), run.end(), target, entryLess);
+    if (it == run.end() || it->id != target.id || it->key != target.key) {
+        return false;
+    }
+    run.erase(it);
+    return true;
+}
+
+// The block of a sorted run whose keys start with the prefix
+std::span<const Entry> prefixRange(const std::vector<Entry>& run, std::string_view foldedPrefix) {
+    const auto first = std::lower_bound(run.begin(), run.end(), foldedPrefix,
+                                        [](const Entry& entry, std::string_view prefix) { return entry.key < prefix; });
+    // Entries starting with the prefix follow it contiguously
+    const auto last = std::partition_point(first, run.end(), [foldedPrefix](const Entry& entry) {
+        return std::string_view(entry.key).starts_with(foldedPrefix);
+    });
+    return {first, last};
+}
+
+// Visits two sorted runs as one, in (key, id) order, until visit returns false
+template <typename Visit>
+void forEachMerged(std::span<const Entry> a, std::span<const Entry> b, Visit&& visit) {
+    auto i = a.begin();
+    auto j = b.begin();
+    while (i != a.end() || j != b.end()) {
+        const bool fromA = j == b.end() || (i != a.end() && entryLess(*i, *j));
+        if (!visit(fromA ? *i++ : *j++)) {
+            return;
+        }
+    }
+}
+} // namespace
+
+std::string SystemNameIndex::fold(std::string_view name) {
+    std::string folded(name);
+    for (auto& c : folded) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+    }
+    return folded;
+}
+
+void SystemNameIndex::insert(utilities::SystemId id, std::string_view name) {
+    Entry entry{fold(name), id};
+    const auto it = std::upper_bound(m_recent.begin(), m_recent.end(), entry, entryLess);
+    m_recent.insert(it, std::move(entry));
+    mergeRecentIfLarge();
+}
+
+void SystemNameIndex::build(std::span<const std::pair<utilities::SystemId, std::string_view>> names) {
+    clear();
+    m_entries.reserve(names.size());
+    for (const auto& [id, name] : names) {
+        m_entries.push_back({fold(name), id});
+    }
+    std::sort(m_entries.begin(), m_entries.end(), entryLess);
+}
+
+bool SystemNameIndex::erase(utilities::SystemId id, std::string_view name) {
+    const Entry target{fold(name), id};
+    return eraseSorted(m_recent, target) || eraseSorted(m_entries, target);
+}
+
+void SystemNameIndex::rename(utilities::SystemId id, std::string_view oldName, std::string_view newName) {
+    if (erase(id, oldName)) {
+        insert(id, newName);
+    }
+}
+
+void SystemNameIndex::clear() {
+    m_entries.clear();
+    m_recent.clear();
+}
+
+void SystemNameIndex::mergeRecentIfLarge() {
+    const auto limit = std::max(MIN_RECENT_RUN, static_cast<std::size_t>(std::sqrt(static_cast<double>(m_entries.size()))));
+    if (m_recent.size() <= limit) {
+        return;
+    }
+    const auto middle = m_entries.size();
+    m_entries.insert(m_entries.end(), std::make_move_iterator(m_recent.begin()),
+                     std::make_move_iterator(m_recent.end()));
+    std::inplace_merge(m_entries.begin(), m_entries.begin() + static_cast<std::ptrdiff_t>(middle), m_entries.end(),
+                       entryLess);
+    m_recent.clear();
+}
+
+std::vector<utilities::SystemId> SystemNameIndex::equalIds(std::string_view name) const {
+    const auto folded = fold(name);
+    const auto sameKey = [&folded](std::span<const Entry> range) {
+        const auto last = std::partition_point(range.begin(), range.end(),
+                                               [&folded](const Entry& entry) { return entry.key.size() == folded.size(); });
+        return std::span<const Entry>(range.begin(), last);
+    };
+
+    std::vector<utilities::SystemId> ids;
+    forEachMerged(sameKey(prefixRange(m_entries, folded)), sameKey(prefixRange(m_recent, folded)),
+                  [&ids](const Entry& entry) {
+                      ids.push_back(entry.id);
+                      return true;
+                  });
+    return ids;
+}
+
+std::size_t SystemNameIndex::prefixSearch(std::string_view prefix, std::size_t limit,
+                                          std::vector<utilities::SystemId>& result) const {
+    const auto folded = fold(prefix);
+    const auto entries = prefixRange(m_entries, folded);
+    const auto recent = prefixRange(m_recent, folded);
+    std::size_t taken = 0;
+    forEachMerged(entries, recent, [&](const Entry& entry) {
+        if (taken == limit) {
+            return false;
+        }
+        result.push_back(entry.id);
+        ++taken;
+        return true;
+    });
+    return entries.size() + recent.size();
+}
+
+std::size_t SystemNameIndex::search(std::string_view text, std::size_t limit,
+                                    std::vector<utilities::SystemId>& result) const {
+    const auto folded = fold(text);
+    const auto entries = prefixRange(m_entries, folded);
+    const auto recent = prefixRange(m_recent, folded);
+    std::size_t matches = entries.size() + recent.size();
+    forEachMerged(entries, recent, [&](const Entry& entry) {
+        if (result.size() >= limit) {
+            return false;
+        }
+        result.push_back(entry.id);
+        return true;
+    });
+    if (folded.empty()) {
+        return matches;
+    }
+
+    // Prefix matches were taken above; a match further into the name ranks after them
+    forEachMerged(m_entries, m_recent, [&](const Entry& entry) {
+        const auto position = entry.key.find(folded);
+        if (position != std::string::npos && position > 0) {
+            ++matches;
+            if (result.size() < limit) {
+                result.push_back(entry.id);
+            }
+        }
+        return true;
+    });
+    return matches;
+}
+
+void SystemNameIndex::reportMemory(utilities::MemoryReport& report) const {
+    using namespace utilities::memory;
+    std::size_t bytes = heapBytes(m_entries) + heapBytes(m_recent);
+    for (const auto& entry : m_entries) {
+        bytes += heapBytes(entry.key);
+    }
+    for (const auto& entry : m_recent) {
+        bytes += heapBytes(entry.key);
+    }
+    report.add("galaxy.nameIndex", bytes, size());
+}
+} // namespace ggh::GalaxyCore::models
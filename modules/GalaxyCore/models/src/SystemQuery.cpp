@@ -0,0 +1,336 @@
+#include "ggh/modules/GalaxyCore/models/SystemQuery.h"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <stdexcept>
+#include <utility>
+
+#include "ggh/modules/GalaxyCore/models/SystemNameIndex.h"
+
+namespace ggh::GalaxyCore::models {
+
+namespace {
+constexpr std::array<std::pair<std::string_view, StarType>, 7> STAR_TYPE_NAMES{{
+    {"reddwarf", StarType::RedDwarf},
+    {"yellowstar", StarType::YellowStar},
+    {"bluestar", StarType::BlueStar},
+    {"whitedwarf", StarType::WhiteDwarf},
+    {"redgiant", StarType::RedGiant},
+    {"neutron", StarType::Neutron},
+    {"blackhole", StarType::BlackHole},
+}};
+
+constexpr std::array<std::pair<std::string_view, SystemSize>, 4> SYSTEM_SIZE_NAMES{{
+    {"small", SystemSize::Small},
+    {"medium", SystemSize::Medium},
+    {"large", SystemSize::Large},
+    {"huge", SystemSize::Huge},
+}};
+
+template <typename Enum>
+std::uint32_t bit(Enum value) {
+    return std::uint32_t{1} << static_cast<unsigned>(value);
+}
+
+// Tokenizer and recursive-descent parser for the text form
+class Parser {
+public:
+    explicit Parser(std::string_view text) : m_text(text) {}
+
+    SystemQuery parse() {
+        SystemQuery query;
+        skipSpace();
+        if (atEnd()) {
+            return query;
+        }
+        parseTerm(query);
+        while (!atEnd()) {
+            expectKeyword("and");
+            parseTerm(query);
+        }
+        return query;
+    }
+
+private:
+    [[noreturn]] void fail(const std::string& message) const {
+        throw std::invalid_argument("SystemQuery: " + message + " at position " + std::to_string(m_position));
+    }
+
+    bool atEnd() const { return m_position >= m_text.size(); }
+
+    void skipSpace() {
+        while (!atEnd() && std::isspace(static_cast<unsigned char>(m_text[m_position]))) {
+            ++m_position;
+        }
+    }
+
+    // Next identifier, case-folded; empty if the next token is not one
+    std::string peekWord() const {
+        auto end = m_position;
+        while (end < m_text.size() && (std::isalnum(static_cast<unsigned char>(m_text[end])) || m_text[end] == '_')) {
+            ++end;
+        }
+        if (end == m_position || std::isdigit(static_cast<unsigned char>(m_text[m_position]))) {
+            return {};
+        }
+        return SystemNameIndex::fold(m_text.substr(m_position, end - m_position));
+    }
+
+    std::string word() {
+        auto result = peekWord();
+        if (result.empty()) {
+            fail("expected a word");
+        }
+        m_position += result.size();
+        skipSpace();
+        return result;
+    }
+
+    void expectKeyword(std::string_view keyword) {
+        if (peekWord() != keyword) {
+            fail("expected '" + std::string(keyword) + "'");
+        }
+        word();
+    }
+
+    bool consume(std::string_view symbol) {
+        if (m_text.substr(m_position).starts_with(symbol)) {
+            m_position += symbol.size();
+            skipSpace();
+            return true;
+        }
+        return false;
+    }
+
+    void expect(std::string_view symbol) {
+        if (!consume(symbol)) {
+            fail("expected '" + std::string(symbol) + "'");
+        }
+    }
+
+    double number() {
+        double value = 0.0;
+        const auto* first = m_text.data() + m_position;
+        const auto [last, error] = std::from_chars(first, m_text.data() + m_text.size(), value);
+        if (error != std::errc()) {
+            fail("expected a number");
+        }
+        m_position += static_cast<std::size_t>(last - first);
+        skipSpace();
+        return value;
+    }
+
+    std::string quoted() {
+        if (atEnd() || (m_text[m_position] != '"' && m_text[m_position] != '\'')) {
+            fail("expected a quoted string");
+        }
+        const char quote = m_text[m_position];
+        const auto close = m_text.find(quote, m_position + 1);
+        if (close == std::string_view::npos) {
+            fail("unterminated string");
+        }
+        std::string result(m_text.substr(m_position + 1, close - m_position - 1));
+        m_position = close + 1;
+        skipSpace();
+        return result;
+    }
+
+    SystemQuery::Comparison comparison() {
+        // Two-character operators first
+        if (consume("<=")) return SystemQuery::Comparison::LessEqual;
+        if (consume(">=")) return SystemQuery::Comparison::GreaterEqual;
+        if (consume("==")) return SystemQuery::Comparison::Equal;
+        if (consume("<")) return SystemQuery::Comparison::Less;
+        if (consume(">")) return SystemQuery::Comparison::Greater;
+        if (consume("=")) return SystemQuery::Comparison::Equal;
+        fail("expected a comparison");
+    }
+
+    // `= Name` or `in (Name, ...)`, as a bit mask over the enum
+    template <typename Enum, std::size_t N>
+    std::uint32_t enumSet(const std::array<std::pair<std::string_view, Enum>, N>& names) {
+        const auto lookup = [&] {
+            const auto start = m_position;
+            const auto name = word();
+            const auto it = std::find_if(names.begin(), names.end(), [&](const auto& entry) { return entry.first == name; });
+            if (it == names.end()) {
+                m_position = start;
+                fail("unknown value '" + name + "'");
+            }
+            return bit(it->second);
+        };
+
+        if (consume("==") || consume("=")) {
+            return lookup();
+        }
+        expectKeyword("in");
+        expect("(");
+        std::uint32_t mask = lookup();
+        while (consume(",")) {
+            mask |= lookup();
+        }
+        expect(")");
+        return mask;
+    }
+
+    void parseTerm(SystemQuery& query) {
+        const auto start = m_position;
+        const auto keyword = word();
+        if (keyword == "type") {
+            query.restrictStarTypes(enumSet(STAR_TYPE_NAMES));
+        } else if (keyword == "size") {
+            query.restrictSystemSizes(enumSet(SYSTEM_SIZE_NAMES));
+        } else if (keyword == "planets") {
+            const auto op = comparison();
+            const auto count = number();
+            if (count < 0.0 || count != static_cast<double>(static_cast<std::size_t>(count))) {
+                fail("expected a whole planet count");
+            }
+            query.planetCount(op, static_cast<std::size_t>(count));
+        } else if (keyword == "within") {
+            const auto radius = number();
+            expectKeyword("of");
+            if (consume("(")) {
+                const auto x = number();
+                expect(",");
+                const auto y = number();
+                expect(")");
+                query.within(utilities::CartesianCoordinates<double>(x, y), radius);
+            } else {
+                const auto id = number();
+                if (id < 0.0 || id != static_cast<double>(static_cast<utilities::SystemId>(id))) {
+                    fail("expected a system id");
+                }
+                query.withinOf(static_cast<utilities::SystemId>(id), radius);
+            }
+        } else if (keyword == "name") {
+            if (!consume("~")) {
+                expectKeyword("contains");
+            }
+            query.nameContains(quoted());
+        } else if (keyword == "owned") {
+            query.owned(true);
+        } else if (keyword == "unowned") {
+            query.owned(false);
+        } else {
+            m_position = start;
+            fail("unknown term '" + keyword + "'");
+        }
+    }
+
+    std::string_view m_text;
+    std::size_t m_position{0};
+};
+} // namespace
+
+SystemQuery SystemQuery::parse(std::string_view text) {
+    return Parser(text).parse();
+}
+
+SystemQuery& SystemQuery::starTypes(std::initializer_list<StarType> types) {
+    std::uint32_t mask = 0;
+    for (const auto type : types) {
+        mask |= bit(type);
+    }
+    return restrictStarTypes(mask);
+}
+
+SystemQuery& SystemQuery::systemSizes(std::initializer_list<SystemSize> sizes) {
+    std::uint32_t mask = 0;
+    for (const auto size : sizes) {
+        mask |= bit(size);
+    }
+    return restrictSystemSizes(mask);
+}
+
+SystemQuery& SystemQuery::restrictStarTypes(std::uint32_t mask) {
+    m_starTypeMask &= mask;
+    return *this;
+}
+
+SystemQuery& SystemQuery::restrictSystemSizes(std::uint32_t mask) {
+    m_systemSizeMask &= mask;
+    return *this;
+}
+
+SystemQuery& SystemQuery::planetCount(Comparison comparison, std::size_t count) {
+    switch (comparison) {
+        case Comparison::Less:
+            if (count == 0) {
+                // Nothing has fewer than zero planets
+                m_minPlanets = 1;
+                m_maxPlanets = 0;
+            } else {
+                m_maxPlanets = std::min(m_maxPlanets, count - 1);
+            }
+            break;
+        case Comparison::LessEqual:
+            m_maxPlanets = std::min(m_maxPlanets, count);
+            break;
+        case Comparison::Equal:
+            m_minPlanets = std::max(m_minPlanets, count);
+            m_maxPlanets = std::min(m_maxPlanets, count);
+            break;
+        case Comparison::GreaterEqual:
+            m_minPlanets = std::max(m_minPlanets, count);
+            break;
+        case Comparison::Greater:
+            m_minPlanets = std::max(m_minPlanets, count + 1);
+            break;
+    }
+    return *this;
+}
+
+SystemQuery& SystemQuery::within(const utilities::CartesianCoordinates<double>& centre, double radius) {
+    m_circles.push_back({std::nullopt, centre, radius});
+    return *this;
+}
+
+SystemQuery& SystemQuery::withinOf(utilities::SystemId system, double radius) {
+    m_circles.push_back({system, utilities::CartesianCoordinates<double>(0.0, 0.0), radius});
+    return *this;
+}
+
+SystemQuery& SystemQuery::inRect(double x1, double y1, double x2, double y2) {
+    const double minX = std::min(x1, x2);
+    const double minY = std::min(y1, y2);
+    const double maxX = std::max(x1, x2);
+    const double maxY = std::max(y1, y2);
+    if (m_hasRect) {
+        m_minX = std::max(m_minX, minX);
+        m_minY = std::max(m_minY, minY);
+        m_maxX = std::min(m_maxX, maxX);
+        m_maxY = std::min(m_maxY, maxY);
+    } else {
+        m_hasRect = true;
+        m_minX = minX;
+        m_minY = minY;
+        m_maxX = maxX;
+        m_maxY = maxY;
+    }
+    return *this;
+}
+
+SystemQuery& SystemQuery::nameContains(std::string_view text) {
+    m_nameFragments.push_back(SystemNameIndex::fold(text));
+    return *this;
+}
+
+SystemQuery& SystemQuery::owned(bool owned) {
+    if (m_owned && *m_owned != owned) {
+        // Owned and unowned at once: no system qualifies
+        m_starTypeMask = 0;
+    }
+    m_owned = owned;
+    return *this;
+}
+
+SystemQuery& SystemQuery::where(Predicate predicate) {
+    if (predicate) {
+        m_predicates.push_back(std::move(predicate));
+    }
+    return *this;
+}
+} // namespace ggh::GalaxyCore::models
@@ -0,0 +1,326 @@
+#include "ggh/modules/GalaxyCore/models/SystemQueryEngine.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "ggh/modules/GalaxyCore/models/SystemNameIndex.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+namespace ggh::GalaxyCore::models {
+
+std::string SystemQueryPlan::describe() const {
+    switch (access) {
+        case Access::Empty:
+            return "empty: no system can match";
+        case Access::ColumnScan:
+            return "column scan over " + std::to_string(estimatedRows) + " rows";
+        case Access::StarTypeRows:
+            return "star type rows: " + std::to_string(estimatedRows) + " rows";
+        case Access::SpatialRange:
+            return "spatial range: ~" + std::to_string(estimatedRows) + " rows";
+    }
+    return {};
+}
+
+void SystemQueryEngine::build(const GalaxyModel& galaxy) {
+    GGH_TRACE_SCOPE("SystemQueryEngine::build");
+    clear();
+
+    m_systems = galaxy.getAllStarSystems();
+    std::sort(m_systems.begin(), m_systems.end(),
+              [](const auto& a, const auto& b) { return a->getId() < b->getId(); });
+
+    const auto count = m_systems.size();
+    m_ids.reserve(count);
+    m_positions.reserve(count);
+    m_starTypes.reserve(count);
+    m_systemSizes.reserve(count);
+    m_planetCounts.reserve(count);
+    m_foldedNames.reserve(count);
+    for (Row row = 0; row < count; ++row) {
+        const auto& system = *m_systems[row];
+        const auto type = static_cast<std::uint8_t>(system.getStarType());
+        m_ids.push_back(system.getId());
+        m_positions.push_back(system.getPosition());
+        m_starTypes.push_back(type);
+        m_systemSizes.push_back(static_cast<std::uint8_t>(system.getSystemSize()));
+        m_planetCounts.push_back(static_cast<std::uint32_t>(system.planetCount()));
+        m_foldedNames.push_back(SystemNameIndex::fold(system.getName()));
+        if (type < STAR_TYPE_COUNT) {
+            m_rowsByStarType[type].push_back(row);
+        }
+    }
+
+    indexPositions();
+}
+
+bool SystemQueryEngine::update(std::span<const std::shared_ptr<StarSystemModel>> systems) {
+    GGH_TRACE_SCOPE("SystemQueryEngine::update");
+    bool moved = false;
+    for (const auto& system : systems) {
+        const auto row = rowOf(system->getId());
+        if (row == NO_ROW) {
+            if (moved) {
+                indexPositions();
+            }
+            return false;
+        }
+
+        m_systems[row] = system;
+        if (m_positions[row] != system->getPosition()) {
+            m_positions[row] = system->getPosition();
+            moved = true;
+        }
+        const auto type = static_cast<std::uint8_t>(system->getStarType());
+        if (m_starTypes[row] != type) {
+            // Star type rows stay in row order
+            if (m_starTypes[row] < STAR_TYPE_COUNT) {
+                auto& oldRows = m_rowsByStarType[m_starTypes[row]];
+                oldRows.erase(std::lower_bound(oldRows.begin(), oldRows.end(), row));
+            }
+            if (type < STAR_TYPE_COUNT) {
+                auto& newRows = m_rowsByStarType[type];
+                newRows.insert(std::lower_bound(newRows.begin(), newRows.end(), row), row);
+            }
+            m_starTypes[row] = type;
+        }
+        m_systemSizes[row] = static_cast<std::uint8_t>(system->getSystemSize());
+        m_planetCounts[row] = static_cast<std::uint32_t>(system->planetCount());
+        m_foldedNames[row] = SystemNameIndex::fold(system->getName());
+    }
+    if (moved) {
+        indexPositions();
+    }
+    return true;
+}
+
+void SystemQueryEngine::indexPositions() {
+    m_grid.build(m_positions);
+    m_minX = m_minY = m_maxX = m_maxY = 0.0;
+    if (!m_positions.empty()) {
+        const auto [minX, maxX] = std::minmax_element(m_positions.begin(), m_positions.end(),
+                                                      [](const auto& a, const auto& b) { return a.x < b.x; });
+        const auto [minY, maxY] = std::minmax_element(m_positions.begin(), m_positions.end(),
+                                                      [](const auto& a, const auto& b) { return a.y < b.y; });
+        m_minX = minX->x;
+        m_maxX = maxX->x;
+        m_minY = minY->y;
+        m_maxY = maxY->y;
+    }
+}
+
+void SystemQueryEngine::clear() {
+    m_ids.clear();
+    m_positions.clear();
+    m_starTypes.clear();
+    m_systemSizes.clear();
+    m_planetCounts.clear();
+    m_foldedNames.clear();
+    m_systems.clear();
+    for (auto& rows : m_rowsByStarType) {
+        rows.clear();
+    }
+    m_grid.build({});
+    m_minX = m_minY = m_maxX = m_maxY = 0.0;
+}
+
+void SystemQueryEngine::setOwnershipLookup(OwnershipLookup lookup) {
+    m_ownership = std::move(lookup);
+}
+
+SystemQueryEngine::Row SystemQueryEngine::rowOf(utilities::SystemId id) const {
+    const auto it = std::lower_bound(m_ids.begin(), m_ids.end(), id);
+    return it != m_ids.end() && *it == id ? static_cast<Row>(it - m_ids.begin()) : NO_ROW;
+}
+
+SystemQueryEngine::Bounds SystemQueryEngine::resolveBounds(const SystemQuery& query) const {
+    Bounds bounds;
+    bounds.circles = query.circles();
+    if (bounds.circles.empty() && !query.hasRect()) {
+        return bounds;
+    }
+
+    bounds.spatial = true;
+    bounds.minX = bounds.minY = -std::numeric_limits<double>::infinity();
+    bounds.maxX = bounds.maxY = std::numeric_limits<double>::infinity();
+    if (query.hasRect()) {
+        bounds.minX = query.rectMinX();
+        bounds.minY = query.rectMinY();
+        bounds.maxX = query.rectMaxX();
+        bounds.maxY = query.rectMaxY();
+    }
+    for (auto& circle : bounds.circles) {
+        if (circle.anchor) {
+            const auto row = rowOf(*circle.anchor);
+            if (row == NO_ROW) {
+                // Around a system that does not exist: nothing is near it
+                bounds.empty = true;
+                return bounds;
+            }
+            circle.centre = m_positions[row];
+        }
+        bounds.minX = std::max(bounds.minX, circle.centre.x - circle.radius);
+        bounds.minY = std::max(bounds.minY, circle.centre.y - circle.radius);
+        bounds.maxX = std::min(bounds.maxX, circle.centre.x + circle.radius);
+        bounds.maxY = std::min(bounds.maxY, circle.centre.y + circle.radius);
+    }
+    bounds.empty = bounds.minX > bounds.maxX || bounds.minY > bounds.maxY;
+    return bounds;
+}
+
+SystemQueryPlan SystemQueryEngine::plan(const SystemQuery& query) const {
+    return plan(query, resolveBounds(query));
+}
+
+SystemQueryPlan SystemQueryEngine::plan(const SystemQuery& query, const Bounds& bounds) const {
+    using Access = SystemQueryPlan::Access;
+    const auto rows = size();
+    if (rows == 0 || bounds.empty || query.starTypeMask() == 0 || query.systemSizeMask() == 0
+        || query.minPlanets() > query.maxPlanets()) {
+        return {Access::Empty, 0};
+    }
+
+    SystemQueryPlan best{Access::ColumnScan, rows};
+
+    std::size_t typeRows = 0;
+    for (std::size_t type = 0; type < STAR_TYPE_COUNT; ++type) {
+        if (query.starTypeMask() & (std::uint32_t{1} << type)) {
+            typeRows += m_rowsByStarType[type].size();
+        }
+    }
+    if (typeRows < best.estimatedRows) {
+        best = {typeRows == 0 ? Access::Empty : Access::StarTypeRows, typeRows};
+    }
+
+    if (bounds.spatial) {
+        // Share of the galaxy's extent under the query's bounding box, assuming even spread
+        const double width = std::max(m_maxX - m_minX, 1e-9);
+        const double height = std::max(m_maxY - m_minY, 1e-9);
+        const double overlapX = std::clamp(std::min(bounds.maxX, m_maxX) - std::max(bounds.minX, m_minX), 0.0, width);
+        const double overlapY = std::clamp(std::min(bounds.maxY, m_maxY) - std::max(bounds.minY, m_minY), 0.0, height);
+        // Degenerate extents (all systems on a line) would make the share meaningless; fall back to the overlap test
+        const double share = (m_maxX > m_minX && m_maxY > m_minY) ? (overlapX / width) * (overlapY / height)
+                                                                  : (overlapX > 0.0 || overlapY > 0.0 ? 1.0 : 0.0);
+        const auto spatialRows = static_cast<std::size_t>(share * static_cast<double>(rows));
+        const bool outside = bounds.maxX < m_minX || bounds.minX > m_maxX || bounds.maxY < m_minY || bounds.minY > m_maxY;
+        if (outside) {
+            return {Access::Empty, 0};
+        }
+        if (spatialRows < best.estimatedRows) {
+            best = {Access::SpatialRange, spatialRows};
+        }
+    }
+    return best;
+}
+
+bool SystemQueryEngine::accepts(Row row, const SystemQuery& query, const Bounds& bounds,
+                                SystemQueryPlan::Access access) const {
+    // Byte and integer columns first, then geometry, then strings, then callbacks
+    if (access != SystemQueryPlan::Access::StarTypeRows
+        && !(query.starTypeMask() & (std::uint32_t{1} << m_starTypes[row]))) {
+        return false;
+    }
+    if (!(query.systemSizeMask() & (std::uint32_t{1} << m_systemSizes[row]))) {
+        return false;
+    }
+    if (m_planetCounts[row] < query.minPlanets() || m_planetCounts[row] > query.maxPlanets()) {
+        return false;
+    }
+
+    const auto& position = m_positions[row];
+    if (bounds.spatial && (position.x < bounds.minX || position.x > bounds.maxX || position.y < bounds.minY
+                           || position.y > bounds.maxY)) {
+        return false;
+    }
+    for (const auto& circle : bounds.circles) {
+        if (utilities::calculateDistance(position, circle.centre) > circle.radius) {
+            return false;
+        }
+    }
+
+    for (const auto& fragment : query.nameFragments()) {
+        if (m_foldedNames[row].find(fragment) == std::string::npos) {
+            return false;
+        }
+    }
+    if (query.ownership() && m_ownership(m_ids[row]) != *query.ownership()) {
+        return false;
+    }
+    for (const auto& predicate : query.predicates()) {
+        if (!predicate(*m_systems[row])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<utilities::SystemId> SystemQueryEngine::execute(const SystemQuery& query, SystemQueryPlan* plan) const {
+    GGH_TRACE_SCOPE("SystemQueryEngine::execute");
+    if (query.ownership() && !m_ownership) {
+        throw std::logic_error("SystemQueryEngine: owned/unowned conditions need an ownership lookup");
+    }
+
+    const auto bounds = resolveBounds(query);
+    const auto chosen = this->plan(query, bounds);
+    if (plan) {
+        *plan = chosen;
+    }
+
+    std::vector<Row> rows;
+    switch (chosen.access) {
+        case SystemQueryPlan::Access::Empty:
+            break;
+        case SystemQueryPlan::Access::ColumnScan:
+            for (Row row = 0; row < size(); ++row) {
+                if (accepts(row, query, bounds, chosen.access)) {
+                    rows.push_back(row);
+                }
+            }
+            break;
+        case SystemQueryPlan::Access::StarTypeRows:
+            for (std::size_t type = 0; type < STAR_TYPE_COUNT; ++type) {
+                if (query.starTypeMask() & (std::uint32_t{1} << type)) {
+                    for (const auto row : m_rowsByStarType[type]) {
+                        if (accepts(row, query, bounds, chosen.access)) {
+                            rows.push_back(row);
+                        }
+                    }
+                }
+            }
+            std::sort(rows.begin(), rows.end());
+            break;
+        case SystemQueryPlan::Access::SpatialRange:
+            m_grid.forEachInRect(bounds.minX, bounds.minY, bounds.maxX, bounds.maxY, [&](utilities::SpatialGrid::Index row) {
+                if (accepts(row, query, bounds, chosen.access)) {
+                    rows.push_back(row);
+                }
+            });
+            std::sort(rows.begin(), rows.end());
+            break;
+    }
+
+    // Rows are in id order, so the ids come out sorted
+    std::vector<utilities::SystemId> ids;
+    ids.reserve(rows.size());
+    for (const auto row : rows) {
+        ids.push_back(m_ids[row]);
+    }
+    return ids;
+}
+
+void SystemQueryEngine::reportMemory(utilities::MemoryReport& report) const {
+    using namespace utilities::memory;
+    std::size_t bytes = heapBytes(m_ids) + heapBytes(m_positions) + heapBytes(m_starTypes) + heapBytes(m_systemSizes)
+                        + heapBytes(m_planetCounts) + heapBytes(m_foldedNames) + heapBytes(m_systems);
+    for (const auto& name : m_foldedNames) {
+        bytes += heapBytes(name);
+    }
+    for (const auto& rows : m_rowsByStarType) {
+        bytes += heapBytes(rows);
+    }
+    // The grid keeps a copy of the positions plus one cell offset and one entry per point, roughly
+    bytes += m_grid.size() * (sizeof(utilities::CartesianCoordinates<double>) + 2 * sizeof(utilities::SpatialGrid::Index));
+    report.add("galaxy.queryEngine", bytes, size());
+}
+} // namespace ggh::GalaxyCore::models
@@ -24,9 +24,21 @@ double TravelLaneModel::getLength() const noexcept {
     return distance;
 }
 
+double TravelLaneModel::getBetweenness() const noexcept {
+    return m_betweenness;
+}
+
+void TravelLaneModel::setBetweenness(double score) noexcept {
+    m_betweenness = score;
+}
+
 std::string TravelLaneModel::toXml() const {
     return std::format("<TravelLane id=\"{}\" fromSystem=\"{}\" toSystem=\"{}\" length=\"{}\"/>",
                        m_id, m_fromSystem->getId(), m_toSystem->getId(),
                        getLength());
     }
+
+void TravelLaneModel::reportMemory(utilities::MemoryReport& report) const {
+    report.add("travelLanes", sizeof(TravelLaneModel), 1);
+}
 }
\ No newline at end of file
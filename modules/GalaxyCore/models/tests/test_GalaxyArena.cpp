@@ -0,0 +1,109 @@
+#include "ggh/modules/GalaxyCore/models/GalaxyArena.h"
+
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+
+namespace ggh::GalaxyCore::models
+{
+namespace {
+using Coordinates = utilities::CartesianCoordinates<double>;
+
+void populate(GalaxyModel& galaxy, SystemId count) {
+    for (SystemId id = 1; id <= count; ++id) {
+        auto system = galaxy.makeStarSystem(id, "System " + std::to_string(id), Coordinates(id * 10.0, 0.0));
+        system->addPlanet(Planet("P" + std::to_string(id), PlanetType::Rocky, 1.0, 1.0, 0, 1.0, 300.0, 200.0));
+        galaxy.addStarSystem(std::move(system));
+        if (id > 1) {
+            galaxy.addTravelLane(id, id - 1, id);
+        }
+    }
+}
+} // namespace
+
+TEST(GalaxyArenaTest, GalaxyAllocatesFromItsArena) {
+    auto arena = std::make_shared<GalaxyArena>(1024);
+    GalaxyModel galaxy(100, 100, arena);
+    EXPECT_EQ(galaxy.arena(), arena);
+    const auto empty = arena->bytesReserved();
+
+    populate(galaxy, 2000);
+    EXPECT_GT(arena->bytesReserved(), empty + 2000 * sizeof(StarSystemModel));
+    EXPECT_EQ(galaxy.getStarSystem(1500)->getPlanets()[0]->name(), "P1500");
+    EXPECT_EQ(galaxy.lanesOf(1500).size(), 2u);
+
+    // Freed blocks are recycled instead of taking more from the heap
+    const auto reserved = arena->bytesReserved();
+    for (SystemId id = 1; id <= 100; ++id) {
+        galaxy.removeStarSystem(id);
+    }
+    for (SystemId id = 1; id <= 100; ++id) {
+        galaxy.addStarSystem(id, "Again", Coordinates(0.0, 0.0));
+    }
+    EXPECT_EQ(arena->bytesReserved(), reserved);
+
+    EXPECT_EQ(GalaxyModel(100, 100).arena(), nullptr);
+}
+
+TEST(GalaxyArenaTest, ObjectsKeepTheArenaAlive) {
+    std::shared_ptr<StarSystemModel> survivor;
+    std::weak_ptr<GalaxyArena> arena;
+    {
+        auto galaxy = std::make_unique<GalaxyModel>(100, 100, std::make_shared<GalaxyArena>());
+        arena = galaxy->arena();
+        populate(*galaxy, 50);
+        survivor = galaxy->getStarSystem(20);
+    }
+    ASSERT_FALSE(arena.expired());
+    survivor->addPlanet(Planet("Late", PlanetType::Ocean, 1.0, 1.0, 0, 2.0, 300.0, 200.0));
+    EXPECT_EQ(survivor->getPlanets().back()->name(), "Late");
+
+    survivor.reset();
+    EXPECT_TRUE(arena.expired());
+}
+
+TEST(GalaxyArenaTest, ReportsArenaControlBlocks) {
+    GalaxyModel heap(100, 100);
+    GalaxyModel pooled(100, 100, std::make_shared<GalaxyArena>());
+    populate(heap, 10);
+    populate(pooled, 10);
+
+    utilities::MemoryReport heapReport;
+    utilities::MemoryReport pooledReport;
+    heap.reportMemory(heapReport);
+    pooled.reportMemory(pooledReport);
+
+    // 10 systems, 10 planets and 9 lanes, each with the allocator kept in its control block
+    EXPECT_EQ(pooledReport.count("galaxy.sharedControlBlocks"), 29u);
+    EXPECT_EQ(heapReport.bytes("galaxy.sharedControlBlocks"), 29 * sharedControlBlockBytes(nullptr));
+    EXPECT_EQ(pooledReport.bytes("galaxy.sharedControlBlocks"), 29 * sharedControlBlockBytes(pooled.arena()));
+    EXPECT_GT(sharedControlBlockBytes(pooled.arena()), sharedControlBlockBytes(nullptr));
+}
+
+TEST(GalaxyArenaTest, ReleasesFromOtherThreads) {
+    auto galaxy = std::make_unique<GalaxyModel>(100, 100, std::make_shared<GalaxyArena>());
+    populate(*galaxy, 400);
+
+    // Workers hold the last references while the galaxy keeps allocating
+    std::vector<std::thread> workers;
+    for (SystemId w = 0; w < 4; ++w) {
+        std::vector<std::shared_ptr<StarSystemModel>> held;
+        for (SystemId id = 1 + w * 100; id <= (w + 1) * 100; ++id) {
+            held.push_back(galaxy->getStarSystem(id));
+            galaxy->removeStarSystem(id);
+        }
+        workers.emplace_back([held = std::move(held)]() mutable { held.clear(); });
+    }
+    for (SystemId id = 1000; id < 1400; ++id) {
+        galaxy->addStarSystem(id, "New", Coordinates(0.0, 0.0));
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    EXPECT_EQ(galaxy->getAllStarSystems().size(), 400u);
+    galaxy.reset();
+}
+} // namespace ggh::GalaxyCore::models
@@ -76,4 +76,92 @@ TEST(GalaxyModelTest, RemoveTravelLane) {
     EXPECT_TRUE(galaxy.removeTravelLane(laneId));
     EXPECT_EQ(galaxy.getTravelLane(laneId), nullptr);
 }
+
+TEST(GalaxyModelTest, ReportMemoryCountsOwnedObjects) {
+    GalaxyModel galaxy(1000, 1000);
+    galaxy.addStarSystem(1, "System A", utilities::CartesianCoordinates<double>(100.0, 200.0), StarType::YellowStar);
+    galaxy.addStarSystem(2, "System B", utilities::CartesianCoordinates<double>(300.0, 400.0), StarType::RedGiant);
+    galaxy.getStarSystem(1)->addPlanet(Planet("A I", PlanetType::Rocky, 1.0, 1.0, 0, 1.0, 300.0, 200.0));
+    galaxy.addTravelLane(1, 1, 2);
+    galaxy.rebuildPlanetCatalogue(1);
+
+    utilities::MemoryReport report;
+    galaxy.reportMemory(report);
+
+    EXPECT_EQ(report.count("galaxy"), 1u);
+    EXPECT_EQ(report.count("starSystems"), 2u);
+    EXPECT_EQ(report.count("planets"), 1u);
+    EXPECT_EQ(report.count("travelLanes"), 1u);
+    EXPECT_GE(report.bytes("planets"), sizeof(Planet));
+    EXPECT_GT(report.bytes("galaxy.laneGraph"), 0u);
+    EXPECT_EQ(report.count("galaxy.nameIndex"), 2u);
+    EXPECT_EQ(report.count("galaxy.planetCatalogue"), 1u);
+    EXPECT_EQ(report.bytes("galaxy"), sizeof(GalaxyModel));
+    EXPECT_EQ(report.count("galaxy.names"), 3u);
+    EXPECT_EQ(report.count("galaxy.sharedControlBlocks"), 4u);
+    EXPECT_EQ(report.bytes("galaxy.sharedControlBlocks"), 4 * utilities::memory::SHARED_CONTROL_BLOCK_BYTES);
+    EXPECT_GT(report.bytes("galaxy.hashBuckets"), 0u);
+    EXPECT_EQ(report.totalBytes(), report.bytes("galaxy") + report.bytes("galaxy.laneGraph")
+                                       + report.bytes("galaxy.nameIndex") + report.bytes("galaxy.planetCatalogue")
+                                       + report.bytes("galaxy.names") + report.bytes("galaxy.sharedControlBlocks")
+                                       + report.bytes("galaxy.hashBuckets") + report.bytes("starSystems")
+                                       + report.bytes("planets") + report.bytes("travelLanes"));
+
+    // Removing a lane releases its bytes
+    const auto before = report.totalBytes();
+    galaxy.removeTravelLane(1);
+    utilities::MemoryReport after;
+    galaxy.reportMemory(after);
+    EXPECT_LT(after.totalBytes(), before);
+    EXPECT_EQ(after.count("travelLanes"), 0u);
+}
+
+TEST(GalaxyModelTest, LanesOfReturnsConnectedLanes) {
+    GalaxyModel galaxy(1000, 1000);
+    galaxy.addStarSystem(1, "A", utilities::CartesianCoordinates<double>(0.0, 0.0));
+    galaxy.addStarSystem(2, "B", utilities::CartesianCoordinates<double>(10.0, 0.0));
+    galaxy.addStarSystem(3, "C", utilities::CartesianCoordinates<double>(20.0, 0.0));
+    galaxy.addTravelLane(1, 1, 2);
+    galaxy.addTravelLane(2, 2, 3);
+
+    EXPECT_EQ(galaxy.lanesOf(1).size(), 1u);
+    EXPECT_EQ(galaxy.lanesOf(2).size(), 2u);
+    EXPECT_TRUE(galaxy.lanesOf(42).empty());
+
+    galaxy.removeTravelLane(1);
+    EXPECT_TRUE(galaxy.lanesOf(1).empty());
+    EXPECT_EQ(galaxy.lanesOf(2).size(), 1u);
+}
+
+TEST(GalaxyModelTest, RemoveStarSystemCascadesToLanes) {
+    GalaxyModel galaxy(1000, 1000);
+    galaxy.addStarSystem(1, "A", utilities::CartesianCoordinates<double>(0.0, 0.0));
+    galaxy.addStarSystem(2, "B", utilities::CartesianCoordinates<double>(10.0, 0.0));
+    galaxy.addStarSystem(3, "C", utilities::CartesianCoordinates<double>(20.0, 0.0));
+    galaxy.addTravelLane(1, 1, 2);
+    galaxy.addTravelLane(2, 2, 3);
+    galaxy.addTravelLane(3, 1, 3);
+
+    std::weak_ptr<StarSystemModel> removed = galaxy.getStarSystem(2);
+    EXPECT_TRUE(galaxy.removeStarSystem(2));
+
+    EXPECT_EQ(galaxy.getTravelLane(1), nullptr);
+    EXPECT_EQ(galaxy.getTravelLane(2), nullptr);
+    ASSERT_NE(galaxy.getTravelLane(3), nullptr);
+    EXPECT_EQ(galaxy.getAllTravelLanes().size(), 1u);
+    EXPECT_TRUE(removed.expired());
+}
+
+TEST(GalaxyModelTest, SetStarSystemPositionUpdatesCachedLaneLength) {
+    GalaxyModel galaxy(1000, 1000);
+    galaxy.addStarSystem(1, "A", utilities::CartesianCoordinates<double>(0.0, 0.0));
+    galaxy.addStarSystem(2, "B", utilities::CartesianCoordinates<double>(10.0, 0.0));
+    galaxy.addTravelLane(1, 1, 2);
+
+    ASSERT_TRUE(galaxy.setStarSystemPosition(2, utilities::CartesianCoordinates<double>(0.0, 30.0)));
+    const auto& graph = galaxy.laneGraph();
+    EXPECT_DOUBLE_EQ(graph.neighbours(graph.indexOf(1)).lengths[0], 30.0);
+    EXPECT_DOUBLE_EQ(galaxy.getTravelLane(1)->getLength(), 30.0);
+    EXPECT_FALSE(galaxy.setStarSystemPosition(99, utilities::CartesianCoordinates<double>(0.0, 0.0)));
+}
 } // namespace ggh::GalaxyCore::models
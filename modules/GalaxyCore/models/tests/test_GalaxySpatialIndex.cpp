@@ -0,0 +1,117 @@
+#include "ggh/modules/GalaxyCore/models/GalaxySpatialIndex.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace ggh::GalaxyCore::models
+{
+
+namespace {
+using Coordinates = utilities::CartesianCoordinates<double>;
+
+double bruteSegmentDistance(const Coordinates& p, const Coordinates& a, const Coordinates& b) {
+    const double dx = b.x - a.x;
+    const double dy = b.y - a.y;
+    const double t = std::clamp(((p.x - a.x) * dx + (p.y - a.y) * dy) / (dx * dx + dy * dy), 0.0, 1.0);
+    return std::hypot(p.x - (a.x + t * dx), p.y - (a.y + t * dy));
+}
+} // namespace
+
+class GalaxySpatialIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 rng(17);
+        std::uniform_real_distribution<double> coordinate(0.0, 2000.0);
+        for (utilities::SystemId id = 1; id <= 3000; ++id) {
+            nodes.push_back({id, Coordinates(coordinate(rng), coordinate(rng))});
+        }
+        // Mostly short lanes plus a few galaxy-spanning ones, which a midpoint-only index would miss
+        std::uniform_int_distribution<utilities::SystemId> pick(1, 3000);
+        utilities::LaneId lane = 1;
+        for (utilities::SystemId id = 1; id < 3000; ++id) {
+            edges.push_back({lane++, id, id + 1});
+        }
+        for (int i = 0; i < 20; ++i) {
+            edges.push_back({lane++, pick(rng), pick(rng)});
+        }
+        graph.build(nodes, edges);
+        index.build(graph);
+    }
+
+    std::vector<LaneGraph::NodeRecord> nodes;
+    std::vector<LaneGraph::EdgeRecord> edges;
+    LaneGraph graph;
+    GalaxySpatialIndex index;
+};
+
+TEST_F(GalaxySpatialIndexTest, SystemAtFindsNearestWithinRadius) {
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<double> coordinate(-50.0, 2050.0);
+    for (int query = 0; query < 300; ++query) {
+        const Coordinates point(coordinate(rng), coordinate(rng));
+        utilities::SystemId expected = GalaxySpatialIndex::NO_SYSTEM;
+        double best = 25.0;
+        for (const auto& node : nodes) {
+            const double d = utilities::calculateDistance(point, node.position);
+            if (d <= best && (d < best || expected == GalaxySpatialIndex::NO_SYSTEM)) {
+                best = d;
+                expected = node.id;
+            }
+        }
+        EXPECT_EQ(index.systemAt(point.x, point.y, 25.0), expected);
+    }
+}
+
+TEST_F(GalaxySpatialIndexTest, SystemsInRectMatchesBruteForce) {
+    std::vector<utilities::SystemId> found;
+    index.systemsInRect(900.0, 1300.0, 400.0, 700.0, found);
+
+    std::vector<utilities::SystemId> expected;
+    for (const auto& node : nodes) {
+        if (node.position.x >= 400.0 && node.position.x <= 900.0 && node.position.y >= 700.0 && node.position.y <= 1300.0) {
+            expected.push_back(node.id);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    EXPECT_EQ(found, expected);
+}
+
+TEST_F(GalaxySpatialIndexTest, NearestLaneMatchesBruteForceIncludingLongLanes) {
+    std::mt19937 rng(9);
+    std::uniform_real_distribution<double> coordinate(0.0, 2000.0);
+    for (int query = 0; query < 300; ++query) {
+        const Coordinates point(coordinate(rng), coordinate(rng));
+        double best = 10.0;
+        for (const auto& edge : edges) {
+            const auto [from, to] = graph.endpoints(edge.lane);
+            if (from == 0) {
+                continue;
+            }
+            best = std::min(best, bruteSegmentDistance(point, graph.position(graph.indexOf(from)),
+                                                       graph.position(graph.indexOf(to))));
+        }
+
+        double distance = -1.0;
+        const auto lane = index.nearestLane(point.x, point.y, 10.0, &distance);
+        if (best < 10.0) {
+            ASSERT_NE(lane, GalaxySpatialIndex::NO_LANE);
+            EXPECT_NEAR(distance, best, 1e-9);
+        } else {
+            EXPECT_EQ(lane, GalaxySpatialIndex::NO_LANE);
+        }
+    }
+}
+
+TEST_F(GalaxySpatialIndexTest, GoesStaleWhenGraphChanges) {
+    EXPECT_TRUE(index.isValidFor(graph));
+    graph.setPosition(1, Coordinates(-500.0, -500.0));
+    EXPECT_FALSE(index.isValidFor(graph));
+
+    index.build(graph);
+    EXPECT_EQ(index.systemAt(-500.0, -500.0, 1.0), 1u);
+}
+
+} // namespace ggh::GalaxyCore::models
@@ -0,0 +1,130 @@
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+
+#include <algorithm>
+#include <random>
+#include <set>
+
+#include <gtest/gtest.h>
+
+namespace ggh::GalaxyCore::models
+{
+namespace {
+using Coordinates = utilities::CartesianCoordinates<double>;
+
+std::set<utilities::LaneId> laneSet(const LaneGraph& graph, utilities::SystemId id) {
+    auto lanes = graph.lanesOf(id);
+    return {lanes.begin(), lanes.end()};
+}
+} // namespace
+
+TEST(LaneGraphTest, AddEdgeIsUndirectedWithCachedLength) {
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(3.0, 4.0));
+
+    ASSERT_TRUE(graph.addEdge(10, 1, 2));
+    EXPECT_EQ(graph.edgeCount(), 1u);
+
+    auto fromA = graph.neighbours(graph.indexOf(1));
+    ASSERT_EQ(fromA.size(), 1u);
+    EXPECT_EQ(graph.systemId(fromA.nodes[0]), 2u);
+    EXPECT_EQ(fromA.lanes[0], 10u);
+    EXPECT_DOUBLE_EQ(fromA.lengths[0], 5.0);
+
+    auto fromB = graph.neighbours(graph.indexOf(2));
+    ASSERT_EQ(fromB.size(), 1u);
+    EXPECT_EQ(graph.systemId(fromB.nodes[0]), 1u);
+}
+
+TEST(LaneGraphTest, RejectsInvalidEdges) {
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(1.0, 0.0));
+
+    EXPECT_FALSE(graph.addEdge(1, 1, 1));
+    EXPECT_FALSE(graph.addEdge(1, 1, 99));
+    EXPECT_TRUE(graph.addEdge(1, 1, 2));
+    EXPECT_FALSE(graph.addEdge(1, 2, 1));
+    EXPECT_EQ(graph.edgeCount(), 1u);
+}
+
+TEST(LaneGraphTest, RemoveNodeCascadesAndKeepsIndicesConsistent) {
+    LaneGraph graph;
+    for (utilities::SystemId id = 1; id <= 4; ++id) {
+        graph.addNode(id, Coordinates(static_cast<double>(id), 0.0));
+    }
+    graph.addEdge(1, 1, 2);
+    graph.addEdge(2, 2, 3);
+    graph.addEdge(3, 3, 4);
+    graph.addEdge(4, 4, 1);
+
+    auto removed = graph.removeNode(2);
+    std::sort(removed.begin(), removed.end());
+    EXPECT_EQ(removed, (std::vector<utilities::LaneId>{1, 2}));
+    EXPECT_EQ(graph.nodeCount(), 3u);
+    EXPECT_EQ(graph.edgeCount(), 2u);
+    EXPECT_EQ(graph.indexOf(2), LaneGraph::INVALID_NODE);
+
+    // Node 4 was swapped into the freed index; its neighbours must still resolve to it
+    EXPECT_EQ(laneSet(graph, 4), (std::set<utilities::LaneId>{3, 4}));
+    auto neighbours = graph.neighbours(graph.indexOf(3));
+    ASSERT_EQ(neighbours.size(), 1u);
+    EXPECT_EQ(graph.systemId(neighbours.nodes[0]), 4u);
+}
+
+TEST(LaneGraphTest, SetPositionRefreshesBothHalfEdges) {
+    LaneGraph graph;
+    graph.addNode(1, Coordinates(0.0, 0.0));
+    graph.addNode(2, Coordinates(1.0, 0.0));
+    graph.addEdge(1, 1, 2);
+    const auto revision = graph.revision();
+
+    ASSERT_TRUE(graph.setPosition(2, Coordinates(0.0, 10.0)));
+    EXPECT_GT(graph.revision(), revision);
+    EXPECT_DOUBLE_EQ(graph.neighbours(graph.indexOf(1)).lengths[0], 10.0);
+    EXPECT_DOUBLE_EQ(graph.neighbours(graph.indexOf(2)).lengths[0], 10.0);
+}
+
+TEST(LaneGraphTest, IncrementalUpdatesMatchBulkBuild) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<utilities::SystemId> pick(1, 200);
+
+    LaneGraph incremental;
+    std::vector<LaneGraph::NodeRecord> nodes;
+    for (utilities::SystemId id = 1; id <= 200; ++id) {
+        Coordinates position(static_cast<double>(id % 17), static_cast<double>(id / 17));
+        incremental.addNode(id, position);
+        nodes.push_back({id, position});
+    }
+
+    std::vector<LaneGraph::EdgeRecord> edges;
+    for (utilities::LaneId lane = 1; lane <= 1500; ++lane) {
+        const auto from = pick(rng);
+        const auto to = pick(rng);
+        if (incremental.addEdge(lane, from, to)) {
+            edges.push_back({lane, from, to});
+        }
+    }
+    // Remove every third lane to exercise holes and compaction
+    std::vector<LaneGraph::EdgeRecord> kept;
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        if (i % 3 == 0) {
+            EXPECT_TRUE(incremental.removeEdge(edges[i].lane));
+        } else {
+            kept.push_back(edges[i]);
+        }
+    }
+
+    LaneGraph bulk;
+    bulk.build(nodes, kept);
+    ASSERT_EQ(bulk.edgeCount(), incremental.edgeCount());
+    for (utilities::SystemId id = 1; id <= 200; ++id) {
+        EXPECT_EQ(laneSet(bulk, id), laneSet(incremental, id)) << "system " << id;
+    }
+
+    incremental.compact();
+    for (utilities::SystemId id = 1; id <= 200; ++id) {
+        EXPECT_EQ(laneSet(bulk, id), laneSet(incremental, id)) << "system " << id;
+    }
+}
+} // namespace ggh::GalaxyCore::models
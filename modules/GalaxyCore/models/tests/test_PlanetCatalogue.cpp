@@ -0,0 +1,108 @@
+#include "ggh/modules/GalaxyCore/models/PlanetCatalogue.h"
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+
+namespace ggh::GalaxyCore::models
+{
+namespace {
+using Coordinates = utilities::CartesianCoordinates<double>;
+using Column = PlanetCatalogue::Column;
+
+void populate(GalaxyModel& galaxy, std::size_t systems, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> planetCount(0, 6);
+    std::uniform_int_distribution<int> type(0, 7);
+    std::uniform_int_distribution<int> moons(0, 5);
+    std::uniform_real_distribution<double> temperature(100.0, 400.0);
+    for (utilities::SystemId id = 1; id <= systems; ++id) {
+        auto system = std::make_shared<StarSystemModel>(id, "S" + std::to_string(id), Coordinates(0.0, 0.0));
+        for (int p = planetCount(rng); p > 0; --p) {
+            const double low = temperature(rng);
+            system->addPlanet(Planet("P" + std::to_string(p), static_cast<PlanetType>(type(rng)), 1.0 + p, 2.0 * p,
+                                     moons(rng), 0.5 * p, low + 40.0, low));
+        }
+        galaxy.addStarSystem(std::move(system));
+    }
+}
+
+std::vector<PlanetCatalogue::Row> bruteForce(const PlanetCatalogue& catalogue, const PlanetCatalogue::Query& query) {
+    std::vector<PlanetCatalogue::Row> rows;
+    for (PlanetCatalogue::Row row = 0; row < catalogue.size(); ++row) {
+        bool match = query.typeMask & (1u << static_cast<unsigned>(catalogue.type(row)));
+        for (const auto& range : query.ranges) {
+            const auto value = catalogue.value(range.column, row);
+            match = match && value >= range.min && value <= range.max;
+        }
+        if (match) {
+            rows.push_back(row);
+        }
+    }
+    return rows;
+}
+} // namespace
+
+TEST(PlanetCatalogueTest, ColumnsMirrorThePlanets) {
+    GalaxyModel galaxy(100, 100);
+    galaxy.addStarSystem(7, "Sol", Coordinates(0.0, 0.0));
+    galaxy.addStarSystem(3, "Vega", Coordinates(1.0, 0.0));
+    galaxy.getStarSystem(7)->addPlanet(Planet("Earth", PlanetType::Ocean, 1.0, 1.0, 1, 1.0, 320.0, 250.0));
+    galaxy.getStarSystem(7)->addPlanet(Planet("Mars", PlanetType::Desert, 0.5, 0.1, 2, 1.5, 290.0, 150.0));
+    galaxy.getStarSystem(3)->addPlanet(Planet("Vega I", PlanetType::GasGiant, 9.0, 300.0, 12, 5.0, 150.0, 90.0));
+    galaxy.rebuildPlanetCatalogue();
+
+    const auto& catalogue = galaxy.planetCatalogue();
+    ASSERT_EQ(catalogue.size(), 3u);
+    // Rows follow system id, then planet order
+    EXPECT_EQ(catalogue.systemOf(0), 3u);
+    EXPECT_EQ(catalogue.systemOf(2), 7u);
+    EXPECT_EQ(catalogue.planetIndexOf(2), 1u);
+    EXPECT_EQ(catalogue.type(1), PlanetType::Ocean);
+    EXPECT_DOUBLE_EQ(catalogue.value(Column::Moons, 0), 12.0);
+    EXPECT_DOUBLE_EQ(catalogue.value(Column::MinTemperature, 2), 150.0);
+
+    EXPECT_EQ(catalogue.countOfType(PlanetType::Ocean), 1u);
+    EXPECT_EQ(catalogue.typeBitmap(PlanetType::Desert)[0], 0b100u);
+
+    const auto warm = catalogue.rowsInRange(Column::MaxTemperature, 280.0, 330.0);
+    EXPECT_EQ(std::vector<PlanetCatalogue::Row>(warm.begin(), warm.end()), (std::vector<PlanetCatalogue::Row>{2, 1}));
+
+    // Ocean worlds between 250 and 320 K with moons
+    PlanetCatalogue::Query query;
+    query.typeMask = 1u << static_cast<unsigned>(PlanetType::Ocean);
+    query.ranges = {{Column::MinTemperature, 250.0}, {Column::MaxTemperature, {}, 320.0}, {Column::Moons, 1.0}};
+    EXPECT_EQ(catalogue.find(query), (std::vector<PlanetCatalogue::Row>{1}));
+}
+
+TEST(PlanetCatalogueTest, FindMatchesBruteForceForAnyThreadCount) {
+    GalaxyModel galaxy(100, 100);
+    populate(galaxy, 3000, 5);
+
+    PlanetCatalogue single;
+    single.build(galaxy, 1);
+    PlanetCatalogue parallel;
+    parallel.build(galaxy, 4);
+    ASSERT_EQ(single.size(), parallel.size());
+
+    std::vector<PlanetCatalogue::Query> queries(6);
+    queries[1].typeMask = 1u << static_cast<unsigned>(PlanetType::Frozen);
+    queries[2].ranges = {{Column::MaxTemperature, 200.0, 260.0}};
+    queries[3].typeMask = 0b1010;
+    queries[3].ranges = {{Column::Moons, 2.0, 3.0}, {Column::Size, 3.0}};
+    queries[4].ranges = {{Column::Mass, 1000.0}};
+    queries[5].typeMask = 0;
+
+    for (const auto& query : queries) {
+        const auto expected = bruteForce(single, query);
+        EXPECT_EQ(single.find(query), expected);
+        EXPECT_EQ(parallel.find(query), expected);
+    }
+    for (PlanetCatalogue::Row row = 0; row < single.size(); row += 97) {
+        EXPECT_EQ(single.systemOf(row), parallel.systemOf(row));
+        EXPECT_EQ(single.value(Column::OrbitalRadius, row), parallel.value(Column::OrbitalRadius, row));
+    }
+}
+} // namespace ggh::GalaxyCore::models
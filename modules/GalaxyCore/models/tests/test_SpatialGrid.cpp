@@ -0,0 +1,76 @@
+#include "ggh/modules/GalaxyCore/utilities/SpatialGrid.h"
+
+#include <algorithm>
+#include <random>
+
+#include <gtest/gtest.h>
+
+namespace ggh::GalaxyCore::utilities
+{
+
+class SpatialGridTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<double> coordinate(-500.0, 500.0);
+        for (int i = 0; i < 2000; ++i) {
+            points.emplace_back(coordinate(rng), coordinate(rng));
+        }
+        grid.build(points);
+    }
+
+    std::vector<CartesianCoordinates<double>> points;
+    SpatialGrid grid;
+};
+
+TEST_F(SpatialGridTest, RadiusQueryMatchesBruteForce) {
+    const CartesianCoordinates<double> centre(12.0, -40.0);
+    std::vector<SpatialGrid::Index> found;
+    grid.forEachInRadius(centre, 75.0, [&](SpatialGrid::Index index, double) { found.push_back(index); });
+    std::sort(found.begin(), found.end());
+
+    std::vector<SpatialGrid::Index> expected;
+    for (SpatialGrid::Index i = 0; i < points.size(); ++i) {
+        if (calculateDistance(centre, points[i]) <= 75.0) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_EQ(found, expected);
+}
+
+TEST_F(SpatialGridTest, RectQueryMatchesBruteForce) {
+    std::size_t found = 0;
+    grid.forEachInRect(-100.0, 0.0, 50.0, 300.0, [&](SpatialGrid::Index) { ++found; });
+
+    const auto expected = std::count_if(points.begin(), points.end(), [](const auto& p) {
+        return p.x >= -100.0 && p.x <= 50.0 && p.y >= 0.0 && p.y <= 300.0;
+    });
+    EXPECT_EQ(found, static_cast<std::size_t>(expected));
+}
+
+TEST_F(SpatialGridTest, NearestHonoursPredicate) {
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<double> coordinate(-700.0, 700.0);
+    auto even = [](SpatialGrid::Index index) { return index % 2 == 0; };
+    for (int query = 0; query < 100; ++query) {
+        const CartesianCoordinates<double> centre(coordinate(rng), coordinate(rng));
+        const auto found = grid.nearest(centre, even);
+        ASSERT_NE(found, SpatialGrid::INVALID_INDEX);
+
+        double best = std::numeric_limits<double>::infinity();
+        for (SpatialGrid::Index i = 0; i < points.size(); i += 2) {
+            best = std::min(best, calculateDistance(centre, points[i]));
+        }
+        EXPECT_DOUBLE_EQ(calculateDistance(centre, points[found]), best);
+    }
+}
+
+TEST(SpatialGridEmptyTest, QueriesOnEmptyGridFindNothing) {
+    SpatialGrid grid;
+    grid.build({});
+    EXPECT_TRUE(grid.empty());
+    EXPECT_EQ(grid.nearest(CartesianCoordinates<double>(0.0, 0.0), [](SpatialGrid::Index) { return true; }),
+              SpatialGrid::INVALID_INDEX);
+}
+
+} // namespace ggh::GalaxyCore::utilities
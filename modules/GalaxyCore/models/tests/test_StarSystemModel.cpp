@@ -79,4 +79,58 @@ TEST(StarSystemModelTest, PlanetXmlConversion) {
 }
 
 
-}
\ No newline at end of file
+namespace {
+// One planet per size class step, named after the system and numbered by the key
+class TestPlanetSource : public PlanetSource {
+public:
+    void generate(std::uint64_t key, SystemSize size, const std::string& systemName,
+                  std::vector<Planet>& planets) const override {
+        for (int i = 0; i <= static_cast<int>(size); ++i) {
+            planets.emplace_back(systemName + " " + std::to_string(key + i), PlanetType::Rocky, 1.0, 1.0, 0, 1.0 + i,
+                                 300.0, 200.0);
+        }
+    }
+
+    std::size_t count(std::uint64_t, SystemSize size) const override { return static_cast<std::size_t>(size) + 1; }
+};
+
+const auto TEST_SOURCE = std::make_shared<const TestPlanetSource>();
+} // namespace
+
+TEST(StarSystemModelTest, DeferredPlanetsGenerateOnFirstRead) {
+    StarSystemModel system(6, "Lazy", {0.0, 0.0}, StarType::YellowStar);
+    system.setSystemSize(SystemSize::Large);
+    system.addPlanet(Planet("Replaced", PlanetType::Ocean, 1.0, 1.0, 0, 1.0, 300.0, 200.0));
+    system.deferPlanets(TEST_SOURCE, 40);
+
+    EXPECT_TRUE(system.hasDeferredPlanets());
+    EXPECT_EQ(system.planetCount(), 3u);
+    EXPECT_TRUE(system.hasDeferredPlanets());
+
+    const auto& planets = system.getPlanets();
+    EXPECT_FALSE(system.hasDeferredPlanets());
+    ASSERT_EQ(planets.size(), 3u);
+    EXPECT_EQ(planets[0]->name(), "Lazy 40");
+    EXPECT_EQ(planets[2]->name(), "Lazy 42");
+    EXPECT_EQ(system.planetCount(), 3u);
+}
+
+TEST(StarSystemModelTest, ChangesGenerateDeferredPlanetsFirst) {
+    // A rename or resize after deferring keeps the planets the original name and size produce
+    StarSystemModel system(7, "Before", {0.0, 0.0});
+    system.setSystemSize(SystemSize::Small);
+    system.deferPlanets(TEST_SOURCE, 1);
+    system.setName("After");
+    system.setSystemSize(SystemSize::Huge);
+    EXPECT_FALSE(system.hasDeferredPlanets());
+    ASSERT_EQ(system.getPlanets().size(), 1u);
+    EXPECT_EQ(system.getPlanets()[0]->name(), "Before 1");
+
+    StarSystemModel other(8, "Other", {0.0, 0.0});
+    other.deferPlanets(TEST_SOURCE, 5);
+    other.addPlanet(Planet("Extra", PlanetType::Toxic, 1.0, 1.0, 0, 9.0, 300.0, 200.0));
+    ASSERT_EQ(other.getPlanets().size(), 3u);
+    EXPECT_EQ(other.getPlanets().back()->name(), "Extra");
+    EXPECT_NE(other.toXml().find("Other 6"), std::string::npos);
+}
+}
@@ -0,0 +1,192 @@
+#include "ggh/modules/GalaxyCore/models/SystemNameIndex.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+
+namespace ggh::GalaxyCore::models
+{
+namespace {
+using Coordinates = utilities::CartesianCoordinates<double>;
+
+std::vector<utilities::SystemId> prefixIds(const SystemNameIndex& index, std::string_view prefix,
+                                           std::size_t limit = 100) {
+    std::vector<utilities::SystemId> ids;
+    index.prefixSearch(prefix, limit, ids);
+    return ids;
+}
+} // namespace
+
+TEST(SystemNameIndexTest, PrefixSearchIgnoresCaseAndKeepsNameOrder) {
+    SystemNameIndex index;
+    index.insert(1, "Sol");
+    index.insert(2, "sirius");
+    index.insert(3, "Solace");
+    index.insert(4, "Vega");
+    index.insert(5, "SOLARIS");
+
+    EXPECT_EQ(prefixIds(index, "sol"), (std::vector<utilities::SystemId>{1, 3, 5}));
+    EXPECT_EQ(prefixIds(index, "S"), (std::vector<utilities::SystemId>{2, 1, 3, 5}));
+    EXPECT_TRUE(prefixIds(index, "x").empty());
+
+    // The total counts matches past the limit
+    std::vector<utilities::SystemId> ids;
+    EXPECT_EQ(index.prefixSearch("s", 2, ids), 4u);
+    EXPECT_EQ(ids, (std::vector<utilities::SystemId>{2, 1}));
+}
+
+TEST(SystemNameIndexTest, SearchRanksPrefixMatchesBeforeSubstrings) {
+    SystemNameIndex index;
+    index.insert(1, "Alpha Centauri");
+    index.insert(2, "Centaur Gate");
+    index.insert(3, "New Centauri");
+    index.insert(4, "Barnard");
+
+    std::vector<utilities::SystemId> ids;
+    EXPECT_EQ(index.search("CENTAUR", 10, ids), 3u);
+    EXPECT_EQ(ids, (std::vector<utilities::SystemId>{2, 1, 3}));
+
+    ids.clear();
+    EXPECT_EQ(index.search("", 2, ids), 4u);
+    EXPECT_EQ(ids.size(), 2u);
+}
+
+TEST(SystemNameIndexTest, MatchesBruteForceAcrossEdits) {
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> letter(0, 5);
+    SystemNameIndex index;
+    std::vector<std::string> names(400);
+    for (utilities::SystemId id = 1; id < names.size(); ++id) {
+        for (int i = 0; i < 5; ++i) {
+            names[id] += static_cast<char>((i % 2 ? 'a' : 'A') + letter(rng));
+        }
+        // Enough names to merge the recent run into the sorted entries several times
+        index.insert(id, names[id]);
+    }
+    for (utilities::SystemId id = 1; id < names.size(); id += 3) {
+        const auto renamed = names[id].substr(0, 2) + "zz";
+        index.rename(id, names[id], renamed);
+        names[id] = renamed;
+    }
+    for (utilities::SystemId id = 2; id < names.size(); id += 11) {
+        ASSERT_TRUE(index.erase(id, names[id]));
+        names[id].clear();
+    }
+    EXPECT_FALSE(index.erase(2, "missing"));
+
+    for (const std::string text : {"a", "Ab", "bZ", "zz", "c"}) {
+        std::vector<utilities::SystemId> expected;
+        const auto folded = SystemNameIndex::fold(text);
+        for (utilities::SystemId id = 1; id < names.size(); ++id) {
+            if (!names[id].empty() && SystemNameIndex::fold(names[id]).find(folded) != std::string::npos) {
+                expected.push_back(id);
+            }
+        }
+        std::vector<utilities::SystemId> ids;
+        EXPECT_EQ(index.search(text, names.size(), ids), expected.size()) << text;
+        std::sort(ids.begin(), ids.end());
+        EXPECT_EQ(ids, expected) << text;
+    }
+}
+
+TEST(SystemNameIndexTest, EqualIdsSpansBothRuns) {
+    SystemNameIndex index;
+    // Merged into the sorted entries by the fillers; the later names stay in the recent run
+    index.insert(300, "Vega");
+    for (utilities::SystemId id = 10; id < 200; ++id) {
+        index.insert(id, "Filler " + std::to_string(id));
+    }
+    index.insert(5, "VEGA");
+    index.insert(7, "vega");
+    index.insert(8, "Vegas");
+
+    EXPECT_EQ(index.equalIds("Vega"), (std::vector<utilities::SystemId>{5, 7, 300}));
+    EXPECT_TRUE(index.equalIds("Veg").empty());
+}
+
+TEST(SystemNameIndexTest, ConcurrentQueriesLeaveTheIndexUntouched) {
+    SystemNameIndex index;
+    for (utilities::SystemId id = 1; id <= 500; ++id) {
+        index.insert(id, "Sector " + std::to_string(id));
+    }
+    index.insert(501, "Sector Prime");
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&index] {
+            for (int i = 0; i < 50; ++i) {
+                std::vector<utilities::SystemId> ids;
+                EXPECT_EQ(index.search("prime", 10, ids), 1u);
+                EXPECT_EQ(index.prefixSearch("sector 1", 5, ids), 111u);
+                EXPECT_EQ(index.equalIds("SECTOR PRIME").size(), 1u);
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+}
+
+TEST(SystemNameIndexTest, BuildReplacesTheIndexInOneSort) {
+    SystemNameIndex index;
+    index.insert(99, "Stale");
+    const std::vector<std::pair<utilities::SystemId, std::string_view>> names{
+        {3, "Solace"}, {1, "Sol"}, {2, "sirius"}};
+    index.build(names);
+
+    EXPECT_EQ(index.size(), 3u);
+    EXPECT_EQ(prefixIds(index, "s"), (std::vector<utilities::SystemId>{2, 1, 3}));
+    EXPECT_TRUE(prefixIds(index, "stale").empty());
+
+    // Later edits land on top of the built index
+    index.insert(4, "Sola");
+    EXPECT_EQ(prefixIds(index, "sol"), (std::vector<utilities::SystemId>{1, 4, 3}));
+}
+
+TEST(SystemNameIndexTest, GalaxyIndexesDeferredSystemsOnRebuild) {
+    GalaxyModel galaxy(100, 100);
+    for (utilities::SystemId id = 1; id <= 3; ++id) {
+        galaxy.addStarSystem(galaxy.makeStarSystem(id, "System " + std::to_string(id), Coordinates(0.0, 0.0)),
+                             GalaxyModel::NameIndexing::Deferred);
+    }
+    EXPECT_TRUE(galaxy.nameIndex().empty());
+
+    galaxy.rebuildNameIndex();
+    EXPECT_EQ(galaxy.nameIndex().size(), 3u);
+    EXPECT_EQ(galaxy.findStarSystemByName("System 2")->getId(), 2u);
+
+    // Renames after the rebuild are followed as usual
+    galaxy.getStarSystem(2)->setName("Renamed");
+    EXPECT_EQ(galaxy.findStarSystemByName("Renamed")->getId(), 2u);
+    EXPECT_EQ(galaxy.findStarSystemByName("System 2"), nullptr);
+}
+
+TEST(SystemNameIndexTest, GalaxyKeepsIndexInSyncWithRenames) {
+    auto sol = std::make_shared<StarSystemModel>(1, "Sol", Coordinates(0.0, 0.0));
+    {
+        GalaxyModel galaxy(100, 100);
+        galaxy.addStarSystem(2, "sol", Coordinates(1.0, 1.0));
+        galaxy.addStarSystem(std::shared_ptr<StarSystemModel>(sol));
+
+        EXPECT_EQ(galaxy.findStarSystemByName("Sol"), sol);
+        EXPECT_EQ(galaxy.findStarSystemByName("sol")->getId(), 2u);
+        EXPECT_EQ(galaxy.findStarSystemByName("SOL"), nullptr);
+
+        sol->setName("Terra");
+        EXPECT_EQ(galaxy.findStarSystemByName("Terra"), sol);
+        EXPECT_EQ(prefixIds(galaxy.nameIndex(), "so"), (std::vector<utilities::SystemId>{2}));
+
+        ASSERT_TRUE(galaxy.removeStarSystem(2));
+        EXPECT_TRUE(prefixIds(galaxy.nameIndex(), "so").empty());
+        EXPECT_EQ(galaxy.nameIndex().size(), 1u);
+    }
+    // The galaxy is gone; renaming the surviving system must not touch its index
+    sol->setName("Sol");
+    EXPECT_EQ(sol->getName(), "Sol");
+}
+} // namespace ggh::GalaxyCore::models
@@ -0,0 +1,179 @@
+#include "ggh/modules/GalaxyCore/models/SystemQueryEngine.h"
+
+#include <random>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+namespace ggh::GalaxyCore::models
+{
+namespace {
+using Coordinates = utilities::CartesianCoordinates<double>;
+
+// Random galaxy with a spread of types, sizes, planet counts and names
+void populate(GalaxyModel& galaxy, std::size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    std::uniform_int_distribution<int> type(0, 6);
+    std::uniform_int_distribution<int> size(0, 3);
+    std::uniform_int_distribution<int> planets(0, 8);
+    const char* names[] = {"Sol", "Vega", "Altair", "Deneb", "Rigel"};
+    for (utilities::SystemId id = 1; id <= count; ++id) {
+        auto system = std::make_shared<StarSystemModel>(id, std::string(names[id % 5]) + std::to_string(id),
+                                                        Coordinates(coordinate(rng), coordinate(rng)),
+                                                        static_cast<StarType>(type(rng)));
+        system->setSystemSize(static_cast<SystemSize>(size(rng)));
+        for (int planet = planets(rng); planet > 0; --planet) {
+            system->addPlanet(Planet("p", PlanetType::Rocky, 1.0, 1.0, 0, 1.0, 300.0, 200.0));
+        }
+        galaxy.addStarSystem(std::move(system));
+    }
+}
+
+bool owns(utilities::SystemId id) {
+    return id % 3 == 0;
+}
+
+// Reference answer: every condition checked on every system
+std::vector<utilities::SystemId> bruteForce(const GalaxyModel& galaxy, const SystemQuery& query) {
+    std::vector<utilities::SystemId> ids;
+    for (const auto& system : galaxy.getAllStarSystems()) {
+        const auto planets = system->getPlanets().size();
+        bool match = (query.starTypeMask() & (1u << static_cast<unsigned>(system->getStarType())))
+                     && (query.systemSizeMask() & (1u << static_cast<unsigned>(system->getSystemSize())))
+                     && planets >= query.minPlanets() && planets <= query.maxPlanets();
+        const auto& position = system->getPosition();
+        if (query.hasRect()) {
+            match = match && position.x >= query.rectMinX() && position.x <= query.rectMaxX()
+                    && position.y >= query.rectMinY() && position.y <= query.rectMaxY();
+        }
+        for (const auto& circle : query.circles()) {
+            const auto anchor = circle.anchor ? galaxy.getStarSystem(*circle.anchor) : nullptr;
+            if (circle.anchor && !anchor) {
+                match = false;
+                continue;
+            }
+            const auto centre = anchor ? anchor->getPosition() : circle.centre;
+            match = match && utilities::calculateDistance(position, centre) <= circle.radius;
+        }
+        for (const auto& fragment : query.nameFragments()) {
+            match = match && SystemNameIndex::fold(system->getName()).find(fragment) != std::string::npos;
+        }
+        if (query.ownership()) {
+            match = match && owns(system->getId()) == *query.ownership();
+        }
+        for (const auto& predicate : query.predicates()) {
+            match = match && predicate(*system);
+        }
+        if (match) {
+            ids.push_back(system->getId());
+        }
+    }
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+} // namespace
+
+TEST(SystemQueryTest, ParsesEveryTerm) {
+    const auto query = SystemQuery::parse(
+        "type in (BlueStar, redgiant) AND size = Huge and planets >= 2 and planets < 6"
+        " and within 150 of 42 and within 80.5 of (10, -20) and name ~ \"Vega\" and unowned");
+    EXPECT_EQ(query.starTypeMask(), (1u << static_cast<unsigned>(StarType::BlueStar))
+                                        | (1u << static_cast<unsigned>(StarType::RedGiant)));
+    EXPECT_EQ(query.systemSizeMask(), 1u << static_cast<unsigned>(SystemSize::Huge));
+    EXPECT_EQ(query.minPlanets(), 2u);
+    EXPECT_EQ(query.maxPlanets(), 5u);
+    ASSERT_EQ(query.circles().size(), 2u);
+    EXPECT_EQ(query.circles()[0].anchor, 42u);
+    EXPECT_DOUBLE_EQ(query.circles()[0].radius, 150.0);
+    EXPECT_FALSE(query.circles()[1].anchor);
+    EXPECT_DOUBLE_EQ(query.circles()[1].centre.y, -20.0);
+    EXPECT_EQ(query.nameFragments(), std::vector<std::string>{"vega"});
+    EXPECT_EQ(query.ownership(), false);
+
+    EXPECT_EQ(SystemQuery::parse("   ").starTypeMask(), SystemQuery::ALL);
+}
+
+TEST(SystemQueryTest, RejectsMalformedText) {
+    for (const char* text : {"type = Pulsar", "planets > many", "within 10 of", "name ~ \"open", "type = BlueStar or owned",
+                             "colour = red", "planets > 2.5", "size in (Small"}) {
+        EXPECT_THROW(SystemQuery::parse(text), std::invalid_argument) << text;
+    }
+}
+
+TEST(SystemQueryTest, MatchesBruteForce) {
+    GalaxyModel galaxy(1000, 1000);
+    populate(galaxy, 3000, 11);
+    SystemQueryEngine engine;
+    engine.build(galaxy);
+    engine.setOwnershipLookup(owns);
+
+    std::vector<SystemQuery> queries{
+        SystemQuery(),
+        SystemQuery::parse("type = BlackHole"),
+        SystemQuery::parse("type in (RedDwarf, YellowStar) and size = Small and planets > 3"),
+        SystemQuery::parse("within 120 of 17 and owned"),
+        SystemQuery::parse("within 200 of (500, 500) and within 200 of (650, 500) and name ~ 'VEGA'"),
+        SystemQuery::parse("within 50 of 99999"),
+        SystemQuery::parse("planets < 0"),
+        SystemQuery::parse("owned and unowned"),
+        SystemQuery().inRect(900, 100, 100, 300).planetCount(SystemQuery::Comparison::Equal, 4),
+        SystemQuery().starTypes({StarType::Neutron}).where([](const StarSystemModel& s) { return s.getId() % 2; }),
+        SystemQuery().within(Coordinates(-500.0, -500.0), 10.0),
+    };
+    for (const auto& query : queries) {
+        SystemQueryPlan plan;
+        const auto ids = engine.execute(query, &plan);
+        EXPECT_EQ(ids, bruteForce(galaxy, query)) << plan.describe();
+    }
+}
+
+TEST(SystemQueryTest, UpdatedRowsMatchBruteForce) {
+    GalaxyModel galaxy(1000, 1000);
+    populate(galaxy, 2000, 5);
+    SystemQueryEngine engine;
+    engine.build(galaxy);
+    engine.setOwnershipLookup(owns);
+
+    std::vector<std::shared_ptr<StarSystemModel>> edited;
+    for (utilities::SystemId id = 1; id <= 2000; id += 97) {
+        auto system = galaxy.getStarSystem(id);
+        system->setStarType(StarType::BlackHole);
+        system->setName("Edited " + std::to_string(id));
+        galaxy.setStarSystemPosition(id, Coordinates(1500.0 + id, 1500.0));
+        edited.push_back(system);
+    }
+    ASSERT_TRUE(engine.update(edited));
+
+    for (const auto& query : {SystemQuery::parse("type = BlackHole"), SystemQuery::parse("name ~ 'edited'"),
+                              SystemQuery::parse("within 300 of (1800, 1500)"),
+                              SystemQuery::parse("type = BlackHole and within 100 of (500, 500)")}) {
+        SystemQueryPlan plan;
+        EXPECT_EQ(engine.execute(query, &plan), bruteForce(galaxy, query)) << plan.describe();
+    }
+
+    // A system added after the snapshot cannot be updated in place
+    galaxy.addStarSystem(5000, "New", Coordinates(1.0, 1.0));
+    EXPECT_FALSE(engine.update(std::vector{galaxy.getStarSystem(5000)}));
+}
+
+TEST(SystemQueryTest, PlannerPicksTheNarrowestAccessPath) {
+    GalaxyModel galaxy(1000, 1000);
+    populate(galaxy, 5000, 3);
+    SystemQueryEngine engine;
+    engine.build(galaxy);
+
+    using Access = SystemQueryPlan::Access;
+    EXPECT_EQ(engine.plan(SystemQuery()).access, Access::ColumnScan);
+    EXPECT_EQ(engine.plan(SystemQuery::parse("size = Small")).access, Access::ColumnScan);
+    EXPECT_EQ(engine.plan(SystemQuery::parse("type = Neutron")).access, Access::StarTypeRows);
+    EXPECT_EQ(engine.plan(SystemQuery::parse("type = Neutron and within 30 of 5")).access, Access::SpatialRange);
+    EXPECT_EQ(engine.plan(SystemQuery::parse("type = Neutron and within 900 of 5")).access, Access::StarTypeRows);
+    EXPECT_EQ(engine.plan(SystemQuery::parse("within 10 of (5000, 5000)")).access, Access::Empty);
+    EXPECT_EQ(engine.plan(SystemQuery::parse("type = Neutron")).estimatedRows,
+              engine.execute(SystemQuery::parse("type = Neutron")).size());
+
+    // Ownership conditions need the lookup
+    EXPECT_THROW(engine.execute(SystemQuery::parse("owned")), std::logic_error);
+}
+} // namespace ggh::GalaxyCore::models
@@ -0,0 +1,137 @@
+#ifndef GGH_MODULES_GALAXYCORE_UTILITIES_MEMORY_REPORT_H
+#define GGH_MODULES_GALAXYCORE_UTILITIES_MEMORY_REPORT_H
+/**
+ * @file MemoryReport.h
+ * @brief Per-category accounting of bytes owned by model objects.
+ *
+ * Models implement `void reportMemory(MemoryReport& report) const` and add the bytes they own
+ * (the object itself plus its heap allocations) under a category name. Objects shared through
+ * std::shared_ptr are only counted by their owner, so totals do not double count.
+ * Figures are estimates based on container capacities and typical standard library layouts.
+ */
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace ggh::GalaxyCore::utilities {
+
+/**
+ * @class MemoryReport
+ * @brief Accumulates owned bytes and object counts by category.
+ */
+class MemoryReport {
+public:
+    struct Entry {
+        std::size_t bytes{0};  ///< Owned bytes attributed to the category
+        std::size_t count{0};  ///< Number of objects attributed to the category
+    };
+
+    /**
+     * @brief Adds bytes (and optionally objects) to a category.
+     */
+    void add(std::string_view category, std::size_t bytes, std::size_t count = 0) {
+        auto& entry = m_entries[std::string(category)];
+        entry.bytes += bytes;
+        entry.count += count;
+    }
+
+    /**
+     * @brief Bytes recorded for a category, 0 if unknown.
+     */
+    std::size_t bytes(std::string_view category) const {
+        auto it = m_entries.find(std::string(category));
+        return it != m_entries.end() ? it->second.bytes : 0;
+    }
+
+    /**
+     * @brief Objects recorded for a category, 0 if unknown.
+     */
+    std::size_t count(std::string_view category) const {
+        auto it = m_entries.find(std::string(category));
+        return it != m_entries.end() ? it->second.count : 0;
+    }
+
+    /**
+     * @brief Sum of bytes over all categories.
+     */
+    std::size_t totalBytes() const {
+        std::size_t total = 0;
+        for (const auto& [category, entry] : m_entries) {
+            total += entry.bytes;
+        }
+        return total;
+    }
+
+    /**
+     * @brief All categories, sorted by name.
+     */
+    const std::map<std::string, Entry>& entries() const noexcept {
+        return m_entries;
+    }
+
+    void clear() noexcept {
+        m_entries.clear();
+    }
+
+private:
+    std::map<std::string, Entry> m_entries;
+};
+
+namespace memory {
+
+/// Approximate size of the control block that std::make_shared co-allocates with its object
+/// (std::allocate_shared adds the size of the allocator it keeps).
+inline constexpr std::size_t SHARED_CONTROL_BLOCK_BYTES = 2 * sizeof(void*);
+
+/**
+ * @brief Heap bytes owned by a string (0 while it fits the small-string buffer).
+ */
+inline std::size_t heapBytes(const std::string& value) noexcept {
+    static const std::size_t smallCapacity = std::string().capacity();
+    return value.capacity() > smallCapacity ? value.capacity() + 1 : 0;
+}
+
+/**
+ * @brief Heap bytes owned by a vector's element storage (not the elements' own allocations).
+ */
+template <typename T, typename Alloc>
+std::size_t heapBytes(const std::vector<T, Alloc>& values) noexcept {
+    return values.capacity() * sizeof(T);
+}
+
+/**
+ * @brief Heap bytes owned by an unordered_map's buckets and nodes (not the values' own allocations).
+ */
+template <typename K, typename V, typename H, typename E, typename A>
+std::size_t heapBytes(const std::unordered_map<K, V, H, E, A>& values) noexcept {
+    using Node = std::pair<const K, V>;
+    return values.bucket_count() * sizeof(void*) + values.size() * (sizeof(Node) + 2 * sizeof(void*));
+}
+
+/**
+ * @brief Heap bytes owned by an unordered_set's buckets and nodes.
+ */
+template <typename K, typename H, typename E, typename A>
+std::size_t heapBytes(const std::unordered_set<K, H, E, A>& values) noexcept {
+    return values.bucket_count() * sizeof(void*) + values.size() * (sizeof(K) + 2 * sizeof(void*));
+}
+
+/**
+ * @brief Bytes of a std::make_shared allocation holding a T.
+ */
+template <typename T>
+constexpr std::size_t sharedAllocationBytes() noexcept {
+    return sizeof(T) + SHARED_CONTROL_BLOCK_BYTES;
+}
+
+} // namespace memory
+
+} // namespace ggh::GalaxyCore::utilities
+
+#endif // !GGH_MODULES_GALAXYCORE_UTILITIES_MEMORY_REPORT_H
@@ -0,0 +1,202 @@
+#ifndef GGH_MODULES_GALAXYCORE_UTILITIES_SPATIAL_GRID_H
+#define GGH_MODULES_GALAXYCORE_UTILITIES_SPATIAL_GRID_H
+/**
+ * @file SpatialGrid.h
+ * @brief Uniform bucket grid over 2D points for radius, rectangle and nearest-neighbour queries.
+ *
+ * Points are bucketed once in O(N) into a compressed cell array (cell offsets plus point indices
+ * sorted by cell). With the default cell size each cell holds about one point, so range queries
+ * cost O(cells touched + points reported) and nearest-neighbour queries expand ring by ring
+ * until no unvisited cell can hold a closer point.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
+
+namespace ggh::GalaxyCore::utilities {
+
+class SpatialGrid {
+public:
+    using Index = std::uint32_t;
+    static constexpr Index INVALID_INDEX = std::numeric_limits<Index>::max();
+
+    /**
+     * @brief Buckets the points; query results are indices into this span.
+     * @param points Point positions.
+     * @param cellSize Cell edge length; 0 picks one that gives about one point per cell.
+     */
+    void build(std::span<const CartesianCoordinates<double>> points, double cellSize = 0.0) {
+        m_points.assign(points.begin(), points.end());
+        m_cellStart.clear();
+        m_entries.clear();
+        if (m_points.empty()) {
+            m_columns = m_rows = 0;
+            return;
+        }
+
+        m_minX = m_maxX = m_points.front().x;
+        m_minY = m_maxY = m_points.front().y;
+        for (const auto& point : m_points) {
+            m_minX = std::min(m_minX, point.x);
+            m_maxX = std::max(m_maxX, point.x);
+            m_minY = std::min(m_minY, point.y);
+            m_maxY = std::max(m_maxY, point.y);
+        }
+        const double width = std::max(m_maxX - m_minX, 1e-9);
+        const double height = std::max(m_maxY - m_minY, 1e-9);
+        if (cellSize <= 0.0) {
+            cellSize = std::sqrt(width * height / static_cast<double>(m_points.size()));
+        }
+        // Keep degenerate (e.g. collinear) inputs from producing millions of empty cells
+        cellSize = std::max(cellSize, std::max(width, height) / (4.0 * static_cast<double>(m_points.size()) + 1.0));
+        m_cellSize = cellSize;
+        m_columns = static_cast<std::size_t>(width / cellSize) + 1;
+        m_rows = static_cast<std::size_t>(height / cellSize) + 1;
+
+        // Counting sort of point indices by cell
+        m_cellStart.assign(m_columns * m_rows + 1, 0);
+        for (const auto& point : m_points) {
+            ++m_cellStart[cellOf(point) + 1];
+        }
+        for (std::size_t cell = 1; cell < m_cellStart.size(); ++cell) {
+            m_cellStart[cell] += m_cellStart[cell - 1];
+        }
+        m_entries.resize(m_points.size());
+        std::vector<Index> cursor(m_cellStart.begin(), m_cellStart.end() - 1);
+        for (Index i = 0; i < m_points.size(); ++i) {
+            m_entries[cursor[cellOf(m_points[i])]++] = i;
+        }
+    }
+
+    std::size_t size() const noexcept { return m_points.size(); }
+    bool empty() const noexcept { return m_points.empty(); }
+    double cellSize() const noexcept { return m_cellSize; }
+    const CartesianCoordinates<double>& point(Index index) const { return m_points[index]; }
+
+    /**
+     * @brief Calls fn(index) for every point inside the axis-aligned rectangle.
+     */
+    template <typename Fn>
+    void forEachInRect(double minX, double minY, double maxX, double maxY, Fn&& fn) const {
+        if (empty() || maxX < m_minX || maxY < m_minY || minX > m_maxX || minY > m_maxY) {
+            return;
+        }
+        const auto [firstColumn, firstRow] = clampedCell(minX, minY);
+        const auto [lastColumn, lastRow] = clampedCell(maxX, maxY);
+        for (std::size_t row = firstRow; row <= lastRow; ++row) {
+            for (std::size_t column = firstColumn; column <= lastColumn; ++column) {
+                const auto cell = row * m_columns + column;
+                for (auto i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+                    const auto& p = m_points[m_entries[i]];
+                    if (p.x >= minX && p.x <= maxX && p.y >= minY && p.y <= maxY) {
+                        fn(m_entries[i]);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Calls fn(index, distance) for every point within radius of the centre.
+     */
+    template <typename Fn>
+    void forEachInRadius(const CartesianCoordinates<double>& centre, double radius, Fn&& fn) const {
+        forEachInRect(centre.x - radius, centre.y - radius, centre.x + radius, centre.y + radius,
+                      [&](Index index) {
+                          const double distance = calculateDistance(centre, m_points[index]);
+                          if (distance <= radius) {
+                              fn(index, distance);
+                          }
+                      });
+    }
+
+    /**
+     * @brief Nearest point accepted by a predicate.
+     * @param centre Query position.
+     * @param accept Predicate on point indices; rejected points are skipped.
+     * @param maxDistance Points farther than this are ignored.
+     * @return The index of the nearest accepted point, or INVALID_INDEX.
+     */
+    template <typename Predicate>
+    Index nearest(const CartesianCoordinates<double>& centre, Predicate&& accept,
+                  double maxDistance = std::numeric_limits<double>::infinity()) const {
+        Index best = INVALID_INDEX;
+        double bestDistance = maxDistance;
+        if (empty()) {
+            return best;
+        }
+
+        const auto [centreColumn, centreRow] = clampedCell(centre.x, centre.y);
+        const auto column = static_cast<std::ptrdiff_t>(centreColumn);
+        const auto row = static_cast<std::ptrdiff_t>(centreRow);
+        const auto maxRing = static_cast<std::ptrdiff_t>(std::max(m_columns, m_rows));
+        auto visit = [&](std::ptrdiff_t c, std::ptrdiff_t r) {
+            if (c < 0 || r < 0 || c >= static_cast<std::ptrdiff_t>(m_columns) || r >= static_cast<std::ptrdiff_t>(m_rows)) {
+                return;
+            }
+            const auto cell = static_cast<std::size_t>(r) * m_columns + static_cast<std::size_t>(c);
+            for (auto i = m_cellStart[cell]; i < m_cellStart[cell + 1]; ++i) {
+                const auto index = m_entries[i];
+                const double distance = calculateDistance(centre, m_points[index]);
+                if ((distance < bestDistance || (distance == bestDistance && index < best)) && accept(index)) {
+                    best = index;
+                    bestDistance = distance;
+                }
+            }
+        };
+
+        for (std::ptrdiff_t ring = 0; ring <= maxRing; ++ring) {
+            // Points in ring r are at least (r - 1) cells away from anywhere in the query cell
+            if (static_cast<double>(ring - 1) * m_cellSize > bestDistance) {
+                break;
+            }
+            if (ring == 0) {
+                visit(column, row);
+                continue;
+            }
+            for (std::ptrdiff_t offset = -ring; offset <= ring; ++offset) {
+                visit(column + offset, row - ring);
+                visit(column + offset, row + ring);
+            }
+            for (std::ptrdiff_t offset = -ring + 1; offset < ring; ++offset) {
+                visit(column - ring, row + offset);
+                visit(column + ring, row + offset);
+            }
+        }
+        return best;
+    }
+
+private:
+    std::size_t cellOf(const CartesianCoordinates<double>& point) const {
+        const auto [column, row] = clampedCell(point.x, point.y);
+        return row * m_columns + column;
+    }
+
+    std::pair<std::size_t, std::size_t> clampedCell(double x, double y) const {
+        const double column = std::clamp(std::floor((x - m_minX) / m_cellSize), 0.0, static_cast<double>(m_columns - 1));
+        const double row = std::clamp(std::floor((y - m_minY) / m_cellSize), 0.0, static_cast<double>(m_rows - 1));
+        return {static_cast<std::size_t>(column), static_cast<std::size_t>(row)};
+    }
+
+    std::vector<CartesianCoordinates<double>> m_points;
+    std::vector<Index> m_cellStart;   ///< Offsets into m_entries, one per cell plus a sentinel
+    std::vector<Index> m_entries;     ///< Point indices grouped by cell
+    double m_minX{0.0};
+    double m_minY{0.0};
+    double m_maxX{0.0};
+    double m_maxY{0.0};
+    double m_cellSize{1.0};
+    std::size_t m_columns{0};
+    std::size_t m_rows{0};
+};
+
+} // namespace ggh::GalaxyCore::utilities
+
+#endif // !GGH_MODULES_GALAXYCORE_UTILITIES_SPATIAL_GRID_H
@@ -0,0 +1,136 @@
+#ifndef GGH_MODULES_GALAXYCORE_UTILITIES_TRACE_H
+#define GGH_MODULES_GALAXYCORE_UTILITIES_TRACE_H
+/**
+ * @file Trace.h
+ * @brief Lightweight scoped-timer tracing with Chrome trace-event output.
+ *
+ * Instrumented code uses GGH_TRACE_SCOPE("Phase::name"). When the build is configured
+ * without GGH_ENABLE_TRACING the macro expands to nothing, so instrumentation has no cost.
+ * When enabled, each thread records completed scopes into its own fixed-size ring buffer
+ * and Tracer::writeChromeTrace() dumps them as `trace_event` JSON (openable in Perfetto
+ * or chrome://tracing).
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ggh::GalaxyCore::utilities {
+
+/**
+ * @brief A single completed scope recorded by the tracer.
+ */
+struct TraceEvent {
+    const char* name{nullptr};   ///< Static scope name (string literal)
+    std::int64_t startNs{0};     ///< Start time relative to the tracer epoch
+    std::int64_t durationNs{0};  ///< Duration of the scope
+};
+
+/**
+ * @class Tracer
+ * @brief Process-wide trace collector backed by thread-local ring buffers.
+ */
+class Tracer {
+public:
+    /// Number of events each thread keeps before the oldest ones are overwritten.
+    static constexpr std::size_t RING_CAPACITY = 1u << 14;
+
+    /// Default environment variable holding the trace output path.
+    static constexpr const char* ENVIRONMENT_VARIABLE = "GALAXY_TRACE_FILE";
+
+    /**
+     * @brief Turns event recording on or off at runtime.
+     */
+    static void setEnabled(bool enabled) noexcept;
+
+    /**
+     * @brief Checks whether events are currently being recorded.
+     */
+    static bool isEnabled() noexcept {
+        return s_enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enables tracing if the given environment variable names an output file.
+     * @param variable Name of the environment variable to read.
+     * @return True if tracing was enabled.
+     */
+    static bool enableFromEnvironment(const char* variable = ENVIRONMENT_VARIABLE);
+
+    /**
+     * @brief Records a completed scope on the calling thread.
+     */
+    static void record(const char* name, std::int64_t startNs, std::int64_t endNs) noexcept;
+
+    /**
+     * @brief Current time in nanoseconds relative to the tracer epoch.
+     */
+    static std::int64_t now() noexcept;
+
+    /**
+     * @brief Serialises all recorded events as Chrome trace-event JSON.
+     *
+     * Safe to call while other threads are still recording; each ring is copied under its lock.
+     */
+    static std::string toChromeTraceJson();
+
+    /**
+     * @brief Writes all recorded events to a Chrome trace-event JSON file.
+     * @param filePath Destination file.
+     * @return True if the file was written.
+     */
+    static bool writeChromeTrace(const std::string& filePath);
+
+    /**
+     * @brief Writes the trace to the path configured by enableFromEnvironment().
+     * @return True if a path was configured and the file was written.
+     */
+    static bool flush();
+
+    /**
+     * @brief Discards all recorded events. Safe to call while other threads are recording.
+     */
+    static void clear();
+
+private:
+    static std::atomic<bool> s_enabled;
+};
+
+/**
+ * @class ScopedTrace
+ * @brief RAII timer that records its lifetime as one trace event.
+ */
+class ScopedTrace {
+public:
+    explicit ScopedTrace(const char* name) noexcept
+        : m_name(Tracer::isEnabled() ? name : nullptr)
+        , m_start(m_name ? Tracer::now() : 0) {}
+
+    ~ScopedTrace() {
+        if (m_name) {
+            Tracer::record(m_name, m_start, Tracer::now());
+        }
+    }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    const char* m_name;
+    std::int64_t m_start;
+};
+
+} // namespace ggh::GalaxyCore::utilities
+
+#define GGH_TRACE_CONCAT_INNER(a, b) a##b
+#define GGH_TRACE_CONCAT(a, b) GGH_TRACE_CONCAT_INNER(a, b)
+
+#ifdef GGH_ENABLE_TRACING
+#define GGH_TRACE_SCOPE(name) \
+    ::ggh::GalaxyCore::utilities::ScopedTrace GGH_TRACE_CONCAT(ggh_trace_scope_, __LINE__){name}
+#else
+#define GGH_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
+
+#endif // !GGH_MODULES_GALAXYCORE_UTILITIES_TRACE_H
@@ -0,0 +1,177 @@
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ggh::GalaxyCore::utilities {
+
+std::atomic<bool> Tracer::s_enabled{false};
+
+namespace {
+
+/**
+ * @brief Per-thread event ring. Only the owning thread appends, but readers and clear() touch the
+ * same slots, so every access takes the ring's own lock. The owner is the only other party, so the
+ * lock is uncontended except while a trace is being dumped.
+ */
+struct ThreadBuffer {
+    std::uint32_t threadIndex{0};
+    std::mutex mutex;
+    std::uint64_t head{0};
+    std::array<TraceEvent, Tracer::RING_CAPACITY> events{};
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    std::string outputPath;
+    const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+};
+
+Registry& registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+ThreadBuffer& threadBuffer()
+{
+    // The registry keeps the buffer alive so events survive thread exit.
+    thread_local ThreadBuffer* buffer = [] {
+        auto& reg = registry();
+        auto created = std::make_shared<ThreadBuffer>();
+        std::lock_guard lock(reg.mutex);
+        created->threadIndex = static_cast<std::uint32_t>(reg.buffers.size() + 1);
+        reg.buffers.push_back(created);
+        return created.get();
+    }();
+    return *buffer;
+}
+
+void appendEscaped(std::string& out, const char* text)
+{
+    for (const char* c = text; *c != '\0'; ++c) {
+        switch (*c) {
+        case '"': out += "\\\""; break;
+        case '\\': out += "\\\\"; break;
+        case '\n': out += "\\n"; break;
+        default: out += *c; break;
+        }
+    }
+}
+
+} // namespace
+
+void Tracer::setEnabled(bool enabled) noexcept
+{
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool Tracer::enableFromEnvironment(const char* variable)
+{
+    const char* path = std::getenv(variable);
+    if (path == nullptr || *path == '\0') {
+        return false;
+    }
+
+    {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        reg.outputPath = path;
+    }
+    setEnabled(true);
+    return true;
+}
+
+std::int64_t Tracer::now() noexcept
+{
+    const auto elapsed = std::chrono::steady_clock::now() - registry().epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+void Tracer::record(const char* name, std::int64_t startNs, std::int64_t endNs) noexcept
+{
+    auto& buffer = threadBuffer();
+    std::lock_guard lock(buffer.mutex);
+    buffer.events[buffer.head % RING_CAPACITY] = TraceEvent{name, startNs, endNs - startNs};
+    ++buffer.head;
+}
+
+std::string Tracer::toChromeTraceJson()
+{
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex);
+
+    std::string json = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    std::vector<TraceEvent> events;
+    for (const auto& buffer : reg.buffers) {
+        // Copy the ring out so its owner is only held up for the copy, not the formatting
+        events.clear();
+        {
+            std::lock_guard bufferLock(buffer->mutex);
+            const auto count = std::min<std::uint64_t>(buffer->head, RING_CAPACITY);
+            for (auto i = buffer->head - count; i < buffer->head; ++i) {
+                events.push_back(buffer->events[i % RING_CAPACITY]);
+            }
+        }
+        for (const auto& event : events) {
+            if (!first) {
+                json += ',';
+            }
+            first = false;
+
+            // Chrome trace timestamps are in microseconds.
+            json += "{\"name\":\"";
+            appendEscaped(json, event.name);
+            json += "\",\"cat\":\"galaxy\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+            json += std::to_string(buffer->threadIndex);
+            json += ",\"ts\":";
+            json += std::to_string(static_cast<double>(event.startNs) / 1000.0);
+            json += ",\"dur\":";
+            json += std::to_string(static_cast<double>(event.durationNs) / 1000.0);
+            json += '}';
+        }
+    }
+    json += "]}\n";
+    return json;
+}
+
+bool Tracer::writeChromeTrace(const std::string& filePath)
+{
+    std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    file << toChromeTraceJson();
+    return static_cast<bool>(file);
+}
+
+bool Tracer::flush()
+{
+    std::string path;
+    {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        path = reg.outputPath;
+    }
+    return !path.empty() && writeChromeTrace(path);
+}
+
+void Tracer::clear()
+{
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    for (auto& buffer : reg.buffers) {
+        std::lock_guard bufferLock(buffer->mutex);
+        buffer->head = 0;
+    }
+}
+
+} // namespace ggh::GalaxyCore::utilities
@@ -0,0 +1,122 @@
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace ggh::GalaxyCore::utilities
+{
+
+namespace
+{
+std::size_t countOccurrences(const std::string& text, const std::string& needle) {
+    std::size_t count = 0;
+    for (auto position = text.find(needle); position != std::string::npos;
+         position = text.find(needle, position + needle.size())) {
+        ++count;
+    }
+    return count;
+}
+} // namespace
+
+class TraceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        Tracer::clear();
+        Tracer::setEnabled(true);
+    }
+
+    void TearDown() override {
+        Tracer::setEnabled(false);
+        Tracer::clear();
+    }
+};
+
+TEST_F(TraceTest, ScopeRecordsOneCompleteEvent) {
+    {
+        ScopedTrace scope("Test::scope");
+    }
+
+    const std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(countOccurrences(json, "\"name\":\"Test::scope\""), 1u);
+    EXPECT_EQ(countOccurrences(json, "\"ph\":\"X\""), 1u);
+}
+
+TEST_F(TraceTest, NothingIsRecordedWhileDisabled) {
+    Tracer::setEnabled(false);
+    {
+        ScopedTrace scope("Test::disabled");
+    }
+
+    EXPECT_EQ(countOccurrences(Tracer::toChromeTraceJson(), "Test::disabled"), 0u);
+}
+
+TEST_F(TraceTest, RingKeepsTheNewestEventsAfterWrapping) {
+    for (int i = 0; i < 10; ++i) {
+        Tracer::record("Test::oldest", 0, 1);
+    }
+    for (std::size_t i = 0; i < Tracer::RING_CAPACITY; ++i) {
+        Tracer::record("Test::newest", 0, 1);
+    }
+
+    const std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(countOccurrences(json, "Test::oldest"), 0u);
+    EXPECT_EQ(countOccurrences(json, "Test::newest"), Tracer::RING_CAPACITY);
+}
+
+TEST_F(TraceTest, JsonUsesMicrosecondsAndEscapesNames) {
+    Tracer::record("Test::\"quoted\"", 2000, 5000);
+
+    const std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"Test::\\\"quoted\\\"\""), std::string::npos);
+    EXPECT_NE(json.find("\"ts\":2.000000,\"dur\":3.000000"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+}
+
+TEST_F(TraceTest, ClearDiscardsEveryThreadsEvents) {
+    std::thread([] { Tracer::record("Test::worker", 0, 1); }).join();
+    Tracer::record("Test::main", 0, 1);
+
+    Tracer::clear();
+
+    const std::string json = Tracer::toChromeTraceJson();
+    EXPECT_EQ(countOccurrences(json, "\"ph\":\"X\""), 0u);
+}
+
+TEST_F(TraceTest, DumpingAndClearingWhileThreadsRecordIsSafe) {
+    std::atomic<bool> stop{false};
+    std::thread writer([&stop] {
+        while (!stop.load()) {
+            ScopedTrace scope("Test::busy");
+        }
+    });
+
+    for (int i = 0; i < 50; ++i) {
+        const std::string json = Tracer::toChromeTraceJson();
+        EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+        Tracer::clear();
+    }
+    stop = true;
+    writer.join();
+}
+
+TEST_F(TraceTest, WriteChromeTraceWritesTheJsonToDisk) {
+    Tracer::record("Test::file", 0, 1);
+    const std::string path = ::testing::TempDir() + "ggh_trace_test.json";
+
+    ASSERT_TRUE(Tracer::writeChromeTrace(path));
+
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    EXPECT_EQ(contents.str(), Tracer::toChromeTraceJson());
+    std::remove(path.c_str());
+}
+
+} // namespace ggh::GalaxyCore::utilities
@@ -4,12 +4,16 @@
 #include <QObject>
 #include <QAbstractItemModel>
 #include <QAbstractListModel>
+#include <QRectF>
 #include <QString>
+#include <QVariantList>
 #include <memory>
 #include <QtQml/qqml.h>
 
 #include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+#include "ggh/modules/GalaxyCore/models/GalaxySpatialIndex.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
+#include "ggh/modules/GalaxyCore/models/SystemQueryEngine.h"
 #include "ggh/modules/GalaxyCore/viewmodels/StarSystemListModel.h"
 #include "ggh/modules/GalaxyCore/viewmodels/TravelLaneListModel.h"
 namespace ggh::GalaxyCore::viewmodels {
@@ -50,22 +54,56 @@ public:
     Q_INVOKABLE bool removeStarSystem(quint32 systemId);
     Q_INVOKABLE void clearSystems();
 
+    // Re-snapshots every planet into the galaxy's planet catalogue, e.g. after planets were edited
+    Q_INVOKABLE void rebuildPlanetCatalogue();
+
+    // Hit-testing in galaxy coordinates, answered from a spatial index instead of per-item mouse areas
+    /**
+     * @brief The system nearest to a point, within a pick radius
+     * @return The system id, or 0 if no system is that close
+     */
+    Q_INVOKABLE quint32 systemAt(double x, double y, double radius) const;
+
+    /**
+     * @brief Ids of the systems inside a rectangle, e.g. a rubber band
+     */
+    Q_INVOKABLE QVariantList systemsInRect(const QRectF& rect) const;
+
+    /**
+     * @brief The lane passing closest to a point, within a pick radius
+     * @return The lane id, or 0 if no lane is that close
+     */
+    Q_INVOKABLE quint32 nearestLane(double x, double y, double maxDistance) const;
+
     // Model access
     std::shared_ptr<models::GalaxyModel> galaxy() const;
     void setGalaxy(std::shared_ptr<models::GalaxyModel> galaxy);
 
+    // Which systems a faction owns, for `owned`/`unowned` filters; set by whoever owns the factions
+    void setOwnershipLookup(models::SystemQueryEngine::OwnershipLookup lookup);
+    const models::SystemQueryEngine::OwnershipLookup& ownershipLookup() const;
+
+    // Diagnostics
+    void reportMemory(utilities::MemoryReport& report) const;
+
 signals:
     void dimensionsChanged();
     void systemCountChanged();
     void travelLaneCountChanged();
+    void planetCatalogueChanged();
 
 private:
+    // Rebuilds the index first if the galaxy's lane graph changed since it was built
+    const models::GalaxySpatialIndex& spatialIndex() const;
+
     void initializeStarSystemsModel();
     void initializeTravelLanesModel();
 
     std::shared_ptr<models::GalaxyModel> m_galaxy;
     std::unique_ptr<StarSystemListModel> m_starSystemsModel;
     std::unique_ptr<TravelLaneListModel> m_travelLanesModel;
+    mutable models::GalaxySpatialIndex m_spatialIndex;
+    models::SystemQueryEngine::OwnershipLookup m_ownershipLookup;
 };
 } // namespace ggh::GalaxyCore::viewmodels
 
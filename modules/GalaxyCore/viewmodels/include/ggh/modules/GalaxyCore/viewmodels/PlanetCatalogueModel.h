@@ -0,0 +1,94 @@
+#ifndef GGH_MODULES_GALAXYCORE_VIEWMODELS_PLANET_CATALOGUE_MODEL_H
+#define GGH_MODULES_GALAXYCORE_VIEWMODELS_PLANET_CATALOGUE_MODEL_H
+
+#include <QAbstractListModel>
+#include <QPointer>
+#include <QVariantList>
+#include <QtQml/qqml.h>
+
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/PlanetCatalogue.h"
+#include "ggh/modules/GalaxyCore/viewmodels/GalaxyViewModel.h"
+
+namespace ggh::GalaxyCore::viewmodels {
+/**
+ * @class PlanetCatalogueModel
+ * @brief Planets anywhere in the galaxy matching a type filter and value ranges
+ *
+ * Answers from the galaxy's PlanetCatalogue, so a query costs a bitmap walk or a range slice
+ * rather than a pass over every system. Rows only hold catalogue row numbers; values come from
+ * the columns and the planet and system names are looked up for the rows a view asks for.
+ */
+class PlanetCatalogueModel : public QAbstractListModel
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(ggh::GalaxyCore::viewmodels::GalaxyViewModel* galaxy READ galaxy WRITE setGalaxy NOTIFY galaxyChanged)
+    Q_PROPERTY(QVariantList planetTypes READ planetTypes WRITE setPlanetTypes NOTIFY planetTypesChanged)
+    Q_PROPERTY(int matchCount READ matchCount NOTIFY resultsChanged)
+
+public:
+    enum Roles {
+        SystemIdRole = Qt::UserRole + 1,
+        SystemNameRole,
+        NameRole,
+        TypeRole,
+        TypeNameRole,
+        SizeRole,
+        MassRole,
+        MoonsRole,
+        OrbitRole,
+        MaxTempRole,
+        MinTempRole
+    };
+    Q_ENUM(Roles)
+
+    // Mirrors PlanetCatalogue::Column for QML
+    enum Column {
+        SizeColumn,
+        MassColumn,
+        MoonsColumn,
+        OrbitColumn,
+        MinTempColumn,
+        MaxTempColumn
+    };
+    Q_ENUM(Column)
+
+    explicit PlanetCatalogueModel(QObject* parent = nullptr);
+
+    GalaxyViewModel* galaxy() const;
+    void setGalaxy(GalaxyViewModel* galaxy);
+    // PlanetType values to keep; empty keeps every type
+    QVariantList planetTypes() const;
+    void setPlanetTypes(const QVariantList& planetTypes);
+    int matchCount() const;
+
+    // Inclusive bounds on a column, replacing any earlier bounds on it
+    Q_INVOKABLE void setRange(int column, double min, double max);
+    Q_INVOKABLE void clearRange(int column);
+    Q_INVOKABLE void clearRanges();
+
+    // QAbstractListModel interface
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    // Re-runs the query against the galaxy's current catalogue
+    Q_INVOKABLE void refresh();
+
+signals:
+    void galaxyChanged();
+    void planetTypesChanged();
+    void resultsChanged();
+
+private:
+    QPointer<GalaxyViewModel> m_galaxy;
+    QList<QMetaObject::Connection> m_galaxyConnections;
+    QVariantList m_planetTypes;
+    models::PlanetCatalogue::Query m_query;
+    std::vector<models::PlanetCatalogue::Row> m_rows;
+};
+}
+
+#endif // !GGH_MODULES_GALAXYCORE_VIEWMODELS_PLANET_CATALOGUE_MODEL_H
@@ -7,11 +7,16 @@
 
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 #include "ggh/modules/GalaxyCore/models/PlanetModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/PlanetViewModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/ViewModelPool.h"
 
 namespace ggh::GalaxyCore::viewmodels {
 /**
  * @class PlanetListModel
  * @brief Abstract list model for planets in a star system
+ *
+ * The viewModel role hands out pooled PlanetViewModels keyed by row, so reading it again
+ * returns the same object instead of allocating a new one per read.
  */
 class PlanetListModel : public QAbstractListModel {
     Q_OBJECT
@@ -34,8 +39,14 @@ public:
     };
     Q_ENUM(PlanetRoles)
 
+    using PlanetViewModelPool = ViewModelPool<PlanetViewModel, models::Planet, &PlanetViewModel::setPlanet, int>;
+
     explicit PlanetListModel(std::shared_ptr<models::StarSystemModel> starSystem, QObject* parent = nullptr);
 
+    // Rebinding keeps this object (and the views using it) while showing another system
+    void setStarSystem(std::shared_ptr<models::StarSystemModel> starSystem);
+    const PlanetViewModelPool& viewModelPool() const noexcept { return m_viewModels; }
+
     // QAbstractListModel interface
     int rowCount(const QModelIndex& parent = QModelIndex()) const override;
     QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
@@ -45,8 +56,12 @@ public:
     // Model mutation methods
     Q_INVOKABLE void refresh();
 
+    // Diagnostics
+    void reportMemory(utilities::MemoryReport& report) const;
+
 private:
     std::shared_ptr<models::StarSystemModel> m_starSystem;
+    mutable PlanetViewModelPool m_viewModels; ///< Filled lazily by data(), hence mutable
 };
 }
 
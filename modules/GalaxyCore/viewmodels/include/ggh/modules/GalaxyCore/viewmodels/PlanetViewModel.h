@@ -22,8 +22,8 @@ class PlanetViewModel : public QObject {
     QML_ELEMENT
     Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
     Q_PROPERTY(int planetType READ planetType WRITE setPlanetType NOTIFY planetTypeChanged)
-    Q_PROPERTY(QString typeName READ planetTypeString CONSTANT)
-    Q_PROPERTY(QColor typeColor READ planetTypeColor CONSTANT)
+    Q_PROPERTY(QString typeName READ planetTypeString NOTIFY planetTypeChanged)
+    Q_PROPERTY(QColor typeColor READ planetTypeColor NOTIFY planetTypeChanged)
     Q_PROPERTY(double size READ size WRITE setSize NOTIFY sizeChanged)
     Q_PROPERTY(double mass READ mass WRITE setMass NOTIFY massChanged)
     Q_PROPERTY(int numberOfMoons READ numberOfMoons WRITE setNumberOfMoons NOTIFY numberOfMoonsChanged)
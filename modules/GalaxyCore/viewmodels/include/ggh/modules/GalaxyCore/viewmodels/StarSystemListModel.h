@@ -3,7 +3,10 @@
 
 #include <QAbstractItemModel>
 #include <QAbstractListModel>
+#include <QVariantList>
 #include <memory>
+#include <unordered_set>
+#include <vector>
 #include <QtQml/qqml.h>
 
 #include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
@@ -15,6 +18,7 @@ class StarSystemListModel : public QAbstractListModel
     Q_OBJECT
     QML_ELEMENT
     QML_UNCREATABLE("Cannot create instances of StarSystemListModel directly, must be created through GalaxyModel")
+    Q_PROPERTY(int selectionCount READ selectionCount NOTIFY selectionChanged)
 
 public:
     enum Roles {
@@ -24,7 +28,9 @@ public:
         PositionYRole,
         StarTypeRole,
         SystemSizeRole,
-        PlanetCountRole
+        PlanetCountRole,
+        BetweennessRole,
+        SelectedRole
     };
     Q_ENUM(Roles)
 
@@ -39,8 +45,52 @@ public:
     // Model update methods
     void refresh();
 
+    // Rows in system id order, as snapshotted by the last refresh()
+    const std::vector<std::shared_ptr<models::StarSystemModel>>& rows() const noexcept;
+    utilities::SystemId systemIdAt(int row) const;
+
+    // Re-reads betweenness scores for every row without resetting the model
+    void notifyBetweennessChanged();
+
+    // Selection set, by system id; rows report membership through SelectedRole
+    int selectionCount() const;
+    Q_INVOKABLE bool isSelected(quint32 systemId) const;
+    Q_INVOKABLE QVariantList selectedSystemIds() const;
+    Q_INVOKABLE void setSelection(const QVariantList& systemIds);
+    Q_INVOKABLE void addToSelection(const QVariantList& systemIds);
+    Q_INVOKABLE void toggleSelected(quint32 systemId);
+    Q_INVOKABLE void clearSelection();
+
+    /**
+     * @brief Sets one role on every selected system in a single pass
+     *
+     * Accepts the roles setData() accepts. Rows are in id order, so a spatial selection
+     * is scattered across them; the edit is reported with a single
+     * dataChanged spanning the first to the last changed row rather than one per system.
+     * @return The number of systems whose value changed
+     */
+    Q_INVOKABLE int applyToSelection(int role, const QVariant& value);
+
+    // Diagnostics
+    void reportMemory(utilities::MemoryReport& report) const;
+
+signals:
+    void selectionChanged();
+
 private:
+    // Writes an editable role onto a system; false if the role is read-only or the value unchanged
+    bool applyRole(models::StarSystemModel& system, int role, const QVariant& value);
+    // Replaces the selection and notifies the rows whose membership flipped
+    void replaceSelection(std::unordered_set<utilities::SystemId> selection);
+    // Emits one dataChanged over [first, last]; nothing if no row changed (first > last)
+    void emitRowSpan(int first, int last, const QList<int>& roles);
+
+    // Re-reads the galaxy's systems into m_rows, sorted by id
+    void loadRows();
+
     std::shared_ptr<models::GalaxyModel> m_galaxy;
+    std::vector<std::shared_ptr<models::StarSystemModel>> m_rows;   ///< One per row, by id; kept until the next refresh()
+    std::unordered_set<utilities::SystemId> m_selection;
 };
 }
 
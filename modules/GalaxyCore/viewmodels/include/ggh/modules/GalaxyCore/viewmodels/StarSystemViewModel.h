@@ -7,10 +7,12 @@
 #include <QAbstractListModel>
 #include <QtQml>
 #include <memory>
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 #include "ggh/modules/GalaxyCore/utilities/Common.h"
 #include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
 #include "ggh/modules/GalaxyCore/viewmodels/PlanetListModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/ViewModelPool.h"
 
 namespace ggh::GalaxyCore::viewmodels {
 
@@ -28,7 +30,7 @@ class StarSystemViewModel : public QObject {
     Q_OBJECT
     QML_ELEMENT
     Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
-    Q_PROPERTY(quint32 systemId READ systemId CONSTANT)
+    Q_PROPERTY(quint32 systemId READ systemId NOTIFY systemIdChanged)
     Q_PROPERTY(double positionX READ positionX WRITE setPositionX NOTIFY positionChanged)
     Q_PROPERTY(double positionY READ positionY WRITE setPositionY NOTIFY positionChanged)
     Q_PROPERTY(int starType READ starType WRITE setStarType NOTIFY starTypeChanged)
@@ -62,6 +64,13 @@ public:
     std::shared_ptr<models::StarSystemModel> starSystem() const;
     void setStarSystem(std::shared_ptr<models::StarSystemModel> starSystem);
 
+    /**
+     * @brief Galaxy that position edits go through, so its lane lengths and revision follow them.
+     *
+     * Edits to a system the galaxy does not hold, or made without a galaxy, move the system only.
+     */
+    void setGalaxy(std::weak_ptr<models::GalaxyModel> galaxy);
+
     // Utility methods
     Q_INVOKABLE QString toXml() const;
     Q_INVOKABLE QString starTypeString() const;
@@ -72,6 +81,7 @@ public:
     Q_INVOKABLE int planetCount() const;
 
 signals:
+    void systemIdChanged();
     void colorChanged();
     void nameChanged();
     void positionChanged();
@@ -81,9 +91,15 @@ signals:
 private:
     std::shared_ptr<models::StarSystemModel> m_starSystem;
     std::unique_ptr<PlanetListModel> m_planetsModel;
+    std::weak_ptr<models::GalaxyModel> m_galaxy;
     
     void initializePlanetsModel();
+    void moveTo(double x, double y);
 };
+/// Star system viewmodels cached by system id, recycled by setStarSystem()
+using StarSystemViewModelPool = ViewModelPool<StarSystemViewModel, models::StarSystemModel,
+                                              &StarSystemViewModel::setStarSystem, SystemId>;
+
 } // namespace ggh::GalaxyCore::viewmodels
 
 #endif // GGH_GALAXYCORE_VIEWMODELS_STARSYSTEMVIEWMODEL_H
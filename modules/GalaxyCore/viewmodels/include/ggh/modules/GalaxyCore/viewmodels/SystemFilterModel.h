@@ -0,0 +1,80 @@
+#ifndef GGH_MODULES_GALAXYCORE_VIEWMODELS_SYSTEM_FILTER_MODEL_H
+#define GGH_MODULES_GALAXYCORE_VIEWMODELS_SYSTEM_FILTER_MODEL_H
+
+#include <QPointer>
+#include <QSortFilterProxyModel>
+#include <QString>
+#include <QVariantList>
+#include <QtQml/qqml.h>
+
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/SystemQueryEngine.h"
+#include "ggh/modules/GalaxyCore/viewmodels/GalaxyViewModel.h"
+
+namespace ggh::GalaxyCore::viewmodels {
+/**
+ * @class SystemFilterModel
+ * @brief A galaxy's star system list, narrowed to the systems matching a SystemQuery text
+ *
+ * Proxies GalaxyViewModel::starSystems(), so rows keep every StarSystemListModel role. The query
+ * runs once through a SystemQueryEngine and rows are accepted by looking their id up in the
+ * result, instead of evaluating the query per row. The engine's snapshot is rebuilt when rows
+ * are added or removed; edited rows are re-read in place. A malformed query leaves every row
+ * visible and sets errorString.
+ */
+class SystemFilterModel : public QSortFilterProxyModel
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(ggh::GalaxyCore::viewmodels::GalaxyViewModel* galaxy READ galaxy WRITE setGalaxy NOTIFY galaxyChanged)
+    Q_PROPERTY(QString query READ query WRITE setQuery NOTIFY queryChanged)
+    Q_PROPERTY(QString errorString READ errorString NOTIFY resultsChanged)
+    Q_PROPERTY(int matchCount READ matchCount NOTIFY resultsChanged)
+    Q_PROPERTY(QString plan READ plan NOTIFY resultsChanged)
+
+public:
+    explicit SystemFilterModel(QObject* parent = nullptr);
+
+    GalaxyViewModel* galaxy() const;
+    void setGalaxy(GalaxyViewModel* galaxy);
+    QString query() const;
+    void setQuery(const QString& query);
+    QString errorString() const;
+    int matchCount() const;
+    // How the engine ran the query, for diagnostics
+    QString plan() const;
+
+    // Ids of the matching systems in ascending order, e.g. to select them all
+    Q_INVOKABLE QVariantList matchingSystemIds() const;
+
+    // Re-snapshots the galaxy and re-runs the query, e.g. after ownership changed
+    Q_INVOKABLE void refresh();
+
+signals:
+    void galaxyChanged();
+    void queryChanged();
+    void resultsChanged();
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const override;
+
+private:
+    // Proxies the galaxy's current star system list; the list is replaced when the galaxy is
+    void attachSource();
+    void onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight, const QList<int>& roles);
+    void runQuery();
+
+    QPointer<GalaxyViewModel> m_galaxy;
+    QMetaObject::Connection m_galaxyConnection;
+    QList<QMetaObject::Connection> m_sourceConnections;
+    QString m_query;
+    QString m_errorString;
+    QString m_plan;
+    models::SystemQueryEngine m_engine;
+    bool m_filtering{false};
+    std::vector<utilities::SystemId> m_matches;   ///< Sorted
+};
+}
+
+#endif // !GGH_MODULES_GALAXYCORE_VIEWMODELS_SYSTEM_FILTER_MODEL_H
@@ -0,0 +1,88 @@
+#ifndef GGH_MODULES_GALAXYCORE_VIEWMODELS_SYSTEM_SEARCH_MODEL_H
+#define GGH_MODULES_GALAXYCORE_VIEWMODELS_SYSTEM_SEARCH_MODEL_H
+
+#include <QAbstractListModel>
+#include <QPointer>
+#include <QString>
+#include <QtQml/qqml.h>
+
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/viewmodels/GalaxyViewModel.h"
+
+namespace ggh::GalaxyCore::viewmodels {
+/**
+ * @class SystemSearchModel
+ * @brief The top matches of a case-insensitive name search over a galaxy's star systems
+ *
+ * Answers from the galaxy's name index and holds at most `limit` rows, so pickers and search
+ * boxes over huge galaxies only ever instantiate a page of delegates. Names starting with the
+ * query come first, then names containing it, each in alphabetical order. An empty query lists
+ * the first systems alphabetically.
+ */
+class SystemSearchModel : public QAbstractListModel
+{
+    Q_OBJECT
+    QML_ELEMENT
+    Q_PROPERTY(ggh::GalaxyCore::viewmodels::GalaxyViewModel* galaxy READ galaxy WRITE setGalaxy NOTIFY galaxyChanged)
+    Q_PROPERTY(QString query READ query WRITE setQuery NOTIFY queryChanged)
+    Q_PROPERTY(int limit READ limit WRITE setLimit NOTIFY limitChanged)
+    Q_PROPERTY(int totalMatches READ totalMatches NOTIFY resultsChanged)
+
+public:
+    enum Roles {
+        SystemIdRole = Qt::UserRole + 1,
+        NameRole,
+        PositionXRole,
+        PositionYRole
+    };
+    Q_ENUM(Roles)
+
+    static constexpr int DEFAULT_LIMIT = 50;
+
+    explicit SystemSearchModel(QObject* parent = nullptr);
+
+    GalaxyViewModel* galaxy() const;
+    void setGalaxy(GalaxyViewModel* galaxy);
+    QString query() const;
+    void setQuery(const QString& query);
+    int limit() const;
+    void setLimit(int limit);
+    // Matches in the galaxy, including those past the limit
+    int totalMatches() const;
+
+    // QAbstractListModel interface
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+    QHash<int, QByteArray> roleNames() const override;
+
+    // Row of a system among the results, or -1
+    Q_INVOKABLE int indexOfSystem(quint32 systemId) const;
+
+    // Re-runs the query, e.g. after systems were renamed
+    Q_INVOKABLE void refresh();
+
+signals:
+    void galaxyChanged();
+    void queryChanged();
+    void limitChanged();
+    void resultsChanged();
+
+private:
+    struct Result {
+        utilities::SystemId id;
+        QString name;
+        double x;
+        double y;
+    };
+
+    QPointer<GalaxyViewModel> m_galaxy;
+    QMetaObject::Connection m_galaxyConnection;
+    QString m_query;
+    int m_limit{DEFAULT_LIMIT};
+    int m_totalMatches{0};
+    std::vector<Result> m_results;
+};
+}
+
+#endif // !GGH_MODULES_GALAXYCORE_VIEWMODELS_SYSTEM_SEARCH_MODEL_H
@@ -30,7 +30,8 @@ public:
         DistanceRole,
         TravelTimeRole,
         LaneTypeRole,
-        IsActiveRole
+        IsActiveRole,
+        BetweennessRole
     };
     Q_ENUM(Roles)
 
@@ -45,6 +46,12 @@ public:
     // Model update methods
     void refresh();
 
+    // Re-reads betweenness scores for every row without resetting the model
+    void notifyBetweennessChanged();
+
+    // Diagnostics
+    void reportMemory(utilities::MemoryReport& report) const;
+
 private:
     std::shared_ptr<models::GalaxyModel> m_galaxy;
 };
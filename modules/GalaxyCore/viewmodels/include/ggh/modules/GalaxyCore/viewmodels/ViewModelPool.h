@@ -0,0 +1,228 @@
+#ifndef GGH_GALAXYCORE_VIEWMODELS_VIEWMODELPOOL_H
+#define GGH_GALAXYCORE_VIEWMODELS_VIEWMODELPOOL_H
+/**
+ * @file ViewModelPool.h
+ * @brief Bounded cache of QObject viewmodels keyed by entity id, recycled by rebinding.
+ *
+ * Views ask for a viewmodel every time a row is read or a system is clicked. Rather than
+ * allocating a fresh QObject each time, the pool returns the cached viewmodel for the key
+ * while it still shows the same entity. A key that has come to name another entity (a
+ * regenerated galaxy, reordered planets) has its viewmodel rebound rather than replaced.
+ * Once the pool is full the least recently used viewmodel is rebound to the new entity
+ * instead of allocating another, so memory stays bounded however many entities are visited.
+ * Pooled viewmodels and their entries hold their current entity strongly, keeping it alive
+ * until the viewmodel is rebound or the pool is cleared.
+ *
+ * A recycled viewmodel changes identity under whoever still holds it; size the pool above
+ * the number of viewmodels a view can show at once, and pin() the one a view keeps showing
+ * (the selection) so it is never recycled.
+ */
+
+#include <QObject>
+#include <QPointer>
+#include <QQmlEngine>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+
+namespace ggh::GalaxyCore::viewmodels {
+
+/**
+ * @class ViewModelPool
+ * @tparam ViewModel QObject viewmodel constructible from (std::shared_ptr<Entity>, QObject*)
+ * @tparam Entity Model type the viewmodel wraps
+ * @tparam Rebind Setter that points an existing viewmodel at another entity
+ * @tparam Key Entity key, e.g. a SystemId or a planet index
+ */
+template <typename ViewModel, typename Entity, void (ViewModel::*Rebind)(std::shared_ptr<Entity>),
+          typename Key = std::uint32_t>
+class ViewModelPool {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 64;
+
+    /**
+     * @param owner Parent of every pooled viewmodel
+     * @param capacity Most viewmodels alive at once; at least 1
+     */
+    explicit ViewModelPool(QObject* owner, std::size_t capacity = DEFAULT_CAPACITY)
+        : m_owner(owner), m_capacity(capacity > 0 ? capacity : 1)
+    {
+    }
+
+    ~ViewModelPool() { clear(); }
+
+    ViewModelPool(const ViewModelPool&) = delete;
+    ViewModelPool& operator=(const ViewModelPool&) = delete;
+
+    /**
+     * @brief Gets the viewmodel for an entity, reusing a cached or least recently used one.
+     * @param key The entity's key
+     * @param entity The entity to show; null returns nullptr
+     * @return A viewmodel owned by the pool; valid until it is recycled or the pool cleared
+     */
+    ViewModel* acquire(Key key, const std::shared_ptr<Entity>& entity)
+    {
+        if (!entity) {
+            return nullptr;
+        }
+
+        if (const auto found = m_index.find(key); found != m_index.end()) {
+            auto entry = found->second;
+            m_entries.splice(m_entries.begin(), m_entries, entry);
+            if (entry->viewModel) {
+                if (entry->entity != entity) {
+                    // The key now names another entity (reloaded galaxy, reordered planets)
+                    (entry->viewModel.data()->*Rebind)(entity);
+                    entry->entity = entity;
+                    ++m_rebindCount;
+                } else {
+                    ++m_hitCount;
+                }
+                return entry->viewModel.data();
+            }
+            // Deleted from outside; drop the entry and fall through to a fresh one
+            m_entries.erase(entry);
+            m_index.erase(found);
+        }
+
+        if (const auto entry = leastRecentlyUsed(); m_entries.size() >= m_capacity && entry != m_entries.end()) {
+            // Recycle the least recently used viewmodel under the new key
+            m_index.erase(entry->key);
+            m_entries.splice(m_entries.begin(), m_entries, entry);
+            entry->key = key;
+            entry->entity = entity;
+            m_index.emplace(key, entry);
+            if (entry->viewModel) {
+                (entry->viewModel.data()->*Rebind)(entity);
+                ++m_rebindCount;
+                return entry->viewModel.data();
+            }
+            entry->viewModel = create(entity);
+            return entry->viewModel.data();
+        }
+
+        m_entries.push_front(Entry{key, entity, create(entity)});
+        m_index.emplace(key, m_entries.begin());
+        return m_entries.front().viewModel.data();
+    }
+
+    /**
+     * @brief Gets the cached viewmodel for a key without creating or recycling one.
+     * @return The viewmodel, or nullptr if none is cached for the key
+     */
+    ViewModel* find(Key key) const
+    {
+        const auto found = m_index.find(key);
+        return found != m_index.end() ? found->second->viewModel.data() : nullptr;
+    }
+
+    /**
+     * @brief Keeps the viewmodel for a key from being recycled, replacing any earlier pin.
+     *
+     * While the pinned viewmodel is the only one left to recycle, the pool grows one past its
+     * capacity rather than rebinding it.
+     */
+    void pin(Key key) { m_pinned = key; }
+
+    /**
+     * @brief Lets the pinned viewmodel be recycled again.
+     */
+    void unpin() noexcept { m_pinned.reset(); }
+
+    std::optional<Key> pinned() const noexcept { return m_pinned; }
+
+    /**
+     * @brief Deletes every pooled viewmodel and drops the pin.
+     */
+    void clear()
+    {
+        for (auto& entry : m_entries) {
+            delete entry.viewModel.data();
+        }
+        m_entries.clear();
+        m_index.clear();
+        m_pinned.reset();
+    }
+
+    /**
+     * @brief Changes the capacity, deleting the least recently used viewmodels over it (never the pinned one).
+     */
+    void setCapacity(std::size_t capacity)
+    {
+        m_capacity = capacity > 0 ? capacity : 1;
+        for (auto entry = leastRecentlyUsed(); m_entries.size() > m_capacity && entry != m_entries.end();
+             entry = leastRecentlyUsed()) {
+            delete entry->viewModel.data();
+            m_index.erase(entry->key);
+            m_entries.erase(entry);
+        }
+    }
+
+    std::size_t size() const noexcept { return m_entries.size(); }
+    std::size_t capacity() const noexcept { return m_capacity; }
+    std::size_t createdCount() const noexcept { return m_createdCount; }
+    std::size_t rebindCount() const noexcept { return m_rebindCount; }
+    std::size_t hitCount() const noexcept { return m_hitCount; }
+
+    /**
+     * @brief Adds the pool's bookkeeping and viewmodel objects to a memory report.
+     */
+    void reportMemory(utilities::MemoryReport& report, const std::string& category) const
+    {
+        using namespace utilities::memory;
+
+        // Each list node holds an Entry plus two links; each index node a key, an iterator and a link
+        const std::size_t entryBytes = sizeof(Entry) + 2 * sizeof(void*) + sizeof(ViewModel);
+        report.add(category, sizeof(ViewModelPool) + m_entries.size() * entryBytes + heapBytes(m_index),
+                   m_entries.size());
+    }
+
+private:
+    struct Entry {
+        Key key;
+        std::shared_ptr<Entity> entity;
+        QPointer<ViewModel> viewModel;
+    };
+    using EntryList = std::list<Entry>;
+
+    // The least recently used entry that is not pinned, or end() if there is none
+    typename EntryList::iterator leastRecentlyUsed()
+    {
+        for (auto entry = m_entries.rbegin(); entry != m_entries.rend(); ++entry) {
+            if (entry->key != m_pinned) {
+                return std::prev(entry.base());
+            }
+        }
+        return m_entries.end();
+    }
+
+    ViewModel* create(const std::shared_ptr<Entity>& entity)
+    {
+        auto* viewModel = new ViewModel(entity, m_owner);
+        // QML must not collect objects the pool hands out again later
+        QQmlEngine::setObjectOwnership(viewModel, QQmlEngine::CppOwnership);
+        ++m_createdCount;
+        return viewModel;
+    }
+
+    QObject* m_owner;
+    std::size_t m_capacity;
+    EntryList m_entries;   ///< Most recently used first
+    std::unordered_map<Key, typename EntryList::iterator> m_index;
+    std::optional<Key> m_pinned;
+    std::size_t m_createdCount{0};
+    std::size_t m_rebindCount{0};
+    std::size_t m_hitCount{0};
+};
+
+} // namespace ggh::GalaxyCore::viewmodels
+
+#endif // GGH_GALAXYCORE_VIEWMODELS_VIEWMODELPOOL_H
@@ -1,5 +1,7 @@
 #include "ggh/modules/GalaxyCore/viewmodels/GalaxyViewModel.h"
 
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
 namespace ggh::GalaxyCore::viewmodels {
 
 // GalaxyViewModel implementation
@@ -122,14 +124,65 @@ void GalaxyViewModel::clearSystems()
     emit systemCountChanged();
 }
 
+quint32 GalaxyViewModel::systemAt(double x, double y, double radius) const
+{
+    return static_cast<quint32>(spatialIndex().systemAt(x, y, radius));
+}
+
+QVariantList GalaxyViewModel::systemsInRect(const QRectF& rect) const
+{
+    std::vector<utilities::SystemId> systems;
+    spatialIndex().systemsInRect(rect.left(), rect.top(), rect.right(), rect.bottom(), systems);
+
+    QVariantList ids;
+    ids.reserve(static_cast<qsizetype>(systems.size()));
+    for (const auto id : systems) {
+        ids.append(static_cast<quint32>(id));
+    }
+    return ids;
+}
+
+quint32 GalaxyViewModel::nearestLane(double x, double y, double maxDistance) const
+{
+    return static_cast<quint32>(spatialIndex().nearestLane(x, y, maxDistance));
+}
+
+const models::GalaxySpatialIndex& GalaxyViewModel::spatialIndex() const
+{
+    const auto& graph = m_galaxy->laneGraph();
+    if (!m_spatialIndex.isValidFor(graph)) {
+        m_spatialIndex.build(graph);
+    }
+    return m_spatialIndex;
+}
+
 std::shared_ptr<models::GalaxyModel> GalaxyViewModel::galaxy() const
 {
     return m_galaxy;
 }
 
+void GalaxyViewModel::rebuildPlanetCatalogue()
+{
+    m_galaxy->rebuildPlanetCatalogue();
+    emit planetCatalogueChanged();
+}
+
+void GalaxyViewModel::setOwnershipLookup(models::SystemQueryEngine::OwnershipLookup lookup)
+{
+    m_ownershipLookup = std::move(lookup);
+}
+
+const models::SystemQueryEngine::OwnershipLookup& GalaxyViewModel::ownershipLookup() const
+{
+    return m_ownershipLookup;
+}
+
 void GalaxyViewModel::setGalaxy(std::shared_ptr<models::GalaxyModel> galaxy)
 {
+    GGH_TRACE_SCOPE("GalaxyViewModel::setGalaxy");
     if (m_galaxy != galaxy) {
+        // A new galaxy may reuse the old one's address; never trust the index across the swap
+        m_spatialIndex.clear();
         m_galaxy = galaxy;
         if (!m_galaxy) {
             m_galaxy = std::make_shared<models::GalaxyModel>(1000, 800);
@@ -143,6 +196,18 @@ void GalaxyViewModel::setGalaxy(std::shared_ptr<models::GalaxyModel> galaxy)
     }
 }
 
+void GalaxyViewModel::reportMemory(utilities::MemoryReport& report) const
+{
+    report.add("viewModels", sizeof(GalaxyViewModel), 1);
+    m_spatialIndex.reportMemory(report);
+    if (m_starSystemsModel) {
+        m_starSystemsModel->reportMemory(report);
+    }
+    if (m_travelLanesModel) {
+        m_travelLanesModel->reportMemory(report);
+    }
+}
+
 void GalaxyViewModel::initializeStarSystemsModel()
 {
     m_starSystemsModel = std::make_unique<StarSystemListModel>(m_galaxy, this);
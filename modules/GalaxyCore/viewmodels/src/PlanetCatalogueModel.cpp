@@ -0,0 +1,175 @@
+#include "ggh/modules/GalaxyCore/viewmodels/PlanetCatalogueModel.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+#include "ggh/modules/GalaxyCore/viewmodels/Commons.h"
+
+namespace ggh::GalaxyCore::viewmodels {
+PlanetCatalogueModel::PlanetCatalogueModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+}
+
+GalaxyViewModel* PlanetCatalogueModel::galaxy() const
+{
+    return m_galaxy.data();
+}
+
+void PlanetCatalogueModel::setGalaxy(GalaxyViewModel* galaxy)
+{
+    if (m_galaxy == galaxy) {
+        return;
+    }
+    for (const auto& connection : std::as_const(m_galaxyConnections)) {
+        disconnect(connection);
+    }
+    m_galaxyConnections.clear();
+    m_galaxy = galaxy;
+    if (m_galaxy) {
+        // A swapped galaxy comes with a count change; edits in place with an explicit rebuild
+        m_galaxyConnections << connect(m_galaxy, &GalaxyViewModel::systemCountChanged, this, &PlanetCatalogueModel::refresh)
+                            << connect(m_galaxy, &GalaxyViewModel::planetCatalogueChanged, this, &PlanetCatalogueModel::refresh);
+    }
+    emit galaxyChanged();
+    refresh();
+}
+
+QVariantList PlanetCatalogueModel::planetTypes() const
+{
+    return m_planetTypes;
+}
+
+void PlanetCatalogueModel::setPlanetTypes(const QVariantList& planetTypes)
+{
+    if (m_planetTypes == planetTypes) {
+        return;
+    }
+    m_planetTypes = planetTypes;
+    m_query.typeMask = planetTypes.isEmpty() ? models::PlanetCatalogue::ALL_TYPES : 0;
+    for (const auto& type : planetTypes) {
+        const int value = type.toInt();
+        if (value >= 0 && value < static_cast<int>(models::PlanetCatalogue::PLANET_TYPE_COUNT)) {
+            m_query.typeMask |= std::uint32_t{1} << value;
+        }
+    }
+    emit planetTypesChanged();
+    refresh();
+}
+
+int PlanetCatalogueModel::matchCount() const
+{
+    return static_cast<int>(m_rows.size());
+}
+
+void PlanetCatalogueModel::setRange(int column, double min, double max)
+{
+    if (column < SizeColumn || column > MaxTempColumn) {
+        return;
+    }
+    const auto catalogueColumn = static_cast<models::PlanetCatalogue::Column>(column);
+    std::erase_if(m_query.ranges, [catalogueColumn](const auto& range) { return range.column == catalogueColumn; });
+    m_query.ranges.push_back({catalogueColumn, min, max});
+    refresh();
+}
+
+void PlanetCatalogueModel::clearRange(int column)
+{
+    const auto catalogueColumn = static_cast<models::PlanetCatalogue::Column>(column);
+    if (std::erase_if(m_query.ranges, [catalogueColumn](const auto& range) { return range.column == catalogueColumn; }) > 0) {
+        refresh();
+    }
+}
+
+void PlanetCatalogueModel::clearRanges()
+{
+    if (!m_query.ranges.empty()) {
+        m_query.ranges.clear();
+        refresh();
+    }
+}
+
+int PlanetCatalogueModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_rows.size());
+}
+
+QVariant PlanetCatalogueModel::data(const QModelIndex& index, int role) const
+{
+    const auto galaxy = m_galaxy ? m_galaxy->galaxy() : nullptr;
+    if (!index.isValid() || index.row() >= static_cast<int>(m_rows.size()) || !galaxy) {
+        return QVariant();
+    }
+
+    using Column = models::PlanetCatalogue::Column;
+    const auto& catalogue = galaxy->planetCatalogue();
+    const auto row = m_rows[index.row()];
+    switch (role) {
+        case SystemIdRole:
+            return static_cast<quint32>(catalogue.systemOf(row));
+        case SystemNameRole: {
+            const auto system = galaxy->getStarSystem(catalogue.systemOf(row));
+            return system ? QString::fromStdString(system->getName()) : QString();
+        }
+        case Qt::DisplayRole:
+        case NameRole: {
+            // Names are not columns; only the rows on screen pay for the lookup
+            const auto system = galaxy->getStarSystem(catalogue.systemOf(row));
+            const auto planetIndex = catalogue.planetIndexOf(row);
+            if (!system || planetIndex >= system->getPlanets().size()) {
+                return QString();
+            }
+            return QString::fromStdString(system->getPlanets()[planetIndex]->name());
+        }
+        case TypeRole:
+            return static_cast<int>(catalogue.type(row));
+        case TypeNameRole:
+            return commons::planetTypeName(catalogue.type(row));
+        case SizeRole:
+            return catalogue.value(Column::Size, row);
+        case MassRole:
+            return catalogue.value(Column::Mass, row);
+        case MoonsRole:
+            return static_cast<int>(catalogue.value(Column::Moons, row));
+        case OrbitRole:
+            return catalogue.value(Column::OrbitalRadius, row);
+        case MaxTempRole:
+            return catalogue.value(Column::MaxTemperature, row);
+        case MinTempRole:
+            return catalogue.value(Column::MinTemperature, row);
+        default:
+            return QVariant();
+    }
+}
+
+QHash<int, QByteArray> PlanetCatalogueModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[SystemIdRole] = "systemId";
+    roles[SystemNameRole] = "systemName";
+    roles[NameRole] = "name";
+    roles[TypeRole] = "planetType";
+    roles[TypeNameRole] = "planetTypeName";
+    roles[SizeRole] = "size";
+    roles[MassRole] = "mass";
+    roles[MoonsRole] = "numberOfMoons";
+    roles[OrbitRole] = "orbitalRadius";
+    roles[MaxTempRole] = "maxTemperature";
+    roles[MinTempRole] = "minTemperature";
+    return roles;
+}
+
+void PlanetCatalogueModel::refresh()
+{
+    GGH_TRACE_SCOPE("PlanetCatalogueModel::refresh");
+    const auto galaxy = m_galaxy ? m_galaxy->galaxy() : nullptr;
+    auto rows = galaxy ? galaxy->planetCatalogue().find(m_query) : std::vector<models::PlanetCatalogue::Row>();
+
+    // Rows are plain numbers with values read on demand, so a reset costs one vector swap
+    beginResetModel();
+    m_rows = std::move(rows);
+    endResetModel();
+    emit resultsChanged();
+}
+}
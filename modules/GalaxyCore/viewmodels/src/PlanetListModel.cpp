@@ -1,15 +1,25 @@
 #include "ggh/modules/GalaxyCore/viewmodels/PlanetListModel.h"
-#include "ggh/modules/GalaxyCore/viewmodels/PlanetViewModel.h"
 #include "ggh/modules/GalaxyCore/viewmodels/Commons.h"
 
 namespace ggh::GalaxyCore::viewmodels {
 
 // PlanetListModel implementation
 PlanetListModel::PlanetListModel(std::shared_ptr<models::StarSystemModel> starSystem, QObject* parent)
-    : QAbstractListModel(parent), m_starSystem(starSystem)
+    : QAbstractListModel(parent), m_starSystem(starSystem), m_viewModels(this)
 {
 }
 
+void PlanetListModel::setStarSystem(std::shared_ptr<models::StarSystemModel> starSystem)
+{
+    if (m_starSystem == starSystem) {
+        return;
+    }
+    // Pooled viewmodels stay; the next read of a row rebinds them to the new system's planets
+    beginResetModel();
+    m_starSystem = std::move(starSystem);
+    endResetModel();
+}
+
 int PlanetListModel::rowCount(const QModelIndex& parent) const
 {
     Q_UNUSED(parent)
@@ -46,8 +56,7 @@ QVariant PlanetListModel::data(const QModelIndex& index, int role) const
         case MinTempRole:
             return planet->minTemperature();
         case ViewModelRole:
-
-            return QVariant::fromValue(new PlanetViewModel(planet));
+            return QVariant::fromValue(m_viewModels.acquire(index.row(), planet));
         default:
             return QVariant();
     }
@@ -96,4 +105,11 @@ void PlanetListModel::refresh()
     endResetModel();
 }
 
+void PlanetListModel::reportMemory(utilities::MemoryReport& report) const
+{
+    // Rows are read straight from the model, so only the object and its pooled viewmodels are owned here
+    report.add("listModels", sizeof(PlanetListModel), 1);
+    m_viewModels.reportMemory(report, "viewModels");
+}
+
 }
\ No newline at end of file
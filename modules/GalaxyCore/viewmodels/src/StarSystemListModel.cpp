@@ -1,29 +1,30 @@
 #include "ggh/modules/GalaxyCore/viewmodels/StarSystemListModel.h"
 
+#include <algorithm>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
 namespace ggh::GalaxyCore::viewmodels {
 StarSystemListModel::StarSystemListModel(std::shared_ptr<models::GalaxyModel> galaxy, QObject* parent)
     : QAbstractListModel(parent), m_galaxy(galaxy)
 {
+    loadRows();
 }
 
 int StarSystemListModel::rowCount(const QModelIndex& parent) const
 {
     Q_UNUSED(parent)
-    return m_galaxy ? static_cast<int>(m_galaxy->getAllStarSystems().size()) : 0;
+    return static_cast<int>(m_rows.size());
 }
 
 QVariant StarSystemListModel::data(const QModelIndex& index, int role) const
 {
-    if (!m_galaxy || !index.isValid()) {
-        return QVariant();
-    }
-    
-    auto systems = m_galaxy->getAllStarSystems();
-    if (index.row() >= static_cast<int>(systems.size())) {
+    if (!index.isValid() || index.row() >= rowCount()) {
         return QVariant();
     }
 
-    const auto& system = systems[index.row()];
+    const auto& system = m_rows[index.row()];
 
     switch (role) {
         case SystemIdRole:
@@ -39,7 +40,11 @@ QVariant StarSystemListModel::data(const QModelIndex& index, int role) const
         case SystemSizeRole:
             return static_cast<int>(system->getSystemSize());
         case PlanetCountRole:
-            return static_cast<int>(system->getPlanets().size());
+            return static_cast<int>(system->planetCount());
+        case BetweennessRole:
+            return system->getBetweenness();
+        case SelectedRole:
+            return m_selection.contains(system->getId());
         default:
             return QVariant();
     }
@@ -51,40 +56,66 @@ bool StarSystemListModel::setData(const QModelIndex& index, const QVariant& valu
         return false;
     }
 
-    auto systems{m_galaxy->getAllStarSystems()};
-    if (index.row() >= static_cast<int>(systems.size())) {
-        return false;
-    }
-
-    auto& system{systems[index.row()]};
-
     switch (role) {
         case NameRole:
-            system->setName(value.toString().toStdString());
-            break;
-        case PositionXRole: {
-            auto pos = system->getPosition();
-            pos.x = value.toDouble();
-            system->setPosition(pos);
-            break;
-        }
-        case PositionYRole: {
-            auto pos = system->getPosition();
-            pos.y = value.toDouble();
-            system->setPosition(pos);
-            break;
-        }
+        case PositionXRole:
+        case PositionYRole:
         case StarTypeRole:
-            system->setStarType(static_cast<utilities::StarType>(value.toInt()));
+        case SystemSizeRole:
             break;
         default:
             return false; // Unsupported role
     }
 
-    emit dataChanged(index, index, {role});
+    if (applyRole(*m_rows[index.row()], role, value)) {
+        emit dataChanged(index, index, {role});
+    }
     return true;
 }
 
+bool StarSystemListModel::applyRole(models::StarSystemModel& system, int role, const QVariant& value)
+{
+    switch (role) {
+        case NameRole: {
+            auto name = value.toString().toStdString();
+            if (system.getName() == name) {
+                return false;
+            }
+            system.setName(name);
+            return true;
+        }
+        case PositionXRole:
+        case PositionYRole: {
+            auto pos = system.getPosition();
+            auto& coordinate = role == PositionXRole ? pos.x : pos.y;
+            if (coordinate == value.toDouble()) {
+                return false;
+            }
+            coordinate = value.toDouble();
+            m_galaxy->setStarSystemPosition(system.getId(), pos);
+            return true;
+        }
+        case StarTypeRole: {
+            const auto type = static_cast<utilities::StarType>(value.toInt());
+            if (system.getStarType() == type) {
+                return false;
+            }
+            system.setStarType(type);
+            return true;
+        }
+        case SystemSizeRole: {
+            const auto size = static_cast<utilities::SystemSize>(value.toInt());
+            if (system.getSystemSize() == size) {
+                return false;
+            }
+            system.setSystemSize(size);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
 QHash<int, QByteArray> StarSystemListModel::roleNames() const
 {
     QHash<int, QByteArray> roles;
@@ -95,12 +126,158 @@ QHash<int, QByteArray> StarSystemListModel::roleNames() const
     roles[StarTypeRole] = "starType";
     roles[SystemSizeRole] = "systemSize";
     roles[PlanetCountRole] = "planetCount";
+    roles[BetweennessRole] = "betweenness";
+    roles[SelectedRole] = "selected";
     return roles;
 }
 
 void StarSystemListModel::refresh()
 {
     beginResetModel();
+    loadRows();
+    // Forget selected systems that no longer exist
+    const auto before = m_selection.size();
+    std::erase_if(m_selection, [this](utilities::SystemId id) { return !m_galaxy || !m_galaxy->getStarSystem(id); });
     endResetModel();
+    if (m_selection.size() != before) {
+        emit selectionChanged();
+    }
+}
+
+const std::vector<std::shared_ptr<models::StarSystemModel>>& StarSystemListModel::rows() const noexcept
+{
+    return m_rows;
+}
+
+utilities::SystemId StarSystemListModel::systemIdAt(int row) const
+{
+    return m_rows[row]->getId();
+}
+
+void StarSystemListModel::loadRows()
+{
+    m_rows = m_galaxy ? m_galaxy->getAllStarSystems() : std::vector<std::shared_ptr<models::StarSystemModel>>{};
+    std::sort(m_rows.begin(), m_rows.end(), [](const auto& a, const auto& b) { return a->getId() < b->getId(); });
+}
+
+void StarSystemListModel::notifyBetweennessChanged()
+{
+    const int rows = rowCount();
+    if (rows > 0) {
+        emit dataChanged(index(0), index(rows - 1), {BetweennessRole});
+    }
+}
+
+int StarSystemListModel::selectionCount() const
+{
+    return static_cast<int>(m_selection.size());
+}
+
+bool StarSystemListModel::isSelected(quint32 systemId) const
+{
+    return m_selection.contains(systemId);
+}
+
+QVariantList StarSystemListModel::selectedSystemIds() const
+{
+    std::vector<utilities::SystemId> ids(m_selection.begin(), m_selection.end());
+    std::sort(ids.begin(), ids.end());
+
+    QVariantList result;
+    result.reserve(static_cast<qsizetype>(ids.size()));
+    for (const auto id : ids) {
+        result.append(static_cast<quint32>(id));
+    }
+    return result;
+}
+
+void StarSystemListModel::setSelection(const QVariantList& systemIds)
+{
+    std::unordered_set<utilities::SystemId> selection;
+    selection.reserve(static_cast<std::size_t>(systemIds.size()));
+    for (const auto& id : systemIds) {
+        selection.insert(id.toUInt());
+    }
+    replaceSelection(std::move(selection));
+}
+
+void StarSystemListModel::addToSelection(const QVariantList& systemIds)
+{
+    auto selection = m_selection;
+    for (const auto& id : systemIds) {
+        selection.insert(id.toUInt());
+    }
+    replaceSelection(std::move(selection));
+}
+
+void StarSystemListModel::toggleSelected(quint32 systemId)
+{
+    auto selection = m_selection;
+    if (!selection.erase(systemId)) {
+        selection.insert(systemId);
+    }
+    replaceSelection(std::move(selection));
+}
+
+void StarSystemListModel::clearSelection()
+{
+    replaceSelection({});
+}
+
+void StarSystemListModel::replaceSelection(std::unordered_set<utilities::SystemId> selection)
+{
+    if (selection == m_selection) {
+        return;
+    }
+
+    std::swap(m_selection, selection);
+    int first = -1;
+    int last = -1;
+    for (int row = 0; row < rowCount(); ++row) {
+        const auto id = m_rows[row]->getId();
+        if (m_selection.contains(id) != selection.contains(id)) {
+            first = (first < 0) ? row : first;
+            last = row;
+        }
+    }
+    emitRowSpan(first, last, {SelectedRole});
+    emit selectionChanged();
+}
+
+int StarSystemListModel::applyToSelection(int role, const QVariant& value)
+{
+    GGH_TRACE_SCOPE("StarSystemListModel::applyToSelection");
+    if (!m_galaxy || m_selection.empty()) {
+        return 0;
+    }
+
+    // One walk over the rows: each system is edited in place and only the changed span is kept
+    int count = 0;
+    int first = -1;
+    int last = -1;
+    for (int row = 0; row < rowCount(); ++row) {
+        if (m_selection.contains(m_rows[row]->getId()) && applyRole(*m_rows[row], role, value)) {
+            first = (first < 0) ? row : first;
+            last = row;
+            ++count;
+        }
+    }
+
+    emitRowSpan(first, last, {role});
+    return count;
+}
+
+void StarSystemListModel::emitRowSpan(int first, int last, const QList<int>& roles)
+{
+    if (first <= last) {
+        emit dataChanged(index(first), index(last), roles);
+    }
+}
+
+void StarSystemListModel::reportMemory(utilities::MemoryReport& report) const
+{
+    using namespace utilities::memory;
+    // The row array shares the galaxy's systems; only its pointers and the selection set are owned here
+    report.add("listModels", sizeof(StarSystemListModel) + heapBytes(m_rows) + heapBytes(m_selection), 1);
 }
 }
\ No newline at end of file
@@ -75,7 +75,7 @@ void StarSystemViewModel::setPositionX(double x)
 {
     auto currentPos = m_starSystem->getPosition();
     if (currentPos.x != x) {
-        m_starSystem->setPosition(utilities::CartesianCoordinates<double>(x, currentPos.y));
+        moveTo(x, currentPos.y);
         emit positionChanged();
     }
 }
@@ -84,7 +84,7 @@ void StarSystemViewModel::setPositionY(double y)
 {
     auto currentPos = m_starSystem->getPosition();
     if (currentPos.y != y) {
-        m_starSystem->setPosition(utilities::CartesianCoordinates<double>(currentPos.x, y));
+        moveTo(currentPos.x, y);
         emit positionChanged();
     }
 }
@@ -93,11 +93,22 @@ void StarSystemViewModel::setPosition(double x, double y)
 {
     auto currentPos = m_starSystem->getPosition();
     if (currentPos.x != x || currentPos.y != y) {
-        m_starSystem->setPosition(utilities::CartesianCoordinates<double>(x, y));
+        moveTo(x, y);
         emit positionChanged();
     }
 }
 
+void StarSystemViewModel::moveTo(double x, double y)
+{
+    const utilities::CartesianCoordinates<double> position(x, y);
+    // Through the galaxy, so its lane graph refreshes lane lengths and bumps its revision
+    if (auto galaxy = m_galaxy.lock(); galaxy && galaxy->getStarSystem(m_starSystem->getId()) == m_starSystem) {
+        galaxy->setStarSystemPosition(m_starSystem->getId(), position);
+        return;
+    }
+    m_starSystem->setPosition(position);
+}
+
 void StarSystemViewModel::setStarType(int type)
 {
     auto starType = static_cast<StarType>(type);
@@ -129,9 +140,11 @@ void StarSystemViewModel::setStarSystem(std::shared_ptr<models::StarSystemModel>
             m_starSystem = std::make_shared<models::StarSystemModel>(0, "New System", 
                                                                    utilities::CartesianCoordinates<double>(0.0, 0.0));
         }
-        initializePlanetsModel();
+        m_planetsModel->setStarSystem(m_starSystem);
         
         // Emit all change signals
+        emit systemIdChanged();
+        emit colorChanged();
         emit nameChanged();
         emit positionChanged();
         emit starTypeChanged();
@@ -139,6 +152,11 @@ void StarSystemViewModel::setStarSystem(std::shared_ptr<models::StarSystemModel>
     }
 }
 
+void StarSystemViewModel::setGalaxy(std::weak_ptr<models::GalaxyModel> galaxy)
+{
+    m_galaxy = std::move(galaxy);
+}
+
 QString StarSystemViewModel::toXml() const
 {
     return QString::fromStdString(m_starSystem->toXml());
@@ -199,7 +217,7 @@ bool StarSystemViewModel::removePlanetByName(const QString& name)
 
 int StarSystemViewModel::planetCount() const
 {
-    return static_cast<int>(m_starSystem->getPlanets().size());
+    return static_cast<int>(m_starSystem->planetCount());
 }
 
 void StarSystemViewModel::initializePlanetsModel()
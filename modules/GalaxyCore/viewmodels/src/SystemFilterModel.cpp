@@ -0,0 +1,179 @@
+#include "ggh/modules/GalaxyCore/viewmodels/SystemFilterModel.h"
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+namespace ggh::GalaxyCore::viewmodels {
+SystemFilterModel::SystemFilterModel(QObject* parent)
+    : QSortFilterProxyModel(parent)
+{
+}
+
+GalaxyViewModel* SystemFilterModel::galaxy() const
+{
+    return m_galaxy.data();
+}
+
+void SystemFilterModel::setGalaxy(GalaxyViewModel* galaxy)
+{
+    if (m_galaxy == galaxy) {
+        return;
+    }
+    disconnect(m_galaxyConnection);
+    m_galaxy = galaxy;
+    if (m_galaxy) {
+        // Swapping the galaxy model replaces the star system list and comes with a count change
+        m_galaxyConnection = connect(m_galaxy, &GalaxyViewModel::systemCountChanged, this, [this]() {
+            if (m_galaxy && sourceModel() != m_galaxy->starSystems()) {
+                attachSource();
+                refresh();
+            }
+        });
+    }
+    attachSource();
+    emit galaxyChanged();
+    refresh();
+}
+
+QString SystemFilterModel::query() const
+{
+    return m_query;
+}
+
+void SystemFilterModel::setQuery(const QString& query)
+{
+    if (m_query != query) {
+        m_query = query;
+        emit queryChanged();
+        runQuery();
+    }
+}
+
+QString SystemFilterModel::errorString() const
+{
+    return m_errorString;
+}
+
+int SystemFilterModel::matchCount() const
+{
+    return m_filtering ? static_cast<int>(m_matches.size()) : rowCount();
+}
+
+QString SystemFilterModel::plan() const
+{
+    return m_plan;
+}
+
+QVariantList SystemFilterModel::matchingSystemIds() const
+{
+    QVariantList ids;
+    if (!m_filtering) {
+        return ids;
+    }
+    ids.reserve(static_cast<qsizetype>(m_matches.size()));
+    for (const auto id : m_matches) {
+        ids.append(static_cast<quint32>(id));
+    }
+    return ids;
+}
+
+void SystemFilterModel::refresh()
+{
+    GGH_TRACE_SCOPE("SystemFilterModel::refresh");
+    const auto galaxy = m_galaxy ? m_galaxy->galaxy() : nullptr;
+    if (galaxy) {
+        m_engine.build(*galaxy);
+        m_engine.setOwnershipLookup(m_galaxy->ownershipLookup());
+    } else {
+        m_engine.clear();
+    }
+    runQuery();
+}
+
+void SystemFilterModel::attachSource()
+{
+    for (const auto& connection : std::as_const(m_sourceConnections)) {
+        disconnect(connection);
+    }
+    m_sourceConnections.clear();
+
+    auto* source = m_galaxy ? m_galaxy->starSystems() : nullptr;
+    setSourceModel(source);
+    if (source) {
+        // Connected after setSourceModel so the proxy has mapped the new rows before the filter is re-run
+        m_sourceConnections << connect(source, &QAbstractItemModel::modelReset, this, &SystemFilterModel::refresh)
+                            << connect(source, &QAbstractItemModel::rowsInserted, this, &SystemFilterModel::refresh)
+                            << connect(source, &QAbstractItemModel::rowsRemoved, this, &SystemFilterModel::refresh)
+                            << connect(source, &QAbstractItemModel::dataChanged, this, &SystemFilterModel::onSourceDataChanged);
+    }
+}
+
+void SystemFilterModel::onSourceDataChanged(const QModelIndex& topLeft, const QModelIndex& bottomRight,
+                                            const QList<int>& roles)
+{
+    // Selection and centrality are not part of the snapshot, so flipping them needs no rebuild
+    const bool snapshotUnchanged = !roles.isEmpty() && std::all_of(roles.begin(), roles.end(), [](int role) {
+        return role == StarSystemListModel::SelectedRole || role == StarSystemListModel::BetweennessRole;
+    });
+    const auto* source = static_cast<const StarSystemListModel*>(sourceModel());
+    if (snapshotUnchanged || !source || !topLeft.isValid() || !bottomRight.isValid()) {
+        if (!snapshotUnchanged) {
+            refresh();
+        }
+        return;
+    }
+
+    // Edited rows are re-read in place; only a row the snapshot does not know forces a rebuild
+    const auto rows = std::span(source->rows()).subspan(
+        static_cast<std::size_t>(topLeft.row()), static_cast<std::size_t>(bottomRight.row() - topLeft.row() + 1));
+    if (m_engine.update(rows)) {
+        runQuery();
+    } else {
+        refresh();
+    }
+}
+
+void SystemFilterModel::runQuery()
+{
+    GGH_TRACE_SCOPE("SystemFilterModel::runQuery");
+    std::vector<utilities::SystemId> matches;
+    QString errorString;
+    QString plan;
+    bool filtering = false;
+    try {
+        const auto query = models::SystemQuery::parse(m_query.toStdString());
+        models::SystemQueryPlan queryPlan;
+        matches = m_engine.execute(query, &queryPlan);
+        plan = QString::fromStdString(queryPlan.describe());
+        filtering = true;
+    } catch (const std::exception& e) {
+        // Malformed text or an ownership query without a lookup: show everything and say why
+        errorString = QString::fromUtf8(e.what());
+    }
+
+    const bool changed = filtering != m_filtering || matches != m_matches;
+    m_matches = std::move(matches);
+    m_filtering = filtering;
+    m_errorString = errorString;
+    m_plan = plan;
+    if (changed) {
+        invalidateFilter();
+    }
+    emit resultsChanged();
+}
+
+bool SystemFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex& sourceParent) const
+{
+    if (!m_filtering) {
+        return true;
+    }
+    Q_UNUSED(sourceParent);
+    // The source is always the galaxy's StarSystemListModel; its row array is read directly
+    const auto* source = static_cast<const StarSystemListModel*>(sourceModel());
+    return std::binary_search(m_matches.begin(), m_matches.end(), source->systemIdAt(sourceRow));
+}
+}
@@ -0,0 +1,139 @@
+#include "ggh/modules/GalaxyCore/viewmodels/SystemSearchModel.h"
+
+#include <algorithm>
+
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+namespace ggh::GalaxyCore::viewmodels {
+SystemSearchModel::SystemSearchModel(QObject* parent)
+    : QAbstractListModel(parent)
+{
+}
+
+GalaxyViewModel* SystemSearchModel::galaxy() const
+{
+    return m_galaxy.data();
+}
+
+void SystemSearchModel::setGalaxy(GalaxyViewModel* galaxy)
+{
+    if (m_galaxy == galaxy) {
+        return;
+    }
+    disconnect(m_galaxyConnection);
+    m_galaxy = galaxy;
+    if (m_galaxy) {
+        // Added, removed and replaced systems all come with a count change
+        m_galaxyConnection = connect(m_galaxy, &GalaxyViewModel::systemCountChanged, this, &SystemSearchModel::refresh);
+    }
+    emit galaxyChanged();
+    refresh();
+}
+
+QString SystemSearchModel::query() const
+{
+    return m_query;
+}
+
+void SystemSearchModel::setQuery(const QString& query)
+{
+    if (m_query != query) {
+        m_query = query;
+        emit queryChanged();
+        refresh();
+    }
+}
+
+int SystemSearchModel::limit() const
+{
+    return m_limit;
+}
+
+void SystemSearchModel::setLimit(int limit)
+{
+    limit = std::max(limit, 0);
+    if (m_limit != limit) {
+        m_limit = limit;
+        emit limitChanged();
+        refresh();
+    }
+}
+
+int SystemSearchModel::totalMatches() const
+{
+    return m_totalMatches;
+}
+
+int SystemSearchModel::rowCount(const QModelIndex& parent) const
+{
+    return parent.isValid() ? 0 : static_cast<int>(m_results.size());
+}
+
+QVariant SystemSearchModel::data(const QModelIndex& index, int role) const
+{
+    if (!index.isValid() || index.row() >= static_cast<int>(m_results.size())) {
+        return QVariant();
+    }
+
+    const auto& result = m_results[index.row()];
+    switch (role) {
+        case Qt::DisplayRole:
+        case NameRole:
+            return result.name;
+        case SystemIdRole:
+            return static_cast<quint32>(result.id);
+        case PositionXRole:
+            return result.x;
+        case PositionYRole:
+            return result.y;
+        default:
+            return QVariant();
+    }
+}
+
+QHash<int, QByteArray> SystemSearchModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles[SystemIdRole] = "systemId";
+    roles[NameRole] = "name";
+    roles[PositionXRole] = "positionX";
+    roles[PositionYRole] = "positionY";
+    return roles;
+}
+
+int SystemSearchModel::indexOfSystem(quint32 systemId) const
+{
+    const auto it = std::find_if(m_results.begin(), m_results.end(),
+                                 [systemId](const Result& result) { return result.id == systemId; });
+    return it != m_results.end() ? static_cast<int>(it - m_results.begin()) : -1;
+}
+
+void SystemSearchModel::refresh()
+{
+    GGH_TRACE_SCOPE("SystemSearchModel::refresh");
+    std::vector<Result> results;
+    int totalMatches = 0;
+
+    const auto galaxy = m_galaxy ? m_galaxy->galaxy() : nullptr;
+    if (galaxy) {
+        std::vector<utilities::SystemId> ids;
+        ids.reserve(static_cast<std::size_t>(m_limit));
+        totalMatches = static_cast<int>(
+            galaxy->nameIndex().search(m_query.toStdString(), static_cast<std::size_t>(m_limit), ids));
+        results.reserve(ids.size());
+        for (const auto id : ids) {
+            if (const auto system = galaxy->getStarSystem(id)) {
+                const auto& position = system->getPosition();
+                results.push_back({id, QString::fromStdString(system->getName()), position.x, position.y});
+            }
+        }
+    }
+
+    // At most `limit` rows, so a reset is cheaper than diffing
+    beginResetModel();
+    m_results = std::move(results);
+    m_totalMatches = totalMatches;
+    endResetModel();
+    emit resultsChanged();
+}
+}
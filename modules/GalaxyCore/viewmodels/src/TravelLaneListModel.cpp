@@ -55,6 +55,8 @@ QVariant TravelLaneListModel::data(const QModelIndex& index, int role) const
         case IsActiveRole:
             // TravelLaneModel doesn't have active status, return true
             return true;
+        case BetweennessRole:
+            return lane->getBetweenness();
         default:
             return QVariant();
     }
@@ -87,6 +89,7 @@ QHash<int, QByteArray> TravelLaneListModel::roleNames() const
     roles[TravelTimeRole] = "travelTime";
     roles[LaneTypeRole] = "laneType";
     roles[IsActiveRole] = "isActive";
+    roles[BetweennessRole] = "betweenness";
     return roles;
 }
 
@@ -95,4 +98,18 @@ void TravelLaneListModel::refresh()
     beginResetModel();
     endResetModel();
 }
+
+void TravelLaneListModel::notifyBetweennessChanged()
+{
+    const int rows = rowCount();
+    if (rows > 0) {
+        emit dataChanged(index(0), index(rows - 1), {BetweennessRole});
+    }
+}
+
+void TravelLaneListModel::reportMemory(utilities::MemoryReport& report) const
+{
+    // Rows are read straight from the model, so only the object itself is owned here
+    report.add("listModels", sizeof(TravelLaneListModel), 1);
+}
 }
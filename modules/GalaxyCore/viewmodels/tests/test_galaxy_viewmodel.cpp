@@ -4,6 +4,10 @@
 #include <memory>
 
 #include "ggh/modules/GalaxyCore/viewmodels/GalaxyViewModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/PlanetCatalogueModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/StarSystemViewModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/SystemFilterModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/SystemSearchModel.h"
 #include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
 
 using namespace ggh::GalaxyCore::viewmodels;
@@ -184,3 +188,206 @@ TEST_F(GalaxyViewModelTest, StarSystemListModelData) {
     EXPECT_DOUBLE_EQ(posXData.toDouble(), 123.45);
     EXPECT_DOUBLE_EQ(posYData.toDouble(), -67.89);
 }
+
+TEST_F(GalaxyViewModelTest, BetweennessRoleNotifiesWithoutReset) {
+    viewModel->addStarSystem(1, "Alpha", 0.0, 0.0);
+    viewModel->addStarSystem(2, "Beta", 10.0, 0.0);
+
+    auto* systemsModel = viewModel->starSystems();
+    QSignalSpy dataSpy(systemsModel, &QAbstractItemModel::dataChanged);
+    QSignalSpy resetSpy(systemsModel, &QAbstractItemModel::modelReset);
+
+    galaxy->getStarSystem(1)->setBetweenness(0.25);
+    galaxy->getStarSystem(2)->setBetweenness(0.25);
+    systemsModel->notifyBetweennessChanged();
+
+    EXPECT_EQ(dataSpy.count(), 1);
+    EXPECT_EQ(resetSpy.count(), 0);
+    EXPECT_EQ(systemsModel->roleNames()[StarSystemListModel::BetweennessRole], "betweenness");
+    EXPECT_DOUBLE_EQ(systemsModel->data(systemsModel->index(0, 0), StarSystemListModel::BetweennessRole).toDouble(), 0.25);
+}
+
+TEST_F(GalaxyViewModelTest, HitTestFollowsSystemsMovedInTheViewModel) {
+    viewModel->addStarSystem(1, "Alpha", 100.0, 100.0);
+    viewModel->addStarSystem(2, "Beta", 500.0, 400.0);
+    // Builds the spatial index before the move
+    ASSERT_EQ(viewModel->systemAt(100.0, 100.0, 5.0), 1u);
+
+    StarSystemViewModel panel(galaxy->getStarSystem(1));
+    panel.setGalaxy(galaxy);
+    panel.setPosition(800.0, 700.0);
+
+    EXPECT_EQ(viewModel->systemAt(800.0, 700.0, 5.0), 1u);
+    EXPECT_EQ(viewModel->systemAt(100.0, 100.0, 5.0), 0u);
+    EXPECT_EQ(viewModel->systemAt(500.0, 400.0, 5.0), 2u);
+}
+
+TEST_F(GalaxyViewModelTest, ApplyToSelectionEmitsOneRangePerEdit) {
+    constexpr int systemCount = 100;
+    for (int i = 1; i <= systemCount; ++i) {
+        viewModel->addStarSystem(i, "System", i, 0.0);
+    }
+    auto* systemsModel = viewModel->starSystems();
+
+    // Select every row in one go: a single range
+    QVariantList all;
+    for (int row = 0; row < systemCount; ++row) {
+        all.append(systemsModel->data(systemsModel->index(row), StarSystemListModel::SystemIdRole));
+    }
+    QSignalSpy selectionSpy(systemsModel, &StarSystemListModel::selectionChanged);
+    QSignalSpy dataSpy(systemsModel, &QAbstractItemModel::dataChanged);
+    systemsModel->setSelection(all);
+    EXPECT_EQ(selectionSpy.count(), 1);
+    EXPECT_EQ(dataSpy.count(), 1);
+    EXPECT_EQ(systemsModel->selectionCount(), systemCount);
+
+    dataSpy.clear();
+    EXPECT_EQ(systemsModel->applyToSelection(StarSystemListModel::SystemSizeRole, 4), systemCount);
+    ASSERT_EQ(dataSpy.count(), 1);
+    EXPECT_EQ(dataSpy[0][0].toModelIndex().row(), 0);
+    EXPECT_EQ(dataSpy[0][1].toModelIndex().row(), systemCount - 1);
+    EXPECT_EQ(dataSpy[0][2].value<QList<int>>(), QList<int>{StarSystemListModel::SystemSizeRole});
+
+    // Values that are already set produce no notification at all
+    dataSpy.clear();
+    EXPECT_EQ(systemsModel->applyToSelection(StarSystemListModel::SystemSizeRole, 4), 0);
+    EXPECT_EQ(dataSpy.count(), 0);
+
+    // Every other row: still one range, and only those rows change
+    QVariantList everyOther;
+    for (int row = 0; row < systemCount; row += 2) {
+        everyOther.append(all[row]);
+    }
+    systemsModel->setSelection(everyOther);
+    dataSpy.clear();
+    EXPECT_EQ(systemsModel->applyToSelection(StarSystemListModel::StarTypeRole, 2), systemCount / 2);
+    EXPECT_EQ(dataSpy.count(), 1);
+    EXPECT_EQ(systemsModel->data(systemsModel->index(0), StarSystemListModel::StarTypeRole).toInt(), 2);
+    EXPECT_TRUE(systemsModel->data(systemsModel->index(0), StarSystemListModel::SelectedRole).toBool());
+    EXPECT_FALSE(systemsModel->data(systemsModel->index(1), StarSystemListModel::SelectedRole).toBool());
+
+    // Read-only roles are refused
+    EXPECT_EQ(systemsModel->applyToSelection(StarSystemListModel::SystemIdRole, 5), 0);
+}
+
+TEST_F(GalaxyViewModelTest, ApplyToSpatialSelectionCoversScatteredRows) {
+    // A 10 x 10 grid whose rows come out in hash order, not by position
+    for (int i = 0; i < 100; ++i) {
+        viewModel->addStarSystem(i + 1, "System", 10.0 * (i % 10), 10.0 * (i / 10));
+    }
+    auto* systemsModel = viewModel->starSystems();
+
+    // A rubber band over the lower-left corner selects systems scattered across the rows
+    systemsModel->setSelection(viewModel->systemsInRect(QRectF(0.0, 0.0, 35.0, 35.0)));
+    ASSERT_EQ(systemsModel->selectionCount(), 16);
+
+    QSignalSpy dataSpy(systemsModel, &QAbstractItemModel::dataChanged);
+    EXPECT_EQ(systemsModel->applyToSelection(StarSystemListModel::StarTypeRole, 3), 16);
+    ASSERT_EQ(dataSpy.count(), 1);
+    const int first = dataSpy[0][0].toModelIndex().row();
+    const int last = dataSpy[0][1].toModelIndex().row();
+
+    for (int row = 0; row < systemsModel->rowCount(); ++row) {
+        const auto index = systemsModel->index(row);
+        const bool selected = systemsModel->data(index, StarSystemListModel::SelectedRole).toBool();
+        const double x = systemsModel->data(index, StarSystemListModel::PositionXRole).toDouble();
+        const double y = systemsModel->data(index, StarSystemListModel::PositionYRole).toDouble();
+        EXPECT_EQ(selected, x <= 35.0 && y <= 35.0);
+        EXPECT_EQ(systemsModel->data(index, StarSystemListModel::StarTypeRole).toInt() == 3, selected);
+        if (selected) {
+            EXPECT_GE(row, first);
+            EXPECT_LE(row, last);
+        }
+    }
+}
+
+TEST_F(GalaxyViewModelTest, SystemSearchModelKeepsTopMatches) {
+    viewModel->addStarSystem(1, "Alpha Centauri", 0.0, 0.0);
+    viewModel->addStarSystem(2, "Centaur Gate", 10.0, 0.0);
+    viewModel->addStarSystem(3, "Barnard", 20.0, 0.0);
+
+    SystemSearchModel search;
+    search.setGalaxy(viewModel.get());
+    EXPECT_EQ(search.rowCount(), 3);
+
+    search.setQuery("centaur");
+    ASSERT_EQ(search.rowCount(), 2);
+    EXPECT_EQ(search.data(search.index(0), SystemSearchModel::SystemIdRole).toUInt(), 2u);
+    EXPECT_EQ(search.data(search.index(1), SystemSearchModel::NameRole).toString(), "Alpha Centauri");
+
+    search.setLimit(1);
+    EXPECT_EQ(search.rowCount(), 1);
+    EXPECT_EQ(search.totalMatches(), 2);
+
+    // New systems show up without a manual refresh
+    viewModel->addStarSystem(4, "Centauri Prime", 30.0, 0.0);
+    EXPECT_EQ(search.totalMatches(), 3);
+    EXPECT_EQ(search.indexOfSystem(2), 0);
+}
+
+TEST_F(GalaxyViewModelTest, SystemFilterModelFollowsQueryAndEdits) {
+    viewModel->addStarSystem(1, "Sol", 0.0, 0.0);
+    viewModel->addStarSystem(2, "Vega", 100.0, 0.0);
+    viewModel->addStarSystem(3, "Rigel", 500.0, 0.0);
+    viewModel->setOwnershipLookup([](ggh::GalaxyCore::utilities::SystemId id) { return id == 2; });
+
+    SystemFilterModel filter;
+    filter.setGalaxy(viewModel.get());
+    EXPECT_EQ(filter.rowCount(), 3);
+
+    filter.setQuery("within 150 of 1");
+    EXPECT_EQ(filter.rowCount(), 2);
+    EXPECT_EQ(filter.matchingSystemIds(), (QVariantList{1u, 2u}));
+
+    filter.setQuery("within 150 of 1 and unowned");
+    ASSERT_EQ(filter.rowCount(), 1);
+    EXPECT_EQ(filter.data(filter.index(0, 0), StarSystemListModel::NameRole).toString(), "Sol");
+
+    // Moving a system through the list model re-runs the query
+    auto* systems = viewModel->starSystems();
+    for (int row = 0; row < systems->rowCount(); ++row) {
+        if (systems->data(systems->index(row), StarSystemListModel::SystemIdRole).toUInt() == 3u) {
+            systems->setData(systems->index(row), 50.0, StarSystemListModel::PositionXRole);
+        }
+    }
+    EXPECT_EQ(filter.rowCount(), 2);
+
+    // Rows are in id order; an edit to one of them is picked up in place
+    filter.setQuery("type = BlackHole");
+    EXPECT_EQ(filter.rowCount(), 0);
+    systems->setData(systems->index(1), static_cast<int>(StarType::BlackHole), StarSystemListModel::StarTypeRole);
+    ASSERT_EQ(filter.rowCount(), 1);
+    EXPECT_EQ(filter.data(filter.index(0, 0), StarSystemListModel::NameRole).toString(), "Vega");
+
+    // A malformed query shows everything and explains why
+    filter.setQuery("within 150 of");
+    EXPECT_EQ(filter.rowCount(), 3);
+    EXPECT_FALSE(filter.errorString().isEmpty());
+}
+
+TEST_F(GalaxyViewModelTest, PlanetCatalogueModelFiltersByTypeAndRange) {
+    viewModel->addStarSystem(1, "Sol", 0.0, 0.0);
+    viewModel->addStarSystem(2, "Vega", 10.0, 0.0);
+    galaxy->getStarSystem(1)->addPlanet(Planet("Earth", PlanetType::Ocean, 1.0, 1.0, 1, 1.0, 320.0, 250.0));
+    galaxy->getStarSystem(1)->addPlanet(Planet("Mars", PlanetType::Desert, 0.5, 0.1, 2, 1.5, 290.0, 150.0));
+    galaxy->getStarSystem(2)->addPlanet(Planet("Thalassa", PlanetType::Ocean, 2.0, 3.0, 0, 2.0, 300.0, 260.0));
+
+    PlanetCatalogueModel planets;
+    planets.setGalaxy(viewModel.get());
+    // Planets added straight to the model only show up once the catalogue is rebuilt
+    EXPECT_EQ(planets.rowCount(), 0);
+    viewModel->rebuildPlanetCatalogue();
+    EXPECT_EQ(planets.rowCount(), 3);
+
+    planets.setPlanetTypes({static_cast<int>(PlanetType::Ocean)});
+    EXPECT_EQ(planets.matchCount(), 2);
+    planets.setRange(PlanetCatalogueModel::MoonsColumn, 1.0, 100.0);
+    ASSERT_EQ(planets.rowCount(), 1);
+    EXPECT_EQ(planets.data(planets.index(0), PlanetCatalogueModel::NameRole).toString(), "Earth");
+    EXPECT_EQ(planets.data(planets.index(0), PlanetCatalogueModel::SystemNameRole).toString(), "Sol");
+    EXPECT_DOUBLE_EQ(planets.data(planets.index(0), PlanetCatalogueModel::MinTempRole).toDouble(), 250.0);
+
+    planets.clearRanges();
+    planets.setPlanetTypes({});
+    EXPECT_EQ(planets.rowCount(), 3);
+}
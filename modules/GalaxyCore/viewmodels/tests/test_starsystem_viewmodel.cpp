@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "ggh/modules/GalaxyCore/viewmodels/StarSystemViewModel.h"
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 #include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
 #include "ggh/modules/GalaxyCore/utilities/Common.h"
@@ -76,6 +77,27 @@ TEST_F(StarSystemViewModelTest, SetPositionBoth) {
     EXPECT_DOUBLE_EQ(viewModel->positionY(), -67.89);
 }
 
+TEST_F(StarSystemViewModelTest, PositionEditsGoThroughTheGalaxy) {
+    auto galaxy = std::make_shared<GalaxyModel>(1000, 1000);
+    galaxy->addStarSystem(1, "Sol", CartesianCoordinates<double>(0.0, 0.0));
+    galaxy->addStarSystem(2, "Proxima", CartesianCoordinates<double>(3.0, 0.0));
+    galaxy->addTravelLane(10, 1, 2);
+
+    StarSystemViewModel panel(galaxy->getStarSystem(2));
+    panel.setGalaxy(galaxy);
+    const auto revision = galaxy->laneGraph().revision();
+
+    // The property panel edits one coordinate at a time
+    panel.setPositionY(4.0);
+
+    const auto& graph = galaxy->laneGraph();
+    EXPECT_GT(graph.revision(), revision);
+    EXPECT_DOUBLE_EQ(graph.position(graph.indexOf(2)).y, 4.0);
+    EXPECT_DOUBLE_EQ(graph.neighbours(graph.indexOf(1)).lengths[0], 5.0);
+    EXPECT_DOUBLE_EQ(graph.neighbours(graph.indexOf(2)).lengths[0], 5.0);
+    EXPECT_DOUBLE_EQ(galaxy->getStarSystem(2)->getPosition().y, 4.0);
+}
+
 TEST_F(StarSystemViewModelTest, NoSignalOnSameValue) {
     QSignalSpy nameSpy(viewModel.get(), &StarSystemViewModel::nameChanged);
     QSignalSpy positionSpy(viewModel.get(), &StarSystemViewModel::positionChanged);
@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <QCoreApplication>
+#include <QSignalSpy>
+#include <memory>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/viewmodels/StarSystemViewModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/PlanetListModel.h"
+#include "ggh/modules/GalaxyCore/viewmodels/ViewModelPool.h"
+#include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
+
+using namespace ggh::GalaxyCore::viewmodels;
+using namespace ggh::GalaxyCore::models;
+using namespace ggh::GalaxyCore::utilities;
+
+class ViewModelPoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!QCoreApplication::instance()) {
+            int argc = 0;
+            char** argv = nullptr;
+            app = std::make_unique<QCoreApplication>(argc, argv);
+        }
+        for (SystemId id = 1; id <= 100; ++id) {
+            systems.push_back(std::make_shared<StarSystemModel>(
+                id, "System " + std::to_string(id), CartesianCoordinates<double>(id, id)));
+        }
+    }
+
+    std::unique_ptr<QCoreApplication> app;
+    std::vector<std::shared_ptr<StarSystemModel>> systems;
+};
+
+TEST_F(ViewModelPoolTest, ReselectingReturnsTheCachedViewModel) {
+    QObject owner;
+    StarSystemViewModelPool pool(&owner, 4);
+
+    auto* first = pool.acquire(1, systems[0]);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(pool.acquire(1, systems[0]), first);
+    EXPECT_EQ(pool.createdCount(), 1u);
+    EXPECT_EQ(pool.hitCount(), 1u);
+    EXPECT_EQ(pool.acquire(2, nullptr), nullptr);
+}
+
+TEST_F(ViewModelPoolTest, VisitingManySystemsStaysWithinCapacity) {
+    QObject owner;
+    StarSystemViewModelPool pool(&owner, 8);
+
+    for (const auto& system : systems) {
+        auto* viewModel = pool.acquire(system->getId(), system);
+        ASSERT_NE(viewModel, nullptr);
+        EXPECT_EQ(viewModel->systemId(), system->getId());
+        EXPECT_EQ(viewModel->name().toStdString(), system->getName());
+    }
+    EXPECT_EQ(pool.size(), 8u);
+    EXPECT_EQ(pool.createdCount(), 8u);
+    EXPECT_EQ(pool.rebindCount(), systems.size() - 8);
+    EXPECT_EQ(owner.children().size(), 8);
+
+    // Only the most recently used systems are still cached
+    EXPECT_EQ(pool.find(1), nullptr);
+    EXPECT_NE(pool.find(100), nullptr);
+}
+
+TEST_F(ViewModelPoolTest, ReplacedEntityIsReboundUnderTheSameKey) {
+    QObject owner;
+    StarSystemViewModelPool pool(&owner);
+
+    auto* viewModel = pool.acquire(1, systems[0]);
+    QSignalSpy nameSpy(viewModel, &StarSystemViewModel::nameChanged);
+
+    // A regenerated galaxy reuses ids for new systems
+    auto regenerated = std::make_shared<StarSystemModel>(1, "Reborn", CartesianCoordinates<double>(0.0, 0.0));
+    EXPECT_EQ(pool.acquire(1, regenerated), viewModel);
+    EXPECT_EQ(viewModel->starSystem(), regenerated);
+    EXPECT_EQ(viewModel->name(), "Reborn");
+    EXPECT_EQ(nameSpy.count(), 1);
+    EXPECT_EQ(pool.createdCount(), 1u);
+}
+
+TEST_F(ViewModelPoolTest, PinnedViewModelIsNeverRecycled) {
+    QObject owner;
+    StarSystemViewModelPool pool(&owner, 4);
+
+    auto* selected = pool.acquire(1, systems[0]);
+    pool.pin(1);
+    for (const auto& system : systems) {
+        pool.acquire(system->getId(), system);
+    }
+    EXPECT_EQ(pool.find(1), selected);
+    EXPECT_EQ(selected->systemId(), 1u);
+    EXPECT_EQ(pool.size(), 4u);
+
+    // With only the pinned viewmodel left to recycle the pool grows by one instead
+    pool.setCapacity(1);
+    EXPECT_EQ(pool.find(1), selected);
+    EXPECT_EQ(pool.size(), 1u);
+    auto* other = pool.acquire(2, systems[1]);
+    EXPECT_NE(other, selected);
+    EXPECT_EQ(pool.size(), 2u);
+    EXPECT_EQ(pool.acquire(3, systems[2]), other);
+    EXPECT_EQ(selected->systemId(), 1u);
+
+    // Unpinned, it is the least recently used one again
+    pool.unpin();
+    EXPECT_EQ(pool.acquire(4, systems[3]), selected);
+    EXPECT_EQ(selected->systemId(), 4u);
+}
+
+TEST_F(ViewModelPoolTest, PooledViewModelsKeepTheirEntitiesAlive) {
+    QObject owner;
+    StarSystemViewModelPool pool(&owner, 2);
+
+    std::weak_ptr<StarSystemModel> removed = systems[0];
+    auto* viewModel = pool.acquire(1, systems[0]);
+    systems[0].reset();
+    ASSERT_FALSE(removed.expired());
+    EXPECT_EQ(pool.find(1), viewModel);
+    EXPECT_EQ(viewModel->name(), "System 1");
+
+    // Rebinding the viewmodel releases the entity
+    pool.acquire(2, systems[1]);
+    pool.acquire(3, systems[2]);
+    EXPECT_TRUE(removed.expired());
+    EXPECT_EQ(pool.find(1), nullptr);
+}
+
+TEST_F(ViewModelPoolTest, PlanetRowsReuseTheirViewModels) {
+    systems[0]->addPlanet(Planet("Inner", PlanetType::Rocky, 1.0, 1.0, 0, 1.0, 300.0, 200.0));
+    systems[0]->addPlanet(Planet("Outer", PlanetType::GasGiant, 10.0, 300.0, 12, 5.0, 150.0, 100.0));
+    PlanetListModel model(systems[0]);
+
+    const auto index = model.index(1, 0);
+    auto* first = model.data(index, PlanetListModel::ViewModelRole).value<PlanetViewModel*>();
+    auto* second = model.data(index, PlanetListModel::ViewModelRole).value<PlanetViewModel*>();
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first->name(), "Outer");
+    EXPECT_EQ(model.viewModelPool().createdCount(), 1u);
+
+    // Showing another system keeps the list model and rebinds the row's viewmodel
+    systems[1]->addPlanet(Planet("Lonely", PlanetType::Frozen, 0.5, 0.1, 0, 9.0, 50.0, 20.0));
+    systems[1]->addPlanet(Planet("Distant", PlanetType::Frozen, 0.5, 0.1, 0, 12.0, 40.0, 10.0));
+    model.setStarSystem(systems[1]);
+    auto* rebound = model.data(index, PlanetListModel::ViewModelRole).value<PlanetViewModel*>();
+    EXPECT_EQ(rebound, first);
+    EXPECT_EQ(rebound->name(), "Distant");
+    EXPECT_EQ(model.viewModelPool().createdCount(), 1u);
+}
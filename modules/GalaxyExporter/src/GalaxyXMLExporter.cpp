@@ -2,12 +2,14 @@
 
 #include <QFile>
 #include <QTextStream>
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
 
 namespace ggh::Galaxy::Exporter {
 GalaxyXMLExporter::GalaxyXMLExporter(std::shared_ptr<GalaxyCore::models::GalaxyModel> model, QObject* parent)
     : AbstractExporter(parent), m_model(model) {}
 
 bool GalaxyXMLExporter::exportToFile(const std::string& filePath) const {
+    GGH_TRACE_SCOPE("GalaxyXMLExporter::exportToFile");
     if (!m_model) {
         return false;
     }
@@ -18,8 +20,14 @@ bool GalaxyXMLExporter::exportToFile(const std::string& filePath) const {
         return false;
     }
 
+    std::string xml;
+    {
+        GGH_TRACE_SCOPE("GalaxyXMLExporter::serialize");
+        xml = m_model->toXml();
+    }
+
     QTextStream stream(&file);
-    stream << m_model->toXml().c_str(); // Assuming GalaxyModel has a toXml() method that returns XML as QString
+    stream << xml.c_str();
     return true;
 }
 
@@ -2,6 +2,7 @@
 
 #include <QFile>
 #include <QTextStream>
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 
 
@@ -11,6 +12,7 @@ StarSystemXMLExporter::StarSystemXMLExporter(std::shared_ptr<GalaxyCore::models:
     : AbstractExporter(parent), m_model(model) {}
 
 bool StarSystemXMLExporter::exportToFile(const std::string& filePath) const {
+    GGH_TRACE_SCOPE("StarSystemXMLExporter::exportToFile");
     if (!m_model) {
         return false;
     }
@@ -21,8 +23,14 @@ bool StarSystemXMLExporter::exportToFile(const std::string& filePath) const {
         return false;
     }
 
+    std::string xml;
+    {
+        GGH_TRACE_SCOPE("StarSystemXMLExporter::serialize");
+        xml = m_model->toXml();
+    }
+
     QTextStream stream(&file);
-    stream << m_model->toXml().c_str(); // Assuming StarSystemModel has a toXml() method that returns XML as QString
+    stream << xml.c_str();
     return true;
 }
 
@@ -0,0 +1,147 @@
+#ifndef GGH_MODULES_GALAXYFACTIONS_EXPANSION_SIMULATOR_H
+#define GGH_MODULES_GALAXYFACTIONS_EXPANSION_SIMULATOR_H
+
+#include "ggh/modules/GalaxyCore/models/GalacticDate.h"
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyFactions/models/FactionHandover.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ggh::Galaxy::Factions::models {
+
+class GalaxyFactions;
+
+/**
+ * @brief Scoring and pacing rules of an expansion simulation.
+ *
+ * A faction scores an unowned system next to its territory as
+ * planetWeight * planets + resourceWeight * resources - distanceWeight * lane length,
+ * using the shortest lane from a system the faction holds. Resources default to the total
+ * planet mass of the system plus any bonuses its holder recorded.
+ */
+struct ExpansionRules {
+    double planetWeight{1.0};
+    double resourceWeight{0.1};
+    double distanceWeight{0.01};
+    double minimumScore{-1e300};     ///< Systems scoring below this are never claimed
+    std::size_t claimsPerTurn{1};    ///< Systems each faction may claim per turn
+    int daysPerTurn{30};
+    int handoverTypeId{1};
+};
+
+/**
+ * @class ExpansionSimulator
+ * @brief Deterministic turn-based expansion of factions over the lane graph.
+ *
+ * Each turn every faction scores the unowned systems bordering its territory and proposes its
+ * best claims. Factions score in parallel against a read-only owner buffer and write only their
+ * own proposal slot. A serial pass then settles contested systems: the higher score wins, and
+ * the lower faction id wins ties. The claims are applied to the other buffer and the two swap.
+ * Results, including handover ids, are the same for any thread count.
+ *
+ * Per-system inputs are flat arrays indexed like the lane graph, and every faction keeps a
+ * frontier of candidate systems, so a turn costs about the size of the factions' borders.
+ */
+class ExpansionSimulator
+{
+public:
+    using NodeIndex = GalaxyCore::models::LaneGraph::NodeIndex;
+    static constexpr int NO_FACTION = 0;
+    static constexpr std::size_t DEFAULT_PARALLEL_THRESHOLD = 16384;
+
+    /**
+     * @brief Takes the lane graph, planet counts, holders and bonuses as the starting state.
+     * @param galaxy The galaxy; its lane graph must outlive the simulator.
+     * @param factions Factions and the systems they hold; only read during bind.
+     */
+    void bind(const GalaxyCore::models::GalaxyModel& galaxy, const GalaxyFactions& factions);
+
+    void setRules(const ExpansionRules& rules) { m_rules = rules; }
+    const ExpansionRules& rules() const noexcept { return m_rules; }
+
+    /**
+     * @brief Frontier size below which a turn is scored on the calling thread only.
+     *
+     * Scoring one frontier entry is cheap, so small turns finish before threads could start.
+     */
+    void setParallelThreshold(std::size_t frontierSize) noexcept { m_parallelThreshold = frontierSize; }
+
+    /**
+     * @brief Overrides the resource value of one system.
+     * @return False if the system is not in the graph.
+     */
+    bool setResources(GalaxyCore::utilities::SystemId system, double resources);
+
+    /**
+     * @brief Runs one turn.
+     * @param handovers Receives the turn's claims, ordered by system id.
+     * @param threadCount Worker threads for scoring; 0 uses all cores.
+     * @return Number of systems claimed.
+     */
+    std::size_t step(std::vector<FactionHandover>& handovers, unsigned threadCount = 0);
+
+    /**
+     * @brief Runs turns until the limit or until no faction can claim anything.
+     * @return Number of turns that claimed at least one system.
+     */
+    std::size_t run(std::size_t turns, std::vector<FactionHandover>& handovers, unsigned threadCount = 0);
+
+    void setStartDate(const GalaxyCore::models::GalacticDate& date) { m_startDay = date.toDayNumber(); }
+    GalaxyCore::models::GalacticDate currentDate() const;
+    std::size_t turn() const noexcept { return m_turn; }
+
+    int ownerOf(GalaxyCore::utilities::SystemId system) const;
+
+    /**
+     * @brief Owner of every graph node after the last turn, indexed like the graph.
+     */
+    std::span<const int> owners() const noexcept { return m_owners[m_current]; }
+
+    /**
+     * @brief Writes claimed systems into the factions through GalaxyFactions::recordHandover.
+     *
+     * Each handover is logged and starts the history of the System record created for it.
+     */
+    static void commit(std::span<const FactionHandover> handovers, GalaxyFactions& factions,
+                       const GalaxyCore::models::GalaxyModel& galaxy);
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    struct Claim {
+        double score;
+        NodeIndex node;
+        int faction;
+    };
+
+    struct FactionState {
+        int id;
+        std::vector<NodeIndex> frontier;   ///< Candidate nodes; may hold stale or repeated entries
+        std::vector<Claim> proposals;      ///< This turn's best claims
+    };
+
+    void score(FactionState& faction) const;
+    void extendFrontier(FactionState& faction, NodeIndex node) const;
+
+    const GalaxyCore::models::LaneGraph* m_graph{nullptr};
+    ExpansionRules m_rules;
+    std::size_t m_parallelThreshold{DEFAULT_PARALLEL_THRESHOLD};
+    std::vector<double> m_planets;                 ///< Planet count per node
+    std::vector<double> m_resources;               ///< Resource value per node
+    std::array<std::vector<int>, 2> m_owners;      ///< Double-buffered owner per node
+    std::size_t m_current{0};                      ///< Buffer holding the current state
+    std::vector<Claim> m_lastClaims;               ///< Claims the other buffer has not seen yet
+    std::vector<FactionState> m_factions;          ///< Sorted by faction id
+    GalaxyCore::models::GalacticDate::DayNumber m_startDay{0};
+    std::size_t m_turn{0};
+    int m_nextHandoverId{1};
+};
+
+} // namespace ggh::Galaxy::Factions::models
+
+#endif // !GGH_MODULES_GALAXYFACTIONS_EXPANSION_SIMULATOR_H
@@ -4,23 +4,47 @@
 #include "ggh/modules/GalaxyFactions/models/System.h"
 #include "ggh/modules/GalaxyFactions/models/SystemResourceBonus.h"
 #include "ggh/modules/GalaxyFactions/models/SystemNotes.h"
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 #include <memory>
 #include <unordered_map>
 
 namespace ggh::Galaxy::Factions::models {
+
+class GalaxyFactions;
+
+/**
+ * @class Faction
+ * @brief A named faction and the systems it holds
+ *
+ * Factions created through GalaxyFactions keep its ownership index current from addSystem and
+ * removeSystem; adding a system another faction of the same registry holds moves it here.
+ * Their setters and system edits are also announced to the registry's change listeners.
+ *
+ * Resource bonuses are summed per resource type handle (see ResourceTypeRegistry) into flat
+ * arrays as systems join and leave and as their bonuses change, so totals are read in O(1).
+ * A system's bonus edits reach the faction that tracks it, which is the first faction holding
+ * it at the time; registries hand a moved system over to its new owner.
+ */
 class Faction
 {
 public:
     Faction(int id, const std::string& name, const std::string& description, const std::string& color);
+    ~Faction();
+
+    // Copies are unregistered snapshots; they do not track the systems' later bonus edits
+    Faction(const Faction& other);
+    Faction& operator=(const Faction&) = delete;
 
     // Getters
     int id() const { return m_id; }
     std::string name() const { return m_name; }
     std::string description() const { return m_description; }
     std::string color() const { return m_color; }
-    std::vector<std::shared_ptr<System>> systems() const { return m_systems; }
+    const std::vector<std::shared_ptr<System>>& systems() const noexcept { return m_systems; }
+    bool hasSystem(int systemId) const;
 
     // Setters
     void setId(int id);
@@ -39,19 +63,44 @@ public:
     std::vector<SystemNotes> getNotes() const;
     int getResourceBonusesByType(int resourceTypeId) const;
     std::unordered_map<ResourceType, int> getResourcesStock() const;
+    std::size_t resourceBonusCount() const noexcept { return m_resourceBonusCount; }
+    int resourceTotal(ResourceTypeRegistry::Handle resourceType) const noexcept {
+        return resourceType < m_resourceAmounts.size() ? m_resourceAmounts[resourceType] : 0;
+    }
+
+    /**
+     * @brief Summed bonus amount per resource type handle; handles past the end have none.
+     */
+    std::span<const int> resourceAmounts() const noexcept { return m_resourceAmounts; }
+
+    /**
+     * @brief Number of bonuses per resource type handle, parallel to resourceAmounts().
+     */
+    std::span<const std::uint32_t> resourceBonusCounts() const noexcept { return m_resourceBonusCounts; }
 
     std::string toXml() const;
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
     static std::string xmlTag() noexcept {
         return "Faction";
     }
 
 private:
+    friend class GalaxyFactions;
+    friend class System;
+
+    bool eraseSystem(int systemId);
+    void applySystem(System& system, int sign);
+    void applyBonus(ResourceTypeRegistry::Handle resourceType, int amount, int count);
+
+    GalaxyFactions* m_registry{nullptr};   ///< Registry that indexes this faction, if any
     int m_id;
     std::string m_name;
     std::string m_description;
     std::string m_color;
     std::vector<std::shared_ptr<System>> m_systems;
-    std::unordered_map<ResourceType, int> m_resourcesStock; // Maps resource type to its stock
+    std::vector<int> m_resourceAmounts;                 ///< Summed bonus, indexed by resource type handle
+    std::vector<std::uint32_t> m_resourceBonusCounts;   ///< Bonus count, indexed by resource type handle
+    std::size_t m_resourceBonusCount{0};
 };
 
 } // namespace ggh::Galaxy::Factions
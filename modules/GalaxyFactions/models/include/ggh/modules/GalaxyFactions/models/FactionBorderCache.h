@@ -0,0 +1,89 @@
+#ifndef GGH_MODULES_GALAXYFACTIONS_FACTION_BORDER_CACHE_H
+#define GGH_MODULES_GALAXYFACTIONS_FACTION_BORDER_CACHE_H
+
+#include "ggh/modules/GalaxyFactions/models/VoronoiCells.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace ggh::Galaxy::Factions::models {
+
+/**
+ * @brief One edge of a faction's region outline.
+ */
+struct BorderSegment {
+    GalaxyCore::utilities::CartesianCoordinates<double> from;
+    GalaxyCore::utilities::CartesianCoordinates<double> to;
+};
+
+/**
+ * @class FactionBorderCache
+ * @brief Faction regions built from Voronoi cells of star systems, with per-cell caching.
+ *
+ * A faction's region is the union of the cells of the systems it owns. Only cell edges whose
+ * two sides have different owners (or that lie on the galaxy bounds) are kept as border
+ * segments, so adjacent cells of one faction merge into a single outlined region.
+ *
+ * Geometry and border segments are cached per cell. Moving a system recomputes only the
+ * cells around it; an ownership change only rebuilds the borders of that cell and its
+ * neighbours.
+ */
+class FactionBorderCache
+{
+public:
+    using Index = VoronoiCells::Index;
+    static constexpr int NO_FACTION = 0;
+
+    void setBounds(double minX, double minY, double maxX, double maxY);
+
+    /**
+     * @brief Replaces all systems; every cell starts unowned.
+     */
+    void setSites(std::span<const GalaxyCore::utilities::CartesianCoordinates<double>> sites);
+    void moveSite(Index site, const GalaxyCore::utilities::CartesianCoordinates<double>& position);
+
+    /**
+     * @brief Sets the owner of every cell; only cells whose owner differs are invalidated.
+     * @param owners One faction id per site, NO_FACTION for unowned.
+     */
+    void setOwners(std::span<const int> owners);
+    void setOwner(Index site, int factionId);
+
+    /**
+     * @brief Brings invalidated cells and borders up to date.
+     * @return True if anything changed; revision() is bumped in that case.
+     */
+    bool update();
+
+    std::uint64_t revision() const noexcept { return m_revision; }
+    const VoronoiCells& cells() const noexcept { return m_cells; }
+    std::span<const int> owners() const noexcept { return m_owners; }
+    int owner(Index site) const { return m_owners[site]; }
+
+    /**
+     * @brief Border segments of one owned cell; empty for unowned cells.
+     */
+    std::span<const BorderSegment> borders(Index site) const { return m_borders[site]; }
+
+    /**
+     * @brief Number of cells whose borders the last update() rebuilt.
+     */
+    std::size_t lastBorderUpdateCount() const noexcept { return m_lastBorderUpdateCount; }
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    void rebuildBorders(Index site);
+
+    VoronoiCells m_cells;
+    std::vector<int> m_owners;
+    std::vector<std::vector<BorderSegment>> m_borders;
+    std::vector<Index> m_ownerChanges;
+    bool m_allBordersDirty{false};
+    std::uint64_t m_revision{0};
+    std::size_t m_lastBorderUpdateCount{0};
+};
+
+} // namespace ggh::Galaxy::Factions::models
+
+#endif // !GGH_MODULES_GALAXYFACTIONS_FACTION_BORDER_CACHE_H
@@ -1,43 +1,139 @@
 #ifndef GGH_MODULES_GALAXYFACTIONS_GALAXY_FACTIONS_H
 #define GGH_MODULES_GALAXYFACTIONS_GALAXY_FACTIONS_H
 
+#include "ggh/modules/GalaxyCore/utilities/Common.h"
 #include "ggh/modules/GalaxyFactions/models/Faction.h"
+#include "ggh/modules/GalaxyFactions/models/HandoverLog.h"
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
 namespace ggh::Galaxy::Factions::models {
 
+/**
+ * @struct FactionChange
+ * @brief What happened to one faction of a GalaxyFactions registry.
+ *
+ * Sent after the change is made. position is the faction's index in factions() at that time;
+ * for Removed it is the index the faction had before it was erased.
+ */
+struct FactionChange {
+    enum class Kind { Created, Modified, Removed };
+
+    /// Parts of a faction a Modified change touched
+    enum Field : unsigned {
+        NoField = 0,
+        IdField = 1u << 0,
+        DetailsField = 1u << 1,   ///< Name, description or color
+        SystemsField = 1u << 2
+    };
+
+    Kind kind;
+    int factionId;
+    std::size_t position;
+    unsigned fields{NoField};
+};
+
 /**
  * @class GalaxyFactions
  * @brief Main manager class for creating, modifying, and managing galaxy factions
+ *
+ * Keeps an id index over its factions and an ownership index over their systems, so faction
+ * lookups and "who owns system X" are O(1). Factions created here report their addSystem and
+ * removeSystem calls back to the registry, which keeps the indices current and enforces that a
+ * system belongs to at most one faction: adding it to one faction takes it from the previous one.
+ *
+ * The registry is the single owner of its factions; views hold the same instances and follow
+ * creation, removal and every edit of a registered faction through change listeners.
  */
 class GalaxyFactions
 {
 public:
+    static constexpr int NO_FACTION = 0;   ///< Owner of systems no faction holds; ids start at 1
+
+    using ChangeListener = std::function<void(const FactionChange&)>;
+    using ListenerId = std::size_t;
+
     GalaxyFactions();
     ~GalaxyFactions();
 
+    // Factions point back at the registry, so it stays where it was created
+    GalaxyFactions(const GalaxyFactions&) = delete;
+    GalaxyFactions& operator=(const GalaxyFactions&) = delete;
+
     // Faction management
     std::shared_ptr<Faction> createFaction(const std::string& name, const std::string& description, const std::string& color);
     std::shared_ptr<Faction> modifyFaction(int id, const std::string& name, const std::string& description, const std::string& color);
     bool deleteFaction(int id);
     std::shared_ptr<Faction> getFaction(int id) const;
     std::vector<std::shared_ptr<Faction>> getAllFactions() const;
+    const std::vector<std::shared_ptr<Faction>>& factions() const noexcept { return m_factions; }
+
+    // System ownership
+    int ownerOf(GalaxyCore::utilities::SystemId systemId) const;
+    std::shared_ptr<Faction> owningFaction(GalaxyCore::utilities::SystemId systemId) const;
+    const std::unordered_map<GalaxyCore::utilities::SystemId, int>& systemOwners() const noexcept {
+        return m_systemOwners;
+    }
+
+    /**
+     * @brief Owner of every system, indexed by system id; NO_FACTION where unowned.
+     *
+     * Sized to the largest owned system id plus one; ids beyond the end are unowned.
+     */
+    std::span<const int> ownerTable() const noexcept { return m_ownerTable; }
+
+    // Ownership history
+    /**
+     * @brief Logs a handover and moves the system if its current holder is known here.
+     * @param starSystem Star system to create the System record from when no faction holds it yet;
+     *                   without it such a handover is only logged.
+     * @return False if the handover is dated before the last logged one.
+     */
+    bool recordHandover(const FactionHandover& handover,
+                        const std::shared_ptr<GalaxyCore::models::StarSystemModel>& starSystem = nullptr);
+    const HandoverLog& handovers() const noexcept { return m_handovers; }
+
+    // Change notification
+    /**
+     * @brief Registers a callback for every faction created, edited or removed from now on.
+     * @return Token for removeChangeListener().
+     */
+    ListenerId addChangeListener(ChangeListener listener);
+    void removeChangeListener(ListenerId id);
 
     // Export functionality
     std::string toXml() const;
+
+    // Diagnostics
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
     static std::string xmlTag() noexcept {
         return "Factions";
     }
 
 private:
-    std::vector<std::shared_ptr<Faction>> m_factions;
+    friend class Faction;
+
+    std::vector<std::shared_ptr<Faction>> m_factions;                       ///< Creation order, for export
+    std::unordered_map<int, std::shared_ptr<Faction>> m_factionIndex;       ///< Faction id to faction
+    std::unordered_map<GalaxyCore::utilities::SystemId, int> m_systemOwners; ///< System id to faction id
+    std::vector<int> m_ownerTable;                                          ///< Dense mirror of m_systemOwners
+    HandoverLog m_handovers;                                                ///< Dated ownership changes
+    std::vector<std::pair<ListenerId, ChangeListener>> m_listeners;
+    ListenerId m_nextListenerId{1};
     int m_nextFactionId;
 
-    // Helper methods
-    std::vector<std::shared_ptr<Faction>>::iterator findFaction(int id);
-    std::vector<std::shared_ptr<Faction>>::const_iterator findFaction(int id) const;
+    // Ownership hooks called by registered factions
+    bool claimSystem(Faction& faction, GalaxyCore::utilities::SystemId systemId);
+    void releaseSystem(const Faction& faction, GalaxyCore::utilities::SystemId systemId);
+    bool renumberFaction(Faction& faction, int newId);
+    void setOwner(GalaxyCore::utilities::SystemId systemId, int factionId);
+    void notifyModified(const Faction& faction, unsigned fields);
+    void notify(const FactionChange& change);
 };
 
 } // namespace Factions
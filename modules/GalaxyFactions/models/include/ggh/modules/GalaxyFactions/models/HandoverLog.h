@@ -0,0 +1,116 @@
+#ifndef GGH_MODULES_GALAXYFACTIONS_HANDOVER_LOG_H
+#define GGH_MODULES_GALAXYFACTIONS_HANDOVER_LOG_H
+
+#include "ggh/modules/GalaxyCore/models/GalacticDate.h"
+#include "ggh/modules/GalaxyCore/utilities/Common.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyFactions/models/FactionHandover.h"
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ggh::Galaxy::Factions::models {
+
+/**
+ * @class HandoverLog
+ * @brief Append-only log of system handovers that answers "who owned what on day D".
+ *
+ * Events are stored in date order as compact records keyed by GalacticDate day numbers.
+ * Every snapshotInterval events the full owner table is copied, so the state on any day is
+ * one snapshot load plus a replay of fewer than snapshotInterval events. Each event also links
+ * to the previous event of the same system, so one system's history or owner on a day only
+ * walks that system's own handovers.
+ */
+class HandoverLog
+{
+public:
+    using DayNumber = GalaxyCore::models::GalacticDate::DayNumber;
+    static constexpr int NO_FACTION = 0;
+    static constexpr std::size_t DEFAULT_SNAPSHOT_INTERVAL = 4096;
+    static constexpr std::uint32_t NO_EVENT = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief One handover; 24 bytes, with notes kept aside since few events have any.
+     */
+    struct Event {
+        DayNumber day;
+        GalaxyCore::utilities::SystemId system;
+        int fromFaction;
+        int toFaction;
+        int handoverTypeId;
+        int id;
+    };
+
+    explicit HandoverLog(std::size_t snapshotInterval = DEFAULT_SNAPSHOT_INTERVAL);
+
+    /**
+     * @brief Appends a handover.
+     * @return False if it is dated before the last logged event; the log is left unchanged.
+     */
+    bool append(const FactionHandover& handover);
+    bool append(const Event& event, const std::string& notes = {});
+
+    void clear();
+
+    std::size_t size() const noexcept { return m_events.size(); }
+    bool empty() const noexcept { return m_events.empty(); }
+    std::size_t snapshotInterval() const noexcept { return m_snapshotInterval; }
+    std::span<const Event> events() const noexcept { return m_events; }
+    const Event& event(std::size_t index) const { return m_events[index]; }
+
+    /**
+     * @brief Rebuilds the full FactionHandover record of a logged event, notes included.
+     */
+    FactionHandover handover(std::size_t index) const;
+
+    /**
+     * @brief Number of events dated on or before a day.
+     */
+    std::size_t countUntil(DayNumber day) const;
+
+    /**
+     * @brief Owner of every system at the end of a day, indexed by system id.
+     * @param day The day number.
+     * @param owners Receives the table; sized to the largest system id logged by then plus one.
+     */
+    void ownersAt(DayNumber day, std::vector<int>& owners) const;
+
+    /**
+     * @brief Owner of one system at the end of a day, or NO_FACTION.
+     */
+    int ownerAt(GalaxyCore::utilities::SystemId system, DayNumber day) const;
+
+    /**
+     * @brief Owners after the last event, indexed by system id.
+     */
+    std::span<const int> currentOwners() const noexcept { return m_owners; }
+
+    /**
+     * @brief Indices of one system's events, oldest first.
+     */
+    std::vector<std::size_t> historyOf(GalaxyCore::utilities::SystemId system) const;
+
+    /**
+     * @brief Events replayed by the last ownersAt() call, for diagnostics.
+     */
+    std::size_t lastReplayCount() const noexcept { return m_lastReplayCount; }
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    std::size_t m_snapshotInterval;
+    std::vector<Event> m_events;                                ///< Sorted by day
+    std::vector<std::uint32_t> m_previousOfSystem;              ///< Per event: previous event of its system
+    std::vector<std::uint32_t> m_lastOfSystem;                  ///< Per system id: its latest event
+    std::unordered_map<std::uint32_t, std::string> m_notes;     ///< Event index to non-empty notes
+    std::vector<int> m_owners;                                  ///< Owners after the last event
+    std::vector<std::vector<int>> m_snapshots;                  ///< Snapshot k: owners after (k + 1) * interval events
+    mutable std::size_t m_lastReplayCount{0};
+};
+
+} // namespace ggh::Galaxy::Factions::models
+
+#endif // !GGH_MODULES_GALAXYFACTIONS_HANDOVER_LOG_H
@@ -0,0 +1,102 @@
+#ifndef GGH_MODULES_GALAXYFACTIONS_RESOURCE_TYPE_REGISTRY_H
+#define GGH_MODULES_GALAXYFACTIONS_RESOURCE_TYPE_REGISTRY_H
+
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyFactions/models/ResourceType.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace ggh::Galaxy::Factions::models {
+
+/**
+ * @class ResourceTypeRegistry
+ * @brief Interns resource types and hands out compact handles for them.
+ *
+ * Each distinct (id, name, description) triple is stored once and gets the next 16-bit
+ * handle, so bonuses and faction totals can hold a handle instead of two strings and index
+ * flat arrays with it. Handles are dense and never reused, and the type behind a handle never
+ * changes.
+ *
+ * Bonuses are created without any owning context, so they intern into one process-wide
+ * registry (global()). Interning and lookups by type or id take a lock. Types live in
+ * fixed-size chunks that never move and the count of published handles is atomic, so
+ * type() and typeId() index them directly without locking.
+ */
+class ResourceTypeRegistry
+{
+public:
+    using Handle = std::uint16_t;
+    static constexpr Handle INVALID_HANDLE = std::numeric_limits<Handle>::max();
+
+    ResourceTypeRegistry();
+
+    ResourceTypeRegistry(const ResourceTypeRegistry&) = delete;
+    ResourceTypeRegistry& operator=(const ResourceTypeRegistry&) = delete;
+
+    /**
+     * @brief The registry bonuses and faction totals use.
+     */
+    static ResourceTypeRegistry& global();
+
+    /**
+     * @brief Returns the handle of a type, registering it on first use.
+     * @throws std::length_error if every handle is taken.
+     */
+    Handle intern(const ResourceType& type);
+
+    /**
+     * @brief Handle of an already registered type, or INVALID_HANDLE.
+     */
+    Handle find(const ResourceType& type) const;
+
+    /**
+     * @brief Handles of every registered type with a ResourceType id; usually just one.
+     *
+     * Types sharing an id but not a name are different types with separate handles.
+     */
+    std::vector<Handle> handlesOf(int typeId) const;
+
+    /**
+     * @brief The type behind a handle; the reference stays valid for the registry's lifetime.
+     * @throws std::out_of_range for a handle that was never handed out.
+     */
+    const ResourceType& type(Handle handle) const;
+
+    /**
+     * @brief ResourceType::id() of the type behind a handle, without touching its strings.
+     * @throws std::out_of_range for a handle that was never handed out.
+     */
+    int typeId(Handle handle) const;
+
+    std::size_t size() const noexcept { return m_size.load(std::memory_order_acquire); }
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    static constexpr std::size_t CHUNK_SIZE = 256;
+    static constexpr std::size_t CHUNK_COUNT = (std::size_t{INVALID_HANDLE} + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    struct Chunk {
+        std::array<ResourceType, CHUNK_SIZE> types;
+        std::array<int, CHUNK_SIZE> typeIds{}; ///< ResourceType ids, so typeId() skips the strings
+    };
+
+    // Entries below m_size are written before m_size is published and never change afterwards
+    const Chunk& chunkOf(Handle handle) const;
+
+    mutable std::shared_mutex m_mutex;                 ///< Guards m_handles, m_handlesById and appends
+    std::array<std::unique_ptr<Chunk>, CHUNK_COUNT> m_chunks; ///< Indexed by handle / CHUNK_SIZE
+    std::atomic<std::size_t> m_size{0};
+    std::unordered_map<ResourceType, Handle> m_handles;
+    std::unordered_map<int, std::vector<Handle>> m_handlesById;
+};
+
+} // namespace ggh::Galaxy::Factions::models
+
+#endif // !GGH_MODULES_GALAXYFACTIONS_RESOURCE_TYPE_REGISTRY_H
@@ -2,6 +2,7 @@
 #define GGH_MODULES_GALAXYFACTIONS_SYSTEM_H
 
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
 #include "ggh/modules/GalaxyFactions/models/ResourceType.h"
 #include "ggh/modules/GalaxyFactions/models/SystemResourceBonus.h"
 #include "ggh/modules/GalaxyFactions/models/SystemNotes.h"
@@ -12,6 +13,15 @@
 
 namespace ggh::Galaxy::Factions::models {
 
+class Faction;
+
+/**
+ * @class System
+ * @brief Faction-side data of a star system: resource bonuses, notes and handovers
+ *
+ * Bonus edits are reported to the faction tracking the system, which keeps its resource
+ * totals current without walking its systems.
+ */
 class System
 {
 public:
@@ -35,6 +45,7 @@ public:
     void removeResourceBonus(const ResourceType& resourceType);
     void addNote(const SystemNotes& note);
     void removeNote(int noteId);
+    void addHandover(const FactionHandover& handover);
 
     // Business methods
     std::vector<SystemResourceBonus> getResourceBonuses() const;
@@ -42,7 +53,13 @@ public:
     int getResourceBonusByType(int resourceTypeId) const;
     std::vector<FactionHandover> getHandoverHistory() const;
 
+    // Diagnostics
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
 private:
+    friend class Faction;
+
+    Faction* m_faction{nullptr};   ///< Faction whose resource totals include this system
     std::shared_ptr<GalaxyCore::models::StarSystemModel> m_starSystemModel;
     std::vector<SystemResourceBonus> m_resourceBonuses;
     std::vector<SystemNotes> m_notes;
@@ -2,20 +2,31 @@
 #define GGH_MODULES_GALAXYFACTIONS_SYSTEM_RESOURCE_BONUS_H
 
 #include "ggh/modules/GalaxyFactions/models/ResourceType.h"
+#include "ggh/modules/GalaxyFactions/models/ResourceTypeRegistry.h"
 #include <string>
 #include <stdexcept>
 
 namespace ggh::Galaxy::Factions::models {
 
+/**
+ * @class SystemResourceBonus
+ * @brief A bonus amount for one resource type
+ *
+ * The type is held as a ResourceTypeRegistry handle, which keeps the record at 8 bytes.
+ */
 class SystemResourceBonus
 {
 public:
+    using Handle = ResourceTypeRegistry::Handle;
+
     SystemResourceBonus();
     SystemResourceBonus(const ResourceType& resourceType, int bonusAmount);
+    SystemResourceBonus(Handle resourceType, int bonusAmount);
 
     // Getters
     int id() const;
-    ResourceType resourceType() const { return m_resourceType; }
+    const ResourceType& resourceType() const { return ResourceTypeRegistry::global().type(m_resourceType); }
+    Handle resourceTypeHandle() const noexcept { return m_resourceType; }
     int bonusAmount() const { return m_bonusAmount; }
 
     // Setters
@@ -30,6 +41,7 @@ public:
         return "SystemResourceBonus";
     }
     friend bool operator==(const SystemResourceBonus& lhs, const SystemResourceBonus& rhs) {
+        // Equal types intern to the same handle
         return lhs.m_resourceType == rhs.m_resourceType && lhs.m_bonusAmount == rhs.m_bonusAmount;
     }
 
@@ -52,7 +64,7 @@ public:
     }
 
     SystemResourceBonus& operator+=(const SystemResourceBonus& other) {
-        if (m_resourceType.id() != other.m_resourceType.id()) {
+        if (id() != other.id()) {
             throw std::invalid_argument("Cannot add bonuses of different resource types");
         }
         if (m_resourceType == other.m_resourceType) {
@@ -62,7 +74,7 @@ public:
     }
 
     SystemResourceBonus& operator-=(const SystemResourceBonus& other) {
-        if (m_resourceType.id() != other.m_resourceType.id()) {
+        if (id() != other.id()) {
             throw std::invalid_argument("Cannot subtract bonuses of different resource types");
         }
         if (m_resourceType == other.m_resourceType) {
@@ -75,14 +87,14 @@ public:
     }
 
     SystemResourceBonus operator+(const SystemResourceBonus& other) const {
-        if (m_resourceType.id() != other.m_resourceType.id()) {
+        if (id() != other.id()) {
             throw std::invalid_argument("Cannot add bonuses of different resource types");
         }
         return SystemResourceBonus(m_resourceType, m_bonusAmount + other.m_bonusAmount);
     }
 
     SystemResourceBonus operator-(const SystemResourceBonus& other) const {
-        if (m_resourceType.id() != other.m_resourceType.id()) {
+        if (id() != other.id()) {
             throw std::invalid_argument("Cannot subtract bonuses of different resource types");
         }
         int newBonusAmount = m_bonusAmount - other.m_bonusAmount;
@@ -94,7 +106,7 @@ public:
 
 
 private:
-    ResourceType m_resourceType;
+    Handle m_resourceType;
     int m_bonusAmount;
 };
 
@@ -0,0 +1,123 @@
+#ifndef GGH_MODULES_GALAXYFACTIONS_TERRITORY_ENGINE_H
+#define GGH_MODULES_GALAXYFACTIONS_TERRITORY_ENGINE_H
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace ggh::Galaxy::Factions::models {
+
+class GalaxyFactions;
+
+/**
+ * @class TerritoryEngine
+ * @brief Assigns every star system to the faction whose held systems are closest along lanes.
+ *
+ * Systems a faction holds are the sources of one multi-source Dijkstra over the lane graph.
+ * Labels are compared as (distance, faction id), so equal distances go to the lower faction id.
+ * A faction's influence stops at its reach limit and only spreads onward from systems it holds
+ * or claims, so another faction's territory blocks it.
+ *
+ * The engine keeps the shortest-path forest. When one system changes holder, only the subtree
+ * that hung from it is cleared and re-settled, together with any systems the new holder wins,
+ * instead of redoing the whole galaxy.
+ */
+class TerritoryEngine
+{
+public:
+    using NodeIndex = GalaxyCore::models::LaneGraph::NodeIndex;
+    static constexpr int NO_FACTION = 0;
+    static constexpr double UNLIMITED_REACH = std::numeric_limits<double>::infinity();
+
+    /**
+     * @brief Binds the engine to a graph and forgets all holders and results.
+     * @param graph The lane graph; must outlive the engine.
+     */
+    void bind(const GalaxyCore::models::LaneGraph& graph);
+
+    /**
+     * @brief Replaces all holders with the systems each faction lists, then recomputes.
+     */
+    void assign(const GalaxyFactions& factions);
+
+    /**
+     * @brief Sets or clears (NO_FACTION) the holder of one system and updates the territory.
+     *
+     * Repairs the affected region only, unless the graph changed since the last computation.
+     * @return False if the system is not in the graph.
+     */
+    bool setHolder(GalaxyCore::utilities::SystemId system, int factionId);
+
+    /**
+     * @brief Limits how far along lanes a faction's influence reaches; recomputes if needed.
+     */
+    void setReach(int factionId, double reach);
+    double reach(int factionId) const noexcept;
+
+    /**
+     * @brief Recomputes the whole territory from scratch.
+     */
+    void compute();
+
+    bool isValidFor(const GalaxyCore::models::LaneGraph& graph) const noexcept;
+
+    int holderOf(GalaxyCore::utilities::SystemId system) const;
+    int ownerOf(GalaxyCore::utilities::SystemId system) const;
+
+    /**
+     * @brief Lane distance from a system to the nearest system its owner holds; infinite if unowned.
+     */
+    double distanceOf(GalaxyCore::utilities::SystemId system) const;
+
+    /**
+     * @brief Owner of every graph node, NO_FACTION where no faction reaches; indexed like the graph.
+     */
+    std::span<const int> owners() const noexcept { return m_owner; }
+
+    /**
+     * @brief Number of systems relabelled by the last compute or update.
+     */
+    std::size_t lastUpdateSize() const noexcept { return m_lastUpdateSize; }
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    struct Candidate {
+        double distance;
+        int faction;
+        NodeIndex node;
+        NodeIndex parent;          ///< Node the offer came from; equal to node for a held system
+        double parentDistance;     ///< Parent's distance when offered, to detect stale offers
+    };
+
+    bool isCurrent() const noexcept;
+    void resetNodes();
+    void offer(NodeIndex from, NodeIndex to, double length);
+    void clearSubtree(NodeIndex root);
+    void reseedCleared();
+    void run();
+
+    const GalaxyCore::models::LaneGraph* m_graph{nullptr};
+    std::uint64_t m_revision{0};
+    bool m_computed{false};
+    std::unordered_map<GalaxyCore::utilities::SystemId, int> m_holders;
+    std::vector<double> m_reach;              ///< Indexed by faction id; missing entries are unlimited
+
+    std::vector<int> m_held;                  ///< Holder per node, NO_FACTION if none
+    std::vector<int> m_owner;                 ///< Winning faction per node
+    std::vector<double> m_distance;           ///< Distance of the winning label
+    std::vector<NodeIndex> m_parent;          ///< Shortest-path forest; INVALID_NODE when unlabelled
+
+    std::vector<Candidate> m_heap;
+    std::vector<NodeIndex> m_cleared;
+    std::size_t m_lastUpdateSize{0};
+};
+
+} // namespace ggh::Galaxy::Factions::models
+
+#endif // !GGH_MODULES_GALAXYFACTIONS_TERRITORY_ENGINE_H
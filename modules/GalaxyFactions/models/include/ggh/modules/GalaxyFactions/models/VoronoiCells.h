@@ -0,0 +1,94 @@
+#ifndef GGH_MODULES_GALAXYFACTIONS_VORONOI_CELLS_H
+#define GGH_MODULES_GALAXYFACTIONS_VORONOI_CELLS_H
+
+#include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyCore/utilities/SpatialGrid.h"
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace ggh::Galaxy::Factions::models {
+
+/**
+ * @brief One Voronoi cell: a convex polygon plus, for each edge, the site on its other side.
+ *
+ * Edge i runs from vertices[i] to vertices[(i + 1) % size]. Every cell winds the same way as
+ * the bounds rectangle (min, min), (max, min), (max, max), (min, max).
+ */
+struct VoronoiCell {
+    std::vector<GalaxyCore::utilities::CartesianCoordinates<double>> vertices;
+    std::vector<std::uint32_t> edgeSites;   ///< Neighbouring site per edge, or VoronoiCells::BOUNDARY
+};
+
+/**
+ * @class VoronoiCells
+ * @brief Voronoi diagram of star system positions, clipped to the galaxy bounds, cached per cell.
+ *
+ * Each cell is computed on its own: the bounds rectangle is clipped by the bisector with each
+ * neighbouring site, nearest first, until the next site is more than twice as far away as the
+ * farthest cell vertex and so cannot cut the cell any more. A spatial grid supplies the
+ * neighbours, so a cell costs O(k) for its k nearby sites and the whole diagram O(N) expected.
+ *
+ * Because cells are independent, moving a site only recomputes that cell and the cells it
+ * borders before and after the move.
+ */
+class VoronoiCells
+{
+public:
+    using Index = std::uint32_t;
+    static constexpr Index BOUNDARY = std::numeric_limits<Index>::max();
+
+    void setBounds(double minX, double minY, double maxX, double maxY);
+
+    /**
+     * @brief Replaces all sites; every cell is recomputed on the next update().
+     */
+    void setSites(std::span<const GalaxyCore::utilities::CartesianCoordinates<double>> sites);
+
+    /**
+     * @brief Moves one site; it and its neighbours are recomputed on the next update().
+     */
+    void moveSite(Index site, const GalaxyCore::utilities::CartesianCoordinates<double>& position);
+
+    /**
+     * @brief Recomputes every invalidated cell.
+     * @return The cells that were recomputed, sorted.
+     */
+    const std::vector<Index>& update();
+
+    bool isDirty() const noexcept { return m_allDirty || !m_moved.empty(); }
+    std::size_t size() const noexcept { return m_sites.size(); }
+    const GalaxyCore::utilities::CartesianCoordinates<double>& site(Index index) const { return m_sites[index]; }
+    const VoronoiCell& cell(Index index) const { return m_cells[index]; }
+
+    /**
+     * @brief Sites sharing an edge with a cell, in edge order.
+     */
+    std::vector<Index> neighbours(Index index) const;
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    void computeCell(Index index);
+
+    std::vector<GalaxyCore::utilities::CartesianCoordinates<double>> m_sites;
+    std::vector<VoronoiCell> m_cells;
+    GalaxyCore::utilities::SpatialGrid m_grid;
+    double m_minX{0.0};
+    double m_minY{0.0};
+    double m_maxX{0.0};
+    double m_maxY{0.0};
+    bool m_allDirty{false};
+    std::vector<Index> m_moved;
+    std::vector<Index> m_updated;
+
+    // Scratch reused across cells
+    std::vector<std::pair<double, Index>> m_candidates;
+    VoronoiCell m_scratch;
+};
+
+} // namespace ggh::Galaxy::Factions::models
+
+#endif // !GGH_MODULES_GALAXYFACTIONS_VORONOI_CELLS_H
@@ -0,0 +1,303 @@
+/**
+ * @file ExpansionSimulator.cpp
+ * @brief Implementation of the ExpansionSimulator class for GalaxyFactions module
+ */
+
+#include "ggh/modules/GalaxyFactions/models/ExpansionSimulator.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <unordered_map>
+
+namespace ggh::Galaxy::Factions::models {
+
+using GalaxyCore::models::LaneGraph;
+
+/**
+ * @brief Takes the starting state from a galaxy and its factions
+ * @param galaxy The galaxy whose lane graph and planets are simulated over
+ * @param factions The factions; their held systems are the starting territory
+ *
+ * Every system's resources start at the total mass of its planets, what a faction could mine
+ * there; held systems add their resource bonuses on top.
+ */
+void ExpansionSimulator::bind(const GalaxyCore::models::GalaxyModel& galaxy, const GalaxyFactions& factions)
+{
+    GGH_TRACE_SCOPE("ExpansionSimulator::bind");
+    m_graph = &galaxy.laneGraph();
+    const std::size_t nodeCount = m_graph->nodeCount();
+
+    m_planets.assign(nodeCount, 0.0);
+    m_resources.assign(nodeCount, 0.0);
+    for (NodeIndex node = 0; node < nodeCount; ++node) {
+        if (const auto system = galaxy.getStarSystem(m_graph->systemId(node))) {
+            m_planets[node] = static_cast<double>(system->planetCount());
+            for (const auto& planet : system->getPlanets()) {
+                m_resources[node] += planet->mass();
+            }
+        }
+    }
+
+    m_current = 0;
+    auto& owners = m_owners[0];
+    owners.assign(nodeCount, NO_FACTION);
+    m_factions.clear();
+    for (const auto& faction : factions.factions()) {
+        m_factions.push_back({faction->id(), {}, {}});
+        for (const auto& system : faction->systems()) {
+            const auto node = m_graph->indexOf(static_cast<GalaxyCore::utilities::SystemId>(system->id()));
+            if (node == LaneGraph::INVALID_NODE) {
+                continue;
+            }
+            owners[node] = faction->id();
+            for (const auto& bonus : system->getResourceBonuses()) {
+                m_resources[node] += bonus.bonusAmount();
+            }
+        }
+    }
+    std::sort(m_factions.begin(), m_factions.end(),
+              [](const FactionState& a, const FactionState& b) { return a.id < b.id; });
+
+    std::unordered_map<int, std::size_t> slots;
+    for (std::size_t slot = 0; slot < m_factions.size(); ++slot) {
+        slots.emplace(m_factions[slot].id, slot);
+    }
+    for (NodeIndex node = 0; node < nodeCount; ++node) {
+        if (owners[node] != NO_FACTION) {
+            extendFrontier(m_factions[slots.at(owners[node])], node);
+        }
+    }
+
+    m_owners[1] = owners;
+    m_lastClaims.clear();
+    m_turn = 0;
+    m_nextHandoverId = static_cast<int>(factions.handovers().size()) + 1;
+}
+
+/**
+ * @brief Overrides the resource value of one system
+ * @param system The star system id
+ * @param resources The value scored with resourceWeight
+ * @return False if the system is not in the graph
+ */
+bool ExpansionSimulator::setResources(GalaxyCore::utilities::SystemId system, double resources)
+{
+    const auto node = m_graph ? m_graph->indexOf(system) : LaneGraph::INVALID_NODE;
+    if (node == LaneGraph::INVALID_NODE) {
+        return false;
+    }
+    m_resources[node] = resources;
+    return true;
+}
+
+/**
+ * @brief Runs one turn: parallel scoring, serial conflict resolution, then a buffer swap
+ * @param handovers Receives the turn's claims, ordered by system id
+ * @param threadCount Worker threads, 0 for hardware concurrency
+ * @return Number of systems claimed
+ */
+std::size_t ExpansionSimulator::step(std::vector<FactionHandover>& handovers, unsigned threadCount)
+{
+    if (!m_graph || m_factions.empty()) {
+        return 0;
+    }
+
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, m_factions.size()));
+    std::size_t frontierSize = 0;
+    for (const auto& faction : m_factions) {
+        frontierSize += faction.frontier.size();
+    }
+    if (frontierSize < m_parallelThreshold) {
+        threadCount = 1;
+    }
+
+    // Factions only read the current buffer and write their own proposals
+    std::atomic<std::size_t> nextFaction{0};
+    auto worker = [&]() {
+        for (auto slot = nextFaction++; slot < m_factions.size(); slot = nextFaction++) {
+            score(m_factions[slot]);
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Settle contested systems in a fixed order: best score, then lowest faction id
+    std::vector<Claim> claims;
+    for (const auto& faction : m_factions) {
+        claims.insert(claims.end(), faction.proposals.begin(), faction.proposals.end());
+    }
+    std::sort(claims.begin(), claims.end(), [this](const Claim& a, const Claim& b) {
+        const auto systemA = m_graph->systemId(a.node);
+        const auto systemB = m_graph->systemId(b.node);
+        if (systemA != systemB) {
+            return systemA < systemB;
+        }
+        return a.score != b.score ? a.score > b.score : a.faction < b.faction;
+    });
+    claims.erase(std::unique(claims.begin(), claims.end(),
+                             [](const Claim& a, const Claim& b) { return a.node == b.node; }),
+                 claims.end());
+
+    // Bring the back buffer up to date with last turn, apply this turn, then swap
+    auto& next = m_owners[1 - m_current];
+    for (const auto& claim : m_lastClaims) {
+        next[claim.node] = claim.faction;
+    }
+    for (const auto& claim : claims) {
+        next[claim.node] = claim.faction;
+    }
+    m_current = 1 - m_current;
+    ++m_turn;
+
+    const auto date = currentDate();
+    for (const auto& claim : claims) {
+        const auto slot = std::lower_bound(m_factions.begin(), m_factions.end(), claim.faction,
+            [](const FactionState& state, int id) { return state.id < id; });
+        extendFrontier(*slot, claim.node);
+        handovers.emplace_back(m_nextHandoverId++, claim.faction, static_cast<int>(m_graph->systemId(claim.node)),
+                               NO_FACTION, m_rules.handoverTypeId, date, std::string{});
+    }
+    m_lastClaims = std::move(claims);
+    return m_lastClaims.size();
+}
+
+/**
+ * @brief Runs turns until the limit or until nothing can be claimed
+ * @param turns Maximum number of turns
+ * @param handovers Receives every claim in turn order
+ * @param threadCount Worker threads, 0 for hardware concurrency
+ * @return Number of turns that claimed at least one system
+ */
+std::size_t ExpansionSimulator::run(std::size_t turns, std::vector<FactionHandover>& handovers, unsigned threadCount)
+{
+    GGH_TRACE_SCOPE("ExpansionSimulator::run");
+    std::size_t played = 0;
+    for (; played < turns; ++played) {
+        if (step(handovers, threadCount) == 0) {
+            break;
+        }
+    }
+    return played;
+}
+
+/**
+ * @brief Gets the date of the last simulated turn
+ * @return The start date advanced by daysPerTurn for every turn run
+ */
+GalaxyCore::models::GalacticDate ExpansionSimulator::currentDate() const
+{
+    return GalaxyCore::models::GalacticDate::fromDayNumber(
+        m_startDay + static_cast<GalaxyCore::models::GalacticDate::DayNumber>(m_turn) * m_rules.daysPerTurn);
+}
+
+/**
+ * @brief Gets the simulated owner of a system
+ * @param system The star system id
+ * @return The owning faction, or NO_FACTION
+ */
+int ExpansionSimulator::ownerOf(GalaxyCore::utilities::SystemId system) const
+{
+    const auto node = m_graph ? m_graph->indexOf(system) : LaneGraph::INVALID_NODE;
+    return node != LaneGraph::INVALID_NODE ? m_owners[m_current][node] : NO_FACTION;
+}
+
+/**
+ * @brief Applies simulated claims to the factions
+ * @param handovers Claims produced by step() or run()
+ * @param factions The factions to update
+ * @param galaxy The galaxy holding the claimed star systems, for their new System records
+ */
+void ExpansionSimulator::commit(std::span<const FactionHandover> handovers, GalaxyFactions& factions,
+                                const GalaxyCore::models::GalaxyModel& galaxy)
+{
+    for (const auto& handover : handovers) {
+        factions.recordHandover(handover,
+                                galaxy.getStarSystem(static_cast<GalaxyCore::utilities::SystemId>(handover.systemId())));
+    }
+}
+
+/**
+ * @brief Scores a faction's frontier against the current buffer and keeps its best claims
+ * @param faction The faction; only its own frontier and proposals are written
+ */
+void ExpansionSimulator::score(FactionState& faction) const
+{
+    const auto& owners = m_owners[m_current];
+    auto& frontier = faction.frontier;
+    std::erase_if(frontier, [&owners](NodeIndex node) { return owners[node] != NO_FACTION; });
+    std::sort(frontier.begin(), frontier.end());
+    frontier.erase(std::unique(frontier.begin(), frontier.end()), frontier.end());
+
+    faction.proposals.clear();
+    for (const auto node : frontier) {
+        const auto neighbours = m_graph->neighbours(node);
+        double shortest = std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < neighbours.size(); ++i) {
+            if (owners[neighbours.nodes[i]] == faction.id) {
+                shortest = std::min(shortest, neighbours.lengths[i]);
+            }
+        }
+        if (shortest == std::numeric_limits<double>::infinity()) {
+            continue;
+        }
+        const double value = m_rules.planetWeight * m_planets[node] + m_rules.resourceWeight * m_resources[node]
+                           - m_rules.distanceWeight * shortest;
+        if (value >= m_rules.minimumScore) {
+            faction.proposals.push_back({value, node, faction.id});
+        }
+    }
+
+    const auto keep = std::min(m_rules.claimsPerTurn, faction.proposals.size());
+    std::partial_sort(faction.proposals.begin(), faction.proposals.begin() + static_cast<std::ptrdiff_t>(keep),
+                      faction.proposals.end(), [this](const Claim& a, const Claim& b) {
+                          return a.score != b.score ? a.score > b.score
+                                                    : m_graph->systemId(a.node) < m_graph->systemId(b.node);
+                      });
+    faction.proposals.resize(keep);
+}
+
+/**
+ * @brief Adds the unowned neighbours of a newly held node to a faction's frontier
+ */
+void ExpansionSimulator::extendFrontier(FactionState& faction, NodeIndex node) const
+{
+    const auto& owners = m_owners[m_current];
+    for (const auto neighbour : m_graph->neighbours(node).nodes) {
+        if (owners[neighbour] == NO_FACTION) {
+            faction.frontier.push_back(neighbour);
+        }
+    }
+}
+
+/**
+ * @brief Adds the bytes owned by the simulator to a memory report
+ * @param report The report to accumulate into
+ */
+void ExpansionSimulator::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+
+    std::size_t bytes = sizeof(ExpansionSimulator) + heapBytes(m_planets) + heapBytes(m_resources)
+                      + heapBytes(m_owners[0]) + heapBytes(m_owners[1]) + heapBytes(m_lastClaims)
+                      + heapBytes(m_factions);
+    for (const auto& faction : m_factions) {
+        bytes += heapBytes(faction.frontier) + heapBytes(faction.proposals);
+    }
+    report.add("factions.expansion", bytes, m_factions.size());
+}
+
+} // namespace ggh::Galaxy::Factions::models
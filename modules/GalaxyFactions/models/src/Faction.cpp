@@ -4,6 +4,7 @@
  */
 
 #include "ggh/modules/GalaxyFactions/models/Faction.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
 #include <algorithm>
 #include <sstream>
 
@@ -24,13 +25,43 @@ Faction::Faction(int id, const std::string& name, const std::string& description
 {
 }
 
+/**
+ * @brief Copies a faction as an unregistered snapshot of its systems and resource totals
+ * @param other The faction to copy
+ */
+Faction::Faction(const Faction& other)
+    : m_id(other.m_id), m_name(other.m_name), m_description(other.m_description), m_color(other.m_color),
+      m_systems(other.m_systems), m_resourceAmounts(other.m_resourceAmounts),
+      m_resourceBonusCounts(other.m_resourceBonusCounts),
+      m_resourceBonusCount(other.m_resourceBonusCount)
+{
+}
+
+/**
+ * @brief Destructor; stops the faction's systems reporting bonus edits to it
+ */
+Faction::~Faction()
+{
+    for (const auto& system : m_systems) {
+        if (system->m_faction == this) {
+            system->m_faction = nullptr;
+        }
+    }
+}
+
 /**
  * @brief Sets the faction ID
- * @param id The new faction ID
+ * @param id The new faction ID; ignored if another faction of the same registry already uses it
  */
 void Faction::setId(int id)
 {
+    if (id == m_id || (m_registry && !m_registry->renumberFaction(*this, id))) {
+        return;
+    }
     m_id = id;
+    if (m_registry) {
+        m_registry->notifyModified(*this, FactionChange::IdField);
+    }
 }
 
 /**
@@ -40,6 +71,9 @@ void Faction::setId(int id)
 void Faction::setName(const std::string& name)
 {
     m_name = name;
+    if (m_registry) {
+        m_registry->notifyModified(*this, FactionChange::DetailsField);
+    }
 }
 
 /**
@@ -49,6 +83,9 @@ void Faction::setName(const std::string& name)
 void Faction::setDescription(const std::string& description)
 {
     m_description = description;
+    if (m_registry) {
+        m_registry->notifyModified(*this, FactionChange::DetailsField);
+    }
 }
 
 /**
@@ -58,15 +95,32 @@ void Faction::setDescription(const std::string& description)
 void Faction::setColor(const std::string& color)
 {
     m_color = color;
+    if (m_registry) {
+        m_registry->notifyModified(*this, FactionChange::DetailsField);
+    }
 }
 
 /**
- * @brief Adds a system to the faction
- * @param system Shared pointer to the system to add
+ * @brief Adds a system to the faction, taking it from any other faction of the same registry
+ * @param system Shared pointer to the system to add; ignored if null or already held
  */
 void Faction::addSystem(std::shared_ptr<System> system)
 {
-    m_systems.push_back(system);
+    if (!system) {
+        return;
+    }
+    if (m_registry) {
+        if (!m_registry->claimSystem(*this, static_cast<GalaxyCore::utilities::SystemId>(system->id()))) {
+            return;
+        }
+    } else if (hasSystem(system->id())) {
+        return;
+    }
+    applySystem(*system, 1);
+    m_systems.push_back(std::move(system));
+    if (m_registry) {
+        m_registry->notifyModified(*this, FactionChange::SystemsField);
+    }
 }
 
 /**
@@ -75,10 +129,76 @@ void Faction::addSystem(std::shared_ptr<System> system)
  */
 void Faction::removeSystem(int systemId)
 {
-    m_systems.erase(
-        std::remove_if(m_systems.begin(), m_systems.end(),
-            [systemId](const std::shared_ptr<System>& s) { return s->id() == systemId; }),
-        m_systems.end());
+    if (eraseSystem(systemId) && m_registry) {
+        m_registry->releaseSystem(*this, static_cast<GalaxyCore::utilities::SystemId>(systemId));
+        m_registry->notifyModified(*this, FactionChange::SystemsField);
+    }
+}
+
+/**
+ * @brief Checks whether the faction holds a system
+ * @param systemId The system ID
+ * @return True if the system is in this faction; O(1) for registered factions
+ */
+bool Faction::hasSystem(int systemId) const
+{
+    if (m_registry) {
+        return m_registry->ownerOf(static_cast<GalaxyCore::utilities::SystemId>(systemId)) == m_id;
+    }
+    return std::any_of(m_systems.begin(), m_systems.end(),
+        [systemId](const std::shared_ptr<System>& s) { return s->id() == systemId; });
+}
+
+/**
+ * @brief Drops a system from the system list without notifying the registry
+ * @param systemId The ID of the system to drop
+ * @return True if the system was held
+ */
+bool Faction::eraseSystem(int systemId)
+{
+    // Partition rather than remove_if so the dropped systems are still readable below
+    const auto it = std::stable_partition(m_systems.begin(), m_systems.end(),
+        [systemId](const std::shared_ptr<System>& s) { return s->id() != systemId; });
+    const bool erased = it != m_systems.end();
+    for (auto removed = it; removed != m_systems.end(); ++removed) {
+        applySystem(**removed, -1);
+    }
+    m_systems.erase(it, m_systems.end());
+    return erased;
+}
+
+/**
+ * @brief Adds or subtracts all of a system's bonuses and starts or stops tracking its edits
+ * @param system The system joining (sign 1) or leaving (sign -1) the faction
+ * @param sign 1 to add the system's bonuses, -1 to subtract them
+ */
+void Faction::applySystem(System& system, int sign)
+{
+    for (const auto& bonus : system.m_resourceBonuses) {
+        applyBonus(bonus.resourceTypeHandle(), sign * bonus.bonusAmount(), sign);
+    }
+    if (sign > 0 && !system.m_faction) {
+        system.m_faction = this;
+    } else if (sign < 0 && system.m_faction == this) {
+        system.m_faction = nullptr;
+    }
+}
+
+/**
+ * @brief Updates the running total of one resource type
+ * @param resourceType The bonus resource type handle
+ * @param amount Signed change of the total
+ * @param count Signed change of the number of bonuses of this type
+ */
+void Faction::applyBonus(ResourceTypeRegistry::Handle resourceType, int amount, int count)
+{
+    if (resourceType >= m_resourceAmounts.size()) {
+        m_resourceAmounts.resize(static_cast<std::size_t>(resourceType) + 1, 0);
+        m_resourceBonusCounts.resize(static_cast<std::size_t>(resourceType) + 1, 0);
+    }
+    m_resourceAmounts[resourceType] += amount;
+    m_resourceBonusCounts[resourceType] += count;
+    m_resourceBonusCount += count;
 }
 
 /**
@@ -111,9 +231,9 @@ std::string Faction::getFactionDetails() const
 std::vector<SystemResourceBonus> Faction::getResourceBonuses() const
 {
     std::vector<SystemResourceBonus> allBonuses;
+    allBonuses.reserve(m_resourceBonusCount);
     for (const auto& system : m_systems) {
-        auto systemBonuses = system->resourceBonuses();
-        allBonuses.insert(allBonuses.end(), systemBonuses.begin(), systemBonuses.end());
+        allBonuses.insert(allBonuses.end(), system->m_resourceBonuses.begin(), system->m_resourceBonuses.end());
     }
     return allBonuses;
 }
@@ -139,22 +259,27 @@ std::vector<SystemNotes> Faction::getNotes() const
  */
 int Faction::getResourceBonusesByType(int resourceTypeId) const
 {
+    // Types sharing an id but not a name have separate handles
     int totalBonus = 0;
-    for (const auto& system : m_systems) {
-        totalBonus += system->getResourceBonusByType(resourceTypeId);
+    for (const auto handle : ResourceTypeRegistry::global().handlesOf(resourceTypeId)) {
+        totalBonus += resourceTotal(handle);
     }
     return totalBonus;
 }
 
 /**
  * @brief Gets resource stock across all faction systems
- * @return Map of resource type to quantity
+ * @return Map of resource type to the summed bonuses of that type
  */
 std::unordered_map<ResourceType, int> Faction::getResourcesStock() const
 {
+    const auto& registry = ResourceTypeRegistry::global();
     std::unordered_map<ResourceType, int> stock;
-    // Implementation would need to aggregate resources from all systems
-    // This is a placeholder implementation
+    for (std::size_t handle = 0; handle < m_resourceAmounts.size(); ++handle) {
+        if (m_resourceBonusCounts[handle] != 0) {
+            stock.emplace(registry.type(static_cast<ResourceTypeRegistry::Handle>(handle)), m_resourceAmounts[handle]);
+        }
+    }
     return stock;
 }
 
@@ -178,4 +303,22 @@ std::string Faction::toXml() const
     return xml.str();
 }
 
+/**
+ * @brief Adds the bytes owned by this faction and its systems to a memory report
+ * @param report The report to accumulate into
+ */
+void Faction::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+
+    std::size_t bytes = sizeof(Faction) + heapBytes(m_name) + heapBytes(m_description) + heapBytes(m_color)
+                      + heapBytes(m_systems) + m_systems.size() * SHARED_CONTROL_BLOCK_BYTES
+                      + heapBytes(m_resourceAmounts) + heapBytes(m_resourceBonusCounts);
+    report.add("factions", bytes, 1);
+
+    for (const auto& system : m_systems) {
+        system->reportMemory(report);
+    }
+}
+
 } // namespace GalaxyFactions
@@ -0,0 +1,140 @@
+/**
+ * @file FactionBorderCache.cpp
+ * @brief Implementation of the FactionBorderCache class for GalaxyFactions module
+ */
+
+#include "ggh/modules/GalaxyFactions/models/FactionBorderCache.h"
+#include <algorithm>
+
+namespace ggh::Galaxy::Factions::models {
+
+/**
+ * @brief Sets the galaxy bounds the cells are clipped to
+ */
+void FactionBorderCache::setBounds(double minX, double minY, double maxX, double maxY)
+{
+    m_cells.setBounds(minX, minY, maxX, maxY);
+    m_allBordersDirty = true;
+}
+
+/**
+ * @brief Replaces all systems and clears ownership
+ * @param sites System positions
+ */
+void FactionBorderCache::setSites(std::span<const GalaxyCore::utilities::CartesianCoordinates<double>> sites)
+{
+    m_cells.setSites(sites);
+    m_owners.assign(sites.size(), NO_FACTION);
+    m_borders.assign(sites.size(), {});
+    m_ownerChanges.clear();
+    m_allBordersDirty = true;
+}
+
+/**
+ * @brief Moves one system
+ */
+void FactionBorderCache::moveSite(Index site, const GalaxyCore::utilities::CartesianCoordinates<double>& position)
+{
+    m_cells.moveSite(site, position);
+}
+
+/**
+ * @brief Sets the owner of every system
+ * @param owners One faction id per site; extra or missing entries are ignored
+ */
+void FactionBorderCache::setOwners(std::span<const int> owners)
+{
+    const std::size_t count = std::min(owners.size(), m_owners.size());
+    for (Index site = 0; site < count; ++site) {
+        setOwner(site, owners[site]);
+    }
+}
+
+/**
+ * @brief Sets the owner of one system
+ */
+void FactionBorderCache::setOwner(Index site, int factionId)
+{
+    if (site < m_owners.size() && m_owners[site] != factionId) {
+        m_owners[site] = factionId;
+        m_ownerChanges.push_back(site);
+    }
+}
+
+/**
+ * @brief Recomputes invalidated cells, then the borders around them and around ownership changes
+ * @return True if any geometry or border changed
+ */
+bool FactionBorderCache::update()
+{
+    m_lastBorderUpdateCount = 0;
+    const auto& recomputed = m_cells.update();
+    if (m_allBordersDirty) {
+        for (Index site = 0; site < m_owners.size(); ++site) {
+            rebuildBorders(site);
+        }
+        m_allBordersDirty = false;
+        m_ownerChanges.clear();
+        m_lastBorderUpdateCount = m_owners.size();
+        ++m_revision;
+        return true;
+    }
+    if (recomputed.empty() && m_ownerChanges.empty()) {
+        return false;
+    }
+
+    // A cell's borders depend on its own geometry and owner and on its neighbours' owners
+    std::vector<Index> dirty(recomputed.begin(), recomputed.end());
+    for (const auto site : m_ownerChanges) {
+        dirty.push_back(site);
+        const auto neighbours = m_cells.neighbours(site);
+        dirty.insert(dirty.end(), neighbours.begin(), neighbours.end());
+    }
+    m_ownerChanges.clear();
+    std::sort(dirty.begin(), dirty.end());
+    dirty.erase(std::unique(dirty.begin(), dirty.end()), dirty.end());
+    for (const auto site : dirty) {
+        rebuildBorders(site);
+    }
+    m_lastBorderUpdateCount = dirty.size();
+    ++m_revision;
+    return true;
+}
+
+/**
+ * @brief Adds the cached geometry to a memory report
+ * @param report The report to accumulate into
+ */
+void FactionBorderCache::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+    m_cells.reportMemory(report);
+    std::size_t bytes = heapBytes(m_owners) + heapBytes(m_borders) + heapBytes(m_ownerChanges);
+    for (const auto& borders : m_borders) {
+        bytes += heapBytes(borders);
+    }
+    report.add("factions.borders", bytes);
+}
+
+/**
+ * @brief Collects the edges of one cell that separate its owner from someone else
+ */
+void FactionBorderCache::rebuildBorders(Index site)
+{
+    auto& borders = m_borders[site];
+    borders.clear();
+    const int owner = m_owners[site];
+    if (owner == NO_FACTION) {
+        return;
+    }
+    const auto& cell = m_cells.cell(site);
+    const std::size_t count = cell.vertices.size();
+    for (std::size_t edge = 0; edge < count; ++edge) {
+        const auto other = cell.edgeSites[edge];
+        if (other == VoronoiCells::BOUNDARY || m_owners[other] != owner) {
+            borders.push_back({cell.vertices[edge], cell.vertices[(edge + 1) % count]});
+        }
+    }
+}
+
+} // namespace ggh::Galaxy::Factions::models
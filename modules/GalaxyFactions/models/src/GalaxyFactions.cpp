@@ -4,6 +4,7 @@
  */
 
 #include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+#include "ggh/modules/GalaxyFactions/models/ResourceTypeRegistry.h"
 #include <algorithm>
 #include <fstream>
 #include <sstream>
@@ -19,10 +20,13 @@ GalaxyFactions::GalaxyFactions()
 }
 
 /**
- * @brief Destructor for GalaxyFactions
+ * @brief Destructor for GalaxyFactions; factions still shared elsewhere become unregistered
  */
 GalaxyFactions::~GalaxyFactions()
 {
+    for (const auto& faction : m_factions) {
+        faction->m_registry = nullptr;
+    }
 }
 
 /**
@@ -34,8 +38,15 @@ GalaxyFactions::~GalaxyFactions()
  */
 std::shared_ptr<Faction> GalaxyFactions::createFaction(const std::string& name, const std::string& description, const std::string& color)
 {
+    // A renumbered faction may already hold the next id
+    while (m_factionIndex.contains(m_nextFactionId)) {
+        ++m_nextFactionId;
+    }
     auto faction = std::make_shared<Faction>(m_nextFactionId++, name, description, color);
+    faction->m_registry = this;
     m_factions.push_back(faction);
+    m_factionIndex.emplace(faction->id(), faction);
+    notify({FactionChange::Kind::Created, faction->id(), m_factions.size() - 1});
     return faction;
 }
 
@@ -49,29 +60,45 @@ std::shared_ptr<Faction> GalaxyFactions::createFaction(const std::string& name,
  */
 std::shared_ptr<Faction> GalaxyFactions::modifyFaction(int id, const std::string& name, const std::string& description, const std::string& color)
 {
-    auto it = findFaction(id);
-    if (it != m_factions.end()) {
-        (*it)->setName(name);
-        (*it)->setDescription(description);
-        (*it)->setColor(color);
-        return *it;
+    auto faction = getFaction(id);
+    if (faction) {
+        // Assign directly so listeners hear about the edit once
+        faction->m_name = name;
+        faction->m_description = description;
+        faction->m_color = color;
+        notifyModified(*faction, FactionChange::DetailsField);
     }
-    return nullptr;
+    return faction;
 }
 
 /**
- * @brief Deletes a faction by ID
+ * @brief Deletes a faction by ID, releasing the systems it held
  * @param id The faction ID to delete
  * @return True if faction was deleted, false if not found
+ *
+ * The faction object may outlive the call through other owners; it is left holding no systems,
+ * so none of them keeps reporting bonus edits to it.
  */
 bool GalaxyFactions::deleteFaction(int id)
 {
-    auto it = findFaction(id);
-    if (it != m_factions.end()) {
-        m_factions.erase(it);
-        return true;
+    const auto indexed = m_factionIndex.find(id);
+    if (indexed == m_factionIndex.end()) {
+        return false;
     }
-    return false;
+
+    const auto faction = indexed->second;
+    for (const auto& system : faction->m_systems) {
+        setOwner(static_cast<GalaxyCore::utilities::SystemId>(system->id()), NO_FACTION);
+        faction->applySystem(*system, -1);
+    }
+    faction->m_systems.clear();
+    faction->m_registry = nullptr;
+    m_factionIndex.erase(indexed);
+    const auto position = std::find(m_factions.begin(), m_factions.end(), faction);
+    const auto row = static_cast<std::size_t>(position - m_factions.begin());
+    m_factions.erase(position);
+    notify({FactionChange::Kind::Removed, id, row});
+    return true;
 }
 
 /**
@@ -81,8 +108,8 @@ bool GalaxyFactions::deleteFaction(int id)
  */
 std::shared_ptr<Faction> GalaxyFactions::getFaction(int id) const
 {
-    auto it = findFaction(id);
-    return (it != m_factions.end()) ? *it : nullptr;
+    const auto it = m_factionIndex.find(id);
+    return (it != m_factionIndex.end()) ? it->second : nullptr;
 }
 
 /**
@@ -95,25 +122,203 @@ std::vector<std::shared_ptr<Faction>> GalaxyFactions::getAllFactions() const
 }
 
 /**
- * @brief Helper method to find faction by ID (non-const version)
- * @param id The faction ID to find
- * @return Iterator to the faction, or end() if not found
+ * @brief Gets the faction that holds a system
+ * @param systemId The star system ID
+ * @return The owning faction ID, or NO_FACTION
  */
-std::vector<std::shared_ptr<Faction>>::iterator GalaxyFactions::findFaction(int id)
+int GalaxyFactions::ownerOf(GalaxyCore::utilities::SystemId systemId) const
 {
-    return std::find_if(m_factions.begin(), m_factions.end(),
-        [id](const std::shared_ptr<Faction>& f) { return f->id() == id; });
+    const auto it = m_systemOwners.find(systemId);
+    return (it != m_systemOwners.end()) ? it->second : NO_FACTION;
 }
 
 /**
- * @brief Helper method to find faction by ID (const version)
- * @param id The faction ID to find
- * @return Const iterator to the faction, or end() if not found
+ * @brief Gets the faction that holds a system
+ * @param systemId The star system ID
+ * @return Shared pointer to the owning faction, or nullptr if the system is unowned
  */
-std::vector<std::shared_ptr<Faction>>::const_iterator GalaxyFactions::findFaction(int id) const
+std::shared_ptr<Faction> GalaxyFactions::owningFaction(GalaxyCore::utilities::SystemId systemId) const
 {
-    return std::find_if(m_factions.begin(), m_factions.end(),
-        [id](const std::shared_ptr<Faction>& f) { return f->id() == id; });
+    const int owner = ownerOf(systemId);
+    return (owner != NO_FACTION) ? getFaction(owner) : nullptr;
+}
+
+/**
+ * @brief Logs a handover and applies it to the current holdings
+ * @param handover The dated handover
+ * @param starSystem The star system, used only if no faction holds it yet
+ * @return False if it is dated before the last logged handover
+ *
+ * The handover joins the System's own history. A held system moves from its holder; a system no
+ * faction holds gets a new System record from starSystem, or is only logged without one.
+ */
+bool GalaxyFactions::recordHandover(const FactionHandover& handover,
+                                    const std::shared_ptr<GalaxyCore::models::StarSystemModel>& starSystem)
+{
+    if (!m_handovers.append(handover)) {
+        return false;
+    }
+
+    const auto holder = owningFaction(static_cast<GalaxyCore::utilities::SystemId>(handover.systemId()));
+    if (!holder) {
+        const auto target = getFaction(handover.factionToId());
+        if (target && starSystem) {
+            auto claimed = std::make_shared<System>(starSystem);
+            claimed->addHandover(handover);
+            target->addSystem(std::move(claimed));
+        }
+        return true;
+    }
+    const auto& systems = holder->systems();
+    const auto system = std::find_if(systems.begin(), systems.end(),
+        [&handover](const std::shared_ptr<System>& s) { return s->id() == handover.systemId(); });
+    if (system == systems.end()) {
+        return true;
+    }
+    // Copy the pointer first: claiming or removing the system erases it from the holder's list
+    const auto moved = *system;
+    moved->addHandover(handover);
+
+    if (holder->id() == handover.factionToId()) {
+        return true;
+    }
+    if (handover.factionToId() == NO_FACTION) {
+        holder->removeSystem(handover.systemId());
+        return true;
+    }
+    if (const auto target = getFaction(handover.factionToId())) {
+        target->addSystem(moved);
+    }
+    return true;
+}
+
+/**
+ * @brief Records a faction taking a system, removing it from its previous owner
+ * @param faction The faction adding the system
+ * @param systemId The star system ID
+ * @return False if the faction already holds the system
+ */
+bool GalaxyFactions::claimSystem(Faction& faction, GalaxyCore::utilities::SystemId systemId)
+{
+    const int previous = ownerOf(systemId);
+    if (previous == faction.id()) {
+        return false;
+    }
+    setOwner(systemId, faction.id());
+    if (previous != NO_FACTION) {
+        const auto& holder = m_factionIndex.at(previous);
+        holder->eraseSystem(static_cast<int>(systemId));
+        notifyModified(*holder, FactionChange::SystemsField);
+    }
+    return true;
+}
+
+/**
+ * @brief Records a faction giving up a system
+ * @param faction The faction removing the system
+ * @param systemId The star system ID
+ */
+void GalaxyFactions::releaseSystem(const Faction& faction, GalaxyCore::utilities::SystemId systemId)
+{
+    if (ownerOf(systemId) == faction.id()) {
+        setOwner(systemId, NO_FACTION);
+    }
+}
+
+/**
+ * @brief Moves a faction to a new ID in the faction and ownership indices
+ * @param faction The faction being renumbered
+ * @param newId The requested ID
+ * @return False if another faction already uses the ID
+ */
+bool GalaxyFactions::renumberFaction(Faction& faction, int newId)
+{
+    if (newId == faction.id()) {
+        return true;
+    }
+    if (newId == NO_FACTION || m_factionIndex.contains(newId)) {
+        return false;
+    }
+
+    auto node = m_factionIndex.extract(faction.id());
+    node.key() = newId;
+    m_factionIndex.insert(std::move(node));
+    for (const auto& system : faction.m_systems) {
+        setOwner(static_cast<GalaxyCore::utilities::SystemId>(system->id()), newId);
+    }
+    return true;
+}
+
+/**
+ * @brief Writes one entry of the ownership map and its dense mirror
+ * @param systemId The star system ID
+ * @param factionId The new owner, or NO_FACTION
+ */
+void GalaxyFactions::setOwner(GalaxyCore::utilities::SystemId systemId, int factionId)
+{
+    if (factionId == NO_FACTION) {
+        m_systemOwners.erase(systemId);
+        if (systemId < m_ownerTable.size()) {
+            m_ownerTable[systemId] = NO_FACTION;
+        }
+        return;
+    }
+
+    m_systemOwners[systemId] = factionId;
+    if (systemId >= m_ownerTable.size()) {
+        m_ownerTable.resize(static_cast<std::size_t>(systemId) + 1, NO_FACTION);
+    }
+    m_ownerTable[systemId] = factionId;
+}
+
+/**
+ * @brief Registers a change listener
+ * @param listener Called after every faction creation, edit or removal
+ * @return Token for removeChangeListener()
+ */
+GalaxyFactions::ListenerId GalaxyFactions::addChangeListener(ChangeListener listener)
+{
+    const auto id = m_nextListenerId++;
+    m_listeners.emplace_back(id, std::move(listener));
+    return id;
+}
+
+/**
+ * @brief Unregisters a change listener; unknown tokens are ignored
+ * @param id Token returned by addChangeListener()
+ */
+void GalaxyFactions::removeChangeListener(ListenerId id)
+{
+    std::erase_if(m_listeners, [id](const auto& entry) { return entry.first == id; });
+}
+
+/**
+ * @brief Tells listeners that a registered faction was edited
+ * @param faction The edited faction
+ * @param fields FactionChange::Field bits that changed
+ */
+void GalaxyFactions::notifyModified(const Faction& faction, unsigned fields)
+{
+    if (m_listeners.empty()) {
+        return;
+    }
+    const auto position = std::find_if(m_factions.begin(), m_factions.end(),
+        [&faction](const std::shared_ptr<Faction>& f) { return f.get() == &faction; });
+    notify({FactionChange::Kind::Modified, faction.id(),
+            static_cast<std::size_t>(position - m_factions.begin()), fields});
+}
+
+/**
+ * @brief Calls every listener with a change
+ * @param change The change that was just made
+ */
+void GalaxyFactions::notify(const FactionChange& change)
+{
+    // Index loop over a copied callback: a listener may unregister itself or others while called
+    for (std::size_t i = 0; i < m_listeners.size(); ++i) {
+        const auto listener = m_listeners[i].second;
+        listener(change);
+    }
 }
 
 /**
@@ -134,5 +339,24 @@ std::string GalaxyFactions::toXml() const
     return xml.str();
 }
 
+/**
+ * @brief Adds the bytes owned by the faction registry and every faction to a memory report
+ * @param report The report to accumulate into
+ */
+void GalaxyFactions::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+
+    report.add("factions", sizeof(GalaxyFactions) + heapBytes(m_factions)
+                               + m_factions.size() * SHARED_CONTROL_BLOCK_BYTES);
+    report.add("factions.index", heapBytes(m_factionIndex) + heapBytes(m_systemOwners) + heapBytes(m_ownerTable)
+                                     + heapBytes(m_listeners));
+    for (const auto& faction : m_factions) {
+        faction->reportMemory(report);
+    }
+    m_handovers.reportMemory(report);
+    ResourceTypeRegistry::global().reportMemory(report);
+}
+
 } // namespace ggh::Galaxy::Factions
 
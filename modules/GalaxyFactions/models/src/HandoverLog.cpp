@@ -0,0 +1,187 @@
+/**
+ * @file HandoverLog.cpp
+ * @brief Implementation of the HandoverLog class for GalaxyFactions module
+ */
+
+#include "ggh/modules/GalaxyFactions/models/HandoverLog.h"
+
+#include <algorithm>
+
+namespace ggh::Galaxy::Factions::models {
+
+/**
+ * @brief Constructs an empty log
+ * @param snapshotInterval Events between owner snapshots; 0 uses the default
+ */
+HandoverLog::HandoverLog(std::size_t snapshotInterval)
+    : m_snapshotInterval(snapshotInterval > 0 ? snapshotInterval : DEFAULT_SNAPSHOT_INTERVAL)
+{
+}
+
+/**
+ * @brief Appends a handover record
+ * @param handover The handover to log
+ * @return False if it is dated before the last logged event
+ */
+bool HandoverLog::append(const FactionHandover& handover)
+{
+    return append(Event{handover.handoverDate().toDayNumber(),
+                        static_cast<GalaxyCore::utilities::SystemId>(handover.systemId()),
+                        handover.factionFromId(), handover.factionToId(),
+                        handover.handoverTypeId(), handover.id()},
+                  handover.notes());
+}
+
+/**
+ * @brief Appends a compact handover event
+ * @param event The event to log
+ * @param notes Optional free-text notes
+ * @return False if it is dated before the last logged event
+ */
+bool HandoverLog::append(const Event& event, const std::string& notes)
+{
+    if (!m_events.empty() && event.day < m_events.back().day) {
+        return false;
+    }
+
+    const auto index = static_cast<std::uint32_t>(m_events.size());
+    if (event.system >= m_lastOfSystem.size()) {
+        m_lastOfSystem.resize(static_cast<std::size_t>(event.system) + 1, NO_EVENT);
+        m_owners.resize(static_cast<std::size_t>(event.system) + 1, NO_FACTION);
+    }
+    m_events.push_back(event);
+    m_previousOfSystem.push_back(m_lastOfSystem[event.system]);
+    m_lastOfSystem[event.system] = index;
+    m_owners[event.system] = event.toFaction;
+    if (!notes.empty()) {
+        m_notes.emplace(index, notes);
+    }
+
+    if (m_events.size() % m_snapshotInterval == 0) {
+        m_snapshots.push_back(m_owners);
+    }
+    return true;
+}
+
+/**
+ * @brief Drops every event and snapshot
+ */
+void HandoverLog::clear()
+{
+    m_events.clear();
+    m_previousOfSystem.clear();
+    m_lastOfSystem.clear();
+    m_notes.clear();
+    m_owners.clear();
+    m_snapshots.clear();
+    m_lastReplayCount = 0;
+}
+
+/**
+ * @brief Rebuilds the full record of a logged event
+ * @param index The event index
+ * @return The handover, dated from its day number
+ */
+FactionHandover HandoverLog::handover(std::size_t index) const
+{
+    const auto& event = m_events.at(index);
+    const auto notes = m_notes.find(static_cast<std::uint32_t>(index));
+    return FactionHandover(event.id, event.toFaction, static_cast<int>(event.system), event.fromFaction,
+                           event.handoverTypeId, GalaxyCore::models::GalacticDate::fromDayNumber(event.day),
+                           notes != m_notes.end() ? notes->second : std::string{});
+}
+
+/**
+ * @brief Counts the events dated on or before a day
+ * @param day The day number
+ * @return The number of events, which is also the index of the first later event
+ */
+std::size_t HandoverLog::countUntil(DayNumber day) const
+{
+    const auto it = std::upper_bound(m_events.begin(), m_events.end(), day,
+        [](DayNumber value, const Event& event) { return value < event.day; });
+    return static_cast<std::size_t>(it - m_events.begin());
+}
+
+/**
+ * @brief Reconstructs the owner table at the end of a day
+ * @param day The day number
+ * @param owners Receives the owners, indexed by system id
+ */
+void HandoverLog::ownersAt(DayNumber day, std::vector<int>& owners) const
+{
+    const std::size_t count = countUntil(day);
+    const std::size_t snapshot = count / m_snapshotInterval;
+    std::size_t first = 0;
+    owners.clear();
+    if (snapshot > 0) {
+        owners = m_snapshots[snapshot - 1];
+        first = snapshot * m_snapshotInterval;
+    }
+
+    for (std::size_t i = first; i < count; ++i) {
+        const auto& event = m_events[i];
+        if (event.system >= owners.size()) {
+            owners.resize(static_cast<std::size_t>(event.system) + 1, NO_FACTION);
+        }
+        owners[event.system] = event.toFaction;
+    }
+    m_lastReplayCount = count - first;
+}
+
+/**
+ * @brief Gets the owner of one system at the end of a day
+ * @param system The star system id
+ * @param day The day number
+ * @return The owning faction, or NO_FACTION
+ */
+int HandoverLog::ownerAt(GalaxyCore::utilities::SystemId system, DayNumber day) const
+{
+    if (system >= m_lastOfSystem.size()) {
+        return NO_FACTION;
+    }
+    for (auto index = m_lastOfSystem[system]; index != NO_EVENT; index = m_previousOfSystem[index]) {
+        if (m_events[index].day <= day) {
+            return m_events[index].toFaction;
+        }
+    }
+    return NO_FACTION;
+}
+
+/**
+ * @brief Lists the events of one system
+ * @param system The star system id
+ * @return Event indices, oldest first
+ */
+std::vector<std::size_t> HandoverLog::historyOf(GalaxyCore::utilities::SystemId system) const
+{
+    std::vector<std::size_t> history;
+    if (system < m_lastOfSystem.size()) {
+        for (auto index = m_lastOfSystem[system]; index != NO_EVENT; index = m_previousOfSystem[index]) {
+            history.push_back(index);
+        }
+    }
+    std::reverse(history.begin(), history.end());
+    return history;
+}
+
+/**
+ * @brief Adds the bytes owned by the log to a memory report
+ * @param report The report to accumulate into
+ */
+void HandoverLog::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+
+    std::size_t bytes = heapBytes(m_events) + heapBytes(m_previousOfSystem) + heapBytes(m_lastOfSystem)
+                      + heapBytes(m_notes) + heapBytes(m_owners) + heapBytes(m_snapshots);
+    for (const auto& [index, notes] : m_notes) {
+        bytes += heapBytes(notes);
+    }
+    for (const auto& snapshot : m_snapshots) {
+        bytes += heapBytes(snapshot);
+    }
+    report.add("factions.handovers", bytes, m_events.size());
+}
+
+} // namespace ggh::Galaxy::Factions::models
@@ -0,0 +1,150 @@
+/**
+ * @file ResourceTypeRegistry.cpp
+ * @brief Implementation of the ResourceTypeRegistry class for GalaxyFactions module
+ */
+
+#include "ggh/modules/GalaxyFactions/models/ResourceTypeRegistry.h"
+
+#include <mutex>
+#include <stdexcept>
+
+namespace ggh::Galaxy::Factions::models {
+
+/**
+ * @brief Constructs a registry; handle 0 is the default-constructed type
+ */
+ResourceTypeRegistry::ResourceTypeRegistry()
+{
+    intern(ResourceType{});
+}
+
+/**
+ * @brief Gets the process-wide registry
+ * @return The registry shared by all bonuses and factions
+ */
+ResourceTypeRegistry& ResourceTypeRegistry::global()
+{
+    static ResourceTypeRegistry registry;
+    return registry;
+}
+
+/**
+ * @brief Returns the handle of a type, registering it on first use
+ * @param type The resource type
+ * @return The type's handle
+ */
+ResourceTypeRegistry::Handle ResourceTypeRegistry::intern(const ResourceType& type)
+{
+    {
+        std::shared_lock lock(m_mutex);
+        const auto it = m_handles.find(type);
+        if (it != m_handles.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(m_mutex);
+    // Another thread may have registered the type between the two locks
+    const auto [it, inserted] = m_handles.try_emplace(type, static_cast<Handle>(size()));
+    if (inserted) {
+        const std::size_t handle = it->second;
+        if (handle >= INVALID_HANDLE) {
+            m_handles.erase(it);
+            throw std::length_error("ResourceTypeRegistry: out of resource type handles");
+        }
+        auto& chunk = m_chunks[handle / CHUNK_SIZE];
+        if (!chunk) {
+            chunk = std::make_unique<Chunk>();
+        }
+        chunk->types[handle % CHUNK_SIZE] = type;
+        chunk->typeIds[handle % CHUNK_SIZE] = type.id();
+        m_handlesById[type.id()].push_back(it->second);
+        // Publishes the entry to lock-free readers
+        m_size.store(handle + 1, std::memory_order_release);
+    }
+    return it->second;
+}
+
+/**
+ * @brief Looks up an already registered type
+ * @param type The resource type
+ * @return The type's handle, or INVALID_HANDLE if it was never interned
+ */
+ResourceTypeRegistry::Handle ResourceTypeRegistry::find(const ResourceType& type) const
+{
+    std::shared_lock lock(m_mutex);
+    const auto it = m_handles.find(type);
+    return (it != m_handles.end()) ? it->second : INVALID_HANDLE;
+}
+
+/**
+ * @brief Looks up the handles of every type with an id
+ * @param typeId The ResourceType id
+ * @return The handles in registration order; empty if no type has the id
+ */
+std::vector<ResourceTypeRegistry::Handle> ResourceTypeRegistry::handlesOf(int typeId) const
+{
+    std::shared_lock lock(m_mutex);
+    const auto it = m_handlesById.find(typeId);
+    return (it != m_handlesById.end()) ? it->second : std::vector<Handle>{};
+}
+
+/**
+ * @brief Gets the chunk holding a published handle
+ * @param handle A handle returned by intern()
+ * @return The chunk
+ */
+const ResourceTypeRegistry::Chunk& ResourceTypeRegistry::chunkOf(Handle handle) const
+{
+    if (handle >= size()) {
+        throw std::out_of_range("ResourceTypeRegistry: unknown resource type handle");
+    }
+    return *m_chunks[handle / CHUNK_SIZE];
+}
+
+/**
+ * @brief Gets the type behind a handle
+ * @param handle A handle returned by intern()
+ * @return The interned type
+ */
+const ResourceType& ResourceTypeRegistry::type(Handle handle) const
+{
+    return chunkOf(handle).types[handle % CHUNK_SIZE];
+}
+
+/**
+ * @brief Gets the ResourceType id behind a handle
+ * @param handle A handle returned by intern()
+ * @return The type's id
+ */
+int ResourceTypeRegistry::typeId(Handle handle) const
+{
+    return chunkOf(handle).typeIds[handle % CHUNK_SIZE];
+}
+
+/**
+ * @brief Adds the bytes owned by the registry to a memory report
+ * @param report The report to accumulate into
+ */
+void ResourceTypeRegistry::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+
+    std::shared_lock lock(m_mutex);
+    const std::size_t count = size();
+    std::size_t bytes = sizeof(ResourceTypeRegistry) + heapBytes(m_handles) + heapBytes(m_handlesById);
+    for (const auto& chunk : m_chunks) {
+        bytes += chunk ? sizeof(Chunk) : 0;
+    }
+    for (const auto& [id, handles] : m_handlesById) {
+        bytes += heapBytes(handles);
+    }
+    for (std::size_t handle = 0; handle < count; ++handle) {
+        // Each string is held twice: once in the table, once in the lookup key
+        const auto& type = m_chunks[handle / CHUNK_SIZE]->types[handle % CHUNK_SIZE];
+        bytes += 2 * (heapBytes(type.name()) + heapBytes(type.description()));
+    }
+    report.add("factions.resourceTypes", bytes, count);
+}
+
+} // namespace ggh::Galaxy::Factions::models
@@ -1,4 +1,5 @@
 #include "ggh/modules/GalaxyFactions/models/System.h"
+#include "ggh/modules/GalaxyFactions/models/Faction.h"
 #include <algorithm>
 
 namespace ggh::Galaxy::Factions::models {
@@ -39,6 +40,15 @@ std::string System::description() const
     return m_starSystemModel ? m_starSystemModel->getName() : std::string{};
 }
 
+/**
+ * @brief Appends a handover to this system's history
+ * @param handover The dated handover
+ */
+void System::addHandover(const FactionHandover& handover)
+{
+    m_handoverHistory.push_back(handover);
+}
+
 /**
  * @brief Gets all resource bonuses for this system
  * @return Vector of resource bonuses
@@ -95,6 +105,9 @@ void System::setDescription(const std::string& description)
 void System::addResourceBonus(const SystemResourceBonus& bonus)
 {
     m_resourceBonuses.push_back(bonus);
+    if (m_faction) {
+        m_faction->applyBonus(bonus.resourceTypeHandle(), bonus.bonusAmount(), 1);
+    }
 }
 
 /**
@@ -108,7 +121,7 @@ void System::addResourceBonus(const ResourceType& resourceType, int bonusAmount)
     bonus.setSystemId(id());
     bonus.setResourceType(resourceType);
     bonus.setBonusAmount(static_cast<float>(bonusAmount));
-    m_resourceBonuses.push_back(bonus);
+    addResourceBonus(bonus);
 }
 
 /**
@@ -117,13 +130,17 @@ void System::addResourceBonus(const ResourceType& resourceType, int bonusAmount)
  */
 void System::removeResourceBonus(const ResourceType& resourceType)
 {
-    m_resourceBonuses.erase(
-        std::remove_if(m_resourceBonuses.begin(), m_resourceBonuses.end(),
-            [&resourceType](const SystemResourceBonus& bonus) {
-                return bonus.resourceType().id() == resourceType.id();
-            }),
-        m_resourceBonuses.end()
-    );
+    // Partition rather than remove_if so the dropped bonuses are still readable below
+    const auto removed = std::stable_partition(m_resourceBonuses.begin(), m_resourceBonuses.end(),
+        [&resourceType](const SystemResourceBonus& bonus) {
+            return bonus.id() != resourceType.id();
+        });
+    if (m_faction) {
+        for (auto it = removed; it != m_resourceBonuses.end(); ++it) {
+            m_faction->applyBonus(it->resourceTypeHandle(), -it->bonusAmount(), -1);
+        }
+    }
+    m_resourceBonuses.erase(removed, m_resourceBonuses.end());
 }
 
 /**
@@ -177,7 +194,7 @@ int System::getResourceBonusByType(int resourceTypeId) const
 {
     int totalBonus = 0;
     for (const auto& bonus : m_resourceBonuses) {
-        if (bonus.resourceType().id() == resourceTypeId) {
+        if (bonus.id() == resourceTypeId) {
             totalBonus += static_cast<int>(bonus.bonusAmount());
         }
     }
@@ -193,4 +210,24 @@ std::vector<FactionHandover> System::getHandoverHistory() const
     return m_handoverHistory;
 }
 
+/**
+ * @brief Adds the bytes owned by this system to a memory report
+ * @param report The report to accumulate into
+ * @note The wrapped StarSystemModel is owned by the galaxy and is not counted here
+ */
+void System::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+
+    // Bonus type strings live once in the ResourceTypeRegistry
+    std::size_t bytes = sizeof(System) + heapBytes(m_resourceBonuses) + heapBytes(m_notes) + heapBytes(m_handoverHistory);
+    for (const auto& note : m_notes) {
+        bytes += heapBytes(note.note());
+    }
+    for (const auto& handover : m_handoverHistory) {
+        bytes += heapBytes(handover.notes());
+    }
+    report.add("factionSystems", bytes, 1);
+}
+
 } // namespace ggh::Galaxy::Factions
@@ -3,26 +3,31 @@
 namespace ggh::Galaxy::Factions::models {
 
 SystemResourceBonus::SystemResourceBonus()
-    : m_resourceType{}, m_bonusAmount{0}
+    : m_resourceType{0}, m_bonusAmount{0}
 {
 }
 
 SystemResourceBonus::SystemResourceBonus(const ResourceType& resourceType, int bonusAmount)
+    : m_resourceType{ResourceTypeRegistry::global().intern(resourceType)}, m_bonusAmount{bonusAmount}
+{
+}
+
+SystemResourceBonus::SystemResourceBonus(Handle resourceType, int bonusAmount)
     : m_resourceType{resourceType}, m_bonusAmount{bonusAmount}
 {
 }
 
 int SystemResourceBonus::id() const
 {
-    return m_resourceType.id();
+    return ResourceTypeRegistry::global().typeId(m_resourceType);
 }
 
 void SystemResourceBonus::setId(int id)
 {
-    // ID is managed by the ResourceType
-    auto updatedResourceType = m_resourceType;
+    // ID is managed by the ResourceType; a changed type is a different interned type
+    auto updatedResourceType = resourceType();
     updatedResourceType.setId(id);
-    m_resourceType = updatedResourceType;
+    m_resourceType = ResourceTypeRegistry::global().intern(updatedResourceType);
 }
 
 void SystemResourceBonus::setSystemId(int systemId)
@@ -33,7 +38,7 @@ void SystemResourceBonus::setSystemId(int systemId)
 
 void SystemResourceBonus::setResourceType(const ResourceType& resourceType)
 {
-    m_resourceType = resourceType;
+    m_resourceType = ResourceTypeRegistry::global().intern(resourceType);
 }
 
 void SystemResourceBonus::setBonusAmount(int bonusAmount)
@@ -0,0 +1,331 @@
+/**
+ * @file TerritoryEngine.cpp
+ * @brief Implementation of the TerritoryEngine class for GalaxyFactions module
+ */
+
+#include "ggh/modules/GalaxyFactions/models/TerritoryEngine.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+#include <algorithm>
+
+namespace ggh::Galaxy::Factions::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+
+// Labels order by distance first, then by faction id so ties resolve the same way every time
+bool isBetter(double distance, int faction, double currentDistance, int currentFaction)
+{
+    return distance < currentDistance || (distance == currentDistance && faction < currentFaction);
+}
+
+// std::push_heap builds a max-heap; invert the comparison to pop the best label first
+struct WorseLabel {
+    template <typename Entry>
+    bool operator()(const Entry& lhs, const Entry& rhs) const noexcept {
+        return isBetter(rhs.distance, rhs.faction, lhs.distance, lhs.faction);
+    }
+};
+} // namespace
+
+/**
+ * @brief Binds the engine to a lane graph, dropping holders, reaches and results
+ * @param graph The graph to compute territory over
+ */
+void TerritoryEngine::bind(const LaneGraph& graph)
+{
+    m_graph = &graph;
+    m_holders.clear();
+    m_reach.clear();
+    m_computed = false;
+    resetNodes();
+}
+
+/**
+ * @brief Takes the holders of every system from the registry's ownership index and recomputes
+ * @param factions The faction registry
+ */
+void TerritoryEngine::assign(const GalaxyFactions& factions)
+{
+    m_holders = factions.systemOwners();
+    compute();
+}
+
+/**
+ * @brief Changes the holder of one system, repairing only the affected territory
+ * @param system The star system id
+ * @param factionId The new holder, or NO_FACTION to release the system
+ * @return False if the system is not in the bound graph
+ */
+bool TerritoryEngine::setHolder(GalaxyCore::utilities::SystemId system, int factionId)
+{
+    if (!m_graph) {
+        return false;
+    }
+    const auto node = m_graph->indexOf(system);
+    if (node == LaneGraph::INVALID_NODE) {
+        return false;
+    }
+
+    if (factionId == NO_FACTION) {
+        m_holders.erase(system);
+    } else {
+        m_holders[system] = factionId;
+    }
+    if (!isCurrent()) {
+        compute();
+        return true;
+    }
+    if (m_held[node] == factionId) {
+        m_lastUpdateSize = 0;
+        return true;
+    }
+
+    GGH_TRACE_SCOPE("TerritoryEngine::setHolder");
+    // Everything that drew its label through this system is suspect; clear it and let the
+    // surviving neighbours (and the new holder, if any) offer labels again
+    m_held[node] = factionId;
+    m_lastUpdateSize = 0;
+    m_heap.clear();
+    m_cleared.clear();
+    clearSubtree(node);
+    reseedCleared();
+    run();
+    return true;
+}
+
+/**
+ * @brief Sets a faction's reach limit
+ * @param factionId The faction
+ * @param reach Maximum lane distance from a held system; negative values act as zero
+ */
+void TerritoryEngine::setReach(int factionId, double reach)
+{
+    if (factionId <= NO_FACTION) {
+        return;
+    }
+    reach = std::max(reach, 0.0);
+    if (static_cast<std::size_t>(factionId) >= m_reach.size()) {
+        m_reach.resize(static_cast<std::size_t>(factionId) + 1, UNLIMITED_REACH);
+    }
+    if (m_reach[factionId] == reach) {
+        return;
+    }
+    m_reach[factionId] = reach;
+    if (m_computed) {
+        compute();
+    }
+}
+
+/**
+ * @brief Gets a faction's reach limit
+ */
+double TerritoryEngine::reach(int factionId) const noexcept
+{
+    return factionId > NO_FACTION && static_cast<std::size_t>(factionId) < m_reach.size()
+        ? m_reach[factionId] : UNLIMITED_REACH;
+}
+
+/**
+ * @brief Runs the multi-source Dijkstra over the whole graph
+ */
+void TerritoryEngine::compute()
+{
+    if (!m_graph) {
+        return;
+    }
+    GGH_TRACE_SCOPE("TerritoryEngine::compute");
+    resetNodes();
+    m_revision = m_graph->revision();
+    m_computed = true;
+    m_lastUpdateSize = 0;
+    m_heap.clear();
+    for (const auto& [system, faction] : m_holders) {
+        const auto node = m_graph->indexOf(system);
+        if (node != LaneGraph::INVALID_NODE) {
+            m_held[node] = faction;
+            m_heap.push_back({0.0, faction, node, node, 0.0});
+        }
+    }
+    std::make_heap(m_heap.begin(), m_heap.end(), WorseLabel{});
+    run();
+}
+
+/**
+ * @brief True if the results were computed for this graph and it has not changed since
+ */
+bool TerritoryEngine::isValidFor(const LaneGraph& graph) const noexcept
+{
+    return m_graph == &graph && isCurrent();
+}
+
+/**
+ * @brief Gets the faction explicitly holding a system
+ * @return The holder, or NO_FACTION
+ */
+int TerritoryEngine::holderOf(GalaxyCore::utilities::SystemId system) const
+{
+    const auto it = m_holders.find(system);
+    return it != m_holders.end() ? it->second : NO_FACTION;
+}
+
+/**
+ * @brief Gets the faction a system belongs to, held or claimed
+ * @return The owner, or NO_FACTION if no faction reaches the system
+ */
+int TerritoryEngine::ownerOf(GalaxyCore::utilities::SystemId system) const
+{
+    const auto node = m_graph ? m_graph->indexOf(system) : LaneGraph::INVALID_NODE;
+    return node < m_owner.size() ? m_owner[node] : NO_FACTION;
+}
+
+/**
+ * @brief Gets the distance of a system's winning label
+ */
+double TerritoryEngine::distanceOf(GalaxyCore::utilities::SystemId system) const
+{
+    const auto node = m_graph ? m_graph->indexOf(system) : LaneGraph::INVALID_NODE;
+    return node < m_distance.size() ? m_distance[node] : UNLIMITED_REACH;
+}
+
+/**
+ * @brief Adds the engine's tables to a memory report
+ * @param report The report to accumulate into
+ */
+void TerritoryEngine::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+    report.add("factions.territory",
+               heapBytes(m_holders) + heapBytes(m_reach) + heapBytes(m_held) + heapBytes(m_owner)
+                   + heapBytes(m_distance) + heapBytes(m_parent) + heapBytes(m_heap) + heapBytes(m_cleared));
+}
+
+/**
+ * @brief True if the results match the bound graph's current revision
+ */
+bool TerritoryEngine::isCurrent() const noexcept
+{
+    return m_computed && m_graph && m_revision == m_graph->revision() && m_owner.size() == m_graph->nodeCount();
+}
+
+/**
+ * @brief Sizes the per-node arrays for the bound graph and clears every label
+ */
+void TerritoryEngine::resetNodes()
+{
+    const std::size_t nodeCount = m_graph ? m_graph->nodeCount() : 0;
+    m_held.assign(nodeCount, NO_FACTION);
+    m_owner.assign(nodeCount, NO_FACTION);
+    m_distance.assign(nodeCount, UNLIMITED_REACH);
+    m_parent.assign(nodeCount, LaneGraph::INVALID_NODE);
+}
+
+/**
+ * @brief Offers the label of one node to a neighbour, if the faction's reach allows it
+ */
+void TerritoryEngine::offer(NodeIndex from, NodeIndex to, double length)
+{
+    const int faction = m_owner[from];
+    if (faction == NO_FACTION || m_held[to] != NO_FACTION) {
+        return;
+    }
+    const double distance = m_distance[from] + length;
+    if (distance <= reach(faction) && isBetter(distance, faction, m_distance[to], m_owner[to])) {
+        m_heap.push_back({distance, faction, to, from, m_distance[from]});
+        std::push_heap(m_heap.begin(), m_heap.end(), WorseLabel{});
+    }
+}
+
+/**
+ * @brief Clears the label of a node and of every node whose label was derived through it
+ */
+void TerritoryEngine::clearSubtree(NodeIndex root)
+{
+    const std::size_t first = m_cleared.size();
+    m_cleared.push_back(root);
+    // The cleared list doubles as the traversal stack
+    for (std::size_t i = first; i < m_cleared.size(); ++i) {
+        const auto node = m_cleared[i];
+        const auto neighbours = m_graph->neighbours(node);
+        for (std::size_t n = 0; n < neighbours.size(); ++n) {
+            const auto child = neighbours.nodes[n];
+            if (m_parent[child] == node && child != node) {
+                m_cleared.push_back(child);
+                m_parent[child] = LaneGraph::INVALID_NODE;
+            }
+        }
+    }
+    for (std::size_t i = first; i < m_cleared.size(); ++i) {
+        const auto node = m_cleared[i];
+        m_owner[node] = NO_FACTION;
+        m_distance[node] = UNLIMITED_REACH;
+        m_parent[node] = LaneGraph::INVALID_NODE;
+    }
+}
+
+/**
+ * @brief Queues fresh offers for every cleared node from its holder and surviving neighbours
+ */
+void TerritoryEngine::reseedCleared()
+{
+    for (const auto node : m_cleared) {
+        if (m_held[node] != NO_FACTION) {
+            m_heap.push_back({0.0, m_held[node], node, node, 0.0});
+            std::push_heap(m_heap.begin(), m_heap.end(), WorseLabel{});
+            continue;
+        }
+        const auto neighbours = m_graph->neighbours(node);
+        for (std::size_t n = 0; n < neighbours.size(); ++n) {
+            offer(neighbours.nodes[n], node, neighbours.lengths[n]);
+        }
+    }
+    m_cleared.clear();
+}
+
+/**
+ * @brief Settles queued offers until no label can improve
+ *
+ * A full compute only ever settles each node once. During a repair an offer can beat a label
+ * that is still valid; the nodes hanging from that label are then cleared and re-offered.
+ */
+void TerritoryEngine::run()
+{
+    while (!m_heap.empty()) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), WorseLabel{});
+        const auto candidate = m_heap.back();
+        m_heap.pop_back();
+
+        const auto node = candidate.node;
+        const bool seed = candidate.parent == node;
+        if (seed ? m_held[node] != candidate.faction
+                 : (m_held[node] != NO_FACTION || m_owner[candidate.parent] != candidate.faction
+                    || m_distance[candidate.parent] != candidate.parentDistance)) {
+            continue;
+        }
+        if (!isBetter(candidate.distance, candidate.faction, m_distance[node], m_owner[node])) {
+            continue;
+        }
+
+        if (m_owner[node] != NO_FACTION) {
+            const auto neighbours = m_graph->neighbours(node);
+            for (std::size_t n = 0; n < neighbours.size(); ++n) {
+                const auto child = neighbours.nodes[n];
+                if (m_parent[child] == node && child != node && m_owner[child] != NO_FACTION) {
+                    clearSubtree(child);
+                }
+            }
+        }
+        m_owner[node] = candidate.faction;
+        m_distance[node] = candidate.distance;
+        m_parent[node] = candidate.parent;
+        ++m_lastUpdateSize;
+
+        const auto neighbours = m_graph->neighbours(node);
+        for (std::size_t n = 0; n < neighbours.size(); ++n) {
+            offer(node, neighbours.nodes[n], neighbours.lengths[n]);
+        }
+        reseedCleared();
+    }
+}
+
+} // namespace ggh::Galaxy::Factions::models
@@ -0,0 +1,234 @@
+/**
+ * @file VoronoiCells.cpp
+ * @brief Implementation of the VoronoiCells class for GalaxyFactions module
+ */
+
+#include "ggh/modules/GalaxyFactions/models/VoronoiCells.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ggh::Galaxy::Factions::models {
+
+namespace {
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+// Sites closer than this are treated as the same point; they have no usable bisector
+constexpr double COINCIDENT_DISTANCE = 1e-9;
+
+double farthestVertex(const VoronoiCell& cell, const Coordinates& site)
+{
+    double farthest = 0.0;
+    for (const auto& vertex : cell.vertices) {
+        farthest = std::max(farthest, GalaxyCore::utilities::calculateDistance(site, vertex));
+    }
+    return farthest;
+}
+
+/**
+ * @brief Keeps the part of a convex cell that is closer to site than to other
+ *
+ * Sutherland-Hodgman against one half-plane; the new edge along the bisector is labelled
+ * with the other site.
+ */
+void clip(const VoronoiCell& cell, const Coordinates& site, const Coordinates& other,
+          VoronoiCells::Index otherIndex, VoronoiCell& out)
+{
+    out.vertices.clear();
+    out.edgeSites.clear();
+    const double dx = other.x - site.x;
+    const double dy = other.y - site.y;
+    const double midX = (site.x + other.x) * 0.5;
+    const double midY = (site.y + other.y) * 0.5;
+    auto side = [&](const Coordinates& point) { return (point.x - midX) * dx + (point.y - midY) * dy; };
+
+    const std::size_t count = cell.vertices.size();
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& a = cell.vertices[i];
+        const auto& b = cell.vertices[(i + 1) % count];
+        const double sideA = side(a);
+        const double sideB = side(b);
+        const bool aInside = sideA <= 0.0;
+        const bool bInside = sideB <= 0.0;
+        if (aInside) {
+            out.vertices.push_back(a);
+            out.edgeSites.push_back(cell.edgeSites[i]);
+        }
+        if (aInside != bInside) {
+            const double t = sideA / (sideA - sideB);
+            out.vertices.emplace_back(a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t);
+            // Leaving the half-plane starts the bisector edge; entering resumes the old edge
+            out.edgeSites.push_back(aInside ? otherIndex : cell.edgeSites[i]);
+        }
+    }
+}
+} // namespace
+
+/**
+ * @brief Sets the rectangle every cell is clipped to and invalidates all cells
+ */
+void VoronoiCells::setBounds(double minX, double minY, double maxX, double maxY)
+{
+    m_minX = std::min(minX, maxX);
+    m_minY = std::min(minY, maxY);
+    m_maxX = std::max(minX, maxX);
+    m_maxY = std::max(minY, maxY);
+    m_allDirty = true;
+}
+
+/**
+ * @brief Replaces all sites
+ * @param sites Site positions; cell i belongs to sites[i]
+ */
+void VoronoiCells::setSites(std::span<const Coordinates> sites)
+{
+    m_sites.assign(sites.begin(), sites.end());
+    m_cells.assign(m_sites.size(), {});
+    m_moved.clear();
+    m_allDirty = true;
+}
+
+/**
+ * @brief Moves one site
+ * @param site The site index
+ * @param position The new position
+ */
+void VoronoiCells::moveSite(Index site, const Coordinates& position)
+{
+    if (site >= m_sites.size()) {
+        return;
+    }
+    m_sites[site] = position;
+    m_moved.push_back(site);
+}
+
+/**
+ * @brief Recomputes the invalidated cells
+ * @return Indices of the recomputed cells, sorted
+ */
+const std::vector<VoronoiCells::Index>& VoronoiCells::update()
+{
+    m_updated.clear();
+    if (!isDirty()) {
+        return m_updated;
+    }
+    GGH_TRACE_SCOPE("VoronoiCells::update");
+    m_grid.build(m_sites);
+
+    if (m_allDirty) {
+        for (Index index = 0; index < m_sites.size(); ++index) {
+            computeCell(index);
+            m_updated.push_back(index);
+        }
+        m_allDirty = false;
+        m_moved.clear();
+        return m_updated;
+    }
+
+    // A moved site's old and new neighbours are the only cells its bisectors can touch
+    std::vector<Index> dirty;
+    for (const auto site : m_moved) {
+        const auto before = neighbours(site);
+        dirty.insert(dirty.end(), before.begin(), before.end());
+        computeCell(site);
+        m_updated.push_back(site);
+        const auto after = neighbours(site);
+        dirty.insert(dirty.end(), after.begin(), after.end());
+    }
+    m_moved.clear();
+
+    auto sortUnique = [](std::vector<Index>& values) {
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+    };
+    sortUnique(m_updated);
+    sortUnique(dirty);
+    for (const auto index : dirty) {
+        if (!std::binary_search(m_updated.begin(), m_updated.end(), index)) {
+            computeCell(index);
+        }
+    }
+    m_updated.insert(m_updated.end(), dirty.begin(), dirty.end());
+    sortUnique(m_updated);
+    return m_updated;
+}
+
+/**
+ * @brief Gets the sites bordering a cell
+ */
+std::vector<VoronoiCells::Index> VoronoiCells::neighbours(Index index) const
+{
+    std::vector<Index> sites;
+    for (const auto site : m_cells[index].edgeSites) {
+        if (site != BOUNDARY) {
+            sites.push_back(site);
+        }
+    }
+    return sites;
+}
+
+/**
+ * @brief Adds the cell geometry to a memory report
+ * @param report The report to accumulate into
+ */
+void VoronoiCells::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+    std::size_t bytes = heapBytes(m_sites) + heapBytes(m_cells) + heapBytes(m_moved) + heapBytes(m_updated);
+    for (const auto& cell : m_cells) {
+        bytes += heapBytes(cell.vertices) + heapBytes(cell.edgeSites);
+    }
+    report.add("factions.voronoi", bytes, m_cells.size());
+}
+
+/**
+ * @brief Clips the bounds rectangle down to one site's cell
+ */
+void VoronoiCells::computeCell(Index index)
+{
+    auto& cell = m_cells[index];
+    cell.vertices = {Coordinates(m_minX, m_minY), Coordinates(m_maxX, m_minY),
+                     Coordinates(m_maxX, m_maxY), Coordinates(m_minX, m_maxY)};
+    cell.edgeSites.assign(4, BOUNDARY);
+
+    const auto& site = m_sites[index];
+    // Once the search circle holds every site, no further ring can add anything
+    const double searchLimit = GalaxyCore::utilities::calculateDistance(
+        Coordinates(std::min(m_minX, site.x), std::min(m_minY, site.y)),
+        Coordinates(std::max(m_maxX, site.x), std::max(m_maxY, site.y)))
+        + GalaxyCore::utilities::calculateDistance(Coordinates(m_minX, m_minY), Coordinates(m_maxX, m_maxY))
+        + 2.0 * m_grid.cellSize();
+    double searched = -1.0;
+    double radius = 3.0 * m_grid.cellSize();
+    while (!cell.vertices.empty()) {
+        m_candidates.clear();
+        m_grid.forEachInRadius(site, radius, [&](Index other, double distance) {
+            if (other != index && distance > searched) {
+                m_candidates.emplace_back(distance, other);
+            }
+        });
+        std::sort(m_candidates.begin(), m_candidates.end());
+
+        double reach = 2.0 * farthestVertex(cell, site);
+        for (const auto& [distance, other] : m_candidates) {
+            if (distance > reach) {
+                break;
+            }
+            if (distance < COINCIDENT_DISTANCE) {
+                continue;
+            }
+            clip(cell, site, m_sites[other], other, m_scratch);
+            std::swap(cell.vertices, m_scratch.vertices);
+            std::swap(cell.edgeSites, m_scratch.edgeSites);
+            reach = 2.0 * farthestVertex(cell, site);
+        }
+        // Sites beyond the searched radius are at least that far, so their bisectors miss the cell
+        if (reach <= radius || radius >= searchLimit) {
+            break;
+        }
+        searched = radius;
+        radius = std::max(reach, 2.0 * radius);
+    }
+}
+
+} // namespace ggh::Galaxy::Factions::models
@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyFactions/models/ExpansionSimulator.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+
+#include <algorithm>
+#include <random>
+
+namespace ggh::Galaxy::Factions::models {
+
+namespace {
+using GalaxyCore::models::GalaxyModel;
+using GalaxyCore::utilities::SystemId;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+// Square grid of systems with lanes to the right and below; ids are row-major from 1
+void buildGrid(GalaxyModel& galaxy, SystemId side, unsigned seed) {
+    std::mt19937 rng(seed);
+    for (SystemId row = 0; row < side; ++row) {
+        for (SystemId column = 0; column < side; ++column) {
+            const SystemId id = row * side + column + 1;
+            galaxy.addStarSystem(id, "S" + std::to_string(id), Coordinates(column * 10.0, row * 10.0));
+            const auto planets = rng() % 4;
+            for (unsigned p = 0; p < planets; ++p) {
+                galaxy.getStarSystem(id)->addPlanet(GalaxyCore::models::Planet(
+                    "P", GalaxyCore::utilities::PlanetType::Rocky, 1.0, 1.0, 0, 1.0, 300.0, 200.0));
+            }
+        }
+    }
+    GalaxyCore::utilities::LaneId lane = 1;
+    for (SystemId row = 0; row < side; ++row) {
+        for (SystemId column = 0; column < side; ++column) {
+            const SystemId id = row * side + column + 1;
+            if (column + 1 < side) {
+                galaxy.addTravelLane(lane++, id, id + 1);
+            }
+            if (row + 1 < side) {
+                galaxy.addTravelLane(lane++, id, id + side);
+            }
+        }
+    }
+}
+
+void found(GalaxyFactions& factions, const GalaxyModel& galaxy, const std::string& name, SystemId homeworld) {
+    factions.createFaction(name, "", "#FFFFFF")->addSystem(std::make_shared<System>(galaxy.getStarSystem(homeworld)));
+}
+} // namespace
+
+class ExpansionSimulatorTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        buildGrid(galaxy, 40, 3);
+        found(factions, galaxy, "North", 1);
+        found(factions, galaxy, "East", 40);
+        found(factions, galaxy, "South", 1561);
+        found(factions, galaxy, "Centre", 820);
+    }
+
+    GalaxyModel galaxy{400, 400};
+    GalaxyFactions factions;
+};
+
+TEST_F(ExpansionSimulatorTest, ResultsDoNotDependOnThreadCount) {
+    ExpansionRules rules;
+    rules.claimsPerTurn = 3;
+
+    ExpansionSimulator serial;
+    serial.setRules(rules);
+    serial.bind(galaxy, factions);
+    std::vector<FactionHandover> serialHandovers;
+    serial.run(1000, serialHandovers, 1);
+
+    ExpansionSimulator parallel;
+    parallel.setRules(rules);
+    parallel.setParallelThreshold(0);
+    parallel.bind(galaxy, factions);
+    std::vector<FactionHandover> parallelHandovers;
+    parallel.run(1000, parallelHandovers, 4);
+
+    ASSERT_EQ(serialHandovers.size(), parallelHandovers.size());
+    for (std::size_t i = 0; i < serialHandovers.size(); ++i) {
+        EXPECT_EQ(serialHandovers[i].systemId(), parallelHandovers[i].systemId());
+        EXPECT_EQ(serialHandovers[i].factionToId(), parallelHandovers[i].factionToId());
+        EXPECT_EQ(serialHandovers[i].handoverDate(), parallelHandovers[i].handoverDate());
+    }
+    EXPECT_TRUE(std::ranges::equal(serial.owners(), parallel.owners()));
+}
+
+TEST_F(ExpansionSimulatorTest, FactionsFillTheConnectedGalaxyThroughAdjacentClaims) {
+    ExpansionSimulator simulator;
+    simulator.setStartDate(GalaxyCore::models::GalacticDate(2400, 1, 1));
+    simulator.bind(galaxy, factions);
+
+    std::vector<FactionHandover> handovers;
+    const auto turns = simulator.run(5000, handovers);
+    EXPECT_EQ(handovers.size(), 1600u - 4u);
+    EXPECT_GT(turns, 0u);
+    for (const auto owner : simulator.owners()) {
+        EXPECT_NE(owner, ExpansionSimulator::NO_FACTION);
+    }
+
+    // Every claim borders a system its faction already held
+    std::vector<int> owners(1601, ExpansionSimulator::NO_FACTION);
+    for (const auto id : {1u, 40u, 1561u, 820u}) {
+        owners[id] = factions.ownerOf(id);
+    }
+    for (const auto& handover : handovers) {
+        const auto& graph = galaxy.laneGraph();
+        bool adjacent = false;
+        for (const auto neighbour : graph.neighbours(graph.indexOf(handover.systemId())).nodes) {
+            adjacent = adjacent || owners[graph.systemId(neighbour)] == handover.factionToId();
+        }
+        EXPECT_TRUE(adjacent) << "system " << handover.systemId();
+        owners[handover.systemId()] = handover.factionToId();
+    }
+    EXPECT_EQ(handovers.front().handoverDate(), GalaxyCore::models::GalacticDate(2400, 2, 1));
+}
+
+TEST_F(ExpansionSimulatorTest, PrefersSystemsWithMorePlanetsAndResources) {
+    ExpansionRules rules;
+    rules.planetWeight = 0.0;
+    rules.resourceWeight = 1.0;
+    ExpansionSimulator simulator;
+    simulator.setRules(rules);
+    simulator.bind(galaxy, factions);
+    // North's homeworld borders systems 2 and 41
+    ASSERT_TRUE(simulator.setResources(41, 10.0));
+
+    std::vector<FactionHandover> handovers;
+    simulator.step(handovers, 1);
+    EXPECT_EQ(simulator.ownerOf(41), factions.ownerOf(1));
+    EXPECT_EQ(simulator.ownerOf(2), ExpansionSimulator::NO_FACTION);
+}
+
+TEST_F(ExpansionSimulatorTest, CommitAddsClaimedSystemsAndLogsThem) {
+    ExpansionSimulator simulator;
+    simulator.bind(galaxy, factions);
+    std::vector<FactionHandover> handovers;
+    simulator.run(10, handovers);
+
+    ExpansionSimulator::commit(handovers, factions, galaxy);
+    EXPECT_EQ(factions.handovers().size(), handovers.size());
+    for (const auto& handover : handovers) {
+        EXPECT_EQ(factions.ownerOf(handover.systemId()), handover.factionToId());
+        const auto& systems = factions.getFaction(handover.factionToId())->systems();
+        const auto system = std::find_if(systems.begin(), systems.end(),
+            [&handover](const std::shared_ptr<System>& s) { return s->id() == handover.systemId(); });
+        ASSERT_NE(system, systems.end());
+        const auto history = (*system)->getHandoverHistory();
+        ASSERT_EQ(history.size(), 1u);
+        EXPECT_EQ(history.front().id(), handover.id());
+    }
+}
+
+TEST_F(ExpansionSimulatorTest, UnheldSystemsScoreTheirPlanetMass) {
+    ExpansionRules rules;
+    rules.planetWeight = 0.0;
+    rules.resourceWeight = 1.0;
+    // North's homeworld borders systems 2 and 41; only 41 has a heavy planet
+    galaxy.getStarSystem(41)->addPlanet(GalaxyCore::models::Planet(
+        "Giant", GalaxyCore::utilities::PlanetType::GasGiant, 10.0, 300.0, 12, 5.0, 150.0, 100.0));
+    ExpansionSimulator simulator;
+    simulator.setRules(rules);
+    simulator.bind(galaxy, factions);
+
+    std::vector<FactionHandover> handovers;
+    simulator.step(handovers, 1);
+    EXPECT_EQ(simulator.ownerOf(41), factions.ownerOf(1));
+    EXPECT_EQ(simulator.ownerOf(2), ExpansionSimulator::NO_FACTION);
+}
+
+} // namespace ggh::Galaxy::Factions::models
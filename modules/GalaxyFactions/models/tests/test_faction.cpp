@@ -1,5 +1,6 @@
 ﻿#include <gtest/gtest.h>
 #include "ggh/modules/GalaxyFactions/models/Faction.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
 #include "ggh/modules/GalaxyFactions/models/System.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 #include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
@@ -55,6 +56,78 @@ TEST_F(FactionTest, SystemManagement) {
     EXPECT_EQ(faction->systems().size(), 0);
 }
 
+TEST_F(FactionTest, ResourceTotalsFollowSystemsAndBonusEdits) {
+    const ResourceType energy(1, "Energy", "Power output");
+    const ResourceType metal(2, "Metal", "Ore output");
+    auto system = std::make_shared<System>(std::make_shared<GalaxyCore::models::StarSystemModel>(
+        1, "Alpha", GalaxyCore::utilities::CartesianCoordinates<double>(0.0, 0.0)));
+    system->addResourceBonus(energy, 10);
+
+    faction->addSystem(system);
+    EXPECT_EQ(faction->getResourceBonusesByType(1), 10);
+    EXPECT_EQ(faction->resourceBonusCount(), 1u);
+
+    // Edits on a held system reach the faction without it walking anything
+    system->addResourceBonus(energy, 5);
+    system->addResourceBonus(metal, 7);
+    EXPECT_EQ(faction->getResourceBonusesByType(1), 15);
+    EXPECT_EQ(faction->getResourceBonusesByType(2), 7);
+    EXPECT_EQ(faction->resourceBonusCount(), 3u);
+    EXPECT_EQ(faction->getResourcesStock().at(metal), 7);
+
+    system->removeResourceBonus(energy);
+    EXPECT_EQ(faction->getResourceBonusesByType(1), 0);
+    EXPECT_EQ(faction->resourceBonusCounts()[ResourceTypeRegistry::global().find(energy)], 0u);
+
+    faction->removeSystem(system->id());
+    EXPECT_EQ(faction->resourceTotal(ResourceTypeRegistry::global().find(metal)), 0);
+    EXPECT_EQ(faction->resourceBonusCount(), 0u);
+
+    // A released system no longer reports to its former faction
+    system->addResourceBonus(metal, 3);
+    EXPECT_EQ(faction->getResourceBonusesByType(2), 0);
+}
+
+TEST_F(FactionTest, ResourceTotalsMoveWithSystemBetweenFactions) {
+    GalaxyFactions registry;
+    auto first = registry.createFaction("First", "", "#FF0000");
+    auto second = registry.createFaction("Second", "", "#00FF00");
+    auto system = std::make_shared<System>(std::make_shared<GalaxyCore::models::StarSystemModel>(
+        4, "Delta", GalaxyCore::utilities::CartesianCoordinates<double>(0.0, 0.0)));
+    system->addResourceBonus(ResourceType(1, "Energy", ""), 8);
+
+    first->addSystem(system);
+    second->addSystem(system);
+    EXPECT_EQ(first->getResourceBonusesByType(1), 0);
+    EXPECT_EQ(second->getResourceBonusesByType(1), 8);
+
+    system->addResourceBonus(ResourceType(1, "Energy", ""), 2);
+    EXPECT_EQ(first->getResourceBonusesByType(1), 0);
+    EXPECT_EQ(second->getResourceBonusesByType(1), 10);
+}
+
+TEST_F(FactionTest, ResourceTotalsFollowSystemsOfDeletedFactions) {
+    GalaxyFactions registry;
+    auto first = registry.createFaction("First", "", "#FF0000");
+    auto second = registry.createFaction("Second", "", "#00FF00");
+    auto system = std::make_shared<System>(std::make_shared<GalaxyCore::models::StarSystemModel>(
+        4, "Delta", GalaxyCore::utilities::CartesianCoordinates<double>(0.0, 0.0)));
+    system->addResourceBonus(ResourceType(1, "Energy", ""), 8);
+    first->addSystem(system);
+
+    // The deleted faction stays alive through this test's pointer
+    ASSERT_TRUE(registry.deleteFaction(first->id()));
+    EXPECT_TRUE(first->systems().empty());
+    EXPECT_EQ(first->getResourceBonusesByType(1), 0);
+
+    second->addSystem(system);
+    system->addResourceBonus(ResourceType(1, "Energy", ""), 2);
+    EXPECT_EQ(second->getResourceBonusesByType(1), 10);
+    system->removeResourceBonus(ResourceType(1, "Energy", ""));
+    EXPECT_EQ(second->getResourceBonusesByType(1), 0);
+    EXPECT_EQ(first->getResourceBonusesByType(1), 0);
+}
+
 TEST_F(FactionTest, XMLExport) {
     auto xmlString = faction->toXml();
     EXPECT_FALSE(xmlString.empty());
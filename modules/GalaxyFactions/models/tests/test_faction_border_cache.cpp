@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyFactions/models/FactionBorderCache.h"
+
+#include <random>
+
+namespace ggh::Galaxy::Factions::models {
+
+namespace {
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+double borderLength(const FactionBorderCache& cache, FactionBorderCache::Index site) {
+    double length = 0.0;
+    for (const auto& segment : cache.borders(site)) {
+        length += GalaxyCore::utilities::calculateDistance(segment.from, segment.to);
+    }
+    return length;
+}
+} // namespace
+
+TEST(FactionBorderCacheTest, SameFactionCellsMergeIntoOneRegion) {
+    // A 2x2 grid of systems in a 100x100 galaxy; the left column is faction 1, the right faction 2
+    const std::vector<Coordinates> sites{Coordinates(25.0, 25.0), Coordinates(75.0, 25.0),
+                                         Coordinates(25.0, 75.0), Coordinates(75.0, 75.0)};
+    FactionBorderCache cache;
+    cache.setBounds(0.0, 0.0, 100.0, 100.0);
+    cache.setSites(sites);
+    const std::vector<int> owners{1, 2, 1, 2};
+    cache.setOwners(owners);
+    EXPECT_TRUE(cache.update());
+
+    // Each cell keeps its two bounds edges and the edge facing the other faction, but not the
+    // edge it shares with its same-faction neighbour
+    for (FactionBorderCache::Index site = 0; site < 4; ++site) {
+        EXPECT_EQ(cache.borders(site).size(), 3u) << site;
+        EXPECT_DOUBLE_EQ(borderLength(cache, site), 150.0) << site;
+    }
+
+    cache.setOwner(1, 1);
+    cache.setOwner(3, FactionBorderCache::NO_FACTION);
+    EXPECT_TRUE(cache.update());
+    EXPECT_DOUBLE_EQ(borderLength(cache, 0), 100.0);
+    EXPECT_DOUBLE_EQ(borderLength(cache, 1), 150.0);
+    EXPECT_DOUBLE_EQ(borderLength(cache, 2), 150.0);
+    EXPECT_TRUE(cache.borders(3).empty());
+}
+
+TEST(FactionBorderCacheTest, OwnershipChangeOnlyRebuildsNeighbourBorders) {
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<double> coordinate(0.0, 2000.0);
+    std::vector<Coordinates> sites;
+    std::vector<int> owners;
+    for (int i = 0; i < 4000; ++i) {
+        sites.emplace_back(coordinate(rng), coordinate(rng));
+        owners.push_back(sites.back().x < 1000.0 ? 1 : 2);
+    }
+    FactionBorderCache cache;
+    cache.setBounds(0.0, 0.0, 2000.0, 2000.0);
+    cache.setSites(sites);
+    cache.setOwners(owners);
+    cache.update();
+    EXPECT_EQ(cache.lastBorderUpdateCount(), sites.size());
+    const auto revision = cache.revision();
+
+    // Re-applying the same owners changes nothing
+    cache.setOwners(owners);
+    EXPECT_FALSE(cache.update());
+    EXPECT_EQ(cache.revision(), revision);
+
+    owners[17] = 3;
+    cache.setOwners(owners);
+    EXPECT_TRUE(cache.update());
+    EXPECT_EQ(cache.lastBorderUpdateCount(), cache.cells().neighbours(17).size() + 1);
+    // The whole cell outline is a border now
+    EXPECT_EQ(cache.borders(17).size(), cache.cells().cell(17).vertices.size());
+}
+
+TEST(FactionBorderCacheTest, MovingASystemUpdatesBordersAroundIt) {
+    const std::vector<Coordinates> sites{Coordinates(25.0, 50.0), Coordinates(75.0, 50.0)};
+    FactionBorderCache cache;
+    cache.setBounds(0.0, 0.0, 100.0, 100.0);
+    cache.setSites(sites);
+    cache.setOwner(0, 1);
+    cache.setOwner(1, 2);
+    cache.update();
+    EXPECT_DOUBLE_EQ(borderLength(cache, 0), 300.0);
+
+    // The bisector shifts right to x = 60, so cell 0 grows by 10 along the top and bottom
+    cache.moveSite(0, Coordinates(45.0, 50.0));
+    EXPECT_TRUE(cache.update());
+    EXPECT_DOUBLE_EQ(borderLength(cache, 0), 320.0);
+    EXPECT_DOUBLE_EQ(borderLength(cache, 1), 280.0);
+}
+
+} // namespace ggh::Galaxy::Factions::models
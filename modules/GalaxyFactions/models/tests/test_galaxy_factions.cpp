@@ -95,4 +95,132 @@ TEST_F(GalaxyFactionsTest, MultipleFactionsUniqueIds) {
     EXPECT_NE(faction2->id(), faction3->id());
     EXPECT_NE(faction1->id(), faction3->id());
 }
+
+TEST_F(GalaxyFactionsTest, ReportMemoryCountsFactionsAndSystems) {
+    auto faction = galaxyFactions->createFaction("Faction1", "Desc1", "#FF0000");
+    galaxyFactions->createFaction("Faction2", "Desc2", "#00FF00");
+    auto starSystem = std::make_shared<GalaxyCore::models::StarSystemModel>(
+        1, "Sol", GalaxyCore::utilities::CartesianCoordinates<double>(0.0, 0.0));
+    faction->addSystem(std::make_shared<System>(starSystem));
+
+    GalaxyCore::utilities::MemoryReport report;
+    galaxyFactions->reportMemory(report);
+
+    EXPECT_EQ(report.count("factions"), 2u);
+    EXPECT_EQ(report.count("factionSystems"), 1u);
+    EXPECT_GE(report.bytes("factions"), 2 * sizeof(Faction));
+    // Star systems belong to the galaxy, not to the factions
+    EXPECT_EQ(report.count("starSystems"), 0u);
+}
+
+namespace {
+std::shared_ptr<System> makeSystem(GalaxyCore::utilities::SystemId id) {
+    return std::make_shared<System>(std::make_shared<GalaxyCore::models::StarSystemModel>(
+        id, "System " + std::to_string(id), GalaxyCore::utilities::CartesianCoordinates<double>(0.0, 0.0)));
+}
+} // namespace
+
+TEST_F(GalaxyFactionsTest, OwnershipIndexFollowsAddAndRemove) {
+    auto faction = galaxyFactions->createFaction("Faction1", "Desc1", "#FF0000");
+    faction->addSystem(makeSystem(3));
+    faction->addSystem(makeSystem(7));
+
+    EXPECT_EQ(galaxyFactions->ownerOf(3), faction->id());
+    EXPECT_EQ(galaxyFactions->owningFaction(7), faction);
+    EXPECT_EQ(galaxyFactions->ownerOf(5), GalaxyFactions::NO_FACTION);
+    ASSERT_EQ(galaxyFactions->ownerTable().size(), 8u);
+    EXPECT_EQ(galaxyFactions->ownerTable()[7], faction->id());
+    EXPECT_EQ(galaxyFactions->ownerTable()[5], GalaxyFactions::NO_FACTION);
+
+    faction->removeSystem(3);
+    EXPECT_EQ(galaxyFactions->ownerOf(3), GalaxyFactions::NO_FACTION);
+    EXPECT_EQ(galaxyFactions->ownerTable()[3], GalaxyFactions::NO_FACTION);
+    EXPECT_FALSE(faction->hasSystem(3));
+    EXPECT_TRUE(faction->hasSystem(7));
+}
+
+TEST_F(GalaxyFactionsTest, SystemBelongsToOneFactionAtATime) {
+    auto first = galaxyFactions->createFaction("First", "Desc1", "#FF0000");
+    auto second = galaxyFactions->createFaction("Second", "Desc2", "#00FF00");
+    first->addSystem(makeSystem(1));
+    first->addSystem(makeSystem(1));
+    EXPECT_EQ(first->systems().size(), 1u);
+
+    second->addSystem(makeSystem(1));
+    EXPECT_TRUE(first->systems().empty());
+    ASSERT_EQ(second->systems().size(), 1u);
+    EXPECT_EQ(galaxyFactions->ownerOf(1), second->id());
+
+    // Removing from a faction that no longer holds it leaves the new owner alone
+    first->removeSystem(1);
+    EXPECT_EQ(galaxyFactions->ownerOf(1), second->id());
+}
+
+TEST_F(GalaxyFactionsTest, DeleteFactionReleasesItsSystems) {
+    auto faction = galaxyFactions->createFaction("Faction1", "Desc1", "#FF0000");
+    faction->addSystem(makeSystem(2));
+    ASSERT_TRUE(galaxyFactions->deleteFaction(faction->id()));
+
+    EXPECT_EQ(galaxyFactions->ownerOf(2), GalaxyFactions::NO_FACTION);
+    EXPECT_TRUE(galaxyFactions->systemOwners().empty());
+
+    // The detached faction no longer reports to the registry
+    faction->addSystem(makeSystem(4));
+    EXPECT_EQ(galaxyFactions->ownerOf(4), GalaxyFactions::NO_FACTION);
+}
+
+TEST_F(GalaxyFactionsTest, RenumberingFactionUpdatesIndices) {
+    auto faction = galaxyFactions->createFaction("Faction1", "Desc1", "#FF0000");
+    auto other = galaxyFactions->createFaction("Faction2", "Desc2", "#00FF00");
+    faction->addSystem(makeSystem(9));
+
+    faction->setId(other->id());
+    EXPECT_EQ(faction->id(), 1);
+
+    faction->setId(3);
+    EXPECT_EQ(galaxyFactions->getFaction(3), faction);
+    EXPECT_EQ(galaxyFactions->getFaction(1), nullptr);
+    EXPECT_EQ(galaxyFactions->ownerOf(9), 3);
+    EXPECT_EQ(galaxyFactions->createFaction("Faction4", "Desc4", "#0000FF")->id(), 4);
+}
+
+TEST_F(GalaxyFactionsTest, ChangeListenersSeeEveryEditWithItsPosition) {
+    std::vector<FactionChange> changes;
+    const auto listener = galaxyFactions->addChangeListener(
+        [&changes](const FactionChange& change) { changes.push_back(change); });
+
+    auto first = galaxyFactions->createFaction("First", "Desc1", "#FF0000");
+    auto second = galaxyFactions->createFaction("Second", "Desc2", "#00FF00");
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[1].kind, FactionChange::Kind::Created);
+    EXPECT_EQ(changes[1].position, 1u);
+
+    // A moved system touches both factions; a full modify is a single change
+    changes.clear();
+    first->addSystem(makeSystem(5));
+    second->addSystem(makeSystem(5));
+    galaxyFactions->modifyFaction(second->id(), "Renamed", "Desc2", "#00FF00");
+    ASSERT_EQ(changes.size(), 4u);
+    EXPECT_EQ(changes[1].factionId, first->id());
+    EXPECT_EQ(changes[1].fields, FactionChange::SystemsField);
+    EXPECT_EQ(changes[2].factionId, second->id());
+    EXPECT_EQ(changes[3].kind, FactionChange::Kind::Modified);
+    EXPECT_EQ(changes[3].position, 1u);
+    EXPECT_EQ(changes[3].fields, FactionChange::DetailsField);
+
+    changes.clear();
+    galaxyFactions->deleteFaction(first->id());
+    second->setColor("#0000FF");
+    ASSERT_EQ(changes.size(), 2u);
+    EXPECT_EQ(changes[0].kind, FactionChange::Kind::Removed);
+    EXPECT_EQ(changes[0].position, 0u);
+    EXPECT_EQ(changes[1].position, 0u);
+
+    // Detached factions and removed listeners stay silent
+    changes.clear();
+    first->setName("Gone");
+    galaxyFactions->removeChangeListener(listener);
+    second->setName("Quiet");
+    EXPECT_TRUE(changes.empty());
+}
 }
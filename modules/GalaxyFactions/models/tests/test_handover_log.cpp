@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+#include "ggh/modules/GalaxyFactions/models/HandoverLog.h"
+
+#include <random>
+
+namespace ggh::Galaxy::Factions::models {
+
+namespace {
+using GalaxyCore::models::GalacticDate;
+
+// Replays every event up to the day, the reference the snapshot-backed queries must match
+std::vector<int> naiveOwnersAt(const HandoverLog& log, HandoverLog::DayNumber day) {
+    std::vector<int> owners;
+    for (const auto& event : log.events()) {
+        if (event.day > day) {
+            break;
+        }
+        if (event.system >= owners.size()) {
+            owners.resize(event.system + 1, HandoverLog::NO_FACTION);
+        }
+        owners[event.system] = event.toFaction;
+    }
+    return owners;
+}
+} // namespace
+
+TEST(GalacticDateTest, DayNumbersRoundTripAndOrder) {
+    const GalacticDate date(2401, 5, 15);
+    EXPECT_EQ(GalacticDate::fromDayNumber(date.toDayNumber()), date);
+    EXPECT_LT(GalacticDate(2401, 12, 30).toDayNumber(), GalacticDate(2402, 1, 1).toDayNumber());
+
+    auto next = date;
+    next += 40;
+    EXPECT_EQ(next.toDayNumber(), date.toDayNumber() + 40);
+    EXPECT_EQ(GalacticDate::fromDayNumber(-1), GalacticDate(-1, 12, 30));
+}
+
+TEST(GalacticDateTest, DifferenceMatchesDayNumbers) {
+    const GalacticDate yearEnd(2401, 12, 30);
+    const GalacticDate newYear(2402, 1, 1);
+    EXPECT_EQ(newYear - yearEnd, 1);
+    EXPECT_EQ(newYear - yearEnd, newYear.toDayNumber() - yearEnd.toDayNumber());
+
+    auto later = yearEnd;
+    later += 400;
+    EXPECT_EQ(later - yearEnd, 400);
+    later -= 400;
+    EXPECT_EQ(later, yearEnd);
+}
+
+TEST(HandoverLogTest, RejectsEventsOutOfDateOrder) {
+    HandoverLog log;
+    EXPECT_TRUE(log.append({100, 1, 0, 1, 0, 1}));
+    EXPECT_TRUE(log.append({100, 2, 0, 2, 0, 2}));
+    EXPECT_FALSE(log.append({99, 3, 0, 1, 0, 3}));
+    EXPECT_EQ(log.size(), 2u);
+}
+
+TEST(HandoverLogTest, StateAtDateMatchesFullReplay) {
+    HandoverLog log(64);
+    std::mt19937 rng(21);
+    std::uniform_int_distribution<GalaxyCore::utilities::SystemId> system(1, 300);
+    std::uniform_int_distribution<int> faction(0, 6);
+    HandoverLog::DayNumber day = 0;
+    for (int i = 0; i < 5000; ++i) {
+        day += static_cast<HandoverLog::DayNumber>(rng() % 3);
+        const auto id = system(rng);
+        ASSERT_TRUE(log.append({day, id, log.ownerAt(id, day), faction(rng), 1, i + 1}));
+    }
+
+    std::vector<int> owners;
+    for (HandoverLog::DayNumber query = -1; query <= day + 1; query += 37) {
+        log.ownersAt(query, owners);
+        EXPECT_EQ(owners, naiveOwnersAt(log, query)) << "day " << query;
+        EXPECT_LT(log.lastReplayCount(), log.snapshotInterval());
+
+        for (GalaxyCore::utilities::SystemId id = 1; id <= 300; id += 13) {
+            const int expected = id < owners.size() ? owners[id] : HandoverLog::NO_FACTION;
+            EXPECT_EQ(log.ownerAt(id, query), expected);
+        }
+    }
+    EXPECT_TRUE(std::ranges::equal(log.currentOwners(), naiveOwnersAt(log, day)));
+}
+
+TEST(HandoverLogTest, HistoryAndRecordsRoundTrip) {
+    HandoverLog log;
+    log.append(FactionHandover(1, 2, 5, 0, 1, GalacticDate(2400, 1, 1), "Founded"));
+    log.append(FactionHandover(2, 3, 6, 0, 1, GalacticDate(2400, 2, 1), ""));
+    log.append(FactionHandover(3, 4, 5, 2, 2, GalacticDate(2401, 3, 10), "Annexed"));
+
+    const auto history = log.historyOf(5);
+    ASSERT_EQ(history.size(), 2u);
+    const auto record = log.handover(history.back());
+    EXPECT_EQ(record.factionFromId(), 2);
+    EXPECT_EQ(record.factionToId(), 4);
+    EXPECT_EQ(record.notes(), "Annexed");
+    EXPECT_EQ(record.handoverDate(), GalacticDate(2401, 3, 10));
+    EXPECT_EQ(log.ownerAt(5, GalacticDate(2400, 12, 30).toDayNumber()), 2);
+    EXPECT_TRUE(log.historyOf(99).empty());
+}
+
+TEST(HandoverLogTest, GalaxyFactionsAppliesRecordedHandovers) {
+    GalaxyFactions factions;
+    auto first = factions.createFaction("First", "", "#FF0000");
+    auto second = factions.createFaction("Second", "", "#00FF00");
+    first->addSystem(std::make_shared<System>(std::make_shared<GalaxyCore::models::StarSystemModel>(
+        8, "Theta", GalaxyCore::utilities::CartesianCoordinates<double>(0.0, 0.0))));
+
+    EXPECT_TRUE(factions.recordHandover(
+        FactionHandover(1, second->id(), 8, first->id(), 1, GalacticDate(2400, 1, 1), "")));
+    EXPECT_EQ(factions.ownerOf(8), second->id());
+    EXPECT_TRUE(first->systems().empty());
+    EXPECT_EQ(factions.handovers().size(), 1u);
+
+    EXPECT_FALSE(factions.recordHandover(
+        FactionHandover(2, first->id(), 8, second->id(), 1, GalacticDate(2399, 1, 1), "")));
+    EXPECT_EQ(factions.ownerOf(8), second->id());
+}
+
+TEST(HandoverLogTest, RecordedHandoversJoinTheSystemHistory) {
+    GalaxyFactions factions;
+    auto first = factions.createFaction("First", "", "#FF0000");
+    auto second = factions.createFaction("Second", "", "#00FF00");
+    auto theta = std::make_shared<System>(std::make_shared<GalaxyCore::models::StarSystemModel>(
+        8, "Theta", GalaxyCore::utilities::CartesianCoordinates<double>(0.0, 0.0)));
+    first->addSystem(theta);
+
+    factions.recordHandover(FactionHandover(1, second->id(), 8, first->id(), 1, GalacticDate(2400, 1, 1), "Ceded"));
+    factions.recordHandover(FactionHandover(2, first->id(), 8, second->id(), 1, GalacticDate(2401, 6, 1), "Retaken"));
+    // Rejected as out of order, so it must not reach the system either
+    factions.recordHandover(FactionHandover(3, second->id(), 8, first->id(), 1, GalacticDate(2400, 6, 1), ""));
+
+    const auto history = theta->getHandoverHistory();
+    ASSERT_EQ(history.size(), 2u);
+    EXPECT_EQ(history[0].notes(), "Ceded");
+    EXPECT_EQ(history[1].notes(), "Retaken");
+    EXPECT_EQ(factions.ownerOf(8), first->id());
+}
+
+} // namespace ggh::Galaxy::Factions::models
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyFactions/models/ResourceTypeRegistry.h"
+#include "ggh/modules/GalaxyFactions/models/SystemResourceBonus.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace ggh::Galaxy::Factions::models {
+
+TEST(ResourceTypeRegistryTest, InternsEachDistinctTypeOnce) {
+    ResourceTypeRegistry registry;
+    const auto energy = registry.intern(ResourceType(1, "Energy", "Power output"));
+    const auto metal = registry.intern(ResourceType(2, "Metal", "Ore output"));
+
+    EXPECT_NE(energy, metal);
+    EXPECT_EQ(registry.intern(ResourceType(1, "Energy", "Power output")), energy);
+    EXPECT_EQ(registry.find(ResourceType(2, "Metal", "Ore output")), metal);
+    EXPECT_EQ(registry.find(ResourceType(3, "Food", "")), ResourceTypeRegistry::INVALID_HANDLE);
+
+    // Same id with a different name is a different type, as ResourceType::operator== says
+    EXPECT_NE(registry.intern(ResourceType(1, "Power", "Power output")), energy);
+    EXPECT_EQ(registry.type(metal).name(), "Metal");
+    EXPECT_EQ(registry.typeId(energy), 1);
+}
+
+TEST(ResourceTypeRegistryTest, DefaultTypeHasHandleZero) {
+    ResourceTypeRegistry registry;
+    EXPECT_EQ(registry.find(ResourceType{}), 0);
+    EXPECT_EQ(registry.size(), 1u);
+    EXPECT_EQ(SystemResourceBonus().resourceTypeHandle(), 0);
+}
+
+TEST(ResourceTypeRegistryTest, BonusesHoldHandlesInsteadOfStrings) {
+    static_assert(sizeof(SystemResourceBonus) <= 8);
+
+    const ResourceType energy(7, "Energy", "Power output");
+    const SystemResourceBonus first(energy, 10);
+    const SystemResourceBonus second(energy, 10);
+    EXPECT_EQ(first.resourceTypeHandle(), second.resourceTypeHandle());
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(first.resourceType(), energy);
+    EXPECT_EQ(first.id(), 7);
+}
+
+TEST(ResourceTypeRegistryTest, HandlesOfGroupsTypesSharingAnId) {
+    ResourceTypeRegistry registry;
+    const auto energy = registry.intern(ResourceType(1, "Energy", "Power output"));
+    const auto power = registry.intern(ResourceType(1, "Power", "Power output"));
+    registry.intern(ResourceType(2, "Metal", "Ore output"));
+
+    EXPECT_EQ(registry.handlesOf(1), (std::vector<ResourceTypeRegistry::Handle>{energy, power}));
+    EXPECT_TRUE(registry.handlesOf(3).empty());
+}
+
+TEST(ResourceTypeRegistryTest, UnknownHandlesThrow) {
+    ResourceTypeRegistry registry;
+    EXPECT_THROW(registry.typeId(1), std::out_of_range);
+    EXPECT_THROW(registry.type(1), std::out_of_range);
+}
+
+TEST(ResourceTypeRegistryTest, ReadsByHandleWhileAnotherThreadInterns) {
+    ResourceTypeRegistry registry;
+    const auto first = registry.intern(ResourceType(1, "Energy", "Power output"));
+
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        // Crosses several chunk boundaries
+        for (int id = 2; id < 1000; ++id) {
+            registry.intern(ResourceType(id, "Type " + std::to_string(id), ""));
+        }
+        done = true;
+    });
+    while (!done.load()) {
+        const auto last = static_cast<ResourceTypeRegistry::Handle>(registry.size() - 1);
+        EXPECT_EQ(registry.typeId(first), 1);
+        EXPECT_EQ(registry.type(last).id(), registry.typeId(last));
+    }
+    writer.join();
+    EXPECT_EQ(registry.size(), 1000u);
+}
+
+} // namespace ggh::Galaxy::Factions::models
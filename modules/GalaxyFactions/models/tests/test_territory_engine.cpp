@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyFactions/models/TerritoryEngine.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+
+#include <random>
+
+namespace ggh::Galaxy::Factions::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+// Systems 1..count on a line, one unit apart, joined in order
+LaneGraph makeLine(GalaxyCore::utilities::SystemId count) {
+    LaneGraph graph;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= count; ++id) {
+        graph.addNode(id, Coordinates(static_cast<double>(id), 0.0));
+    }
+    for (GalaxyCore::utilities::SystemId id = 1; id < count; ++id) {
+        graph.addEdge(id, id, id + 1);
+    }
+    return graph;
+}
+
+LaneGraph makeRandomGraph(std::size_t systems, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    LaneGraph graph;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= systems; ++id) {
+        graph.addNode(id, Coordinates(coordinate(rng), coordinate(rng)));
+    }
+    std::uniform_int_distribution<GalaxyCore::utilities::SystemId> pick(1, static_cast<GalaxyCore::utilities::SystemId>(systems));
+    GalaxyCore::utilities::LaneId lane = 1;
+    while (lane <= systems * 3) {
+        const auto from = pick(rng);
+        const auto to = pick(rng);
+        if (from != to && GalaxyCore::utilities::calculateDistance(graph.position(graph.indexOf(from)),
+                                                                   graph.position(graph.indexOf(to))) < 90.0) {
+            graph.addEdge(lane++, from, to);
+        }
+    }
+    return graph;
+}
+} // namespace
+
+TEST(TerritoryEngineTest, SystemsGoToTheNearestFaction) {
+    const auto graph = makeLine(9);
+    TerritoryEngine engine;
+    engine.bind(graph);
+    engine.setHolder(1, 3);
+    engine.setHolder(9, 2);
+
+    EXPECT_EQ(engine.ownerOf(1), 3);
+    EXPECT_EQ(engine.ownerOf(4), 3);
+    EXPECT_EQ(engine.ownerOf(6), 2);
+    // System 5 is four lanes from both; the lower faction id wins the tie
+    EXPECT_EQ(engine.ownerOf(5), 2);
+    EXPECT_DOUBLE_EQ(engine.distanceOf(5), 4.0);
+    EXPECT_EQ(engine.holderOf(5), TerritoryEngine::NO_FACTION);
+    EXPECT_EQ(engine.owners().size(), graph.nodeCount());
+}
+
+TEST(TerritoryEngineTest, ReachLimitsInfluence) {
+    const auto graph = makeLine(10);
+    TerritoryEngine engine;
+    engine.bind(graph);
+    engine.setReach(1, 2.0);
+    engine.setHolder(1, 1);
+
+    EXPECT_EQ(engine.ownerOf(3), 1);
+    EXPECT_EQ(engine.ownerOf(4), TerritoryEngine::NO_FACTION);
+    EXPECT_TRUE(std::isinf(engine.distanceOf(4)));
+
+    // Widening the reach recomputes
+    engine.setReach(1, 5.0);
+    EXPECT_EQ(engine.ownerOf(6), 1);
+    EXPECT_EQ(engine.ownerOf(7), TerritoryEngine::NO_FACTION);
+}
+
+TEST(TerritoryEngineTest, ForeignTerritoryBlocksInfluence) {
+    // Faction 1 claims 2 and 3 first; faction 2 cannot pass through them to reach system 4
+    const auto graph = makeLine(4);
+    TerritoryEngine engine;
+    engine.bind(graph);
+    engine.setReach(1, 2.0);
+    engine.setHolder(2, 1);
+    engine.setHolder(1, 2);
+
+    EXPECT_EQ(engine.ownerOf(1), 2);
+    EXPECT_EQ(engine.ownerOf(3), 1);
+    EXPECT_EQ(engine.ownerOf(4), 1);
+
+    engine.setReach(1, 1.0);
+    EXPECT_EQ(engine.ownerOf(4), TerritoryEngine::NO_FACTION);
+}
+
+TEST(TerritoryEngineTest, ReleasingASystemHandsItToItsNeighbours) {
+    const auto graph = makeLine(5);
+    TerritoryEngine engine;
+    engine.bind(graph);
+    engine.setHolder(1, 1);
+    engine.setHolder(3, 2);
+    EXPECT_EQ(engine.ownerOf(3), 2);
+    EXPECT_EQ(engine.ownerOf(5), 2);
+
+    engine.setHolder(3, TerritoryEngine::NO_FACTION);
+    for (GalaxyCore::utilities::SystemId id = 1; id <= 5; ++id) {
+        EXPECT_EQ(engine.ownerOf(id), 1) << id;
+    }
+    EXPECT_FALSE(engine.setHolder(99, 1));
+}
+
+TEST(TerritoryEngineTest, IncrementalUpdatesMatchFullRecompute) {
+    const auto graph = makeRandomGraph(3000, 3);
+    TerritoryEngine incremental;
+    incremental.bind(graph);
+    for (int faction = 1; faction <= 6; ++faction) {
+        incremental.setReach(faction, 150.0 + 60.0 * faction);
+    }
+
+    std::mt19937 rng(21);
+    std::uniform_int_distribution<GalaxyCore::utilities::SystemId> pickSystem(1, 3000);
+    std::uniform_int_distribution<int> pickFaction(0, 6);
+    for (int step = 0; step < 40; ++step) {
+        incremental.setHolder(pickSystem(rng), 1 + step % 6);
+    }
+    incremental.compute();
+    const std::size_t fullSize = incremental.lastUpdateSize();
+
+    std::size_t repairedTotal = 0;
+    for (int step = 0; step < 200; ++step) {
+        incremental.setHolder(pickSystem(rng), pickFaction(rng));
+        repairedTotal += incremental.lastUpdateSize();
+    }
+
+    TerritoryEngine full = incremental;
+    full.compute();
+    const auto expected = full.owners();
+    const auto actual = incremental.owners();
+    ASSERT_EQ(actual.size(), expected.size());
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        const auto system = graph.systemId(node);
+        ASSERT_EQ(actual[node], expected[node]) << "system " << system;
+        if (expected[node] != TerritoryEngine::NO_FACTION) {
+            ASSERT_NEAR(incremental.distanceOf(system), full.distanceOf(system), 1e-9);
+        }
+    }
+    // A single change should touch a small region, not the whole galaxy
+    EXPECT_LT(repairedTotal / 200, fullSize / 4);
+}
+
+TEST(TerritoryEngineTest, GraphChangesFallBackToFullRecompute) {
+    auto graph = makeLine(6);
+    TerritoryEngine engine;
+    engine.bind(graph);
+    engine.setHolder(1, 1);
+    EXPECT_TRUE(engine.isValidFor(graph));
+    EXPECT_EQ(engine.ownerOf(6), 1);
+
+    graph.removeEdge(3);
+    EXPECT_FALSE(engine.isValidFor(graph));
+    engine.setHolder(6, 2);
+    EXPECT_TRUE(engine.isValidFor(graph));
+    EXPECT_EQ(engine.ownerOf(3), 1);
+    EXPECT_EQ(engine.ownerOf(4), 2);
+}
+
+TEST(TerritoryEngineTest, AssignTakesHoldersFromFactions) {
+    const auto graph = makeLine(7);
+    GalaxyFactions factions;
+    auto west = factions.createFaction("West", "", "#ff0000");
+    auto east = factions.createFaction("East", "", "#0000ff");
+    west->addSystem(std::make_shared<System>(
+        std::make_shared<GalaxyCore::models::StarSystemModel>(1, "Alpha", Coordinates(1.0, 0.0))));
+    east->addSystem(std::make_shared<System>(
+        std::make_shared<GalaxyCore::models::StarSystemModel>(7, "Omega", Coordinates(7.0, 0.0))));
+
+    TerritoryEngine engine;
+    engine.bind(graph);
+    engine.assign(factions);
+    EXPECT_EQ(engine.holderOf(1), west->id());
+    EXPECT_EQ(engine.ownerOf(3), west->id());
+    EXPECT_EQ(engine.ownerOf(5), east->id());
+    EXPECT_EQ(engine.ownerOf(4), std::min(west->id(), east->id()));
+}
+
+} // namespace ggh::Galaxy::Factions::models
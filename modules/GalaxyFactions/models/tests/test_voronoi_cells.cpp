@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyFactions/models/VoronoiCells.h"
+
+#include <algorithm>
+#include <random>
+
+namespace ggh::Galaxy::Factions::models {
+
+namespace {
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+double polygonArea(const VoronoiCell& cell) {
+    double twiceArea = 0.0;
+    for (std::size_t i = 0; i < cell.vertices.size(); ++i) {
+        const auto& a = cell.vertices[i];
+        const auto& b = cell.vertices[(i + 1) % cell.vertices.size()];
+        twiceArea += a.x * b.y - b.x * a.y;
+    }
+    return std::abs(twiceArea) * 0.5;
+}
+
+std::vector<Coordinates> makeRandomSites(std::size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    std::vector<Coordinates> sites;
+    for (std::size_t i = 0; i < count; ++i) {
+        sites.emplace_back(coordinate(rng), coordinate(rng));
+    }
+    return sites;
+}
+} // namespace
+
+TEST(VoronoiCellsTest, TwoSitesSplitTheBoundsInHalf) {
+    const std::vector<Coordinates> sites{Coordinates(25.0, 50.0), Coordinates(75.0, 50.0)};
+    VoronoiCells cells;
+    cells.setBounds(0.0, 0.0, 100.0, 100.0);
+    cells.setSites(sites);
+    EXPECT_EQ(cells.update().size(), 2u);
+
+    EXPECT_DOUBLE_EQ(polygonArea(cells.cell(0)), 5000.0);
+    EXPECT_DOUBLE_EQ(polygonArea(cells.cell(1)), 5000.0);
+    EXPECT_EQ(cells.neighbours(0), (std::vector<VoronoiCells::Index>{1}));
+    EXPECT_EQ(cells.neighbours(1), (std::vector<VoronoiCells::Index>{0}));
+    for (const auto& vertex : cells.cell(0).vertices) {
+        EXPECT_LE(vertex.x, 50.0 + 1e-12);
+    }
+}
+
+TEST(VoronoiCellsTest, RandomCellsTileTheBoundsAndHoldTheNearestPoints) {
+    const auto sites = makeRandomSites(2000, 8);
+    VoronoiCells cells;
+    cells.setBounds(0.0, 0.0, 1000.0, 1000.0);
+    cells.setSites(sites);
+    cells.update();
+
+    double totalArea = 0.0;
+    for (VoronoiCells::Index i = 0; i < cells.size(); ++i) {
+        totalArea += polygonArea(cells.cell(i));
+        // Adjacency is symmetric
+        for (const auto neighbour : cells.neighbours(i)) {
+            const auto back = cells.neighbours(neighbour);
+            EXPECT_NE(std::find(back.begin(), back.end(), i), back.end()) << i << " / " << neighbour;
+        }
+    }
+    EXPECT_NEAR(totalArea, 1000.0 * 1000.0, 1e-3);
+
+    // Every cell vertex is at least as close to its own site as to any other
+    for (VoronoiCells::Index i = 0; i < cells.size(); i += 37) {
+        for (const auto& vertex : cells.cell(i).vertices) {
+            const double own = GalaxyCore::utilities::calculateDistance(vertex, sites[i]);
+            for (const auto& other : sites) {
+                ASSERT_LE(own, GalaxyCore::utilities::calculateDistance(vertex, other) + 1e-6);
+            }
+        }
+    }
+}
+
+TEST(VoronoiCellsTest, MovingASiteOnlyRecomputesItsNeighbourhood) {
+    auto sites = makeRandomSites(3000, 12);
+    VoronoiCells incremental;
+    incremental.setBounds(0.0, 0.0, 1000.0, 1000.0);
+    incremental.setSites(sites);
+    incremental.update();
+
+    sites[100] = Coordinates(sites[100].x + 12.0, sites[100].y - 7.0);
+    sites[2500] = Coordinates(500.0, 500.0);
+    incremental.moveSite(100, sites[100]);
+    incremental.moveSite(2500, sites[2500]);
+    const auto updated = incremental.update();
+    EXPECT_LT(updated.size(), 40u);
+    EXPECT_TRUE(std::binary_search(updated.begin(), updated.end(), 100u));
+    EXPECT_TRUE(std::binary_search(updated.begin(), updated.end(), 2500u));
+
+    VoronoiCells full;
+    full.setBounds(0.0, 0.0, 1000.0, 1000.0);
+    full.setSites(sites);
+    full.update();
+    for (VoronoiCells::Index i = 0; i < full.size(); ++i) {
+        ASSERT_EQ(incremental.neighbours(i), full.neighbours(i)) << "cell " << i;
+        ASSERT_NEAR(polygonArea(incremental.cell(i)), polygonArea(full.cell(i)), 1e-6) << "cell " << i;
+    }
+}
+
+TEST(VoronoiCellsTest, SingleSiteOwnsTheWholeBounds) {
+    const std::vector<Coordinates> sites{Coordinates(10.0, 10.0)};
+    VoronoiCells cells;
+    cells.setBounds(0.0, 0.0, 40.0, 20.0);
+    cells.setSites(sites);
+    cells.update();
+    EXPECT_DOUBLE_EQ(polygonArea(cells.cell(0)), 800.0);
+    EXPECT_TRUE(cells.neighbours(0).empty());
+    EXPECT_TRUE(cells.update().empty());
+}
+
+} // namespace ggh::Galaxy::Factions::models
@@ -0,0 +1,75 @@
+/**
+ * @file FactionBordersItem.h
+ * @brief Scene graph item drawing faction territory regions and borders
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#ifndef GGH_MODULES_GALAXYFACTIONS_VIEWMODELS_FACTION_BORDERS_ITEM_H
+#define GGH_MODULES_GALAXYFACTIONS_VIEWMODELS_FACTION_BORDERS_ITEM_H
+
+#include <QPointer>
+#include <QQuickItem>
+#include <QtQml/qqmlregistration.h>
+#include <cstdint>
+
+#include "ggh/modules/GalaxyFactions/viewmodels/GalaxyFactionsViewModel.h"
+
+namespace ggh::Galaxy::Factions::viewmodels
+{
+
+/**
+ * @class FactionBordersItem
+ * @brief Draws every faction's region and outline as one batched scene graph node
+ *
+ * Owned Voronoi cells are filled with their faction's color and border segments are drawn as
+ * thin quads on the inner side of each edge, all in a single vertex-colored triangle geometry.
+ * The item works in galaxy coordinates; place it at (0, 0) inside the transformed galaxy
+ * container. The geometry is rebuilt only when the border cache revision changes.
+ */
+class FactionBordersItem : public QQuickItem
+{
+    Q_OBJECT
+    Q_PROPERTY(GalaxyFactionsViewModel* factions READ factions WRITE setFactions NOTIFY factionsChanged)
+    Q_PROPERTY(qreal fillOpacity READ fillOpacity WRITE setFillOpacity NOTIFY fillOpacityChanged)
+    Q_PROPERTY(qreal borderWidth READ borderWidth WRITE setBorderWidth NOTIFY borderWidthChanged)
+    QML_ELEMENT
+public:
+    /**
+     * @brief Default constructor
+     * @param parent Parent item
+     */
+    explicit FactionBordersItem(QQuickItem* parent = nullptr);
+
+    GalaxyFactionsViewModel* factions() const;
+    void setFactions(GalaxyFactionsViewModel* factions);
+    qreal fillOpacity() const;
+    void setFillOpacity(qreal opacity);
+    qreal borderWidth() const;
+    void setBorderWidth(qreal width);
+
+signals:
+    void factionsChanged();
+    void fillOpacityChanged();
+    void borderWidthChanged();
+
+protected:
+    QSGNode* updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData* data) override;
+
+private:
+    /**
+     * @brief Schedules a geometry rebuild on the next frame
+     */
+    void invalidateGeometry();
+
+    QPointer<GalaxyFactionsViewModel> m_factions; ///< Source of territory and border geometry
+    QMetaObject::Connection m_territoryConnection; ///< territoryChanged connection to the current source
+    qreal m_fillOpacity; ///< Alpha of region fills
+    qreal m_borderWidth; ///< Border thickness in galaxy units
+    bool m_geometryDirty; ///< Style or source changed since the last upload
+    std::uint64_t m_uploadedRevision; ///< Border cache revision in the current geometry
+};
+
+} // namespace ggh::Galaxy::Factions::viewmodels
+
+#endif // !GGH_MODULES_GALAXYFACTIONS_VIEWMODELS_FACTION_BORDERS_ITEM_H
@@ -9,12 +9,14 @@
 #define GGH_MODULES_GALAXYFACTIONS_VIEWMODELS_FACTION_LIST_MODEL_H
 
 #include <QAbstractListModel>
+#include <QHash>
 #include <QList>
 #include <QtQml/qqmlregistration.h>
 
 #include <memory>
 
 #include "ggh/modules/GalaxyFactions/models/Faction.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
 
 namespace ggh::Galaxy::Factions::viewmodels
 {
@@ -25,6 +27,11 @@ namespace ggh::Galaxy::Factions::viewmodels
  * 
  * This class provides a QAbstractListModel implementation for displaying
  * and managing a list of factions in QML views.
+ *
+ * Rows hold the Faction instances themselves, never copies. Once bound to a GalaxyFactions
+ * registry the rows mirror its factions() in order and follow its change notifications:
+ * creating or deleting a faction inserts or removes one row, and an edit emits dataChanged
+ * for that row and only the roles it touched.
  */
 class FactionListModel : public QAbstractListModel
 {
@@ -39,7 +46,8 @@ public:
         IdRole = Qt::UserRole + 1,  ///< Faction ID role
         NameRole,                   ///< Faction name role
         DescriptionRole,            ///< Faction description role
-        ColorRole                   ///< Faction color role
+        ColorRole,                  ///< Faction color role
+        SystemCountRole             ///< Number of systems held
     };
     Q_ENUM(Roles)
 
@@ -49,6 +57,11 @@ public:
      */
     explicit FactionListModel(QObject* parent = nullptr);
 
+    /**
+     * @brief Destructor; stops listening to the bound registry
+     */
+    ~FactionListModel() override;
+
     /**
      * @brief Gets the number of rows in the model
      * @param parent The parent model index (unused for list models)
@@ -71,28 +84,54 @@ public:
     QHash<int, QByteArray> roleNames() const override;
 
     /**
-     * @brief Adds a faction to the model
-     * @param faction The faction to add
+     * @brief Binds the rows to a registry's factions and follows its changes
+     * @param galaxyFactions The registry, or nullptr to unbind and clear the rows
      */
-    void addFaction(const ggh::Galaxy::Factions::models::Faction& faction);
+    void setGalaxyFactions(std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> galaxyFactions);
+
+    /**
+     * @brief Gets the bound registry
+     * @return The registry, or nullptr when unbound
+     */
+    std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> galaxyFactions() const;
+
+    /**
+     * @brief Adds a faction to the model without copying it
+     * @param faction The faction to add; ignored if null
+     *
+     * Ignored by a bound model, which gains rows when the registry creates factions.
+     */
+    void addFaction(std::shared_ptr<ggh::Galaxy::Factions::models::Faction> faction);
     
     /**
-     * @brief Clears all factions from the model
+     * @brief Clears all factions from the model and unbinds it
      */
     void clearFactions();
     
     /**
      * @brief Removes a faction by ID
      * @param id The ID of the faction to remove
+     *
+     * A bound model deletes the faction from its registry, which then removes the row.
      */
     void removeFaction(int id);
     
     /**
      * @brief Gets a faction by ID
      * @param id The faction ID
-     * @return The faction with the specified ID
+     * @return The faction instance shown in the model, or nullptr if not found
+     */
+    std::shared_ptr<ggh::Galaxy::Factions::models::Faction> getFaction(int id) const;
+
+    /**
+     * @brief Gets the row showing a faction, from an id index kept with the rows
+     * @param id The faction ID
+     * @return The row, or -1 if not found
+     *
+     * Unbound factions are indexed by the id they had when added; renumber factions through
+     * a bound registry so the index follows.
      */
-    ggh::Galaxy::Factions::models::Faction getFaction(int id) const;
+    int rowOf(int id) const;
     
     /**
      * @brief Gets all factions
@@ -101,13 +140,42 @@ public:
     QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>> getFactions() const;
     
     /**
-     * @brief Sets the factions list
+     * @brief Sets the factions list, unbinding from any registry
      * @param factions The new list of factions
      */
     void setFactions(const QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>>& factions);
 
+    /**
+     * @brief Adds the bytes owned by this model to a memory report
+     * @param report The report to accumulate into
+     *
+     * Factions shared with GalaxyFactions are counted there; only factions held
+     * exclusively by this model are attributed to it.
+     */
+    void reportMemory(ggh::GalaxyCore::utilities::MemoryReport& report) const;
+
  private:
+    /**
+     * @brief Applies one registry change to the affected row
+     * @param change The change the registry just made
+     */
+    void onFactionChanged(const ggh::Galaxy::Factions::models::FactionChange& change);
+
+    /**
+     * @brief Stops listening to the bound registry and forgets it
+     */
+    void unbind();
+
+    /**
+     * @brief Points the id index at rows from a given row on, after rows there moved
+     * @param first The first row whose position may have changed
+     */
+    void indexRows(int first);
+
     QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>> m_factions; ///< List of factions
+    QHash<int, int> m_rowsById; ///< Faction id to its row in m_factions
+    std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> m_galaxyFactions; ///< Bound registry, if any
+    ggh::Galaxy::Factions::models::GalaxyFactions::ListenerId m_listenerId{0}; ///< Token of the registry listener
 
 };
 
@@ -8,12 +8,18 @@
 #ifndef GGH_MODULES_GALAXYFACTIONS_VIEWMODELS_GALAXY_FACTIONS_VIEW_MODEL_H
 #define GGH_MODULES_GALAXYFACTIONS_VIEWMODELS_GALAXY_FACTIONS_VIEW_MODEL_H
 
+#include <QColor>
 #include <QObject>
 #include <QQmlListProperty>
+#include <QVariantList>
 #include <QtQml/qqmlregistration.h>
 #include <memory>
+#include <vector>
 
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+#include "ggh/modules/GalaxyFactions/models/FactionBorderCache.h"
 #include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+#include "ggh/modules/GalaxyFactions/models/TerritoryEngine.h"
 #include "ggh/modules/GalaxyFactions/viewmodels/FactionViewModel.h"
 #include "ggh/modules/GalaxyFactions/viewmodels/FactionListModel.h"
 
@@ -26,12 +32,17 @@ namespace ggh::Galaxy::Factions::viewmodels
  * 
  * This class serves as the main entry point for the Galaxy Factions module,
  * providing access to faction data and operations for QML views.
+ *
+ * Once a galaxy is set it also keeps the factions' territory (every system assigned to the
+ * nearest faction along lanes) and the Voronoi border geometry FactionBordersItem draws.
+ * Founding or removing a faction updates both incrementally.
  */
 class GalaxyFactionsViewModel : public QObject
 {
     Q_OBJECT
     Q_PROPERTY(FactionListModel* factionListModel READ factionListModel NOTIFY factionListModelChanged)
     Q_PROPERTY(int selectedFactionId READ selectedFactionId WRITE setSelectedFactionId NOTIFY selectedFactionIdChanged)
+    Q_PROPERTY(bool showBorders READ showBorders WRITE setShowBorders NOTIFY showBordersChanged)
     QML_ELEMENT
 public:
     /**
@@ -58,6 +69,58 @@ public:
      */
     void setSelectedFactionId(int factionId);
 
+    bool showBorders() const;
+    void setShowBorders(bool show);
+
+    /**
+     * @brief Sets the galaxy whose systems the territory and borders are computed over
+     * @param galaxy The galaxy model
+     */
+    void setGalaxy(std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> galaxy);
+
+    /**
+     * @brief Recomputes the territory from every faction's systems and updates the borders
+     */
+    Q_INVOKABLE void refreshTerritory();
+
+    /**
+     * @brief Catches territory and borders up with edits to the galaxy's systems, lanes or positions
+     *
+     * Does nothing while the lane graph is unchanged; a moved system only redoes the cells around it.
+     */
+    Q_INVOKABLE void syncWithGalaxy();
+
+    /**
+     * @brief Gets the faction owning a system, held or claimed
+     * @return The faction ID, or 0 if no faction reaches the system
+     */
+    Q_INVOKABLE int territoryOwner(quint32 systemId) const;
+
+    /**
+     * @brief Gets the cached border geometry, indexed like the galaxy's lane graph nodes
+     */
+    const ggh::Galaxy::Factions::models::FactionBorderCache& borderCache() const;
+
+    /**
+     * @brief Gets a faction's display color
+     * @return The color, or an invalid QColor for unknown factions
+     */
+    QColor factionColor(int factionId) const;
+
+    /**
+     * @brief Gets a faction's resource bonus totals, one entry per resource type
+     * @param factionId The faction ID
+     * @return Maps with resourceTypeId, resourceType, bonusAmount and bonusCount keys
+     */
+    Q_INVOKABLE QVariantList resourceTotals(int factionId) const;
+
+    /**
+     * @brief Gets the number of resource bonuses across a faction's systems
+     * @param factionId The faction ID
+     * @return The bonus count, or 0 for unknown factions
+     */
+    Q_INVOKABLE int resourceBonusCount(int factionId) const;
+
     /**
      * @brief Initializes the view model with galaxy factions data
      * @param galaxyFactions The galaxy factions model
@@ -124,8 +187,39 @@ signals:
      */
     void selectedFactionIdChanged(int factionId);
 
+    /**
+     * @brief Signal emitted when territory ownership or border geometry changes
+     */
+    void territoryChanged();
+
+    /**
+     * @brief Signal emitted when border display is toggled
+     */
+    void showBordersChanged();
+
 private:
+    /**
+     * @brief Re-binds the territory and border cache if the galaxy's lane graph changed
+     * @return False if there is no galaxy
+     */
+    bool ensureTerritoryBound();
+
+    /**
+     * @brief Moves the border cache's sites to the graph's positions, or replaces them if systems changed
+     */
+    void syncBorderSites(const ggh::GalaxyCore::models::LaneGraph& graph);
+
+    /**
+     * @brief Pushes territory owners into the border cache and signals if anything changed
+     */
+    void updateBorders();
+
     std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> m_galaxyFactions; ///< The galaxy factions model
+    std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> m_galaxy; ///< Galaxy the territory is computed over
+    ggh::Galaxy::Factions::models::TerritoryEngine m_territory; ///< Nearest-faction assignment over the lane graph
+    ggh::Galaxy::Factions::models::FactionBorderCache m_borders; ///< Per-cell border geometry
+    std::vector<ggh::GalaxyCore::utilities::SystemId> m_borderSystemIds; ///< System behind each border cell
+    bool m_showBorders; ///< Whether views should draw faction borders
     FactionListModel* m_factionListModel; ///< The faction list model
     int m_selectedFactionId; ///< The currently selected faction ID
 };
@@ -0,0 +1,187 @@
+/**
+ * @file FactionBordersItem.cpp
+ * @brief Implementation of FactionBordersItem
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#include "ggh/modules/GalaxyFactions/viewmodels/FactionBordersItem.h"
+
+#include <QHash>
+#include <QSGGeometryNode>
+#include <QSGVertexColorMaterial>
+#include <cmath>
+
+namespace ggh::Galaxy::Factions::viewmodels {
+
+namespace {
+using ggh::Galaxy::Factions::models::FactionBorderCache;
+
+// Premultiplied RGBA, as QSGVertexColorMaterial expects
+struct VertexColor {
+    uchar r;
+    uchar g;
+    uchar b;
+    uchar a;
+};
+
+VertexColor premultiplied(const QColor& color, qreal opacity)
+{
+    const qreal alpha = color.alphaF() * opacity;
+    return {static_cast<uchar>(std::lround(color.redF() * alpha * 255.0)),
+            static_cast<uchar>(std::lround(color.greenF() * alpha * 255.0)),
+            static_cast<uchar>(std::lround(color.blueF() * alpha * 255.0)),
+            static_cast<uchar>(std::lround(alpha * 255.0))};
+}
+
+void setVertex(QSGGeometry::ColoredPoint2D*& vertex, double x, double y, const VertexColor& color)
+{
+    vertex->set(static_cast<float>(x), static_cast<float>(y), color.r, color.g, color.b, color.a);
+    ++vertex;
+}
+} // namespace
+
+FactionBordersItem::FactionBordersItem(QQuickItem* parent)
+    : QQuickItem(parent)
+    , m_fillOpacity(0.18)
+    , m_borderWidth(2.0)
+    , m_geometryDirty(true)
+    , m_uploadedRevision(0)
+{
+    setFlag(ItemHasContents, true);
+}
+
+GalaxyFactionsViewModel* FactionBordersItem::factions() const
+{
+    return m_factions;
+}
+
+void FactionBordersItem::setFactions(GalaxyFactionsViewModel* factions)
+{
+    if (m_factions == factions) {
+        return;
+    }
+    disconnect(m_territoryConnection);
+    m_factions = factions;
+    if (m_factions) {
+        m_territoryConnection = connect(m_factions, &GalaxyFactionsViewModel::territoryChanged,
+                                        this, &QQuickItem::update);
+    }
+    invalidateGeometry();
+    emit factionsChanged();
+}
+
+qreal FactionBordersItem::fillOpacity() const
+{
+    return m_fillOpacity;
+}
+
+void FactionBordersItem::setFillOpacity(qreal opacity)
+{
+    if (!qFuzzyCompare(m_fillOpacity, opacity)) {
+        m_fillOpacity = opacity;
+        invalidateGeometry();
+        emit fillOpacityChanged();
+    }
+}
+
+qreal FactionBordersItem::borderWidth() const
+{
+    return m_borderWidth;
+}
+
+void FactionBordersItem::setBorderWidth(qreal width)
+{
+    if (!qFuzzyCompare(m_borderWidth, width)) {
+        m_borderWidth = width;
+        invalidateGeometry();
+        emit borderWidthChanged();
+    }
+}
+
+void FactionBordersItem::invalidateGeometry()
+{
+    m_geometryDirty = true;
+    update();
+}
+
+QSGNode* FactionBordersItem::updatePaintNode(QSGNode* oldNode, UpdatePaintNodeData*)
+{
+    auto* node = static_cast<QSGGeometryNode*>(oldNode);
+    if (!m_factions) {
+        delete node;
+        return nullptr;
+    }
+    const auto& cache = m_factions->borderCache();
+    if (node && !m_geometryDirty && m_uploadedRevision == cache.revision()) {
+        return node;
+    }
+
+    if (!node) {
+        node = new QSGGeometryNode;
+        auto* geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(), 0);
+        geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+        node->setGeometry(geometry);
+        node->setFlag(QSGNode::OwnsGeometry);
+        node->setMaterial(new QSGVertexColorMaterial);
+        node->setFlag(QSGNode::OwnsMaterial);
+    }
+
+    // Fan-triangulated fills for owned cells, then two triangles per border segment
+    const auto& cells = cache.cells();
+    int vertexCount = 0;
+    for (FactionBorderCache::Index site = 0; site < cells.size(); ++site) {
+        if (cache.owner(site) != FactionBorderCache::NO_FACTION && cells.cell(site).vertices.size() >= 3) {
+            vertexCount += 3 * static_cast<int>(cells.cell(site).vertices.size() - 2);
+            vertexCount += 6 * static_cast<int>(cache.borders(site).size());
+        }
+    }
+
+    auto* geometry = node->geometry();
+    geometry->allocate(vertexCount);
+    auto* vertex = geometry->vertexDataAsColoredPoint2D();
+    QHash<int, std::pair<VertexColor, VertexColor>> colors;   // faction -> (fill, border)
+    for (FactionBorderCache::Index site = 0; site < cells.size(); ++site) {
+        const int owner = cache.owner(site);
+        const auto& polygon = cells.cell(site).vertices;
+        if (owner == FactionBorderCache::NO_FACTION || polygon.size() < 3) {
+            continue;
+        }
+        auto color = colors.find(owner);
+        if (color == colors.end()) {
+            QColor factionColor = m_factions->factionColor(owner);
+            if (!factionColor.isValid()) {
+                factionColor = Qt::gray;
+            }
+            color = colors.insert(owner, {premultiplied(factionColor, m_fillOpacity), premultiplied(factionColor, 0.9)});
+        }
+
+        for (std::size_t i = 1; i + 1 < polygon.size(); ++i) {
+            setVertex(vertex, polygon[0].x, polygon[0].y, color->first);
+            setVertex(vertex, polygon[i].x, polygon[i].y, color->first);
+            setVertex(vertex, polygon[i + 1].x, polygon[i + 1].y, color->first);
+        }
+        // Cells wind with the interior on the left of each edge, so the quad grows inward and
+        // the borders of two neighbouring factions sit side by side instead of overlapping
+        for (const auto& segment : cache.borders(site)) {
+            const double dx = segment.to.x - segment.from.x;
+            const double dy = segment.to.y - segment.from.y;
+            const double length = std::hypot(dx, dy);
+            const double nx = length > 0.0 ? -dy / length * m_borderWidth : 0.0;
+            const double ny = length > 0.0 ? dx / length * m_borderWidth : 0.0;
+            setVertex(vertex, segment.from.x, segment.from.y, color->second);
+            setVertex(vertex, segment.to.x, segment.to.y, color->second);
+            setVertex(vertex, segment.to.x + nx, segment.to.y + ny, color->second);
+            setVertex(vertex, segment.from.x, segment.from.y, color->second);
+            setVertex(vertex, segment.to.x + nx, segment.to.y + ny, color->second);
+            setVertex(vertex, segment.from.x + nx, segment.from.y + ny, color->second);
+        }
+    }
+
+    m_uploadedRevision = cache.revision();
+    m_geometryDirty = false;
+    node->markDirty(QSGNode::DirtyGeometry);
+    return node;
+}
+
+} // namespace ggh::Galaxy::Factions::viewmodels
@@ -14,6 +14,11 @@ FactionListModel::FactionListModel(QObject* parent)
 {
 }
 
+FactionListModel::~FactionListModel()
+{
+    unbind();
+}
+
 int FactionListModel::rowCount(const QModelIndex& parent) const
 {
     Q_UNUSED(parent)
@@ -40,6 +45,8 @@ QVariant FactionListModel::data(const QModelIndex& index, int role) const
         return QString::fromStdString(faction->description());
     case ColorRole:
         return QString::fromStdString(faction->color());
+    case SystemCountRole:
+        return static_cast<int>(faction->systems().size());
     default:
         return QVariant();
     }
@@ -52,44 +59,78 @@ QHash<int, QByteArray> FactionListModel::roleNames() const
     roles[NameRole] = "name";
     roles[DescriptionRole] = "description";
     roles[ColorRole] = "color";
+    roles[SystemCountRole] = "systemCount";
     return roles;
 }
 
-void FactionListModel::addFaction(const ggh::Galaxy::Factions::models::Faction& faction)
+void FactionListModel::setGalaxyFactions(std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> galaxyFactions)
+{
+    beginResetModel();
+    unbind();
+    m_factions.clear();
+    m_rowsById.clear();
+    m_galaxyFactions = std::move(galaxyFactions);
+    if (m_galaxyFactions) {
+        const auto& factions = m_galaxyFactions->factions();
+        m_factions = QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>>(factions.begin(), factions.end());
+        indexRows(0);
+        m_listenerId = m_galaxyFactions->addChangeListener(
+            [this](const ggh::Galaxy::Factions::models::FactionChange& change) { onFactionChanged(change); });
+    }
+    endResetModel();
+}
+
+std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> FactionListModel::galaxyFactions() const
 {
+    return m_galaxyFactions;
+}
+
+void FactionListModel::addFaction(std::shared_ptr<ggh::Galaxy::Factions::models::Faction> faction)
+{
+    if (!faction || m_galaxyFactions) {
+        return;
+    }
     beginInsertRows(QModelIndex(), m_factions.size(), m_factions.size());
-    m_factions.append(std::make_shared<ggh::Galaxy::Factions::models::Faction>(faction));
+    m_factions.append(std::move(faction));
+    indexRows(static_cast<int>(m_factions.size()) - 1);
     endInsertRows();
 }
 
 void FactionListModel::clearFactions()
 {
     beginResetModel();
+    unbind();
     m_factions.clear();
+    m_rowsById.clear();
     endResetModel();
 }
 
 void FactionListModel::removeFaction(int id)
 {
-    for (int i = 0; i < m_factions.size(); ++i) {
-        if (m_factions[i] && m_factions[i]->id() == id) {
-            beginRemoveRows(QModelIndex(), i, i);
-            m_factions.removeAt(i);
-            endRemoveRows();
-            break;
-        }
+    if (m_galaxyFactions) {
+        // The registry's notification removes the row
+        m_galaxyFactions->deleteFaction(id);
+        return;
+    }
+    const int row = rowOf(id);
+    if (row >= 0) {
+        beginRemoveRows(QModelIndex(), row, row);
+        m_factions.removeAt(row);
+        m_rowsById.remove(id);
+        indexRows(row);
+        endRemoveRows();
     }
 }
 
-ggh::Galaxy::Factions::models::Faction FactionListModel::getFaction(int id) const
+std::shared_ptr<ggh::Galaxy::Factions::models::Faction> FactionListModel::getFaction(int id) const
 {
-    for (const auto& faction : m_factions) {
-        if (faction && faction->id() == id) {
-            return *faction;
-        }
-    }
-    // Return default faction if not found
-    return ggh::Galaxy::Factions::models::Faction(-1, "", "", "");
+    const int row = rowOf(id);
+    return row >= 0 ? m_factions.at(row) : nullptr;
+}
+
+int FactionListModel::rowOf(int id) const
+{
+    return m_rowsById.value(id, -1);
 }
 
 QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>> FactionListModel::getFactions() const
@@ -100,8 +141,91 @@ QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>> FactionListModel:
 void FactionListModel::setFactions(const QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>>& factions)
 {
     beginResetModel();
+    unbind();
     m_factions = factions;
+    m_rowsById.clear();
+    indexRows(0);
     endResetModel();
 }
 
+void FactionListModel::onFactionChanged(const ggh::Galaxy::Factions::models::FactionChange& change)
+{
+    using ggh::Galaxy::Factions::models::FactionChange;
+
+    const auto row = static_cast<int>(change.position);
+    switch (change.kind) {
+    case FactionChange::Kind::Created:
+        beginInsertRows(QModelIndex(), row, row);
+        m_factions.insert(row, m_galaxyFactions->factions()[change.position]);
+        indexRows(row);
+        endInsertRows();
+        break;
+    case FactionChange::Kind::Removed:
+        if (row < m_factions.size()) {
+            beginRemoveRows(QModelIndex(), row, row);
+            m_factions.removeAt(row);
+            m_rowsById.remove(change.factionId);
+            indexRows(row);
+            endRemoveRows();
+        }
+        break;
+    case FactionChange::Kind::Modified: {
+        if (row >= m_factions.size()) {
+            break;
+        }
+        QList<int> roles;
+        if (change.fields & FactionChange::IdField) {
+            // The change carries only the new id, so index every row again
+            m_rowsById.clear();
+            indexRows(0);
+            roles << IdRole;
+        }
+        if (change.fields & FactionChange::DetailsField) {
+            roles << NameRole << DescriptionRole << ColorRole;
+        }
+        if (change.fields & FactionChange::SystemsField) {
+            roles << SystemCountRole;
+        }
+        const auto changed = index(row, 0);
+        emit dataChanged(changed, changed, roles);
+        break;
+    }
+    }
+}
+
+void FactionListModel::unbind()
+{
+    if (m_galaxyFactions) {
+        m_galaxyFactions->removeChangeListener(m_listenerId);
+        m_galaxyFactions.reset();
+        m_listenerId = 0;
+    }
+}
+
+void FactionListModel::indexRows(int first)
+{
+    for (int row = first; row < m_factions.size(); ++row) {
+        if (m_factions[row]) {
+            m_rowsById.insert(m_factions[row]->id(), row);
+        }
+    }
+}
+
+void FactionListModel::reportMemory(ggh::GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace ggh::GalaxyCore::utilities;
+
+    std::size_t bytes = sizeof(FactionListModel)
+                      + static_cast<std::size_t>(m_factions.capacity()) * sizeof(decltype(m_factions)::value_type)
+                      + static_cast<std::size_t>(m_rowsById.capacity()) * 2 * sizeof(int);
+    for (const auto& faction : m_factions) {
+        if (faction && faction.use_count() == 1) {
+            MemoryReport copy;
+            faction->reportMemory(copy);
+            bytes += copy.totalBytes() + memory::SHARED_CONTROL_BLOCK_BYTES;
+        }
+    }
+    report.add("listModels", bytes, 1);
+}
+
 } // namespace ggh::Galaxy::Factions::viewmodels
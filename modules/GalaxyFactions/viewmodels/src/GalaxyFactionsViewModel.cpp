@@ -13,6 +13,7 @@
 #include <QTextStream>
 #include <QDebug>
 #include <QUrl>
+#include <QVariantMap>
 
 namespace ggh::Galaxy::Factions::viewmodels {
 
@@ -21,6 +22,7 @@ GalaxyFactionsViewModel::GalaxyFactionsViewModel(QObject* parent)
     , m_galaxyFactions(nullptr)
     , m_factionListModel(new FactionListModel(this))
     , m_selectedFactionId(Commons::INVALID_ID)
+    , m_showBorders(false)
 {
 }
 
@@ -42,23 +44,162 @@ void GalaxyFactionsViewModel::setSelectedFactionId(int factionId)
     }
 }
 
+bool GalaxyFactionsViewModel::showBorders() const
+{
+    return m_showBorders;
+}
+
+void GalaxyFactionsViewModel::setShowBorders(bool show)
+{
+    if (m_showBorders != show) {
+        m_showBorders = show;
+        emit showBordersChanged();
+    }
+}
+
+void GalaxyFactionsViewModel::setGalaxy(std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> galaxy)
+{
+    m_galaxy = std::move(galaxy);
+    m_territory = {};
+    m_borders = {};
+    m_borderSystemIds.clear();
+    refreshTerritory();
+}
+
+void GalaxyFactionsViewModel::refreshTerritory()
+{
+    if (!m_galaxyFactions || !m_galaxy) {
+        return;
+    }
+    // Rebinding a stale engine already re-reads every holder from the registry
+    if (m_territory.isValidFor(m_galaxy->laneGraph())) {
+        m_territory.assign(*m_galaxyFactions);
+    } else {
+        ensureTerritoryBound();
+    }
+    updateBorders();
+}
+
+void GalaxyFactionsViewModel::syncWithGalaxy()
+{
+    if (m_galaxy && !m_territory.isValidFor(m_galaxy->laneGraph()) && ensureTerritoryBound()) {
+        updateBorders();
+    }
+}
+
+int GalaxyFactionsViewModel::territoryOwner(quint32 systemId) const
+{
+    return m_territory.ownerOf(systemId);
+}
+
+const ggh::Galaxy::Factions::models::FactionBorderCache& GalaxyFactionsViewModel::borderCache() const
+{
+    return m_borders;
+}
+
+QColor GalaxyFactionsViewModel::factionColor(int factionId) const
+{
+    const auto faction = m_galaxyFactions ? m_galaxyFactions->getFaction(factionId) : nullptr;
+    return faction ? QColor(QString::fromStdString(faction->color())) : QColor();
+}
+
+QVariantList GalaxyFactionsViewModel::resourceTotals(int factionId) const
+{
+    QVariantList totals;
+    const auto faction = m_galaxyFactions ? m_galaxyFactions->getFaction(factionId) : nullptr;
+    if (!faction) {
+        return totals;
+    }
+    const auto& registry = ggh::Galaxy::Factions::models::ResourceTypeRegistry::global();
+    const auto amounts = faction->resourceAmounts();
+    const auto counts = faction->resourceBonusCounts();
+    for (std::size_t handle = 0; handle < amounts.size(); ++handle) {
+        if (counts[handle] == 0) {
+            continue;
+        }
+        const auto& type = registry.type(static_cast<ggh::Galaxy::Factions::models::ResourceTypeRegistry::Handle>(handle));
+        totals.append(QVariantMap{
+            {"resourceTypeId", type.id()},
+            {"resourceType", QString::fromStdString(type.name())},
+            {"bonusAmount", amounts[handle]},
+            {"bonusCount", static_cast<int>(counts[handle])}
+        });
+    }
+    return totals;
+}
+
+int GalaxyFactionsViewModel::resourceBonusCount(int factionId) const
+{
+    const auto faction = m_galaxyFactions ? m_galaxyFactions->getFaction(factionId) : nullptr;
+    return faction ? static_cast<int>(faction->resourceBonusCount()) : 0;
+}
+
+bool GalaxyFactionsViewModel::ensureTerritoryBound()
+{
+    if (!m_galaxy) {
+        return false;
+    }
+    const auto& graph = m_galaxy->laneGraph();
+    if (m_territory.isValidFor(graph)) {
+        return true;
+    }
+
+    // Binding forgets the holders, so every faction's systems are taken from the registry again
+    m_territory.bind(graph);
+    if (m_galaxyFactions) {
+        m_territory.assign(*m_galaxyFactions);
+    }
+    syncBorderSites(graph);
+    return true;
+}
+
+void GalaxyFactionsViewModel::syncBorderSites(const ggh::GalaxyCore::models::LaneGraph& graph)
+{
+    using NodeIndex = ggh::GalaxyCore::models::LaneGraph::NodeIndex;
+
+    bool sameSystems = m_borderSystemIds.size() == graph.nodeCount();
+    for (NodeIndex node = 0; sameSystems && node < graph.nodeCount(); ++node) {
+        sameSystems = m_borderSystemIds[node] == graph.systemId(node);
+    }
+    if (sameSystems) {
+        // Only positions or lanes changed; moved systems redo their own cell and the cells around it
+        for (NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+            if (m_borders.cells().site(node) != graph.position(node)) {
+                m_borders.moveSite(node, graph.position(node));
+            }
+        }
+        return;
+    }
+
+    // Cell i of the border cache belongs to lane graph node i, so owners() maps across directly
+    std::vector<ggh::GalaxyCore::utilities::CartesianCoordinates<double>> sites;
+    sites.reserve(graph.nodeCount());
+    m_borderSystemIds.clear();
+    m_borderSystemIds.reserve(graph.nodeCount());
+    for (NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        sites.push_back(graph.position(node));
+        m_borderSystemIds.push_back(graph.systemId(node));
+    }
+    m_borders.setBounds(0.0, 0.0, m_galaxy->getWidth(), m_galaxy->getHeight());
+    m_borders.setSites(sites);
+}
+
+void GalaxyFactionsViewModel::updateBorders()
+{
+    m_borders.setOwners(m_territory.owners());
+    if (m_borders.update()) {
+        emit territoryChanged();
+    }
+}
+
 void GalaxyFactionsViewModel::initialize(std::shared_ptr<ggh::Galaxy::Factions::models::GalaxyFactions> galaxyFactions)
 {
     m_galaxyFactions = galaxyFactions;
     
     if (m_galaxyFactions) {
-        // Clear existing factions
-        m_factionListModel->clearFactions();
-        
-        // Load all factions from the model
-        auto factions = m_galaxyFactions->getAllFactions();
-        QList<std::shared_ptr<ggh::Galaxy::Factions::models::Faction>> qFactions;
-        
-        for (const auto& faction : factions) {
-            qFactions.append(faction);
-        }
-        
-        m_factionListModel->setFactions(qFactions);
+        // The list shows the registry's own factions and follows its changes from here on
+        m_factionListModel->setGalaxyFactions(m_galaxyFactions);
+        refreshTerritory();
     }
 }
 
@@ -68,15 +209,12 @@ void GalaxyFactionsViewModel::addFaction(const QString& name, const QString& des
         return;
     }
     
-    auto faction = m_galaxyFactions->createFaction(
+    // The bound list model inserts the row when the registry reports the new faction
+    m_galaxyFactions->createFaction(
         name.toStdString(),
         description.toStdString(), 
         color.toStdString()
     );
-    
-    if (faction) {
-        m_factionListModel->addFaction(*faction);
-    }
 }
 
 int GalaxyFactionsViewModel::addFactionWithHomeworld(const QString& name, const QString& description, const QString& color, quint32 homeworldSystemId, QObject* starSystemModel)
@@ -133,10 +271,11 @@ int GalaxyFactionsViewModel::addFactionWithHomeworld(const QString& name, const
     } else {
         qDebug() << "WARNING: starSystemModel parameter is null";
     }
-    
-    // Add the faction to the list model
-    qDebug() << "Adding faction to list model...";
-    m_factionListModel->addFaction(*faction);
+
+    // Only the region around the new homeworld changes hands
+    if (ensureTerritoryBound() && m_territory.setHolder(homeworldSystemId, faction->id())) {
+        updateBorders();
+    }
     
     // Emit the signal with all the faction details
     qDebug() << "Emitting factionCreated signal with ID:" << faction->id();
@@ -152,8 +291,17 @@ void GalaxyFactionsViewModel::removeFaction(int factionId)
         return;
     }
     
+    const auto faction = m_galaxyFactions->getFaction(factionId);
+    const auto systems = faction ? faction->systems() : std::vector<std::shared_ptr<ggh::Galaxy::Factions::models::System>>{};
     if (m_galaxyFactions->deleteFaction(factionId)) {
-        m_factionListModel->removeFaction(factionId);
+        // Release the faction's systems one at a time so only its former territory is redone
+        if (ensureTerritoryBound()) {
+            for (const auto& system : systems) {
+                m_territory.setHolder(static_cast<ggh::GalaxyCore::utilities::SystemId>(system->id()),
+                                      ggh::Galaxy::Factions::models::TerritoryEngine::NO_FACTION);
+            }
+            updateBorders();
+        }
         
         // If the deleted faction was selected, clear the selection
         if (m_selectedFactionId == factionId) {
@@ -10,6 +10,7 @@
 
 #include "ggh/modules/GalaxyFactions/viewmodels/FactionListModel.h"
 #include "ggh/modules/GalaxyFactions/models/Faction.h"
+#include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
 
 class TestFactionListModel : public QObject
 {
@@ -55,6 +56,11 @@ private slots:
      * @brief Test setting factions list
      */
     void testSetFactions();
+
+    /**
+     * @brief Test following a bound registry row by row
+     */
+    void testBoundToGalaxyFactions();
 };
 
 void TestFactionListModel::testDefaultConstructor()
@@ -70,7 +76,7 @@ void TestFactionListModel::testAddFaction()
     ggh::Galaxy::Factions::viewmodels::FactionListModel model;
     
     // Test adding a faction
-    ggh::Galaxy::Factions::models::Faction faction(1, "Test Faction", "Test Description", "#FF0000");
+    auto faction = std::make_shared<ggh::Galaxy::Factions::models::Faction>(1, "Test Faction", "Test Description", "#FF0000");
     
     QSignalSpy rowsInsertedSpy(&model, &QAbstractItemModel::rowsInserted);
     model.addFaction(faction);
@@ -79,7 +85,7 @@ void TestFactionListModel::testAddFaction()
     QCOMPARE(rowsInsertedSpy.count(), 1);
     
     // Add another faction
-    ggh::Galaxy::Factions::models::Faction faction2(2, "Test Faction 2", "Test Description 2", "#00FF00");
+    auto faction2 = std::make_shared<ggh::Galaxy::Factions::models::Faction>(2, "Test Faction 2", "Test Description 2", "#00FF00");
     model.addFaction(faction2);
     
     QCOMPARE(model.rowCount(), 2);
@@ -91,8 +97,8 @@ void TestFactionListModel::testRemoveFaction()
     ggh::Galaxy::Factions::viewmodels::FactionListModel model;
     
     // Add some factions first
-    ggh::Galaxy::Factions::models::Faction faction1(1, "Faction 1", "Description 1", "#FF0000");
-    ggh::Galaxy::Factions::models::Faction faction2(2, "Faction 2", "Description 2", "#00FF00");
+    auto faction1 = std::make_shared<ggh::Galaxy::Factions::models::Faction>(1, "Faction 1", "Description 1", "#FF0000");
+    auto faction2 = std::make_shared<ggh::Galaxy::Factions::models::Faction>(2, "Faction 2", "Description 2", "#00FF00");
     model.addFaction(faction1);
     model.addFaction(faction2);
     
@@ -115,8 +121,8 @@ void TestFactionListModel::testClearFactions()
     ggh::Galaxy::Factions::viewmodels::FactionListModel model;
     
     // Add some factions
-    ggh::Galaxy::Factions::models::Faction faction1(1, "Faction 1", "Description 1", "#FF0000");
-    ggh::Galaxy::Factions::models::Faction faction2(2, "Faction 2", "Description 2", "#00FF00");
+    auto faction1 = std::make_shared<ggh::Galaxy::Factions::models::Faction>(1, "Faction 1", "Description 1", "#FF0000");
+    auto faction2 = std::make_shared<ggh::Galaxy::Factions::models::Faction>(2, "Faction 2", "Description 2", "#00FF00");
     model.addFaction(faction1);
     model.addFaction(faction2);
     
@@ -136,7 +142,7 @@ void TestFactionListModel::testDataAccess()
     ggh::Galaxy::Factions::viewmodels::FactionListModel model;
     
     // Add a faction
-    ggh::Galaxy::Factions::models::Faction faction(42, "Test Faction", "Test Description", "#FF0000");
+    auto faction = std::make_shared<ggh::Galaxy::Factions::models::Faction>(42, "Test Faction", "Test Description", "#FF0000");
     model.addFaction(faction);
     
     QModelIndex index = model.index(0, 0);
@@ -176,19 +182,18 @@ void TestFactionListModel::testGetFaction()
     ggh::Galaxy::Factions::viewmodels::FactionListModel model;
     
     // Add a faction
-    ggh::Galaxy::Factions::models::Faction faction(123, "Get Test Faction", "Get Test Description", "#0000FF");
+    auto faction = std::make_shared<ggh::Galaxy::Factions::models::Faction>(123, "Get Test Faction", "Get Test Description", "#0000FF");
     model.addFaction(faction);
     
-    // Test getting existing faction
+    // Test getting existing faction: the model hands back the instance it was given
     auto retrievedFaction = model.getFaction(123);
-    QCOMPARE(retrievedFaction.id(), 123);
-    QCOMPARE(retrievedFaction.name(), "Get Test Faction");
-    QCOMPARE(retrievedFaction.description(), "Get Test Description");
-    QCOMPARE(retrievedFaction.color(), "#0000FF");
+    QVERIFY(retrievedFaction == faction);
+    QCOMPARE(retrievedFaction->name(), "Get Test Faction");
+    QCOMPARE(model.rowOf(123), 0);
     
     // Test getting non-existent faction
-    auto nonExistentFaction = model.getFaction(999);
-    QCOMPARE(nonExistentFaction.id(), -1);
+    QVERIFY(model.getFaction(999) == nullptr);
+    QCOMPARE(model.rowOf(999), -1);
 }
 
 void TestFactionListModel::testSetFactions()
@@ -213,6 +218,58 @@ void TestFactionListModel::testSetFactions()
     QCOMPARE(retrievedFactions[0]->id(), 1);
     QCOMPARE(retrievedFactions[1]->id(), 2);
     QCOMPARE(retrievedFactions[2]->id(), 3);
+    QCOMPARE(model.rowOf(3), 2);
+
+    // Rows after a removed one move up in the id index
+    model.removeFaction(1);
+    QCOMPARE(model.rowOf(1), -1);
+    QCOMPARE(model.rowOf(2), 0);
+    QCOMPARE(model.rowOf(3), 1);
+}
+
+void TestFactionListModel::testBoundToGalaxyFactions()
+{
+    auto galaxyFactions = std::make_shared<ggh::Galaxy::Factions::models::GalaxyFactions>();
+    auto first = galaxyFactions->createFaction("Faction 1", "Desc 1", "#FF0000");
+    auto second = galaxyFactions->createFaction("Faction 2", "Desc 2", "#00FF00");
+
+    ggh::Galaxy::Factions::viewmodels::FactionListModel model;
+    model.setGalaxyFactions(galaxyFactions);
+    QCOMPARE(model.rowCount(), 2);
+    QVERIFY(model.getFaction(second->id()) == second);
+
+    // Edits reach only the affected row, with the roles they touched
+    QSignalSpy dataChangedSpy(&model, &QAbstractItemModel::dataChanged);
+    second->setName("Renamed");
+    QCOMPARE(dataChangedSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.at(0).at(0).value<QModelIndex>().row(), 1);
+    QCOMPARE(dataChangedSpy.at(0).at(1).value<QModelIndex>().row(), 1);
+    QVERIFY(dataChangedSpy.at(0).at(2).value<QList<int>>().contains(ggh::Galaxy::Factions::viewmodels::FactionListModel::NameRole));
+    QCOMPARE(model.data(model.index(1, 0), ggh::Galaxy::Factions::viewmodels::FactionListModel::NameRole).toString(), QString("Renamed"));
+
+    QSignalSpy rowsInsertedSpy(&model, &QAbstractItemModel::rowsInserted);
+    QSignalSpy rowsRemovedSpy(&model, &QAbstractItemModel::rowsRemoved);
+    QSignalSpy modelResetSpy(&model, &QAbstractItemModel::modelReset);
+    galaxyFactions->createFaction("Faction 3", "Desc 3", "#0000FF");
+    galaxyFactions->deleteFaction(first->id());
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(rowsRemovedSpy.count(), 1);
+    QCOMPARE(modelResetSpy.count(), 0);
+    QCOMPARE(model.rowCount(), 2);
+    QCOMPARE(model.data(model.index(0, 0), ggh::Galaxy::Factions::viewmodels::FactionListModel::IdRole).toInt(), second->id());
+    QCOMPARE(model.rowOf(first->id()), -1);
+    QCOMPARE(model.rowOf(second->id()), 0);
+
+    // Renumbering through the registry moves the row to the new id
+    const int oldId = second->id();
+    second->setId(100);
+    QCOMPARE(model.rowOf(oldId), -1);
+    QCOMPARE(model.rowOf(100), 0);
+
+    // Removing through the model deletes from the registry
+    model.removeFaction(second->id());
+    QVERIFY(galaxyFactions->getFaction(second->id()) == nullptr);
+    QCOMPARE(model.rowCount(), 1);
 }
 
 QTEST_MAIN(TestFactionListModel)
@@ -10,6 +10,7 @@
 
 #include "ggh/modules/GalaxyFactions/viewmodels/GalaxyFactionsViewModel.h"
 #include "ggh/modules/GalaxyFactions/models/GalaxyFactions.h"
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 #include "ggh/modules/GalaxyCore/viewmodels/StarSystemViewModel.h"
 
@@ -52,6 +53,21 @@ private slots:
      * @brief Test faction list model access
      */
     void testFactionListModel();
+
+    /**
+     * @brief Test territory and border updates as factions are founded and removed
+     */
+    void testTerritoryFollowsFactions();
+
+    /**
+     * @brief Test that founding a faction after a lane edit keeps the other factions' territory
+     */
+    void testTerritorySurvivesGraphEdits();
+
+    /**
+     * @brief Test that moving a system redoes only the border cells around it
+     */
+    void testMovedSystemRedoesNearbyCells();
 };
 
 void TestGalaxyFactionsViewModel::testDefaultConstructor()
@@ -237,5 +253,130 @@ void TestGalaxyFactionsViewModel::testFactionListModel()
     QCOMPARE(firstCall, secondCall);
 }
 
+void TestGalaxyFactionsViewModel::testTerritoryFollowsFactions()
+{
+    using ggh::GalaxyCore::utilities::CartesianCoordinates;
+
+    // Five systems in a row, joined in order
+    auto galaxy = std::make_shared<ggh::GalaxyCore::models::GalaxyModel>(600, 200);
+    for (ggh::GalaxyCore::utilities::SystemId id = 1; id <= 5; ++id) {
+        galaxy->addStarSystem(id, "System " + std::to_string(id), CartesianCoordinates<double>(100.0 * id, 100.0));
+    }
+    for (ggh::GalaxyCore::utilities::SystemId id = 1; id < 5; ++id) {
+        galaxy->addTravelLane(id, id, id + 1);
+    }
+
+    ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel viewModel;
+    viewModel.initialize(std::make_shared<ggh::Galaxy::Factions::models::GalaxyFactions>());
+    viewModel.setGalaxy(galaxy);
+    QSignalSpy territorySpy(&viewModel, &ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel::territoryChanged);
+
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel west(galaxy->getStarSystem(1));
+    const int westId = viewModel.addFactionWithHomeworld("West", "", "#ff0000", 1, &west);
+    QCOMPARE(territorySpy.count(), 1);
+    for (quint32 id = 1; id <= 5; ++id) {
+        QCOMPARE(viewModel.territoryOwner(id), westId);
+    }
+
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel east(galaxy->getStarSystem(5));
+    const int eastId = viewModel.addFactionWithHomeworld("East", "", "#0000ff", 5, &east);
+    QCOMPARE(viewModel.territoryOwner(2), westId);
+    QCOMPARE(viewModel.territoryOwner(4), eastId);
+    // System 3 is equally far from both; the lower faction id wins
+    QCOMPARE(viewModel.territoryOwner(3), std::min(westId, eastId));
+
+    // Cells follow node order (systems 1..5 as vertical strips); inner edges between cells of
+    // one faction are merged away, leaving the galaxy bounds and the West/East frontier
+    const auto& borders = viewModel.borderCache();
+    QCOMPARE(borders.owners().size(), std::size_t{5});
+    QCOMPARE(borders.borders(1).size(), std::size_t{2});
+    QCOMPARE(borders.borders(2).size(), std::size_t{3});
+    QCOMPARE(viewModel.factionColor(eastId), QColor("#0000ff"));
+
+    viewModel.removeFaction(westId);
+    for (quint32 id = 1; id <= 5; ++id) {
+        QCOMPARE(viewModel.territoryOwner(id), eastId);
+    }
+    QCOMPARE(territorySpy.count(), 3);
+}
+
+void TestGalaxyFactionsViewModel::testTerritorySurvivesGraphEdits()
+{
+    using ggh::GalaxyCore::utilities::CartesianCoordinates;
+
+    // Five systems in a row, joined in order
+    auto galaxy = std::make_shared<ggh::GalaxyCore::models::GalaxyModel>(600, 200);
+    for (ggh::GalaxyCore::utilities::SystemId id = 1; id <= 5; ++id) {
+        galaxy->addStarSystem(id, "System " + std::to_string(id), CartesianCoordinates<double>(100.0 * id, 100.0));
+    }
+    for (ggh::GalaxyCore::utilities::SystemId id = 1; id < 5; ++id) {
+        galaxy->addTravelLane(id, id, id + 1);
+    }
+
+    ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel viewModel;
+    viewModel.initialize(std::make_shared<ggh::Galaxy::Factions::models::GalaxyFactions>());
+    viewModel.setGalaxy(galaxy);
+
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel west(galaxy->getStarSystem(1));
+    const int westId = viewModel.addFactionWithHomeworld("West", "", "#ff0000", 1, &west);
+
+    // Any edit bumps the lane graph revision
+    galaxy->removeTravelLane(4);
+
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel east(galaxy->getStarSystem(5));
+    const int eastId = viewModel.addFactionWithHomeworld("East", "", "#0000ff", 5, &east);
+    for (quint32 id = 1; id <= 4; ++id) {
+        QCOMPARE(viewModel.territoryOwner(id), westId);
+    }
+    QCOMPARE(viewModel.territoryOwner(5), eastId);
+    QCOMPARE(viewModel.borderCache().owner(0), westId);
+
+    // Removing a faction after another edit keeps the remaining one
+    galaxy->addTravelLane(4, 4, 5);
+    viewModel.removeFaction(eastId);
+    for (quint32 id = 1; id <= 5; ++id) {
+        QCOMPARE(viewModel.territoryOwner(id), westId);
+    }
+}
+
+void TestGalaxyFactionsViewModel::testMovedSystemRedoesNearbyCells()
+{
+    using ggh::GalaxyCore::utilities::CartesianCoordinates;
+
+    auto galaxy = std::make_shared<ggh::GalaxyCore::models::GalaxyModel>(1000, 200);
+    for (ggh::GalaxyCore::utilities::SystemId id = 1; id <= 9; ++id) {
+        galaxy->addStarSystem(id, "System " + std::to_string(id), CartesianCoordinates<double>(100.0 * id, 100.0));
+    }
+    for (ggh::GalaxyCore::utilities::SystemId id = 1; id < 9; ++id) {
+        galaxy->addTravelLane(id, id, id + 1);
+    }
+
+    ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel viewModel;
+    viewModel.initialize(std::make_shared<ggh::Galaxy::Factions::models::GalaxyFactions>());
+    viewModel.setGalaxy(galaxy);
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel west(galaxy->getStarSystem(1));
+    const int westId = viewModel.addFactionWithHomeworld("West", "", "#ff0000", 1, &west);
+    QSignalSpy territorySpy(&viewModel, &ggh::Galaxy::Factions::viewmodels::GalaxyFactionsViewModel::territoryChanged);
+
+    // Nothing changed, nothing to do
+    viewModel.syncWithGalaxy();
+    QCOMPARE(territorySpy.count(), 0);
+
+    // Nudge the last system the way the property panel does
+    ggh::GalaxyCore::viewmodels::StarSystemViewModel panel(galaxy->getStarSystem(9));
+    panel.setGalaxy(galaxy);
+    panel.setPositionY(120.0);
+    viewModel.syncWithGalaxy();
+
+    QCOMPARE(territorySpy.count(), 1);
+    const auto& borders = viewModel.borderCache();
+    const auto node = galaxy->laneGraph().indexOf(9);
+    QCOMPARE(borders.cells().site(node).y, 120.0);
+    QVERIFY(borders.lastBorderUpdateCount() < borders.owners().size());
+    for (quint32 id = 1; id <= 9; ++id) {
+        QCOMPARE(viewModel.territoryOwner(id), westId);
+    }
+}
+
 QTEST_MAIN(TestGalaxyFactionsViewModel)
 #include "test_galaxy_factions_viewmodel.moc"
@@ -7,6 +7,7 @@
 #include "ggh/modules/GalaxyFactories/AbstractGalaxyFactory.h"
 #include "ggh/modules/GalaxyFactories/Types.h"
 #include "galaxyfactories_global.h"
+#include <cstdint>
 #include <memory>
 #include <random>
 
@@ -45,6 +46,7 @@ private:
     mutable std::uniform_real_distribution<double> m_realDist;
     mutable std::uniform_int_distribution<int> m_intDist;
     GenerationParameters m_params;
+    std::uint64_t m_planetSeedBase{0};   ///< Drawn per galaxy; a system's planet seed mixes in its id
 
     // Generation methods for different galaxy shapes
     void generateSpiralGalaxy(GalaxyModel& galaxy, const GenerationParameters& params);
@@ -61,12 +63,24 @@ private:
     // Generate travel lanes based on existing systems
     void generateTravelLanes(GalaxyModel& galaxy, const GenerationParameters& params);
 
+    // Remove the longer lane of each crossing pair without splitting any cluster
+    void removeCrossingLanes(GalaxyModel& galaxy);
+
+    // Add the shortest lanes that join every isolated cluster into one network
+    void connectComponents(GalaxyModel& galaxy);
+
     // Utility methods
     ggh::GalaxyCore::utilities::CartesianCoordinates<double> generateSpiralPosition(double angle, double radius, double armOffset, 
                                    const GenerationParameters& params);
     StarType generateRandomStarType();
     bool isValidSystemPosition(const GalaxyModel& galaxy, const ggh::GalaxyCore::utilities::CartesianCoordinates<double>& position);
     void connectNearestSystems(GalaxyModel& galaxy, const GenerationParameters& params);
+
+    // Gives a new system its planets, now or deferred to first read when params.lazyPlanets is set;
+    // both give the same planets
+    void populatePlanets(ggh::GalaxyCore::models::StarSystemModel& system, const GenerationParameters& params) const;
+    static void addPlanets(ggh::GalaxyCore::models::StarSystemModel& system, std::uint64_t seed);
+    std::uint64_t drawSeed() const;
 };
 }
 #endif // !GGH_GALAXYGENERATOR_GALAXYGENERATOR_H
@@ -19,6 +19,10 @@ namespace ggh::GalaxyFactories {
         double coreRadius = 0.2;
         double edgeRadius = 0.8;
         int seed = 0; // 0 for random seed
+        bool connectComponents = false; // Join isolated clusters with the shortest extra lanes
+        bool removeCrossings = false; // Drop the longer lane of each crossing pair unless it is needed for connectivity
+        bool lazyPlanets = false; // Generate each system's planets on first read instead of up front
+        bool arenaAllocation = false; // Allocate the galaxy's objects from an arena it owns, freed in bulk
 
         std::string toXml() const {
             // Convert parameters to XML format
@@ -33,6 +37,10 @@ namespace ggh::GalaxyFactories {
                 << "<CoreRadius>" << coreRadius << "</CoreRadius>"
                 << "<EdgeRadius>" << edgeRadius << "</EdgeRadius>"
                 << "<Seed>" << seed << "</Seed>"
+                << "<ConnectComponents>" << (connectComponents ? "true" : "false") << "</ConnectComponents>"
+                << "<RemoveCrossings>" << (removeCrossings ? "true" : "false") << "</RemoveCrossings>"
+                << "<LazyPlanets>" << (lazyPlanets ? "true" : "false") << "</LazyPlanets>"
+                << "<ArenaAllocation>" << (arenaAllocation ? "true" : "false") << "</ArenaAllocation>"
                 << "</GalaxyParameters>";
             return oss.str();
         }
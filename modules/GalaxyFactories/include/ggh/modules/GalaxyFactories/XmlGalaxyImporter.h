@@ -3,6 +3,7 @@
 
 #include "ggh/modules/GalaxyFactories/AbstractGalaxyFactory.h"
 #include "galaxyfactories_global.h"
+#include <cstdint>
 #include <expected>
 #include <memory>
 #include <QString>
@@ -53,19 +54,43 @@ public:
      */
     GenerationParameters getParameters() const;
 
+    /**
+     * @brief Selects the two-stage import: systems up front, each system's planets on first access.
+     *
+     * The first pass records the byte offset of every StarSystem element and skips its planets;
+     * reading a system's planets later seeks to that offset and parses that element alone. The
+     * file must stay unchanged while the galaxy uses it, and a bad planet is reported when the
+     * system is first read instead of failing the import. Files not in UTF-8 are loaded in full.
+     */
+    void setLazyPlanets(bool lazy);
+    bool lazyPlanets() const;
+
+    /**
+     * @brief Builds imported galaxies on a GalaxyArena of their own, released in bulk.
+     */
+    void setArenaAllocation(bool arena);
+    bool arenaAllocation() const;
+
 private:
+    class PlanetIndex;
+
     QString m_filePath; // Path to the XML file
+    bool m_lazyPlanets{false}; // Defer each system's planets to first access
+    bool m_arenaAllocation{false}; // Give each imported galaxy its own arena
 
     /**
      * @brief Parses a StarSystem element using QXmlStreamReader.
      * @param galaxy The GalaxyModel to populate.
      * @param systemMap Map to track systems for travel lane parsing.
      * @param xml The XML stream reader.
+     * @param planetIndex When set, planets are counted and deferred to this index instead of parsed.
+     * @param byteOffset Offset of the StarSystem element in the file, recorded in planetIndex.
      * @return True if parsing was successful, false otherwise.
      */
     bool parseSystemFromStream(GalaxyModel* galaxy, 
                               std::unordered_map<quint32, std::shared_ptr<StarSystemModel>>& systemMap,
-                              QXmlStreamReader& xml);
+                              QXmlStreamReader& xml,
+                              const std::shared_ptr<PlanetIndex>& planetIndex, qint64 byteOffset);
 
     /**
      * @brief Parses a TravelLane element using QXmlStreamReader.
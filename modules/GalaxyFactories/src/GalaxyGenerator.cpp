@@ -1,13 +1,19 @@
 #include "ggh/modules/GalaxyFactories/GalaxyGenerator.h"
 #include <cmath>
 #include <algorithm>
+#include <array>
 #include <chrono>
+#include <limits>
 #include <vector>
 
+#include "ggh/modules/GalaxyAnalysis/models/ComponentBridger.h"
+#include "ggh/modules/GalaxyAnalysis/models/LaneCrossingDetector.h"
 #include "ggh/modules/GalaxyCore/models/PlanetModel.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
 
 using namespace ggh::GalaxyFactories;
 using GalaxyModel = ggh::GalaxyCore::models::GalaxyModel;
+using GalaxyArena = ggh::GalaxyCore::models::GalaxyArena;
 using StarSystemModel = ggh::GalaxyCore::models::StarSystemModel;
 using PlanetModel = ggh::GalaxyCore::models::Planet;
 using CartesianCoordinates = ggh::GalaxyCore::utilities::CartesianCoordinates<double>;
@@ -32,16 +38,32 @@ GenerationParameters GalaxyGenerator::getParameters() const {
 }
 
 std::unique_ptr<GalaxyModel> GalaxyGenerator::generateGalaxy(const GenerationParameters& params) {
-    auto galaxy = std::make_unique<GalaxyModel>(params.width, params.height);
+    GGH_TRACE_SCOPE("GalaxyGenerator::generateGalaxy");
+    auto galaxy = std::make_unique<GalaxyModel>(
+        params.width, params.height, params.arenaAllocation ? std::make_shared<GalaxyArena>() : nullptr);
+    m_planetSeedBase = drawSeed();
     // Note: GalaxyModel doesn't have setShape method, shape is handled by generation algorithm
     
     generateSystems(*galaxy, params);
     generateTravelLanes(*galaxy, params);
+    galaxy->rebuildLaneGraph();
+    galaxy->rebuildNameIndex();
+    if (params.removeCrossings) {
+        removeCrossingLanes(*galaxy);
+    }
+    if (params.connectComponents) {
+        connectComponents(*galaxy);
+    }
+    if (!params.lazyPlanets) {
+        // Building the catalogue reads every system's planets, which would generate them all
+        galaxy->rebuildPlanetCatalogue();
+    }
     
     return galaxy;
 } 
 
 void GalaxyGenerator::generateSystems(GalaxyModel& galaxy, const GenerationParameters& params) {
+    GGH_TRACE_SCOPE("GalaxyGenerator::generateSystems");
     // Note: GalaxyModel doesn't have clear method - it starts empty
     
     switch (params.shape) {
@@ -61,9 +83,40 @@ void GalaxyGenerator::generateSystems(GalaxyModel& galaxy, const GenerationParam
 }
 
 void GalaxyGenerator::generateTravelLanes(GalaxyModel& galaxy, const GenerationParameters& params) {
+    GGH_TRACE_SCOPE("GalaxyGenerator::generateTravelLanes");
     connectNearestSystems(galaxy, params);
 }
 
+void GalaxyGenerator::removeCrossingLanes(GalaxyModel& galaxy) {
+    GGH_TRACE_SCOPE("GalaxyGenerator::removeCrossingLanes");
+    const ggh::Galaxy::Analysis::models::LaneCrossingDetector detector;
+    const auto crossings = detector.find(galaxy.laneGraph());
+    if (crossings.empty()) {
+        return;
+    }
+    // removeTravelLane keeps the lane graph in sync
+    for (const auto laneId : detector.planRemovals(galaxy.laneGraph(), crossings)) {
+        galaxy.removeTravelLane(laneId);
+    }
+}
+
+void GalaxyGenerator::connectComponents(GalaxyModel& galaxy) {
+    GGH_TRACE_SCOPE("GalaxyGenerator::connectComponents");
+    const auto bridges = ggh::Galaxy::Analysis::models::ComponentBridger{}.plan(galaxy.laneGraph());
+    if (bridges.empty()) {
+        return;
+    }
+
+    // New lanes are numbered after the existing ones; addTravelLane keeps the lane graph in sync
+    LaneId laneId = 1;
+    for (const auto& lane : galaxy.getAllTravelLanes()) {
+        laneId = std::max(laneId, lane->getId() + 1);
+    }
+    for (const auto& bridge : bridges) {
+        galaxy.addTravelLane(laneId++, bridge.from, bridge.to);
+    }
+}
+
 void GalaxyGenerator::setSeed(std::uint32_t seed) {
     m_rng.seed(seed == 0 ? std::chrono::steady_clock::now().time_since_epoch().count() : seed);
 }
@@ -115,10 +168,10 @@ void GalaxyGenerator::generateSpiralGalaxy(GalaxyModel& galaxy, const Generation
             if (pos.x >= 0 && pos.x < params.width && pos.y >= 0 && pos.y < params.height) {
                 if (isValidSystemPosition(galaxy, pos) || attempts > static_cast<int>(params.systemCount) * 3) {
                     std::string systemName = "System_" + std::to_string(systemId);
-                    auto system = std::make_shared<StarSystemModel>(systemId++, systemName, pos, generateRandomStarType());
+                    auto system = galaxy.makeStarSystem(systemId++, systemName, pos, generateRandomStarType());
                     system->setSystemSize(generateRandomSystemSize());
-                    generatePlanetsForSystem(system);
-                    galaxy.addStarSystem(std::move(system));
+                    populatePlanets(*system, params);
+                    galaxy.addStarSystem(std::move(system), GalaxyModel::NameIndexing::Deferred);
                     systemsGenerated++;
                 } else {
                     systemInArm--; // Try this position again
@@ -155,10 +208,10 @@ void GalaxyGenerator::generateEllipticalGalaxy(GalaxyModel& galaxy, const Genera
         if (pos.x >= 0 && pos.x < params.width && pos.y >= 0 && pos.y < params.height) {
             if (isValidSystemPosition(galaxy, pos) || attempts > static_cast<int>(params.systemCount) * 5) {
                 std::string systemName = "System_" + std::to_string(systemId);
-                auto system = std::make_shared<StarSystemModel>(systemId++, systemName, pos, generateRandomStarType());
+                auto system = galaxy.makeStarSystem(systemId++, systemName, pos, generateRandomStarType());
                 system->setSystemSize(generateRandomSystemSize());
-                generatePlanetsForSystem(system);
-                galaxy.addStarSystem(std::move(system));
+                populatePlanets(*system, params);
+                galaxy.addStarSystem(std::move(system), GalaxyModel::NameIndexing::Deferred);
                 systemsGenerated++;
             }
         }
@@ -190,10 +243,10 @@ void GalaxyGenerator::generateRingGalaxy(GalaxyModel& galaxy, const GenerationPa
         if (pos.x >= 0 && pos.x < params.width && pos.y >= 0 && pos.y < params.height) {
             if (isValidSystemPosition(galaxy, pos) || attempts > static_cast<int>(params.systemCount) * 5) {
                 std::string systemName = "System_" + std::to_string(systemId);
-                auto system = std::make_shared<StarSystemModel>(systemId++, systemName, pos, generateRandomStarType());
+                auto system = galaxy.makeStarSystem(systemId++, systemName, pos, generateRandomStarType());
                 system->setSystemSize(generateRandomSystemSize());
-                generatePlanetsForSystem(system);
-                galaxy.addStarSystem(std::move(system));
+                populatePlanets(*system, params);
+                galaxy.addStarSystem(std::move(system), GalaxyModel::NameIndexing::Deferred);
                 systemsGenerated++;
             }
         }
@@ -230,10 +283,10 @@ void GalaxyGenerator::generateClusterGalaxy(GalaxyModel& galaxy, const Generatio
                 pos.y >= 0 && pos.y < params.height) {
                 if (isValidSystemPosition(galaxy, pos) || attempts > systemsInThisCluster * 5) {
                     std::string systemName = "System_" + std::to_string(systemId);
-                    auto system = std::make_shared<StarSystemModel>(systemId++, systemName, pos, generateRandomStarType());
+                    auto system = galaxy.makeStarSystem(systemId++, systemName, pos, generateRandomStarType());
                     system->setSystemSize(generateRandomSystemSize());
-                    generatePlanetsForSystem(system);
-                    galaxy.addStarSystem(std::move(system));
+                    populatePlanets(*system, params);
+                    galaxy.addStarSystem(std::move(system), GalaxyModel::NameIndexing::Deferred);
                     systemsGenerated++;
                     totalSystemsGenerated++;
                 }
@@ -325,37 +378,75 @@ ggh::GalaxyCore::utilities::SystemSize GalaxyGenerator::generateRandomSystemSize
     else return ggh::GalaxyCore::utilities::SystemSize::Huge;                    // 5%
 }
 
-ggh::GalaxyCore::utilities::PlanetType GalaxyGenerator::generateRandomPlanetType() const {
-    int rand = m_intDist(m_rng);
-    
-    if (rand < 35) return ggh::GalaxyCore::utilities::PlanetType::Rocky;        // 35%
-    else if (rand < 50) return ggh::GalaxyCore::utilities::PlanetType::Desert;   // 15%
-    else if (rand < 65) return ggh::GalaxyCore::utilities::PlanetType::Ocean;    // 15%
-    else if (rand < 75) return ggh::GalaxyCore::utilities::PlanetType::Frozen;   // 10%
-    else if (rand < 85) return ggh::GalaxyCore::utilities::PlanetType::GasGiant; // 10%
-    else if (rand < 92) return ggh::GalaxyCore::utilities::PlanetType::IceGiant; // 7%
-    else if (rand < 97) return ggh::GalaxyCore::utilities::PlanetType::Volcanic; // 5%
-    else return ggh::GalaxyCore::utilities::PlanetType::Toxic;                   // 3%
+namespace {
+using PlanetType = ggh::GalaxyCore::utilities::PlanetType;
+using SystemSize = ggh::GalaxyCore::utilities::SystemSize;
+
+// splitmix64; each system gets its own stream, and seeding one is a single word where std::mt19937
+// fills 624
+class PlanetEngine {
+public:
+    using result_type = std::uint64_t;
+
+    explicit PlanetEngine(std::uint64_t seed) : m_state(seed) {}
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    result_type operator()() {
+        auto value = (m_state += 0x9e3779b97f4a7c15ULL);
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+        return value ^ (value >> 31);
+    }
+
+private:
+    std::uint64_t m_state;
+};
+
+std::uint64_t mix(std::uint64_t value) {
+    return PlanetEngine(value)();
 }
 
-std::string GalaxyGenerator::generatePlanetName(int planetIndex, const std::string& systemName) const {
-    // Generate Roman numeral suffixes for planets
-    const std::vector<std::string> romanNumerals = {"I", "II", "III", "IV", "V", "VI", "VII", "VIII", "IX", "X"};
-    
-    if (planetIndex < romanNumerals.size()) {
+// The same draws as the generator's m_realDist and m_intDist, on a system's own stream
+struct PlanetDice {
+    explicit PlanetDice(std::uint64_t seed) : engine(seed) {}
+
+    double real() { return realDist(engine); }
+    int integer() { return intDist(engine); }
+
+    PlanetEngine engine;
+    std::uniform_real_distribution<double> realDist{0.0, 1.0};
+    std::uniform_int_distribution<int> intDist{0, 100};
+};
+
+PlanetType planetTypeFromRoll(int roll) {
+    if (roll < 35) return PlanetType::Rocky;        // 35%
+    else if (roll < 50) return PlanetType::Desert;   // 15%
+    else if (roll < 65) return PlanetType::Ocean;    // 15%
+    else if (roll < 75) return PlanetType::Frozen;   // 10%
+    else if (roll < 85) return PlanetType::GasGiant; // 10%
+    else if (roll < 92) return PlanetType::IceGiant; // 7%
+    else if (roll < 97) return PlanetType::Volcanic; // 5%
+    else return PlanetType::Toxic;                   // 3%
+}
+
+std::string planetName(int planetIndex, const std::string& systemName) {
+    // Roman numeral suffixes for the first ten planets
+    static const std::array<const char*, 10> romanNumerals = {"I", "II", "III", "IV", "V", "VI", "VII", "VIII", "IX", "X"};
+
+    if (planetIndex < static_cast<int>(romanNumerals.size())) {
         return systemName + " " + romanNumerals[planetIndex];
     }
     return systemName + " " + std::to_string(planetIndex + 1);
 }
 
-void GalaxyGenerator::generatePlanetsForSystem(std::shared_ptr<ggh::GalaxyCore::models::StarSystemModel> system) const {
-    using SystemSize = ggh::GalaxyCore::utilities::SystemSize;
-    
-    // Determine number of planets based on system size
+// Always the first draw of a system's stream, so the count is known without rolling the planets
+int rollPlanetCount(PlanetDice& dice, SystemSize size) {
     int basePlanetCount = 0;
     int maxVariation = 0;
-    
-    switch (system->getSystemSize()) {
+
+    switch (size) {
         case SystemSize::Small:
             basePlanetCount = 1;
             maxVariation = 2; // 1-3 planets
@@ -373,62 +464,69 @@ void GalaxyGenerator::generatePlanetsForSystem(std::shared_ptr<ggh::GalaxyCore::
             maxVariation = 5; // 7-12 planets
             break;
     }
-    
-    int planetCount = basePlanetCount + (m_intDist(m_rng) % (maxVariation + 1));
-    
+
+    return basePlanetCount + (dice.integer() % (maxVariation + 1));
+}
+
+// Rolls a system's planets from its seed and hands each to sink; eager and deferred generation both
+// come through here, which is what keeps them identical
+template <typename Sink>
+void rollPlanets(std::uint64_t seed, SystemSize systemSize, const std::string& systemName, Sink&& sink) {
+    PlanetDice dice(seed);
+    const int planetCount = rollPlanetCount(dice, systemSize);
+
     for (int i = 0; i < planetCount; ++i) {
-        std::string planetName = generatePlanetName(i, system->getName());
-        auto planetType = generateRandomPlanetType();
-        
+        const auto planetType = planetTypeFromRoll(dice.integer());
+
         // Generate planet properties based on type and orbital position
-        double orbitalRadius = 0.3 + (i * 0.7) + (m_realDist(m_rng) * 0.5); // AU
-        double size = 0.3 + m_realDist(m_rng) * 2.0; // Earth sizes
-        double mass = size * size * (0.8 + m_realDist(m_rng) * 0.4); // Rough mass correlation
-        
+        double orbitalRadius = 0.3 + (i * 0.7) + (dice.real() * 0.5); // AU
+        double size = 0.3 + dice.real() * 2.0; // Earth sizes
+        double mass = size * size * (0.8 + dice.real() * 0.4); // Rough mass correlation
+
         // Adjust properties based on planet type
         switch (planetType) {
-            case ggh::GalaxyCore::utilities::PlanetType::GasGiant:
-                size *= 3.0 + m_realDist(m_rng) * 2.0; // Much larger
-                mass *= 10.0 + m_realDist(m_rng) * 50.0; // Much more massive
+            case PlanetType::GasGiant:
+                size *= 3.0 + dice.real() * 2.0; // Much larger
+                mass *= 10.0 + dice.real() * 50.0; // Much more massive
                 break;
-            case ggh::GalaxyCore::utilities::PlanetType::IceGiant:
-                size *= 2.0 + m_realDist(m_rng) * 1.5;
-                mass *= 5.0 + m_realDist(m_rng) * 10.0;
+            case PlanetType::IceGiant:
+                size *= 2.0 + dice.real() * 1.5;
+                mass *= 5.0 + dice.real() * 10.0;
                 break;
             default:
                 // Rocky planets and others keep base size/mass
                 break;
         }
-        
+
         // Generate number of moons (more for larger planets)
         int moons = 0;
         if (size > 1.5) {
-            moons = static_cast<int>(size * (1 + m_realDist(m_rng)));
+            moons = static_cast<int>(size * (1 + dice.real()));
         } else if (size > 0.8) {
-            moons = m_intDist(m_rng) % 3; // 0-2 moons
+            moons = dice.integer() % 3; // 0-2 moons
         }
-        
+
         // Generate temperatures based on orbital distance
         double baseTemp = 300.0 / std::sqrt(orbitalRadius); // Simple inverse square approximation
-        double tempVariation = 20.0 + m_realDist(m_rng) * 40.0;
+        double tempVariation = 20.0 + dice.real() * 40.0;
         double maxTemp = baseTemp + tempVariation;
         double minTemp = baseTemp - tempVariation;
-        
+
         // Adjust for planet type
         switch (planetType) {
-            case ggh::GalaxyCore::utilities::PlanetType::Volcanic:
+            case PlanetType::Volcanic:
                 maxTemp += 100.0;
                 minTemp += 50.0;
                 break;
-            case ggh::GalaxyCore::utilities::PlanetType::Frozen:
+            case PlanetType::Frozen:
                 maxTemp = std::min(maxTemp, 200.0);
                 minTemp = std::min(minTemp, 150.0);
                 break;
-            case ggh::GalaxyCore::utilities::PlanetType::Desert:
+            case PlanetType::Desert:
                 maxTemp += 50.0;
                 minTemp -= 30.0;
                 break;
-            case ggh::GalaxyCore::utilities::PlanetType::Ocean:
+            case PlanetType::Ocean:
                 // More stable temperatures
                 tempVariation *= 0.5;
                 maxTemp = baseTemp + tempVariation;
@@ -437,10 +535,63 @@ void GalaxyGenerator::generatePlanetsForSystem(std::shared_ptr<ggh::GalaxyCore::
             default:
                 break;
         }
-        
-        // Create and add the planet
-        PlanetModel planet(planetName, planetType, size, mass, moons, orbitalRadius, maxTemp, minTemp);
-        system->addPlanet(std::move(planet));
+
+        sink(PlanetModel(planetName(i, systemName), planetType, size, mass, moons, orbitalRadius, maxTemp, minTemp));
+    }
+}
+
+// Rolls deferred planets from the seed each system holds
+class RolledPlanetSource final : public ggh::GalaxyCore::models::PlanetSource {
+public:
+    void generate(std::uint64_t seed, SystemSize size, const std::string& systemName,
+                  std::vector<PlanetModel>& planets) const override {
+        rollPlanets(seed, size, systemName, [&planets](PlanetModel&& planet) { planets.push_back(std::move(planet)); });
+    }
+
+    std::size_t count(std::uint64_t seed, SystemSize size) const override {
+        PlanetDice dice(seed);
+        return static_cast<std::size_t>(rollPlanetCount(dice, size));
     }
+};
+
+// Stateless, so one instance serves every galaxy
+const std::shared_ptr<const ggh::GalaxyCore::models::PlanetSource>& rolledPlanetSource() {
+    static const std::shared_ptr<const ggh::GalaxyCore::models::PlanetSource> source =
+        std::make_shared<RolledPlanetSource>();
+    return source;
+}
+} // namespace
+
+ggh::GalaxyCore::utilities::PlanetType GalaxyGenerator::generateRandomPlanetType() const {
+    return planetTypeFromRoll(m_intDist(m_rng));
+}
+
+std::string GalaxyGenerator::generatePlanetName(int planetIndex, const std::string& systemName) const {
+    return planetName(planetIndex, systemName);
+}
+
+void GalaxyGenerator::generatePlanetsForSystem(std::shared_ptr<ggh::GalaxyCore::models::StarSystemModel> system) const {
+    // A fresh stream per call, seeded from the generator's own
+    addPlanets(*system, mix(drawSeed()));
+}
+
+void GalaxyGenerator::populatePlanets(StarSystemModel& system, const GenerationParameters& params) const {
+    // Keyed by system id, so a system's planets do not depend on when they are generated
+    const auto seed = mix(m_planetSeedBase + system.getId());
+    if (params.lazyPlanets) {
+        system.deferPlanets(rolledPlanetSource(), seed);
+    } else {
+        addPlanets(system, seed);
+    }
+}
+
+std::uint64_t GalaxyGenerator::drawSeed() const {
+    const std::uint64_t high = m_rng();
+    return (high << 32) | m_rng();
+}
+
+void GalaxyGenerator::addPlanets(StarSystemModel& system, std::uint64_t seed) {
+    rollPlanets(seed, system.getSystemSize(), system.getName(),
+                [&system](PlanetModel&& planet) { system.addPlanet(std::move(planet)); });
+}
 }
-}
\ No newline at end of file
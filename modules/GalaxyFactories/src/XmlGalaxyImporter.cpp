@@ -5,9 +5,12 @@
 #include <QXmlStreamReader>
 #include <unordered_map>
 #include <limits>
+#include <optional>
+#include <vector>
 
 #include "ggh/modules/GalaxyCore/utilities/Common.h"
 #include "ggh/modules/GalaxyCore/utilities/Coordinates.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
 #include "ggh/modules/GalaxyCore/models/StarSystemModel.h"
 #include "ggh/modules/GalaxyCore/models/PlanetModel.h"
 #include "ggh/modules/GalaxyCore/models/TravelLaneModel.h"
@@ -20,9 +23,116 @@ using GalaxyModel = ggh::GalaxyCore::models::GalaxyModel;
 using StarSystemModel = ggh::GalaxyCore::models::StarSystemModel;
 using Planet = ggh::GalaxyCore::models::Planet;
 using TravelLaneModel = ggh::GalaxyCore::models::TravelLaneModel;
+using SystemSize = ggh::GalaxyCore::utilities::SystemSize;
 
 
 namespace ggh::GalaxyFactories {
+namespace {
+// Reads the attributes of the Planet element at the reader and moves past it
+std::optional<Planet> readPlanet(QXmlStreamReader& xml) {
+    QXmlStreamAttributes attributes = xml.attributes();
+    
+    std::string name = attributes.value("name").toString().toStdString();
+    PlanetType type = static_cast<PlanetType>(attributes.value("type").toInt());
+    double size = attributes.value("size").toDouble();
+    double mass = attributes.value("mass").toDouble();
+    int numberOfMoons = attributes.value("numberOfMoons").toInt();
+    double orbitalRadius = attributes.value("orbitalRadius").toDouble();
+    double maxTemperature = attributes.value("maxTemperature").toDouble();
+    double minTemperature = attributes.value("minTemperature").toDouble();
+
+    if (name.empty() || size <= 0 || mass <= 0 || orbitalRadius < 0) {
+        qWarning() << "Invalid planet data in XML";
+        return std::nullopt;
+    }
+
+    xml.skipCurrentElement(); // Skip to end of Planet element
+    return Planet(name, type, size, mass, numberOfMoons, orbitalRadius, maxTemperature, minTemperature);
+}
+
+// QXmlStreamReader::characterOffset() counts UTF-16 units of the decoded text; this walks the
+// UTF-8 bytes alongside it. Offsets must be asked for in increasing order, so a whole pass is O(bytes)
+class Utf8ByteOffsets {
+public:
+    explicit Utf8ByteOffsets(const QByteArray& bytes) : m_bytes(bytes) {
+        // The decoder drops a byte order mark without counting it
+        if (m_bytes.startsWith("\xEF\xBB\xBF")) {
+            m_byte = 3;
+        }
+    }
+
+    qint64 byteOffset(qint64 characterOffset) {
+        while (m_character < characterOffset && m_byte < m_bytes.size()) {
+            const auto lead = static_cast<unsigned char>(m_bytes[m_byte]);
+            const qint64 length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+            m_byte += length;
+            m_character += length == 4 ? 2 : 1; // Beyond the BMP takes a surrogate pair
+        }
+        return m_byte;
+    }
+
+private:
+    const QByteArray& m_bytes;
+    qint64 m_byte{0};
+    qint64 m_character{0};
+};
+} // namespace
+
+// Where each deferred system's element starts in the file; the key a system holds is its entry
+class XmlGalaxyImporter::PlanetIndex final : public ggh::GalaxyCore::models::PlanetSource {
+public:
+    explicit PlanetIndex(QString filePath) : m_filePath(std::move(filePath)) {}
+
+    std::uint64_t add(qint64 byteOffset, SystemId systemId, std::uint32_t planetCount) {
+        m_entries.push_back({byteOffset, systemId, planetCount});
+        return m_entries.size() - 1;
+    }
+
+    void generate(std::uint64_t key, SystemSize /*size*/, const std::string& /*systemName*/,
+                  std::vector<Planet>& planets) const override {
+        const auto& entry = m_entries[key];
+        QFile file(m_filePath);
+        if (!file.open(QIODevice::ReadOnly) || !file.seek(entry.byteOffset)) {
+            qWarning() << "Cannot reopen" << m_filePath << "to load the planets of system" << entry.systemId;
+            return;
+        }
+
+        // The element alone reads as a document of its own
+        QXmlStreamReader xml(&file);
+        if (!xml.readNextStartElement() || xml.name() != "StarSystem"
+            || xml.attributes().value("id").toUInt() != entry.systemId) {
+            qWarning() << "System" << entry.systemId << "is no longer where it was imported from in" << m_filePath;
+            return;
+        }
+        while (xml.readNextStartElement()) {
+            if (xml.name() == "Planet") {
+                auto planet = readPlanet(xml);
+                if (!planet) {
+                    qWarning() << "Failed to parse planet in system" << entry.systemId;
+                    return;
+                }
+                planets.push_back(std::move(*planet));
+            } else {
+                xml.skipCurrentElement();
+            }
+        }
+    }
+
+    std::size_t count(std::uint64_t key, SystemSize /*size*/) const override {
+        return m_entries[key].planetCount;
+    }
+
+private:
+    struct Entry {
+        qint64 byteOffset;
+        SystemId systemId;
+        std::uint32_t planetCount;
+    };
+
+    QString m_filePath;
+    std::vector<Entry> m_entries;
+};
+
 std::unique_ptr<GalaxyModel> XmlGalaxyImporter::importGalaxy(const QString& filePath) {
     setXmlPath(filePath);
     return generateGalaxy();
@@ -33,21 +143,42 @@ void XmlGalaxyImporter::setXmlPath(const QString& filePath) {
 }
 
 std::unique_ptr<GalaxyModel> XmlGalaxyImporter::generateGalaxy() {
+    GGH_TRACE_SCOPE("XmlGalaxyImporter::generateGalaxy");
     if (m_filePath.isEmpty()) {
         qWarning() << "XML file path not set";
         return nullptr;
     }
 
+    // Byte offsets need the file as stored, without line ending translation
+    QIODevice::OpenMode mode = QIODevice::ReadOnly;
+    if (!m_lazyPlanets) {
+        mode |= QIODevice::Text;
+    }
     QFile file(m_filePath);
-    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+    if (!file.open(mode)) {
         qWarning() << "Cannot open file for reading:" << m_filePath;
         return nullptr;
     }
 
     // Create galaxy with default dimensions, we'll update them later
-    auto galaxy = std::make_unique<GalaxyModel>(1000, 1000);
+    auto galaxy = std::make_unique<GalaxyModel>(
+        1000, 1000, m_arenaAllocation ? std::make_shared<ggh::GalaxyCore::models::GalaxyArena>() : nullptr);
     std::unordered_map<quint32, std::shared_ptr<StarSystemModel>> systemMap;
 
+    // The lazy pass keeps a mapping of the file beside the reader to turn element offsets into byte offsets
+    std::shared_ptr<PlanetIndex> planetIndex;
+    QByteArray bytes;
+    if (m_lazyPlanets) {
+        planetIndex = std::make_shared<PlanetIndex>(m_filePath);
+        if (const auto* data = file.map(0, file.size())) {
+            bytes = QByteArray::fromRawData(reinterpret_cast<const char*>(data), file.size());
+        } else {
+            bytes = file.readAll();
+            file.seek(0);
+        }
+    }
+    Utf8ByteOffsets byteOffsets(bytes);
+
     QXmlStreamReader xml(&file);
     
     // First find the root element and validate it
@@ -69,6 +200,12 @@ std::unique_ptr<GalaxyModel> XmlGalaxyImporter::generateGalaxy() {
         qWarning() << "Invalid XML: No 'Galaxy' root element found";
         return nullptr;
     }
+
+    if (planetIndex && !xml.documentEncoding().isEmpty()
+        && xml.documentEncoding().compare(QLatin1String("UTF-8"), Qt::CaseInsensitive) != 0) {
+        qWarning() << "Planets load on demand from UTF-8 files only, loading all of" << m_filePath;
+        planetIndex.reset();
+    }
     
     // Parse XML using streaming parser for better performance
     while (!xml.atEnd() && !xml.hasError()) {
@@ -76,7 +213,16 @@ std::unique_ptr<GalaxyModel> XmlGalaxyImporter::generateGalaxy() {
         
         if (xml.isStartElement()) {
             if (xml.name() == "StarSystem") {
-                if (!parseSystemFromStream(galaxy.get(), systemMap, xml)) {
+                qint64 byteOffset = -1;
+                if (planetIndex) {
+                    // The reader stands just past the start tag, and attribute values cannot hold a '<'
+                    byteOffset = bytes.lastIndexOf('<', byteOffsets.byteOffset(xml.characterOffset()) - 1);
+                    if (byteOffset < 0 || !QByteArrayView(bytes).sliced(byteOffset).startsWith("<StarSystem")) {
+                        qWarning() << "Cannot locate star system element at offset" << xml.characterOffset();
+                        return nullptr;
+                    }
+                }
+                if (!parseSystemFromStream(galaxy.get(), systemMap, xml, planetIndex, byteOffset)) {
                     qWarning() << "Failed to parse star system";
                     return nullptr;
                 }
@@ -99,6 +245,12 @@ std::unique_ptr<GalaxyModel> XmlGalaxyImporter::generateGalaxy() {
     
     // Set galaxy dimensions based on the systems (find bounding box and add some padding)
     updateGalaxyDimensions(galaxy.get(), systemMap);
+    galaxy->rebuildLaneGraph();
+    galaxy->rebuildNameIndex();
+    if (!planetIndex) {
+        // Building the catalogue reads every system's planets, which would load them all
+        galaxy->rebuildPlanetCatalogue();
+    }
 
     return galaxy;
 }
@@ -113,11 +265,28 @@ GenerationParameters XmlGalaxyImporter::getParameters() const {
     return params;
 }
 
+void XmlGalaxyImporter::setLazyPlanets(bool lazy) {
+    m_lazyPlanets = lazy;
+}
+
+bool XmlGalaxyImporter::lazyPlanets() const {
+    return m_lazyPlanets;
+}
+
+void XmlGalaxyImporter::setArenaAllocation(bool arena) {
+    m_arenaAllocation = arena;
+}
+
+bool XmlGalaxyImporter::arenaAllocation() const {
+    return m_arenaAllocation;
+}
+
 // DOM-based methods removed - using streaming parser implementation instead
 
 bool XmlGalaxyImporter::parseSystemFromStream(GalaxyModel* galaxy, 
                                             std::unordered_map<quint32, std::shared_ptr<StarSystemModel>>& systemMap,
-                                            QXmlStreamReader& xml) {
+                                            QXmlStreamReader& xml,
+                                            const std::shared_ptr<PlanetIndex>& planetIndex, qint64 byteOffset) {
     QXmlStreamAttributes attributes = xml.attributes();
     
     quint32 id = attributes.value("id").toUInt();
@@ -135,7 +304,7 @@ bool XmlGalaxyImporter::parseSystemFromStream(GalaxyModel* galaxy,
     // Create position coordinates
     ggh::GalaxyCore::utilities::CartesianCoordinates<double> position(positionX, positionY);
     
-    auto starSystem = std::make_shared<StarSystemModel>(
+    auto starSystem = galaxy->makeStarSystem(
         id, name.toStdString(), position, 
         static_cast<StarType>(starType)
     );
@@ -143,20 +312,32 @@ bool XmlGalaxyImporter::parseSystemFromStream(GalaxyModel* galaxy,
     // Set system size separately
     starSystem->setSystemSize(static_cast<ggh::GalaxyCore::utilities::SystemSize>(systemSize));
     
-    // Parse any nested Planet elements
-    while (xml.readNextStartElement()) {
-        if (xml.name() == "Planet") {
-            if (!parsePlanetFromStream(starSystem, xml)) {
-                qWarning() << "Failed to parse planet in system" << id;
-                return false;
+    if (planetIndex) {
+        // Count the planets for now; they are parsed from byteOffset when first read
+        std::uint32_t planetCount = 0;
+        while (xml.readNextStartElement()) {
+            if (xml.name() == "Planet") {
+                ++planetCount;
             }
-        } else {
             xml.skipCurrentElement();
         }
+        starSystem->deferPlanets(planetIndex, planetIndex->add(byteOffset, id, planetCount));
+    } else {
+        // Parse any nested Planet elements
+        while (xml.readNextStartElement()) {
+            if (xml.name() == "Planet") {
+                if (!parsePlanetFromStream(starSystem, xml)) {
+                    qWarning() << "Failed to parse planet in system" << id;
+                    return false;
+                }
+            } else {
+                xml.skipCurrentElement();
+            }
+        }
     }
     
     systemMap[id] = starSystem;
-    galaxy->addStarSystem(std::move(starSystem));
+    galaxy->addStarSystem(std::move(starSystem), GalaxyModel::NameIndexing::Deferred);
     return true;
 }
 
@@ -180,8 +361,8 @@ bool XmlGalaxyImporter::parseTravelLaneFromStream(GalaxyModel* galaxy,
     auto toSystemIt = systemMap.find(toSystemId);
     
     if (fromSystemIt != systemMap.end() && toSystemIt != systemMap.end()) {
-        auto travelLane = std::make_shared<TravelLaneModel>(
-            id, fromSystemIt->second, toSystemIt->second
+        auto travelLane = ggh::GalaxyCore::models::allocateShared<TravelLaneModel>(
+            galaxy->arena(), id, fromSystemIt->second, toSystemIt->second
         );
         
         galaxy->addTravelLane(std::move(travelLane));
@@ -194,31 +375,17 @@ bool XmlGalaxyImporter::parseTravelLaneFromStream(GalaxyModel* galaxy,
 }
 
 bool XmlGalaxyImporter::parsePlanetFromStream(std::shared_ptr<StarSystemModel> system, QXmlStreamReader& xml) {
-    QXmlStreamAttributes attributes = xml.attributes();
-    
-    std::string name = attributes.value("name").toString().toStdString();
-    PlanetType type = static_cast<PlanetType>(attributes.value("type").toInt());
-    double size = attributes.value("size").toDouble();
-    double mass = attributes.value("mass").toDouble();
-    int numberOfMoons = attributes.value("numberOfMoons").toInt();
-    double orbitalRadius = attributes.value("orbitalRadius").toDouble();
-    double maxTemperature = attributes.value("maxTemperature").toDouble();
-    double minTemperature = attributes.value("minTemperature").toDouble();
-
-    if (name.empty() || size <= 0 || mass <= 0 || orbitalRadius < 0) {
-        qWarning() << "Invalid planet data in XML";
+    auto planet = readPlanet(xml);
+    if (!planet) {
         return false;
     }
-
-    Planet planet(name, type, size, mass, numberOfMoons, orbitalRadius, maxTemperature, minTemperature);
-    system->addPlanet(std::move(planet));
-    
-    xml.skipCurrentElement(); // Skip to end of Planet element
+    system->addPlanet(std::move(*planet));
     return true;
 }
 
 void XmlGalaxyImporter::updateGalaxyDimensions(GalaxyModel* galaxy,
                                              const std::unordered_map<quint32, std::shared_ptr<StarSystemModel>>& systemMap) {
+    GGH_TRACE_SCOPE("XmlGalaxyImporter::updateGalaxyDimensions");
     if (!systemMap.empty()) {
         double minX = std::numeric_limits<double>::max();
         double maxX = std::numeric_limits<double>::lowest();
@@ -85,6 +85,10 @@ TEST_F(GalaxyGeneratorTest, GenerateBasicGalaxy) {
     auto systems = galaxy->getAllStarSystems();
     EXPECT_GT(systems.size(), 0);
     EXPECT_LE(systems.size(), params.systemCount);
+
+    // Names are indexed in one pass after generation
+    EXPECT_EQ(galaxy->nameIndex().size(), systems.size());
+    EXPECT_EQ(galaxy->findStarSystemByName(systems.front()->getName()), systems.front());
 }
 
 TEST_F(GalaxyGeneratorTest, GenerateWithDifferentShapes) {
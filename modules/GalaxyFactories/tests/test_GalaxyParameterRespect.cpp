@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "ggh/modules/GalaxyFactories/GalaxyGenerator.h"
 #include "ggh/modules/GalaxyFactories/Types.h"
+#include "ggh/modules/GalaxyAnalysis/models/ConnectivityAnalysis.h"
+#include "ggh/modules/GalaxyAnalysis/models/LaneCrossingDetector.h"
 #include "ggh/modules/GalaxyCore/utilities/Common.h"
 
 using namespace ggh::GalaxyFactories;
@@ -428,3 +430,80 @@ TEST_F(GalaxyParameterRespectTest, SpiralShapeIsWellFormed) {
     EXPECT_NEAR(medianRadius, expectedMidRadius, radiusRange * 0.3) 
         << "Median system radius should be reasonably close to middle of range";
 }
+
+TEST_F(GalaxyParameterRespectTest, ConnectComponentsJoinsIsolatedClusters) {
+    GenerationParameters params;
+    params.systemCount = 200;
+    params.width = 4000;
+    params.height = 4000;
+    params.shape = GalaxyShape::Cluster;
+    params.seed = 12345;
+
+    generator->setParameters(params);
+    auto disconnected = generator->generateGalaxy();
+    ggh::Galaxy::Analysis::models::ConnectivityAnalysis before;
+    before.analyze(disconnected->laneGraph());
+    ASSERT_GT(before.componentCount(), 1u) << "Sparse clusters should start out disconnected";
+
+    params.connectComponents = true;
+    generator->setParameters(params);
+    auto connected = generator->generateGalaxy();
+    ggh::Galaxy::Analysis::models::ConnectivityAnalysis after;
+    after.analyze(connected->laneGraph());
+
+    EXPECT_EQ(after.componentCount(), 1u);
+    EXPECT_EQ(connected->getAllTravelLanes().size(),
+              disconnected->getAllTravelLanes().size() + before.componentCount() - 1)
+        << "Each extra lane should join two previously separate clusters";
+}
+
+TEST_F(GalaxyParameterRespectTest, RemoveCrossingsKeepsClustersConnected) {
+    GenerationParameters params;
+    params.systemCount = 400;
+    params.shape = GalaxyShape::Spiral;
+    params.seed = 4242;
+
+    generator->setParameters(params);
+    auto crossed = generator->generateGalaxy();
+    const ggh::Galaxy::Analysis::models::LaneCrossingDetector detector;
+    const auto crossingsBefore = detector.find(crossed->laneGraph());
+    ASSERT_FALSE(crossingsBefore.empty()) << "Nearest-neighbour lanes should cross somewhere";
+    ggh::Galaxy::Analysis::models::ConnectivityAnalysis before;
+    before.analyze(crossed->laneGraph());
+
+    params.removeCrossings = true;
+    generator->setParameters(params);
+    auto pruned = generator->generateGalaxy();
+    ggh::Galaxy::Analysis::models::ConnectivityAnalysis after;
+    after.analyze(pruned->laneGraph());
+
+    EXPECT_EQ(after.componentCount(), before.componentCount());
+    EXPECT_LT(pruned->getAllTravelLanes().size(), crossed->getAllTravelLanes().size());
+    EXPECT_LT(detector.find(pruned->laneGraph()).size(), crossingsBefore.size());
+}
+
+TEST_F(GalaxyParameterRespectTest, ArenaAllocationBuildsTheSameGalaxy) {
+    GenerationParameters params;
+    params.systemCount = 150;
+    params.seed = 2024;
+
+    generator->setParameters(params);
+    auto heap = generator->generateGalaxy();
+    params.arenaAllocation = true;
+    generator->setParameters(params);
+    auto arena = generator->generateGalaxy();
+    ASSERT_EQ(heap->arena(), nullptr);
+    ASSERT_NE(arena->arena(), nullptr);
+    EXPECT_GT(arena->arena()->bytesReserved(), 0u);
+
+    ASSERT_EQ(arena->getAllStarSystems().size(), heap->getAllStarSystems().size());
+    EXPECT_EQ(arena->getAllTravelLanes().size(), heap->getAllTravelLanes().size());
+    for (const auto& system : heap->getAllStarSystems()) {
+        auto twin = arena->getStarSystem(system->getId());
+        ASSERT_NE(twin, nullptr);
+        EXPECT_EQ(twin->getName(), system->getName());
+        EXPECT_EQ(twin->getPosition().x, system->getPosition().x);
+        EXPECT_EQ(twin->getPlanets().size(), system->getPlanets().size());
+        EXPECT_EQ(arena->lanesOf(system->getId()).size(), heap->lanesOf(system->getId()).size());
+    }
+}
@@ -96,6 +96,8 @@ TEST_F(XmlGalaxyImporterTest, ImportValidGalaxy) {
     EXPECT_DOUBLE_EQ(beta->getPosition().y, 400.0);
     EXPECT_EQ(beta->getStarType(), StarType::BlueStar);
     EXPECT_EQ(beta->getPlanets().size(), 2);
+    EXPECT_EQ(galaxy->findStarSystemByName("Beta"), beta);
+    EXPECT_EQ(galaxy->nameIndex().size(), 2u);
     
     // Check travel lanes
     auto lanes = galaxy->getAllTravelLanes();
@@ -245,3 +247,48 @@ TEST_F(XmlGalaxyImporterTest, RoundTripCompatibility) {
     EXPECT_DOUBLE_EQ(originalSystem->getPosition().x, reimportedSystem->getPosition().x);
     EXPECT_DOUBLE_EQ(originalSystem->getPosition().y, reimportedSystem->getPosition().y);
 }
+
+TEST_F(XmlGalaxyImporterTest, LazyImportLoadsPlanetsOnDemand) {
+    // Multi-byte names ahead of later systems, so their byte offsets differ from character offsets
+    QString xmlContent = QString::fromUtf8(R"(<?xml version="1.0" encoding="UTF-8"?>
+<Galaxy>
+    <StarSystem id="1" name="Ωmega 🌌" positionX="100.0" positionY="200.0" starType="1" systemSize="2">
+        <Planet name="Ωmega I" type="0" size="1.0" mass="1.0" numberOfMoons="0" orbitalRadius="1.0" maxTemperature="100.0" minTemperature="-50.0"/>
+    </StarSystem>
+    <StarSystem id="2" name="Beta" positionX="300.0" positionY="400.0" starType="2" systemSize="1"/>
+    <StarSystem id="3" name="Gamma" positionX="500.0" positionY="100.0" starType="0" systemSize="3">
+        <Planet name="Gamma I" type="1" size="2.0" mass="5.0" numberOfMoons="4" orbitalRadius="2.0" maxTemperature="200.0" minTemperature="-100.0"/>
+        <Planet name="Gamma II" type="0" size="1.5" mass="3.0" numberOfMoons="1" orbitalRadius="3.0" maxTemperature="150.0" minTemperature="-75.0"/>
+    </StarSystem>
+    <TravelLane id="1" fromSystem="1" toSystem="3" length="412.3"/>
+</Galaxy>)");
+    QString xmlFilePath = createTestXmlFile(xmlContent);
+    ASSERT_FALSE(xmlFilePath.isEmpty());
+
+    auto eager = importer->importGalaxy(xmlFilePath);
+    importer->setLazyPlanets(true);
+    auto lazy = importer->importGalaxy(xmlFilePath);
+    ASSERT_NE(eager, nullptr);
+    ASSERT_NE(lazy, nullptr);
+    EXPECT_EQ(lazy->getAllTravelLanes().size(), 1u);
+    EXPECT_TRUE(lazy->planetCatalogue().empty());
+
+    // Read the last system first, so offsets are not relied on in file order
+    for (SystemId id : {3u, 1u, 2u}) {
+        auto system = lazy->getStarSystem(id);
+        ASSERT_NE(system, nullptr);
+        EXPECT_EQ(system->getName(), eager->getStarSystem(id)->getName());
+        EXPECT_TRUE(system->hasDeferredPlanets());
+
+        const auto& expected = eager->getStarSystem(id)->getPlanets();
+        EXPECT_EQ(system->planetCount(), expected.size());
+        const auto& planets = system->getPlanets();
+        EXPECT_FALSE(system->hasDeferredPlanets());
+        ASSERT_EQ(planets.size(), expected.size());
+        for (std::size_t i = 0; i < planets.size(); ++i) {
+            EXPECT_EQ(planets[i]->name(), expected[i]->name());
+            EXPECT_EQ(planets[i]->numberOfMoons(), expected[i]->numberOfMoons());
+            EXPECT_DOUBLE_EQ(planets[i]->maxTemperature(), expected[i]->maxTemperature());
+        }
+    }
+}
@@ -242,3 +242,57 @@ TEST_F(PlanetGenerationTest, MultipleGenerationsAreConsistent) {
         }
     }
 }
+
+// Generated galaxies come with a planet catalogue covering every planet
+TEST_F(PlanetGenerationTest, GeneratedGalaxyHasPlanetCatalogue) {
+    GenerationParameters params;
+    params.systemCount = 40;
+    params.seed = 4242;
+    generator->setParameters(params);
+    auto galaxy = generator->generateGalaxy();
+    ASSERT_NE(galaxy, nullptr);
+
+    std::size_t planets = 0;
+    for (const auto& system : galaxy->getAllStarSystems()) {
+        planets += system->getPlanets().size();
+    }
+    EXPECT_GT(planets, 0u);
+    EXPECT_EQ(galaxy->planetCatalogue().size(), planets);
+}
+
+// Deferred planets come out exactly as eager generation with the same seed would make them
+TEST_F(PlanetGenerationTest, LazyPlanetsMatchEagerGeneration) {
+    GenerationParameters params;
+    params.systemCount = 60;
+    params.seed = 777;
+    generator->setParameters(params);
+    auto eager = generator->generateGalaxy();
+    params.lazyPlanets = true;
+    generator->setParameters(params);
+    auto lazy = generator->generateGalaxy();
+    ASSERT_NE(eager, nullptr);
+    ASSERT_NE(lazy, nullptr);
+    ASSERT_EQ(lazy->getAllStarSystems().size(), eager->getAllStarSystems().size());
+    EXPECT_TRUE(lazy->planetCatalogue().empty());
+
+    for (const auto& system : eager->getAllStarSystems()) {
+        auto deferred = lazy->getStarSystem(system->getId());
+        ASSERT_NE(deferred, nullptr);
+        EXPECT_TRUE(deferred->hasDeferredPlanets());
+        EXPECT_EQ(deferred->planetCount(), system->getPlanets().size());
+
+        const auto& expected = system->getPlanets();
+        const auto& actual = deferred->getPlanets();
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_EQ(actual[i]->name(), expected[i]->name());
+            EXPECT_EQ(actual[i]->type(), expected[i]->type());
+            EXPECT_EQ(actual[i]->size(), expected[i]->size());
+            EXPECT_EQ(actual[i]->mass(), expected[i]->mass());
+            EXPECT_EQ(actual[i]->numberOfMoons(), expected[i]->numberOfMoons());
+            EXPECT_EQ(actual[i]->orbitalRadius(), expected[i]->orbitalRadius());
+            EXPECT_EQ(actual[i]->minTemperature(), expected[i]->minTemperature());
+            EXPECT_EQ(actual[i]->maxTemperature(), expected[i]->maxTemperature());
+        }
+    }
+}
@@ -0,0 +1,109 @@
+#ifndef GGH_MODULES_GALAXYNAVIGATION_MODELS_LANDMARK_INDEX_H
+#define GGH_MODULES_GALAXYNAVIGATION_MODELS_LANDMARK_INDEX_H
+
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+#include "ggh/modules/GalaxyCore/utilities/MemoryReport.h"
+#include "ggh/modules/GalaxyNavigation/models/RouteFinder.h"
+
+namespace ggh::Galaxy::Navigation::models {
+
+/**
+ * @class LandmarkIndex
+ * @brief Landmark distance tables for ALT (A*, landmarks, triangle inequality) route queries.
+ *
+ * A handful of landmark systems are chosen far apart, and the shortest distance from each
+ * landmark to every system is stored. For any landmark L, |d(L, t) - d(L, v)| is a lower bound
+ * on d(v, t), which gives A* a much tighter heuristic than the straight-line distance.
+ *
+ * Tables are bound to the graph they were built or loaded for and become stale as soon as
+ * its revision changes; stale tables are ignored by LandmarkRouteFinder.
+ */
+class LandmarkIndex {
+public:
+    static constexpr std::size_t DEFAULT_LANDMARK_COUNT = 16;
+
+    /**
+     * @brief Picks landmarks and computes their distance tables.
+     * @param graph The graph to preprocess; must outlive the index.
+     * @param landmarkCount Number of landmarks, capped at the node count.
+     * @param threadCount Worker threads, one landmark Dijkstra at a time each; 0 uses all cores.
+     * @return False if the graph is empty.
+     */
+    bool build(const GalaxyCore::models::LaneGraph& graph,
+               std::size_t landmarkCount = DEFAULT_LANDMARK_COUNT,
+               unsigned threadCount = 0);
+
+    /**
+     * @brief Writes the tables in a binary format keyed by system id.
+     */
+    bool save(std::ostream& stream) const;
+
+    /**
+     * @brief Reads tables written by save() and binds them to a graph.
+     * @return False if the data is malformed or was built for a different graph.
+     */
+    bool load(std::istream& stream, const GalaxyCore::models::LaneGraph& graph);
+
+    bool saveToFile(const std::string& filePath) const;
+    bool loadFromFile(const std::string& filePath, const GalaxyCore::models::LaneGraph& graph);
+
+    void clear();
+
+    /**
+     * @brief True if the tables were built for this graph and it has not changed since.
+     */
+    bool isValidFor(const GalaxyCore::models::LaneGraph& graph) const noexcept;
+
+    /**
+     * @brief Best landmark lower bound on the distance from one node to another.
+     */
+    double lowerBound(GalaxyCore::models::LaneGraph::NodeIndex node,
+                      GalaxyCore::models::LaneGraph::NodeIndex target) const;
+
+    /**
+     * @brief Distances from every landmark to one node, in landmark order.
+     */
+    std::span<const double> distances(GalaxyCore::models::LaneGraph::NodeIndex node) const;
+
+    bool empty() const noexcept { return m_landmarks.empty(); }
+    std::size_t landmarkCount() const noexcept { return m_landmarks.size(); }
+    const std::vector<GalaxyCore::utilities::SystemId>& landmarks() const noexcept { return m_landmarks; }
+
+    void reportMemory(GalaxyCore::utilities::MemoryReport& report) const;
+
+private:
+    const GalaxyCore::models::LaneGraph* m_graph{nullptr};
+    std::uint64_t m_revision{0};
+    std::vector<GalaxyCore::utilities::SystemId> m_landmarks;
+    std::vector<double> m_table;   ///< Node-major: the distances of node n start at n * landmarkCount()
+};
+
+/**
+ * @class LandmarkRouteFinder
+ * @brief RouteFinder whose A* heuristic also uses landmark lower bounds.
+ *
+ * Falls back to the straight-line heuristic while the index is empty or stale.
+ */
+class LandmarkRouteFinder : public RouteFinder {
+public:
+    LandmarkRouteFinder(const GalaxyCore::models::LaneGraph& graph, const LandmarkIndex& landmarks);
+
+protected:
+    double estimate(NodeIndex node, NodeIndex target) const override;
+    void prepare(NodeIndex source, NodeIndex target) override;
+
+private:
+    const LandmarkIndex* m_landmarks;
+    bool m_useLandmarks{false};
+    std::span<const double> m_targetDistances;   ///< Landmark distances of the current target
+};
+
+} // namespace ggh::Galaxy::Navigation::models
+
+#endif // !GGH_MODULES_GALAXYNAVIGATION_MODELS_LANDMARK_INDEX_H
@@ -0,0 +1,42 @@
+#ifndef GGH_MODULES_GALAXYNAVIGATION_MODELS_ROUTE_H
+#define GGH_MODULES_GALAXYNAVIGATION_MODELS_ROUTE_H
+
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/utilities/Common.h"
+
+namespace ggh::Galaxy::Navigation::models {
+
+/**
+ * @brief Shortest-path search strategy used by RouteFinder.
+ */
+enum class RouteAlgorithm {
+    Dijkstra,   ///< Uninformed search, settles nodes in distance order
+    AStar       ///< Goal-directed search using the straight-line distance to the target
+};
+
+/**
+ * @struct Route
+ * @brief A path through the lane graph.
+ *
+ * `systems` lists every system from origin to destination; `lanes[i]` connects
+ * `systems[i]` to `systems[i + 1]`. An empty route means no path exists.
+ */
+struct Route {
+    std::vector<GalaxyCore::utilities::SystemId> systems;
+    std::vector<GalaxyCore::utilities::LaneId> lanes;
+    double distance{0.0};
+
+    bool empty() const noexcept { return systems.empty(); }
+    std::size_t hopCount() const noexcept { return lanes.size(); }
+
+    void clear() noexcept {
+        systems.clear();
+        lanes.clear();
+        distance = 0.0;
+    }
+};
+
+} // namespace ggh::Galaxy::Navigation::models
+
+#endif // !GGH_MODULES_GALAXYNAVIGATION_MODELS_ROUTE_H
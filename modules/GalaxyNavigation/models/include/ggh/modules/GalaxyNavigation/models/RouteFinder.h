@@ -0,0 +1,98 @@
+#ifndef GGH_MODULES_GALAXYNAVIGATION_MODELS_ROUTE_FINDER_H
+#define GGH_MODULES_GALAXYNAVIGATION_MODELS_ROUTE_FINDER_H
+
+#include <cstdint>
+#include <vector>
+
+#include "ggh/modules/GalaxyCore/models/LaneGraph.h"
+#include "ggh/modules/GalaxyNavigation/models/Route.h"
+
+namespace ggh::Galaxy::Navigation::models {
+
+/**
+ * @class RouteFinder
+ * @brief Shortest routes over a LaneGraph using binary-heap Dijkstra or A*.
+ *
+ * The finder keeps its distance, parent and heap buffers between queries and resets them
+ * lazily through a visit stamp, so repeated queries on the same graph do not allocate once
+ * the buffers have grown to the graph size. The graph must outlive the finder.
+ * A finder is not thread-safe; use one per thread.
+ */
+class RouteFinder {
+public:
+    explicit RouteFinder(const GalaxyCore::models::LaneGraph& graph);
+    virtual ~RouteFinder() = default;
+
+    /**
+     * @brief Finds the shortest route between two systems.
+     * @param from Origin system id.
+     * @param to Destination system id.
+     * @param algorithm Search strategy; both return a shortest route.
+     * @return The route, empty if either system is unknown or unreachable.
+     */
+    Route findRoute(GalaxyCore::utilities::SystemId from, GalaxyCore::utilities::SystemId to,
+                    RouteAlgorithm algorithm = RouteAlgorithm::AStar);
+
+    /**
+     * @brief Same as findRoute() but writes into an existing route to reuse its storage.
+     * @return True if a route was found.
+     */
+    bool findRoute(GalaxyCore::utilities::SystemId from, GalaxyCore::utilities::SystemId to,
+                   Route& route, RouteAlgorithm algorithm = RouteAlgorithm::AStar);
+
+    /**
+     * @brief Shortest distance from one system to every node, indexed by LaneGraph node index.
+     * @param from Origin system id.
+     * @param distances Receives one entry per node; unreachable nodes are infinite.
+     * @return False if the origin is unknown.
+     */
+    bool distancesFrom(GalaxyCore::utilities::SystemId from, std::vector<double>& distances);
+
+    /**
+     * @brief Number of nodes settled by the last query; useful to compare algorithms.
+     */
+    std::size_t lastSettledCount() const noexcept { return m_settledCount; }
+
+    const GalaxyCore::models::LaneGraph& graph() const noexcept { return *m_graph; }
+
+protected:
+    using NodeIndex = GalaxyCore::models::LaneGraph::NodeIndex;
+
+    /**
+     * @brief Lower bound on the remaining distance from a node to the target.
+     *
+     * The default is the straight-line distance, which is admissible and consistent because
+     * every lane is exactly as long as the straight line between its endpoints.
+     */
+    virtual double estimate(NodeIndex node, NodeIndex target) const;
+
+    /**
+     * @brief Called once per query before the search starts.
+     */
+    virtual void prepare(NodeIndex /*source*/, NodeIndex /*target*/) {}
+
+private:
+    struct HeapEntry {
+        double priority;
+        NodeIndex node;
+    };
+
+    bool search(NodeIndex source, NodeIndex target, bool informed);
+    void touch(NodeIndex node);
+
+    const GalaxyCore::models::LaneGraph* m_graph;
+
+    // Scratch buffers, reused across queries
+    std::vector<double> m_distance;
+    std::vector<NodeIndex> m_parent;
+    std::vector<GalaxyCore::utilities::LaneId> m_parentLane;
+    std::vector<std::uint32_t> m_stamp;       ///< Node state is valid only when equal to m_currentStamp
+    std::vector<std::uint8_t> m_settled;
+    std::vector<HeapEntry> m_heap;
+    std::uint32_t m_currentStamp{0};
+    std::size_t m_settledCount{0};
+};
+
+} // namespace ggh::Galaxy::Navigation::models
+
+#endif // !GGH_MODULES_GALAXYNAVIGATION_MODELS_ROUTE_FINDER_H
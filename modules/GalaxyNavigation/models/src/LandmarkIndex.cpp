@@ -0,0 +1,376 @@
+/**
+ * @file LandmarkIndex.cpp
+ * @brief Implementation of the LandmarkIndex and LandmarkRouteFinder classes for GalaxyNavigation module
+ */
+
+#include "ggh/modules/GalaxyNavigation/models/LandmarkIndex.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <thread>
+
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+
+namespace ggh::Galaxy::Navigation::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+
+constexpr std::array<char, 8> FILE_MAGIC{'G', 'G', 'H', 'L', 'M', 'K', '\0', '\0'};
+constexpr std::uint32_t FILE_VERSION = 1;
+
+std::uint64_t mix(std::uint64_t value)
+{
+    // splitmix64 finaliser
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Order-independent hash of a graph's systems, positions and lanes
+ *
+ * Node indices depend on insertion order, which differs between runs, so the fingerprint is
+ * built from system and lane ids only and summed so that order does not matter.
+ */
+std::uint64_t fingerprint(const LaneGraph& graph)
+{
+    std::uint64_t hash = mix(graph.nodeCount()) ^ mix(graph.edgeCount() << 32);
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        const auto id = graph.systemId(node);
+        const auto& position = graph.position(node);
+        hash += mix(id ^ mix(std::bit_cast<std::uint64_t>(position.x))
+                    ^ mix(std::bit_cast<std::uint64_t>(position.y) + 1));
+        const auto neighbours = graph.neighbours(node);
+        for (std::size_t i = 0; i < neighbours.size(); ++i) {
+            hash += mix((static_cast<std::uint64_t>(neighbours.lanes[i]) << 32 | id)
+                        ^ mix(graph.systemId(neighbours.nodes[i])));
+        }
+    }
+    return hash;
+}
+
+template <typename T>
+void writeValue(std::ostream& stream, const T& value)
+{
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool readValue(std::istream& stream, T& value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+/**
+ * @brief Farthest-point landmark selection on straight-line distance
+ *
+ * Lane lengths are Euclidean, so spreading landmarks geometrically approximates spreading them
+ * by graph distance without a sequential Dijkstra per pick, which keeps the table
+ * computation free to run one landmark per thread.
+ */
+std::vector<LaneGraph::NodeIndex> selectLandmarks(const LaneGraph& graph, std::size_t count)
+{
+    const std::size_t nodeCount = graph.nodeCount();
+    double centreX = 0.0;
+    double centreY = 0.0;
+    for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+        centreX += graph.position(node).x;
+        centreY += graph.position(node).y;
+    }
+    const GalaxyCore::utilities::CartesianCoordinates<double> centre(centreX / nodeCount, centreY / nodeCount);
+
+    // Start from the system farthest from the centre, then repeatedly take the system
+    // farthest from every landmark chosen so far
+    std::vector<double> nearest(nodeCount);
+    for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+        nearest[node] = GalaxyCore::utilities::calculateDistance(graph.position(node), centre);
+    }
+
+    std::vector<LaneGraph::NodeIndex> landmarks;
+    landmarks.reserve(count);
+    while (landmarks.size() < count) {
+        const auto next = static_cast<LaneGraph::NodeIndex>(
+            std::max_element(nearest.begin(), nearest.end()) - nearest.begin());
+        if (nearest[next] <= 0.0 && !landmarks.empty()) {
+            break;   // Remaining systems coincide with existing landmarks
+        }
+        landmarks.push_back(next);
+        for (LaneGraph::NodeIndex node = 0; node < nodeCount; ++node) {
+            nearest[node] = std::min(nearest[node],
+                                     GalaxyCore::utilities::calculateDistance(graph.position(node), graph.position(next)));
+        }
+    }
+    return landmarks;
+}
+} // namespace
+
+/**
+ * @brief Picks landmarks and computes their distance tables in parallel
+ * @param graph The graph to preprocess
+ * @param landmarkCount Number of landmarks to pick
+ * @param threadCount Number of worker threads, 0 for hardware concurrency
+ * @return False if the graph is empty
+ */
+bool LandmarkIndex::build(const LaneGraph& graph, std::size_t landmarkCount, unsigned threadCount)
+{
+    GGH_TRACE_SCOPE("LandmarkIndex::build");
+    clear();
+    if (graph.nodeCount() == 0 || landmarkCount == 0) {
+        return false;
+    }
+
+    const auto selected = selectLandmarks(graph, std::min(landmarkCount, graph.nodeCount()));
+    for (auto node : selected) {
+        m_landmarks.push_back(graph.systemId(node));
+    }
+
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, m_landmarks.size()));
+
+    // Each worker owns a RouteFinder and claims whole landmarks, writing into that landmark's
+    // own column so no two threads touch the same vector
+    std::vector<std::vector<double>> columns(m_landmarks.size());
+    std::atomic<std::size_t> nextLandmark{0};
+    auto worker = [&]() {
+        RouteFinder finder(graph);
+        for (auto landmark = nextLandmark++; landmark < m_landmarks.size(); landmark = nextLandmark++) {
+            finder.distancesFrom(m_landmarks[landmark], columns[landmark]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned i = 1; i < threadCount; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Transpose into node-major rows so a heuristic evaluation reads one contiguous row
+    const std::size_t stride = m_landmarks.size();
+    m_table.resize(graph.nodeCount() * stride);
+    for (std::size_t landmark = 0; landmark < stride; ++landmark) {
+        for (std::size_t node = 0; node < graph.nodeCount(); ++node) {
+            m_table[node * stride + landmark] = columns[landmark][node];
+        }
+    }
+
+    m_graph = &graph;
+    m_revision = graph.revision();
+    return true;
+}
+
+/**
+ * @brief Serialises the tables keyed by system id so they survive node renumbering
+ * @param stream Binary output stream
+ * @return True if all data was written
+ */
+bool LandmarkIndex::save(std::ostream& stream) const
+{
+    if (!m_graph || empty()) {
+        return false;
+    }
+
+    stream.write(FILE_MAGIC.data(), FILE_MAGIC.size());
+    writeValue(stream, FILE_VERSION);
+    writeValue(stream, fingerprint(*m_graph));
+    writeValue(stream, static_cast<std::uint32_t>(m_graph->nodeCount()));
+    writeValue(stream, static_cast<std::uint32_t>(m_landmarks.size()));
+    for (auto id : m_landmarks) {
+        writeValue(stream, id);
+    }
+    const std::size_t stride = m_landmarks.size();
+    for (LaneGraph::NodeIndex node = 0; node < m_graph->nodeCount(); ++node) {
+        writeValue(stream, m_graph->systemId(node));
+        stream.write(reinterpret_cast<const char*>(m_table.data() + node * stride),
+                     static_cast<std::streamsize>(stride * sizeof(double)));
+    }
+    return static_cast<bool>(stream);
+}
+
+/**
+ * @brief Loads tables written by save() and binds them to a graph
+ * @param stream Binary input stream
+ * @param graph The graph the tables must match
+ * @return False if the data is malformed or belongs to another graph
+ */
+bool LandmarkIndex::load(std::istream& stream, const LaneGraph& graph)
+{
+    GGH_TRACE_SCOPE("LandmarkIndex::load");
+    clear();
+
+    std::array<char, 8> magic{};
+    std::uint32_t version = 0;
+    std::uint64_t storedFingerprint = 0;
+    std::uint32_t nodeCount = 0;
+    std::uint32_t landmarkCount = 0;
+    if (!stream.read(magic.data(), magic.size()) || magic != FILE_MAGIC
+        || !readValue(stream, version) || version != FILE_VERSION
+        || !readValue(stream, storedFingerprint) || storedFingerprint != fingerprint(graph)
+        || !readValue(stream, nodeCount) || nodeCount != graph.nodeCount()
+        || !readValue(stream, landmarkCount) || landmarkCount == 0 || landmarkCount > nodeCount) {
+        return false;
+    }
+
+    std::vector<GalaxyCore::utilities::SystemId> landmarks(landmarkCount);
+    for (auto& id : landmarks) {
+        if (!readValue(stream, id) || graph.indexOf(id) == LaneGraph::INVALID_NODE) {
+            return false;
+        }
+    }
+
+    std::vector<double> table(static_cast<std::size_t>(nodeCount) * landmarkCount);
+    std::vector<std::uint8_t> seen(nodeCount, 0);
+    for (std::uint32_t row = 0; row < nodeCount; ++row) {
+        GalaxyCore::utilities::SystemId id = 0;
+        if (!readValue(stream, id)) {
+            return false;
+        }
+        const auto node = graph.indexOf(id);
+        if (node == LaneGraph::INVALID_NODE || seen[node]) {
+            return false;
+        }
+        seen[node] = 1;
+        if (!stream.read(reinterpret_cast<char*>(table.data() + static_cast<std::size_t>(node) * landmarkCount),
+                         static_cast<std::streamsize>(landmarkCount * sizeof(double)))) {
+            return false;
+        }
+    }
+
+    m_landmarks = std::move(landmarks);
+    m_table = std::move(table);
+    m_graph = &graph;
+    m_revision = graph.revision();
+    return true;
+}
+
+/**
+ * @brief Saves the tables to a file
+ * @param filePath Destination path
+ * @return True on success
+ */
+bool LandmarkIndex::saveToFile(const std::string& filePath) const
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    return file && save(file);
+}
+
+/**
+ * @brief Loads the tables from a file
+ * @param filePath Source path
+ * @param graph The graph the tables must match
+ * @return True on success
+ */
+bool LandmarkIndex::loadFromFile(const std::string& filePath, const LaneGraph& graph)
+{
+    std::ifstream file(filePath, std::ios::binary);
+    return file && load(file, graph);
+}
+
+/**
+ * @brief Drops the tables and unbinds the graph
+ */
+void LandmarkIndex::clear()
+{
+    m_graph = nullptr;
+    m_revision = 0;
+    m_landmarks.clear();
+    m_table.clear();
+}
+
+/**
+ * @brief Checks whether the tables still describe the given graph
+ */
+bool LandmarkIndex::isValidFor(const LaneGraph& graph) const noexcept
+{
+    return !empty() && m_graph == &graph && m_revision == graph.revision();
+}
+
+/**
+ * @brief Largest triangle-inequality bound over all landmarks
+ */
+double LandmarkIndex::lowerBound(LaneGraph::NodeIndex node, LaneGraph::NodeIndex target) const
+{
+    const auto from = distances(node);
+    const auto to = distances(target);
+    double bound = 0.0;
+    for (std::size_t i = 0; i < from.size(); ++i) {
+        // Unreachable entries say nothing useful about this pair
+        if (std::isfinite(from[i]) && std::isfinite(to[i])) {
+            bound = std::max(bound, std::abs(to[i] - from[i]));
+        }
+    }
+    return bound;
+}
+
+/**
+ * @brief Row of landmark distances for one node
+ */
+std::span<const double> LandmarkIndex::distances(LaneGraph::NodeIndex node) const
+{
+    return std::span<const double>(m_table).subspan(static_cast<std::size_t>(node) * m_landmarks.size(),
+                                                    m_landmarks.size());
+}
+
+/**
+ * @brief Reports the landmark tables under "navigation.landmarks"
+ */
+void LandmarkIndex::reportMemory(GalaxyCore::utilities::MemoryReport& report) const
+{
+    using namespace GalaxyCore::utilities::memory;
+    report.add("navigation.landmarks", heapBytes(m_landmarks) + heapBytes(m_table));
+}
+
+/**
+ * @brief Constructs a finder that uses landmark bounds when they are valid
+ * @param graph The graph to search
+ * @param landmarks Landmark tables; must outlive the finder
+ */
+LandmarkRouteFinder::LandmarkRouteFinder(const LaneGraph& graph, const LandmarkIndex& landmarks)
+    : RouteFinder(graph)
+    , m_landmarks(&landmarks)
+{
+}
+
+/**
+ * @brief Checks the tables against the graph and caches the target's landmark row
+ */
+void LandmarkRouteFinder::prepare(NodeIndex /*source*/, NodeIndex target)
+{
+    m_useLandmarks = m_landmarks->isValidFor(graph());
+    m_targetDistances = m_useLandmarks ? m_landmarks->distances(target) : std::span<const double>{};
+}
+
+/**
+ * @brief Maximum of the straight-line and landmark lower bounds
+ */
+double LandmarkRouteFinder::estimate(NodeIndex node, NodeIndex target) const
+{
+    double bound = RouteFinder::estimate(node, target);
+    if (!m_useLandmarks) {
+        return bound;
+    }
+
+    const auto from = m_landmarks->distances(node);
+    for (std::size_t i = 0; i < from.size(); ++i) {
+        if (std::isfinite(from[i]) && std::isfinite(m_targetDistances[i])) {
+            bound = std::max(bound, std::abs(m_targetDistances[i] - from[i]));
+        }
+    }
+    return bound;
+}
+
+} // namespace ggh::Galaxy::Navigation::models
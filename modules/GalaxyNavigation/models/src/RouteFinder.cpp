@@ -0,0 +1,195 @@
+/**
+ * @file RouteFinder.cpp
+ * @brief Implementation of the RouteFinder class for GalaxyNavigation module
+ */
+
+#include "ggh/modules/GalaxyNavigation/models/RouteFinder.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace ggh::Galaxy::Navigation::models {
+
+namespace {
+constexpr double INFINITE_DISTANCE = std::numeric_limits<double>::infinity();
+
+// std::push_heap builds a max-heap; invert the comparison to pop the smallest priority first
+struct GreaterPriority {
+    template <typename Entry>
+    bool operator()(const Entry& lhs, const Entry& rhs) const noexcept {
+        return lhs.priority > rhs.priority;
+    }
+};
+} // namespace
+
+/**
+ * @brief Constructs a RouteFinder over a lane graph
+ * @param graph The graph to search; must outlive the finder
+ */
+RouteFinder::RouteFinder(const GalaxyCore::models::LaneGraph& graph)
+    : m_graph(&graph)
+{
+}
+
+/**
+ * @brief Finds the shortest route between two systems
+ * @param from Origin system id
+ * @param to Destination system id
+ * @param algorithm Search strategy
+ * @return The route, empty if none exists
+ */
+Route RouteFinder::findRoute(GalaxyCore::utilities::SystemId from, GalaxyCore::utilities::SystemId to,
+                             RouteAlgorithm algorithm)
+{
+    Route route;
+    findRoute(from, to, route, algorithm);
+    return route;
+}
+
+/**
+ * @brief Finds the shortest route between two systems into an existing route
+ * @param from Origin system id
+ * @param to Destination system id
+ * @param route Receives the route; cleared if none exists
+ * @param algorithm Search strategy
+ * @return True if a route was found
+ */
+bool RouteFinder::findRoute(GalaxyCore::utilities::SystemId from, GalaxyCore::utilities::SystemId to,
+                            Route& route, RouteAlgorithm algorithm)
+{
+    route.clear();
+    m_settledCount = 0;
+
+    const auto source = m_graph->indexOf(from);
+    const auto target = m_graph->indexOf(to);
+    if (source == GalaxyCore::models::LaneGraph::INVALID_NODE
+        || target == GalaxyCore::models::LaneGraph::INVALID_NODE) {
+        return false;
+    }
+
+    if (!search(source, target, algorithm == RouteAlgorithm::AStar)) {
+        return false;
+    }
+
+    // Walk the parent chain back from the target, then reverse into origin-first order
+    route.distance = m_distance[target];
+    for (auto node = target; node != source; node = m_parent[node]) {
+        route.systems.push_back(m_graph->systemId(node));
+        route.lanes.push_back(m_parentLane[node]);
+    }
+    route.systems.push_back(m_graph->systemId(source));
+    std::reverse(route.systems.begin(), route.systems.end());
+    std::reverse(route.lanes.begin(), route.lanes.end());
+    return true;
+}
+
+/**
+ * @brief Computes single-source shortest distances to every node
+ * @param from Origin system id
+ * @param distances Receives the distance of every node, infinite if unreachable
+ * @return False if the origin is unknown
+ */
+bool RouteFinder::distancesFrom(GalaxyCore::utilities::SystemId from, std::vector<double>& distances)
+{
+    m_settledCount = 0;
+    const auto source = m_graph->indexOf(from);
+    if (source == GalaxyCore::models::LaneGraph::INVALID_NODE) {
+        distances.assign(m_graph->nodeCount(), INFINITE_DISTANCE);
+        return false;
+    }
+
+    // No target: the search runs until every reachable node is settled
+    search(source, GalaxyCore::models::LaneGraph::INVALID_NODE, false);
+    distances.resize(m_graph->nodeCount());
+    for (std::size_t node = 0; node < distances.size(); ++node) {
+        distances[node] = m_stamp[node] == m_currentStamp ? m_distance[node] : INFINITE_DISTANCE;
+    }
+    return true;
+}
+
+/**
+ * @brief Straight-line distance between a node and the target
+ */
+double RouteFinder::estimate(NodeIndex node, NodeIndex target) const
+{
+    return GalaxyCore::utilities::calculateDistance(m_graph->position(node), m_graph->position(target));
+}
+
+/**
+ * @brief Runs Dijkstra (uninformed) or A* (informed) from source until target is settled
+ * @return True if the target was reached
+ */
+bool RouteFinder::search(NodeIndex source, NodeIndex target, bool informed)
+{
+    const std::size_t nodeCount = m_graph->nodeCount();
+    if (m_stamp.size() < nodeCount) {
+        m_distance.resize(nodeCount);
+        m_parent.resize(nodeCount);
+        m_parentLane.resize(nodeCount);
+        m_stamp.resize(nodeCount, 0);
+        m_settled.resize(nodeCount);
+    }
+    if (++m_currentStamp == 0) {
+        // Stamp counter wrapped; stale stamps could now alias the new one
+        std::fill(m_stamp.begin(), m_stamp.end(), 0u);
+        m_currentStamp = 1;
+    }
+    m_heap.clear();
+
+    if (informed) {
+        prepare(source, target);
+    }
+
+    touch(source);
+    m_distance[source] = 0.0;
+    m_parent[source] = source;
+    m_heap.push_back({informed ? estimate(source, target) : 0.0, source});
+
+    while (!m_heap.empty()) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), GreaterPriority{});
+        const auto node = m_heap.back().node;
+        m_heap.pop_back();
+
+        // Lazy deletion: skip entries superseded by a shorter distance
+        if (m_settled[node]) {
+            continue;
+        }
+        m_settled[node] = 1;
+        ++m_settledCount;
+        if (node == target) {
+            return true;
+        }
+
+        const auto neighbours = m_graph->neighbours(node);
+        for (std::size_t i = 0; i < neighbours.size(); ++i) {
+            const auto next = neighbours.nodes[i];
+            touch(next);
+            if (m_settled[next]) {
+                continue;
+            }
+            const double distance = m_distance[node] + neighbours.lengths[i];
+            if (distance < m_distance[next]) {
+                m_distance[next] = distance;
+                m_parent[next] = node;
+                m_parentLane[next] = neighbours.lanes[i];
+                m_heap.push_back({informed ? distance + estimate(next, target) : distance, next});
+                std::push_heap(m_heap.begin(), m_heap.end(), GreaterPriority{});
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Resets a node's scratch state the first time the current query sees it
+ */
+void RouteFinder::touch(NodeIndex node)
+{
+    if (m_stamp[node] != m_currentStamp) {
+        m_stamp[node] = m_currentStamp;
+        m_distance[node] = INFINITE_DISTANCE;
+        m_settled[node] = 0;
+    }
+}
+
+} // namespace ggh::Galaxy::Navigation::models
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyNavigation/models/LandmarkIndex.h"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+
+namespace ggh::Galaxy::Navigation::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+struct GraphData {
+    std::vector<LaneGraph::NodeRecord> nodes;
+    std::vector<LaneGraph::EdgeRecord> edges;
+};
+
+// Random geometric graph whose lanes only join systems adjacent in x order, so straight-line
+// distance is a weak heuristic and landmarks have something to improve on
+GraphData makeRandomGraphData(std::size_t systems, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    GraphData data;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= systems; ++id) {
+        data.nodes.push_back({id, Coordinates(coordinate(rng), coordinate(rng))});
+    }
+    std::sort(data.nodes.begin(), data.nodes.end(),
+              [](const auto& a, const auto& b) { return a.position.x < b.position.x; });
+
+    GalaxyCore::utilities::LaneId lane = 1;
+    for (std::size_t i = 0; i < data.nodes.size(); ++i) {
+        for (std::size_t j = i + 1; j < std::min(data.nodes.size(), i + 4); ++j) {
+            data.edges.push_back({lane++, data.nodes[i].id, data.nodes[j].id});
+        }
+    }
+    return data;
+}
+} // namespace
+
+class LandmarkIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        data = makeRandomGraphData(1500, 11);
+        graph.build(data.nodes, data.edges);
+    }
+
+    GraphData data;
+    LaneGraph graph;
+};
+
+TEST_F(LandmarkIndexTest, ParallelBuildMatchesSingleThreadedBuild) {
+    LandmarkIndex serial;
+    LandmarkIndex parallel;
+    ASSERT_TRUE(serial.build(graph, 8, 1));
+    ASSERT_TRUE(parallel.build(graph, 8, 4));
+
+    EXPECT_EQ(serial.landmarks(), parallel.landmarks());
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        const auto a = serial.distances(node);
+        const auto b = parallel.distances(node);
+        ASSERT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+    }
+}
+
+TEST_F(LandmarkIndexTest, LowerBoundIsAdmissible) {
+    LandmarkIndex index;
+    ASSERT_TRUE(index.build(graph, 8));
+
+    RouteFinder finder(graph);
+    std::vector<double> exact;
+    const auto source = graph.systemId(0);
+    ASSERT_TRUE(finder.distancesFrom(source, exact));
+    for (LaneGraph::NodeIndex node = 0; node < graph.nodeCount(); ++node) {
+        EXPECT_LE(index.lowerBound(node, 0), exact[node] + 1e-9);
+    }
+}
+
+TEST_F(LandmarkIndexTest, AltQueriesMatchDijkstraAndSettleFewerNodes) {
+    LandmarkIndex index;
+    ASSERT_TRUE(index.build(graph, 8));
+    RouteFinder plain(graph);
+    LandmarkRouteFinder alt(graph, index);
+
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<GalaxyCore::utilities::SystemId> pick(1, 1500);
+    std::size_t aStarSettled = 0;
+    std::size_t altSettled = 0;
+    Route expected;
+    Route actual;
+    for (int query = 0; query < 50; ++query) {
+        const auto from = pick(rng);
+        const auto to = pick(rng);
+        plain.findRoute(from, to, expected, RouteAlgorithm::Dijkstra);
+        plain.findRoute(from, to, actual, RouteAlgorithm::AStar);
+        aStarSettled += plain.lastSettledCount();
+        alt.findRoute(from, to, actual, RouteAlgorithm::AStar);
+        altSettled += alt.lastSettledCount();
+        EXPECT_NEAR(actual.distance, expected.distance, 1e-6) << from << " -> " << to;
+    }
+    EXPECT_LT(altSettled, aStarSettled);
+}
+
+TEST_F(LandmarkIndexTest, TablesBecomeStaleWhenGraphChanges) {
+    LandmarkIndex index;
+    ASSERT_TRUE(index.build(graph, 4));
+    EXPECT_TRUE(index.isValidFor(graph));
+
+    // Removing a lane can only lengthen routes, so stale bounds could overestimate
+    graph.removeEdge(data.edges.front().lane);
+    EXPECT_FALSE(index.isValidFor(graph));
+
+    LandmarkRouteFinder alt(graph, index);
+    RouteFinder plain(graph);
+    const auto from = data.edges.front().from;
+    const auto to = data.edges.front().to;
+    EXPECT_NEAR(alt.findRoute(from, to).distance,
+                plain.findRoute(from, to, RouteAlgorithm::Dijkstra).distance, 1e-9);
+}
+
+TEST_F(LandmarkIndexTest, SaveAndLoadRoundTripAcrossNodeRenumbering) {
+    LandmarkIndex index;
+    ASSERT_TRUE(index.build(graph, 6));
+    std::stringstream buffer;
+    ASSERT_TRUE(index.save(buffer));
+
+    // Same galaxy inserted in a different order gets different node indices
+    auto reversed = data;
+    std::reverse(reversed.nodes.begin(), reversed.nodes.end());
+    LaneGraph reloaded;
+    reloaded.build(reversed.nodes, reversed.edges);
+
+    LandmarkIndex loaded;
+    ASSERT_TRUE(loaded.load(buffer, reloaded));
+    EXPECT_TRUE(loaded.isValidFor(reloaded));
+    EXPECT_EQ(loaded.landmarks(), index.landmarks());
+    for (const auto& record : data.nodes) {
+        const auto a = index.distances(graph.indexOf(record.id));
+        const auto b = loaded.distances(reloaded.indexOf(record.id));
+        ASSERT_TRUE(std::equal(a.begin(), a.end(), b.begin(), b.end()));
+    }
+}
+
+TEST_F(LandmarkIndexTest, LoadRejectsOtherGraphsAndGarbage) {
+    LandmarkIndex index;
+    ASSERT_TRUE(index.build(graph, 4));
+    std::stringstream buffer;
+    ASSERT_TRUE(index.save(buffer));
+
+    auto changed = data;
+    changed.edges.pop_back();
+    LaneGraph other;
+    other.build(changed.nodes, changed.edges);
+    LandmarkIndex loaded;
+    EXPECT_FALSE(loaded.load(buffer, other));
+    EXPECT_TRUE(loaded.empty());
+
+    std::stringstream garbage("not a landmark file");
+    EXPECT_FALSE(loaded.load(garbage, graph));
+}
+
+} // namespace ggh::Galaxy::Navigation::models
@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "ggh/modules/GalaxyNavigation/models/RouteFinder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace ggh::Galaxy::Navigation::models {
+
+namespace {
+using GalaxyCore::models::LaneGraph;
+using Coordinates = GalaxyCore::utilities::CartesianCoordinates<double>;
+
+// Random geometric graph: systems scattered on a square, each linked to a few near neighbours
+LaneGraph makeRandomGraph(std::size_t systems, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coordinate(0.0, 1000.0);
+    std::vector<LaneGraph::NodeRecord> nodes;
+    for (GalaxyCore::utilities::SystemId id = 1; id <= systems; ++id) {
+        nodes.push_back({id, Coordinates(coordinate(rng), coordinate(rng))});
+    }
+    std::sort(nodes.begin(), nodes.end(),
+              [](const auto& a, const auto& b) { return a.position.x < b.position.x; });
+
+    std::vector<LaneGraph::EdgeRecord> edges;
+    GalaxyCore::utilities::LaneId lane = 1;
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        for (std::size_t j = i + 1; j < std::min(nodes.size(), i + 4); ++j) {
+            edges.push_back({lane++, nodes[i].id, nodes[j].id});
+        }
+    }
+    LaneGraph graph;
+    graph.build(nodes, edges);
+    return graph;
+}
+} // namespace
+
+class RouteFinderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // 1 -- 2 -- 3 is the long way round; 1 -- 4 -- 3 is shorter
+        graph.addNode(1, Coordinates(0.0, 0.0));
+        graph.addNode(2, Coordinates(0.0, 10.0));
+        graph.addNode(3, Coordinates(10.0, 10.0));
+        graph.addNode(4, Coordinates(5.0, 5.0));
+        graph.addNode(5, Coordinates(50.0, 50.0));
+        graph.addEdge(100, 1, 2);
+        graph.addEdge(101, 2, 3);
+        graph.addEdge(102, 1, 4);
+        graph.addEdge(103, 4, 3);
+    }
+
+    LaneGraph graph;
+};
+
+TEST_F(RouteFinderTest, FindsShortestRouteWithBothAlgorithms) {
+    RouteFinder finder(graph);
+    for (auto algorithm : {RouteAlgorithm::Dijkstra, RouteAlgorithm::AStar}) {
+        Route route = finder.findRoute(1, 3, algorithm);
+        ASSERT_FALSE(route.empty());
+        EXPECT_EQ(route.systems, (std::vector<GalaxyCore::utilities::SystemId>{1, 4, 3}));
+        EXPECT_EQ(route.lanes, (std::vector<GalaxyCore::utilities::LaneId>{102, 103}));
+        EXPECT_NEAR(route.distance, 2.0 * std::sqrt(50.0), 1e-9);
+        EXPECT_EQ(route.hopCount(), 2u);
+    }
+}
+
+TEST_F(RouteFinderTest, UnreachableOrUnknownSystemsYieldEmptyRoute) {
+    RouteFinder finder(graph);
+    EXPECT_TRUE(finder.findRoute(1, 5).empty());
+    EXPECT_TRUE(finder.findRoute(1, 99).empty());
+    EXPECT_TRUE(finder.findRoute(99, 1).empty());
+}
+
+TEST_F(RouteFinderTest, RouteToSelfHasNoLanes) {
+    RouteFinder finder(graph);
+    Route route = finder.findRoute(2, 2);
+    EXPECT_EQ(route.systems, (std::vector<GalaxyCore::utilities::SystemId>{2}));
+    EXPECT_TRUE(route.lanes.empty());
+    EXPECT_DOUBLE_EQ(route.distance, 0.0);
+}
+
+TEST_F(RouteFinderTest, SeesGraphChangesBetweenQueries) {
+    RouteFinder finder(graph);
+    ASSERT_EQ(finder.findRoute(1, 3).hopCount(), 2u);
+
+    graph.addEdge(104, 1, 3);
+    EXPECT_EQ(finder.findRoute(1, 3).lanes, (std::vector<GalaxyCore::utilities::LaneId>{104}));
+
+    graph.removeEdge(104);
+    graph.removeEdge(102);
+    EXPECT_EQ(finder.findRoute(1, 3).lanes, (std::vector<GalaxyCore::utilities::LaneId>{100, 101}));
+}
+
+TEST(RouteFinderRandomTest, AStarMatchesDijkstraAndSettlesFewerNodes) {
+    const LaneGraph graph = makeRandomGraph(2000, 42);
+    RouteFinder finder(graph);
+    std::mt19937 rng(3);
+    std::uniform_int_distribution<GalaxyCore::utilities::SystemId> pick(1, 2000);
+
+    std::size_t dijkstraSettled = 0;
+    std::size_t aStarSettled = 0;
+    Route dijkstra;
+    Route aStar;
+    for (int query = 0; query < 50; ++query) {
+        const auto from = pick(rng);
+        const auto to = pick(rng);
+        const bool found = finder.findRoute(from, to, dijkstra, RouteAlgorithm::Dijkstra);
+        dijkstraSettled += finder.lastSettledCount();
+        EXPECT_EQ(finder.findRoute(from, to, aStar, RouteAlgorithm::AStar), found);
+        aStarSettled += finder.lastSettledCount();
+        EXPECT_NEAR(aStar.distance, dijkstra.distance, 1e-6) << from << " -> " << to;
+    }
+    EXPECT_LT(aStarSettled, dijkstraSettled);
+}
+
+} // namespace ggh::Galaxy::Navigation::models
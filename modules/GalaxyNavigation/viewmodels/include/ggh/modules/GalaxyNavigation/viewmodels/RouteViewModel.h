@@ -0,0 +1,140 @@
+/**
+ * @file RouteViewModel.h
+ * @brief ViewModel exposing route finding to QML
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#ifndef GGH_MODULES_GALAXYNAVIGATION_VIEWMODELS_ROUTE_VIEW_MODEL_H
+#define GGH_MODULES_GALAXYNAVIGATION_VIEWMODELS_ROUTE_VIEW_MODEL_H
+
+#include <QObject>
+#include <QSet>
+#include <QVariantList>
+#include <QtQml/qqmlregistration.h>
+#include <memory>
+
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+#include "ggh/modules/GalaxyNavigation/models/LandmarkIndex.h"
+
+namespace ggh::Galaxy::Navigation::viewmodels
+{
+
+/**
+ * @class RouteViewModel
+ * @brief Finds routes between star systems and holds the current route for highlighting
+ *
+ * The view model searches the galaxy's lane graph with a RouteFinder that is kept alive
+ * between queries, so picking routes interactively does not allocate per query.
+ * Optional landmark preprocessing tightens the A* heuristic for repeated queries.
+ */
+class RouteViewModel : public QObject
+{
+    Q_OBJECT
+    Q_PROPERTY(bool hasRoute READ hasRoute NOTIFY routeChanged)
+    Q_PROPERTY(QVariantList systemIds READ systemIds NOTIFY routeChanged)
+    Q_PROPERTY(QVariantList laneIds READ laneIds NOTIFY routeChanged)
+    Q_PROPERTY(double totalDistance READ totalDistance NOTIFY routeChanged)
+    Q_PROPERTY(int hopCount READ hopCount NOTIFY routeChanged)
+    Q_PROPERTY(bool useAStar READ useAStar WRITE setUseAStar NOTIFY useAStarChanged)
+    Q_PROPERTY(bool hasLandmarks READ hasLandmarks NOTIFY landmarksChanged)
+    QML_ELEMENT
+public:
+    /**
+     * @brief Default constructor
+     * @param parent QObject parent
+     */
+    explicit RouteViewModel(QObject* parent = nullptr);
+    ~RouteViewModel() override;
+
+    /**
+     * @brief Sets the galaxy to route through and clears the current route
+     * @param galaxy The galaxy model
+     */
+    void setGalaxy(std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> galaxy);
+
+    bool hasRoute() const;
+    QVariantList systemIds() const;
+    QVariantList laneIds() const;
+    double totalDistance() const;
+    int hopCount() const;
+    bool useAStar() const;
+    void setUseAStar(bool useAStar);
+    bool hasLandmarks() const;
+
+    /**
+     * @brief Finds the shortest route between two systems and makes it the current route
+     * @param fromSystemId The origin system ID
+     * @param toSystemId The destination system ID
+     * @return True if a route was found
+     */
+    Q_INVOKABLE bool findRoute(quint32 fromSystemId, quint32 toSystemId);
+
+    /**
+     * @brief Clears the current route
+     */
+    Q_INVOKABLE void clearRoute();
+
+    /**
+     * @brief Checks whether a travel lane is part of the current route
+     * @param laneId The lane ID
+     * @return True if the lane is on the route
+     */
+    Q_INVOKABLE bool isLaneOnRoute(quint32 laneId) const;
+
+    /**
+     * @brief Checks whether a star system is part of the current route
+     * @param systemId The system ID
+     * @return True if the system is on the route
+     */
+    Q_INVOKABLE bool isSystemOnRoute(quint32 systemId) const;
+
+    /**
+     * @brief Precomputes landmark distance tables for the current galaxy
+     * @param landmarkCount Number of landmarks to pick
+     * @return True if the tables were built
+     */
+    Q_INVOKABLE bool buildLandmarks(int landmarkCount = 16);
+
+    /**
+     * @brief Saves the landmark tables to a file
+     * @param filePath The file path to write
+     * @return True if the tables were saved
+     */
+    Q_INVOKABLE bool saveLandmarks(const QString& filePath) const;
+
+    /**
+     * @brief Loads landmark tables saved for the current galaxy
+     * @param filePath The file path to read
+     * @return True if the tables were loaded and match the galaxy
+     */
+    Q_INVOKABLE bool loadLandmarks(const QString& filePath);
+
+signals:
+    /**
+     * @brief Signal emitted when the current route is found, replaced or cleared
+     */
+    void routeChanged();
+
+    /**
+     * @brief Signal emitted when the search algorithm changes
+     */
+    void useAStarChanged();
+
+    /**
+     * @brief Signal emitted when landmark tables are built, loaded or dropped
+     */
+    void landmarksChanged();
+
+private:
+    std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> m_galaxy; ///< The galaxy being routed through
+    ggh::Galaxy::Navigation::models::LandmarkIndex m_landmarks; ///< Optional landmark tables for the galaxy
+    std::unique_ptr<ggh::Galaxy::Navigation::models::LandmarkRouteFinder> m_finder; ///< Finder over the galaxy's lane graph
+    ggh::Galaxy::Navigation::models::Route m_route; ///< The current route
+    QSet<quint32> m_routeLanes; ///< Lane IDs on the current route, for O(1) lookups from delegates
+    QSet<quint32> m_routeSystems; ///< System IDs on the current route
+    bool m_useAStar; ///< Whether to search with A* instead of Dijkstra
+};
+}
+
+#endif // !GGH_MODULES_GALAXYNAVIGATION_VIEWMODELS_ROUTE_VIEW_MODEL_H
@@ -0,0 +1,173 @@
+/**
+ * @file RouteViewModel.cpp
+ * @brief Implementation of RouteViewModel
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#include "ggh/modules/GalaxyNavigation/viewmodels/RouteViewModel.h"
+#include "ggh/modules/GalaxyCore/utilities/Trace.h"
+#include <QDebug>
+
+namespace ggh::Galaxy::Navigation::viewmodels {
+
+RouteViewModel::RouteViewModel(QObject* parent)
+    : QObject(parent)
+    , m_galaxy(nullptr)
+    , m_useAStar(true)
+{
+}
+
+RouteViewModel::~RouteViewModel() = default;
+
+void RouteViewModel::setGalaxy(std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> galaxy)
+{
+    const bool hadLandmarks = hasLandmarks();
+    m_galaxy = std::move(galaxy);
+    m_landmarks.clear();
+    m_finder = m_galaxy
+        ? std::make_unique<ggh::Galaxy::Navigation::models::LandmarkRouteFinder>(m_galaxy->laneGraph(), m_landmarks)
+        : nullptr;
+    clearRoute();
+    if (hadLandmarks) {
+        emit landmarksChanged();
+    }
+}
+
+bool RouteViewModel::hasRoute() const
+{
+    return !m_route.empty();
+}
+
+QVariantList RouteViewModel::systemIds() const
+{
+    QVariantList ids;
+    ids.reserve(static_cast<qsizetype>(m_route.systems.size()));
+    for (auto id : m_route.systems) {
+        ids.append(QVariant::fromValue<quint32>(id));
+    }
+    return ids;
+}
+
+QVariantList RouteViewModel::laneIds() const
+{
+    QVariantList ids;
+    ids.reserve(static_cast<qsizetype>(m_route.lanes.size()));
+    for (auto id : m_route.lanes) {
+        ids.append(QVariant::fromValue<quint32>(id));
+    }
+    return ids;
+}
+
+double RouteViewModel::totalDistance() const
+{
+    return m_route.distance;
+}
+
+int RouteViewModel::hopCount() const
+{
+    return static_cast<int>(m_route.hopCount());
+}
+
+bool RouteViewModel::useAStar() const
+{
+    return m_useAStar;
+}
+
+void RouteViewModel::setUseAStar(bool useAStar)
+{
+    if (m_useAStar != useAStar) {
+        m_useAStar = useAStar;
+        emit useAStarChanged();
+    }
+}
+
+bool RouteViewModel::hasLandmarks() const
+{
+    return m_galaxy && m_landmarks.isValidFor(m_galaxy->laneGraph());
+}
+
+bool RouteViewModel::findRoute(quint32 fromSystemId, quint32 toSystemId)
+{
+    GGH_TRACE_SCOPE("RouteViewModel::findRoute");
+    if (!m_finder) {
+        qWarning() << "RouteViewModel::findRoute: no galaxy set";
+        return false;
+    }
+
+    const auto algorithm = m_useAStar ? ggh::Galaxy::Navigation::models::RouteAlgorithm::AStar
+                                      : ggh::Galaxy::Navigation::models::RouteAlgorithm::Dijkstra;
+    const bool found = m_finder->findRoute(fromSystemId, toSystemId, m_route, algorithm);
+
+    m_routeLanes.clear();
+    m_routeSystems.clear();
+    for (auto id : m_route.lanes) {
+        m_routeLanes.insert(id);
+    }
+    for (auto id : m_route.systems) {
+        m_routeSystems.insert(id);
+    }
+    emit routeChanged();
+    return found;
+}
+
+void RouteViewModel::clearRoute()
+{
+    const bool hadRoute = !m_route.empty();
+    m_route.clear();
+    m_routeLanes.clear();
+    m_routeSystems.clear();
+    if (hadRoute) {
+        emit routeChanged();
+    }
+}
+
+bool RouteViewModel::isLaneOnRoute(quint32 laneId) const
+{
+    return m_routeLanes.contains(laneId);
+}
+
+bool RouteViewModel::isSystemOnRoute(quint32 systemId) const
+{
+    return m_routeSystems.contains(systemId);
+}
+
+bool RouteViewModel::buildLandmarks(int landmarkCount)
+{
+    if (!m_galaxy || landmarkCount <= 0) {
+        qWarning() << "RouteViewModel::buildLandmarks: no galaxy set or invalid landmark count";
+        return false;
+    }
+
+    const bool built = m_landmarks.build(m_galaxy->laneGraph(), static_cast<std::size_t>(landmarkCount));
+    emit landmarksChanged();
+    return built;
+}
+
+bool RouteViewModel::saveLandmarks(const QString& filePath) const
+{
+    if (!hasLandmarks()) {
+        return false;
+    }
+    if (!m_landmarks.saveToFile(filePath.toStdString())) {
+        qWarning() << "RouteViewModel::saveLandmarks: failed to write" << filePath;
+        return false;
+    }
+    return true;
+}
+
+bool RouteViewModel::loadLandmarks(const QString& filePath)
+{
+    if (!m_galaxy) {
+        return false;
+    }
+
+    const bool loaded = m_landmarks.loadFromFile(filePath.toStdString(), m_galaxy->laneGraph());
+    if (!loaded) {
+        qWarning() << "RouteViewModel::loadLandmarks: could not load landmarks for this galaxy from" << filePath;
+    }
+    emit landmarksChanged();
+    return loaded;
+}
+
+} // namespace ggh::Galaxy::Navigation::viewmodels
@@ -0,0 +1,153 @@
+/**
+ * @file test_route_viewmodel.cpp
+ * @brief Unit tests for RouteViewModel
+ * @author Galaxy Builder Project
+ * @date 2025
+ */
+
+#include <QtTest/QtTest>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+
+#include "ggh/modules/GalaxyNavigation/viewmodels/RouteViewModel.h"
+#include "ggh/modules/GalaxyCore/models/GalaxyModel.h"
+
+using ggh::Galaxy::Navigation::viewmodels::RouteViewModel;
+
+class TestRouteViewModel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void init();
+
+    /**
+     * @brief Test that finding a route fills the route properties and lookups
+     */
+    void testFindRoute();
+
+    /**
+     * @brief Test that an unreachable destination yields no route
+     */
+    void testUnreachableRoute();
+
+    /**
+     * @brief Test clearing the route
+     */
+    void testClearRoute();
+
+    /**
+     * @brief Test that routing without a galaxy fails gracefully
+     */
+    void testFindRouteWithoutGalaxy();
+
+    /**
+     * @brief Test building, saving and loading landmark tables
+     */
+    void testLandmarks();
+
+private:
+    std::shared_ptr<ggh::GalaxyCore::models::GalaxyModel> m_galaxy;
+};
+
+void TestRouteViewModel::init()
+{
+    using Coordinates = ggh::GalaxyCore::utilities::CartesianCoordinates<double>;
+    m_galaxy = std::make_shared<ggh::GalaxyCore::models::GalaxyModel>(100, 100);
+    m_galaxy->addStarSystem(1, "Alpha", Coordinates(0.0, 0.0));
+    m_galaxy->addStarSystem(2, "Beta", Coordinates(10.0, 0.0));
+    m_galaxy->addStarSystem(3, "Gamma", Coordinates(20.0, 0.0));
+    m_galaxy->addStarSystem(4, "Delta", Coordinates(90.0, 90.0));
+    m_galaxy->addTravelLane(10, 1, 2);
+    m_galaxy->addTravelLane(11, 2, 3);
+}
+
+void TestRouteViewModel::testFindRoute()
+{
+    RouteViewModel viewModel;
+    viewModel.setGalaxy(m_galaxy);
+    QSignalSpy routeSpy(&viewModel, &RouteViewModel::routeChanged);
+
+    QVERIFY(viewModel.findRoute(1, 3));
+    QCOMPARE(routeSpy.count(), 1);
+    QVERIFY(viewModel.hasRoute());
+    QCOMPARE(viewModel.hopCount(), 2);
+    QCOMPARE(viewModel.totalDistance(), 20.0);
+    QCOMPARE(viewModel.systemIds(), (QVariantList{1u, 2u, 3u}));
+    QVERIFY(viewModel.isLaneOnRoute(10));
+    QVERIFY(viewModel.isLaneOnRoute(11));
+    QVERIFY(viewModel.isSystemOnRoute(2));
+    QVERIFY(!viewModel.isSystemOnRoute(4));
+
+    viewModel.setUseAStar(false);
+    QVERIFY(viewModel.findRoute(3, 1));
+    QCOMPARE(viewModel.systemIds(), (QVariantList{3u, 2u, 1u}));
+}
+
+void TestRouteViewModel::testUnreachableRoute()
+{
+    RouteViewModel viewModel;
+    viewModel.setGalaxy(m_galaxy);
+
+    QVERIFY(!viewModel.findRoute(1, 4));
+    QVERIFY(!viewModel.hasRoute());
+    QCOMPARE(viewModel.hopCount(), 0);
+    QVERIFY(!viewModel.isLaneOnRoute(10));
+}
+
+void TestRouteViewModel::testClearRoute()
+{
+    RouteViewModel viewModel;
+    viewModel.setGalaxy(m_galaxy);
+    QVERIFY(viewModel.findRoute(1, 2));
+
+    QSignalSpy routeSpy(&viewModel, &RouteViewModel::routeChanged);
+    viewModel.clearRoute();
+    QCOMPARE(routeSpy.count(), 1);
+    QVERIFY(!viewModel.hasRoute());
+    QVERIFY(!viewModel.isLaneOnRoute(10));
+
+    // Clearing an empty route is not a change
+    viewModel.clearRoute();
+    QCOMPARE(routeSpy.count(), 1);
+}
+
+void TestRouteViewModel::testFindRouteWithoutGalaxy()
+{
+    RouteViewModel viewModel;
+    QVERIFY(!viewModel.findRoute(1, 2));
+    QVERIFY(!viewModel.hasRoute());
+}
+
+void TestRouteViewModel::testLandmarks()
+{
+    RouteViewModel viewModel;
+    viewModel.setGalaxy(m_galaxy);
+    QVERIFY(!viewModel.hasLandmarks());
+
+    QSignalSpy landmarksSpy(&viewModel, &RouteViewModel::landmarksChanged);
+    QVERIFY(viewModel.buildLandmarks(2));
+    QCOMPARE(landmarksSpy.count(), 1);
+    QVERIFY(viewModel.hasLandmarks());
+    QVERIFY(viewModel.findRoute(1, 3));
+    QCOMPARE(viewModel.totalDistance(), 20.0);
+
+    QTemporaryDir directory;
+    QVERIFY(directory.isValid());
+    const QString filePath = directory.filePath("galaxy.xml.landmarks");
+    QVERIFY(viewModel.saveLandmarks(filePath));
+
+    RouteViewModel reloaded;
+    reloaded.setGalaxy(m_galaxy);
+    QVERIFY(reloaded.loadLandmarks(filePath));
+    QVERIFY(reloaded.hasLandmarks());
+
+    // A different galaxy must not accept the tables
+    auto other = std::make_shared<ggh::GalaxyCore::models::GalaxyModel>(100, 100);
+    reloaded.setGalaxy(other);
+    QVERIFY(!reloaded.hasLandmarks());
+    QVERIFY(!reloaded.loadLandmarks(filePath));
+}
+
+QTEST_MAIN(TestRouteViewModel)
+#include "test_route_viewmodel.moc"